@@ -90,8 +90,7 @@ def processShaderFile(shaderPath, outputDir, definePath="BABYLON_SHADERS",
     output += "#define %s%s%s" % (defineName, eol, eol)
     output += "namespace BABYLON {%s%s" % (eol, eol)
     # process first line
-    output += "extern const char* %s;%s%s" % (varName, eol, eol)
-    output += "const char* %s%s  = " % (varName, eol)
+    output += "constexpr const char* %s%s  = " % (varName, eol)
     if lines[0] == "precision highp float;":
         output += "\"%s\\n\"%s" % ("#ifdef GL_ES", eol)
         output += "    \"%s\\n\"%s" % (lines[0], eol)
@@ -119,73 +118,164 @@ def processShaderFile(shaderPath, outputDir, definePath="BABYLON_SHADERS",
         file.write(output)
     return outputFileLocation
 
-def generateShadersStore(shaderFiles, outputDir,
-                         outputFileName = "effect_shaders_store.cpp"):
+def fnv1aHash(key, seed):
     """
-    Generates the "effect_shaders_store.cpp" file containing the shaders map.
+    Returns the seeded 32-bit FNV-1a hash of a key, same as PerfectHash::Hash
+    in "babylon/core/perfect_hash.h".
+    """
+    hash = seed if seed != 0 else 0x811c9dc5
+    for c in bytearray(key.encode("utf-8")):
+        hash = ((hash ^ c) * 0x01000193) & 0xffffffff
+    return hash
+
+def computePerfectHash(keys):
+    """
+    Computes the seeds of a minimal perfect hash of the keys. The keys are
+    distributed in buckets, the largest buckets get the first seed which sends
+    all of their keys to free slots and the single key buckets get the
+    remaining slots, stored as -(slot + 1). Returns the seeds and the keys
+    ordered by slot.
+    """
+    size = len(keys)
+    buckets = [[] for i in range(size)]
+    for key in keys:
+        buckets[fnv1aHash(key, 0) % size].append(key)
+    seeds = [0] * size
+    slots = [None] * size
+    order = sorted(range(size), key=lambda b: -len(buckets[b]))
+    for b in order:
+        bucket = buckets[b]
+        if len(bucket) <= 1:
+            break
+        seed = 1
+        while True:
+            candidates = [fnv1aHash(key, seed) % size for key in bucket]
+            if len(set(candidates)) == len(candidates) and \
+                            all(slots[slot] is None for slot in candidates):
+                break
+            seed += 1
+        for key, slot in zip(bucket, candidates):
+            slots[slot] = key
+        seeds[b] = seed
+    freeSlots = [slot for slot in range(size) if slots[slot] is None]
+    for b in order:
+        if len(buckets[b]) == 1:
+            slot = freeSlots.pop(0)
+            slots[slot] = buckets[b][0]
+            seeds[b] = -slot - 1
+    return seeds, slots
+
+def generateStore(className, description, shaderNames, shaderHeaders,
+                  outputDir, outputFileName):
+    """
+    Generates the header and source file of a shaders store: a table of the
+    shaders built at compile time and indexed with a minimal perfect hash.
     """
     import codecs
-    ### generate header file ###
     eol = '\n'
+    ### generate header file ###
     headerFilename = outputFileName.replace(".cpp", ".h")
-    output = "#ifndef BABYLON_MATERIALS_EFFECT_SHADERS_STORE_H%s" % eol
-    output += "#define BABYLON_MATERIALS_EFFECT_SHADERS_STORE_H%s%s" % (eol,eol)
-    output += "#include <string>%s" % eol
-    output += "#include <unordered_map>%s%s" % (eol, eol)
+    defineName = "BABYLON_MATERIALS_%s" % \
+                                headerFilename.replace(".", "_").upper()
+    output = "#ifndef %s%s" % (defineName, eol)
+    output += "#define %s%s%s" % (defineName, eol, eol)
+    output += "#include <array>%s" % eol
+    output += "#include <string_view>%s%s" % (eol, eol)
     output += "#include <babylon/babylon_api.h>%s%s" % (eol, eol)
     output += "namespace BABYLON {%s%s" % (eol, eol)
-    output += "class BABYLON_SHARED_EXPORT EffectShadersStore {%s%s" % (eol,eol)
+    output += "/**%s" % eol
+    output += " * @brief %s of the library, in a table built at compile " % \
+                                                                description
+    output += "time.%s" % eol
+    output += " */%s" % eol
+    output += "class BABYLON_SHARED_EXPORT %s {%s%s" % (className, eol, eol)
     output += "public:%s" % eol
-    output += "  EffectShadersStore();%s" % eol
-    output += "  ~EffectShadersStore();%s%s" % (eol,eol)
-    output += "  std::unordered_map<std::string, std::string>& "
-    output += "shaders();%s" % eol
-    output += "  const std::unordered_map<std::string, std::string>& shaders() "
-    output += "const;%s%s" % (eol, eol)
-    output += "private:%s" % eol
-    output += "  static std::unordered_map<std::string, std::string> _shaders;"
-    output += "%s%s" % (eol,eol)
-    output += "}; // end of class EffectShadersStore%s%s" % (eol, eol)
-    output += "} // end of namespace BABYLON%s%s#endif " % (eol, eol)
-    output += "// end of BABYLON_MATERIALS_EFFECT_SHADERS_STORE_H%s" % eol
+    output += "  static constexpr size_t Size = %d;%s%s" % (len(shaderNames),
+                                                           eol, eol)
+    output += "  /**%s" % eol
+    output += "   * @brief Returns the source code of a shader, or an empty "
+    output += "view if the shader%s" % eol
+    output += "   * is not in the store.%s" % eol
+    output += "   */%s" % eol
+    output += "  static std::string_view Find(std::string_view name);%s%s" % \
+                                                                    (eol, eol)
+    output += "  /**%s" % eol
+    output += "   * @brief Returns the names of the shaders, in the order of "
+    output += "the table.%s" % eol
+    output += "   */%s" % eol
+    output += "  static const std::array<std::string_view, Size>& Names();"
+    output += "%s%s" % (eol, eol)
+    output += "}; // end of class %s%s%s" % (className, eol, eol)
+    output += "} // end of namespace BABYLON%s%s" % (eol, eol)
+    output += "#endif // end of %s%s" % (defineName, eol)
     # write output to file
     hdir = rreplace(outputDir, "src", os.path.join("include", "babylon"), 1)
     outputFileLocation = os.path.join(hdir, headerFilename)
     with codecs.open(outputFileLocation, "w", "utf-8-sig") as file:
         file.write(output)
-    ### generate source file containg the shader map ###
-    output = "#include <babylon/materials/%s>%s%s" % \
-                                (outputFileName.replace(".cpp", ".h"), eol, eol)
-    shaderNames = []
-    for shaderFile in shaderFiles:
-        shaderFilename = os.path.basename(shaderFile)
-        shaderNames.append(shaderFilenameToVariableName(shaderFilename))
-        shaderFilename = prepareFilename(shaderFilename)
-        output += "#include <babylon/shaders/%s>%s" % ("%s.h" % \
-                                        shaderFilename.replace(".", "_"), eol)
+    ### generate source file containing the shaders table ###
+    tableName = "%sTable" % className
+    seeds, slots = computePerfectHash(shaderNames)
+    output = "#include <babylon/materials/%s>%s%s" % (headerFilename, eol,
+                                                      eol)
+    output += "#include <babylon/core/perfect_hash.h>%s" % eol
+    for shaderHeader in sorted(shaderHeaders):
+        output += "#include <babylon/shaders/%s>%s" % (shaderHeader, eol)
     output += "%snamespace BABYLON {%s%s" % (eol, eol, eol)
-    output += "EffectShadersStore::EffectShadersStore()%s" % eol
-    output += "{%s}%s%s" % (eol, eol, eol)
-    output += "EffectShadersStore::~EffectShadersStore()%s" % eol
-    output += "{%s}%s%s" % (eol, eol, eol)
-    output += "std::unordered_map<std::string, std::string>& "
-    output += "EffectShadersStore::shaders()%s" % eol
-    output += "{%s  return _shaders;%s}%s%s" % (eol, eol, eol, eol)
-    output += "const std::unordered_map<std::string, std::string>&%s" % eol
-    output += "EffectShadersStore::shaders() const%s" % eol
-    output += "{%s  return _shaders;%s}%s%s" % (eol, eol, eol, eol)
-    # create shader name to shared source mapping
-    output += "std::unordered_map<std::string, std::string> "
-    output += "EffectShadersStore::_shaders%s" % eol
-    shaderMapping = ""
-    for shaderName in shaderNames:
-        if len(shaderName) * 2 + 10 > 80:
-            shaderMapping += "     {\"%s\",%s" % (shaderName, eol)
-            shaderMapping += "      %s},%s" % (shaderName, eol)
-        else:
-            shaderMapping += "     {\"%s\", %s},%s" % \
-                                                (shaderName, shaderName, eol)
-    output += "  = {%s};%s%s" % (shaderMapping[5:-2], eol, eol)
+    output += "/**%s" % eol
+    output += " * @brief Shaders of the store, ordered by slot of the perfect "
+    output += "hash.%s" % eol
+    output += " */%s" % eol
+    output += "struct %s {%s" % (tableName, eol)
+    output += "  using Views = std::array<std::string_view, %s::Size>;%s" % \
+                                                            (className, eol)
+    output += "  using Seeds = std::array<int32_t, %s::Size>;%s%s" % \
+                                                        (className, eol, eol)
+    output += "  static constexpr Views names{{%s" % eol
+    for shaderName in slots:
+        output += "    \"%s\",%s" % (shaderName, eol)
+    output += "  }};%s" % eol
+    output += "  static constexpr Views sources{{%s" % eol
+    for shaderName in slots:
+        output += "    %s,%s" % (shaderName, eol)
+    output += "  }};%s" % eol
+    output += "  static constexpr Seeds seeds{{%s" % eol
+    for i in range(0, len(seeds), 12):
+        output += "    %s,%s" % (", ".join(["%d" % seed \
+                                        for seed in seeds[i:i + 12]]), eol)
+    output += "  }};%s%s" % (eol, eol)
+    output += "  static constexpr bool IsPerfect()%s" % eol
+    output += "  {%s" % eol
+    output += "    for (size_t i = 0; i < %s::Size; ++i) {%s" % (className,
+                                                                   eol)
+    output += "      if (PerfectHash::Slot(names[i], seeds) != i) {%s" % eol
+    output += "        return false;%s" % eol
+    output += "      }%s" % eol
+    output += "    }%s" % eol
+    output += "    return true;%s" % eol
+    output += "  }%s" % eol
+    output += "}; // end of struct %s%s%s" % (tableName, eol, eol)
+    output += "static_assert(%s::IsPerfect(),%s" % (tableName, eol)
+    output += "              \"The seeds do not match the shader names\");"
+    output += "%s%s" % (eol, eol)
+    output += "constexpr size_t %s::Size;%s%s" % (className, eol, eol)
+    output += "std::string_view %s::Find(std::string_view name)%s" % \
+                                                            (className, eol)
+    output += "{%s" % eol
+    output += "  using Table     = %s;%s" % (tableName, eol)
+    output += "  const auto slot = PerfectHash::Slot(name, Table::seeds);%s" \
+                                                                        % eol
+    output += "  return (Table::names[slot] == name) ? Table::sources[slot] :"
+    output += "%s" % eol
+    output += "                                        std::string_view{};%s"\
+                                                                        % eol
+    output += "}%s%s" % (eol, eol)
+    output += "const std::array<std::string_view, %s::Size>&%s" % (className,
+                                                                   eol)
+    output += "%s::Names()%s" % (className, eol)
+    output += "{%s" % eol
+    output += "  return %s::names;%s" % (tableName, eol)
+    output += "}%s%s" % (eol, eol)
     output += "} // end of namespace BABYLON%s" % eol
     # write output to file
     outputFileLocation = os.path.join(outputDir, outputFileName)
@@ -193,76 +283,37 @@ def generateShadersStore(shaderFiles, outputDir,
         file.write(output)
     return outputFileLocation
 
+def generateShadersStore(shaderFiles, outputDir,
+                         outputFileName = "effect_shaders_store.cpp"):
+    """
+    Generates the "effect_shaders_store.cpp" file containing the shaders table.
+    """
+    shaderNames = []
+    shaderHeaders = []
+    for shaderFile in shaderFiles:
+        shaderFilename = os.path.basename(shaderFile)
+        shaderNames.append(shaderFilenameToVariableName(shaderFilename))
+        shaderFilename = prepareFilename(shaderFilename)
+        shaderHeaders.append("%s.h" % shaderFilename.replace(".", "_"))
+    return generateStore("EffectShadersStore", "Shaders", shaderNames,
+                         shaderHeaders, outputDir, outputFileName)
+
 def generateIncludesShadersStore(shaderFiles, outputDir,
                         outputFileName = "effect_includes_shaders_store.cpp"):
     """
     Generates the "effect_includes_shaders_store.cpp" file containing the
-    shaders includes map.
+    shaders includes table.
     """
-    import codecs
-    ### generate header file ###
-    eol = '\n'
-    headerFilename = outputFileName.replace(".cpp", ".h")
-    output = "#ifndef BABYLON_MATERIALS_EFFECT_INCLUDES_SHADERS_STORE_H%s" % eol
-    output += "#define BABYLON_MATERIALS_EFFECT_INCLUDES_SHADERS_STORE_H%s%s"  \
-                                                                    % (eol,eol)
-    output += "#include <string>%s" % eol
-    output += "#include <unordered_map>%s%s" % (eol, eol)
-    output += "#include <babylon/babylon_api.h>%s%s" % (eol, eol)
-    output += "namespace BABYLON {%s%s" % (eol, eol)
-    output += "class BABYLON_SHARED_EXPORT EffectIncludesShadersStore {"
-    output += "%s%s" % (eol,eol)
-    output += "public:%s" % eol
-    output += "  EffectIncludesShadersStore();%s" % eol
-    output += "  ~EffectIncludesShadersStore();%s%s" % (eol,eol)
-    output += "  std::unordered_map<std::string, std::string>& "
-    output += "shaders();%s" % eol
-    output += "  const std::unordered_map<std::string, std::string>& shaders() "
-    output += "const;%s%s" % (eol, eol)
-    output += "private:%s" % eol
-    output += "  static std::unordered_map<std::string, std::string> _shaders;"
-    output += "%s%s" % (eol,eol)
-    output += "}; // end of class EffectIncludesShadersStore%s%s" % (eol, eol)
-    output += "} // end of namespace BABYLON%s%s#endif " % (eol, eol)
-    output += "// end of BABYLON_MATERIALS_EFFECT_INCLUDES_SHADERS_STORE_H%s"  \
-                                                                        % eol
-    # write output to file
-    hdir = rreplace(outputDir, "src", os.path.join("include", "babylon"), 1)
-    outputFileLocation = os.path.join(hdir, headerFilename)
-    with codecs.open(outputFileLocation, "w", "utf-8-sig") as file:
-        file.write(output)
-    ### generate source file containg the shader map ###
-    output = "#include <babylon/materials/%s>%s%s" % (headerFilename, eol, eol)
     shaderNames = []
+    shaderHeaders = []
     for shaderFile in shaderFiles:
         shaderFilename = os.path.basename(shaderFile)
         shaderNames.append(shaderFilenameToVariableName(shaderFilename, True))
         shaderFilename = prepareFilename(shaderFilename)
-        output += "#include <babylon/shaders/shadersinclude/%s>%s" % ("%s.h" % \
-                                        shaderFilename.replace(".", "_"), eol)
-    output += "%snamespace BABYLON {%s%s" % (eol, eol, eol)
-    output += "EffectIncludesShadersStore::EffectIncludesShadersStore()%s" % eol
-    output += "{%s}%s%s" % (eol, eol, eol)
-    output += "EffectIncludesShadersStore::~EffectIncludesShadersStore()%s" % eol
-    output += "{%s}%s%s" % (eol, eol, eol)
-    output += "std::unordered_map<std::string, std::string>&%s" % eol
-    output += "EffectIncludesShadersStore::shaders()%s" % eol
-    output += "{%s  return _shaders;%s}%s%s" % (eol, eol, eol, eol)
-    output += "const std::unordered_map<std::string, std::string>&%s" % eol
-    output += "EffectIncludesShadersStore::shaders() const%s" % eol
-    output += "{%s  return _shaders;%s}%s%s" % (eol, eol, eol, eol)
-    # create shader include name to shared source mapping
-    output += "std::unordered_map<std::string, std::string>%s" % eol
-    output += "EffectIncludesShadersStore::_shaders = {%s" % eol
-    for shaderName in shaderNames:
-        output += "{\"%s\", %s},%s   " % (shaderName, shaderName, eol)
-    output = "%s%s};%s%s" % (output[:-5], eol, eol, eol)
-    output += "} // end of namespace BABYLON%s" % eol
-    # write output to file
-    outputFileLocation = os.path.join(outputDir, outputFileName)
-    with codecs.open(outputFileLocation, "w", "utf-8-sig") as file:
-        file.write(output)
-    return outputFileLocation
+        shaderHeaders.append("shadersinclude/%s.h" % \
+                                            shaderFilename.replace(".", "_"))
+    return generateStore("EffectIncludesShadersStore", "Shader includes",
+                         shaderNames, shaderHeaders, outputDir, outputFileName)
 
 def sortDictionaryByKey(directory):
     """
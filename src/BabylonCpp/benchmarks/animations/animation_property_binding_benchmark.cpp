@@ -0,0 +1,60 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_property_binding.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/mesh/mesh.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkAnimationPropertyBinding, setValue)
+{
+  using namespace BABYLON;
+
+  const size_t animatableCount = 10000;
+  const size_t frameCount      = 60;
+
+  // Engine without rendering context
+  auto engine = Engine::New(nullptr);
+  auto scene  = Scene::New(engine.get());
+
+  std::vector<MeshPtr> meshes;
+  std::vector<AnimationPropertyBinding> bindings;
+  meshes.reserve(animatableCount);
+  bindings.reserve(animatableCount);
+  for (size_t i = 0; i < animatableCount; ++i) {
+    auto mesh = Mesh::New("mesh" + std::to_string(i), scene.get());
+    bindings.emplace_back(AnimationPropertyBinding::Compile(
+      mesh.get(), {"position"}, Animation::ANIMATIONTYPE_VECTOR3()));
+    meshes.emplace_back(mesh);
+  }
+
+  const auto run = [&](const char* title,
+                       const std::function<void(size_t, const AnimationValue&)>&
+                         setValue) {
+    AnimationValue value(Vector3::Zero());
+    BenchmarkReporter::Instance().measure(
+      title, frameCount, animatableCount, [&](size_t frame) {
+        value.vector3Data.x = static_cast<float>(frame);
+        for (size_t i = 0; i < animatableCount; ++i) {
+          setValue(i, value);
+        }
+      });
+  };
+
+  // Property looked up by name on every frame
+  run("Reflection", [&](size_t i, const AnimationValue& value) {
+    IReflect* target = meshes[i].get();
+    any destination  = target;
+    target->setProperty(destination, "position", value.getValue());
+  });
+  EXPECT_FLOAT_EQ(meshes.back()->position().x, frameCount - 1.f);
+
+  // Setter resolved once
+  run("Compiled binding", [&](size_t i, const AnimationValue& value) {
+    bindings[i].setValue(value);
+  });
+  EXPECT_FLOAT_EQ(meshes.back()->position().x, frameCount - 1.f);
+}
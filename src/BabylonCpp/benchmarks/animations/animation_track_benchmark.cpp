@@ -0,0 +1,73 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_track.h>
+#include <babylon/animations/ianimation_key.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkAnimationTrack, interpolate)
+{
+  using namespace BABYLON;
+
+  const size_t channelCount = 50000;
+  const size_t keyCount     = 30;
+  const size_t frameCount   = 60;
+
+  std::vector<AnimationPtr> animations;
+  animations.reserve(channelCount);
+  for (size_t i = 0; i < channelCount; ++i) {
+    auto animation = Animation::New("position", "position", 30,
+                                     Animation::ANIMATIONTYPE_VECTOR3());
+    std::vector<IAnimationKey> keys;
+    for (size_t k = 0; k < keyCount; ++k) {
+      const auto f = static_cast<float>((i + k) % 100);
+      IAnimationKey key(k * 10.f, AnimationValue(Vector3(f, -f, 0.5f * f)));
+      key.interpolation = AnimationValue();
+      keys.emplace_back(key);
+    }
+    animation->setKeys(keys);
+    animations.emplace_back(animation);
+  }
+
+  const auto run = [&](const char* title, const std::function<float()>& step) {
+    float checksum = 0.f;
+    BenchmarkReporter::Instance().measure(
+      title, frameCount, channelCount, [&](size_t) { checksum += step(); });
+    std::cout << title << " checksum: " << checksum << std::endl;
+  };
+
+  // Interpolation copying the animation values
+  float currentFrame = 0.f;
+  std::optional<AnimationValue> workValue;
+  run("AnimationValue", [&]() {
+    float sum = 0.f;
+    currentFrame += 2.5f;
+    for (auto& animation : animations) {
+      sum += animation
+               ->_interpolate(currentFrame, 0, workValue,
+                              Animation::ANIMATIONLOOPMODE_CYCLE())
+               .vector3Data.x;
+    }
+    return sum;
+  });
+
+  // Compact tracks with a cursor per channel
+  std::vector<AnimationTrackCursor> cursors(channelCount);
+  AnimationValue offsetValue, highLimitValue, result;
+  currentFrame = 0.f;
+  run("AnimationTrack", [&]() {
+    float sum = 0.f;
+    currentFrame += 2.5f;
+    for (size_t i = 0; i < channelCount; ++i) {
+      animations[i]->_interpolateTrack(
+        currentFrame, 0, Animation::ANIMATIONLOOPMODE_CYCLE(), offsetValue,
+        highLimitValue, cursors[i], result);
+      sum += result.vector3Data.x;
+    }
+    return sum;
+  });
+}
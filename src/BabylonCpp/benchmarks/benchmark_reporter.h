@@ -0,0 +1,136 @@
+#ifndef BABYLON_BENCHMARKS_BENCHMARK_REPORTER_H
+#define BABYLON_BENCHMARKS_BENCHMARK_REPORTER_H
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Collects the timings of the benchmarks to write them as JSON, e.g.
+ * to compare them with the results of a previous build.
+ *
+ * The results are written when the benchmarks are run with
+ * --benchmark_json=<file>.
+ */
+class BenchmarkReporter {
+
+public:
+  struct Result {
+    std::string suite;
+    std::string name;
+    size_t iterations;
+    double millisecondsPerIteration;
+    size_t itemsPerIteration;
+  }; // end of struct Result
+
+public:
+  static BenchmarkReporter& Instance()
+  {
+    static BenchmarkReporter reporter;
+    return reporter;
+  }
+
+  /**
+   * @brief Calls the function for every iteration, then records and prints
+   * the average duration of an iteration.
+   * @param name defines the name of the measure, unique in the benchmark
+   * @param iterations defines the number of calls to the function
+   * @param items defines the number of items processed per iteration
+   * @param function defines the function to call with the iteration index
+   * @returns the average duration of an iteration in milliseconds
+   */
+  template <typename F>
+  double measure(const std::string& name, size_t iterations, size_t items,
+                 F&& function)
+  {
+    const auto before = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+      function(i);
+    }
+    const auto after = std::chrono::high_resolution_clock::now();
+    const auto milliseconds
+      = std::chrono::duration<double, std::milli>(after - before).count();
+    record(name, iterations, milliseconds / iterations, items);
+    return milliseconds / iterations;
+  }
+
+  /**
+   * @brief Records and prints the average duration of an iteration, the suite
+   * is the name of the running benchmark.
+   */
+  void record(const std::string& name, size_t iterations,
+              double millisecondsPerIteration, size_t itemsPerIteration)
+  {
+    const auto testInfo
+      = ::testing::UnitTest::GetInstance()->current_test_info();
+    const std::string suite
+      = testInfo ? std::string(testInfo->test_case_name()) + "."
+                     + testInfo->name() :
+                   "";
+    _results.emplace_back(Result{suite, name, iterations,
+                                 millisecondsPerIteration, itemsPerIteration});
+    std::cout << name << ": " << millisecondsPerIteration
+              << " ms per iteration (" << itemsPerIteration << " items)"
+              << std::endl;
+  }
+
+  const std::vector<Result>& results() const
+  {
+    return _results;
+  }
+
+  void writeJson(std::ostream& os) const
+  {
+    os << "{\n  \"benchmarks\": [";
+    for (size_t i = 0; i < _results.size(); ++i) {
+      const auto& result = _results[i];
+      os << (i == 0 ? "\n" : ",\n") << "    {\"suite\": \""
+         << _Escape(result.suite) << "\", \"name\": \""
+         << _Escape(result.name) << "\", \"iterations\": " << result.iterations
+         << ", \"ms_per_iteration\": " << std::setprecision(9)
+         << result.millisecondsPerIteration
+         << ", \"items_per_iteration\": " << result.itemsPerIteration << "}";
+    }
+    os << "\n  ]\n}\n";
+  }
+
+  bool writeJson(const std::string& filename) const
+  {
+    std::ofstream file(filename);
+    if (!file) {
+      return false;
+    }
+    writeJson(file);
+    return static_cast<bool>(file);
+  }
+
+private:
+  BenchmarkReporter() = default;
+
+  static std::string _Escape(const std::string& text)
+  {
+    std::string escaped;
+    for (const auto c : text) {
+      if (c == '"' || c == '\\') {
+        escaped += '\\';
+      }
+      escaped += c;
+    }
+    return escaped;
+  }
+
+private:
+  std::vector<Result> _results;
+
+}; // end of class BenchmarkReporter
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BENCHMARKS_BENCHMARK_REPORTER_H
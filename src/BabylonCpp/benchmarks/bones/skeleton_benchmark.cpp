@@ -0,0 +1,60 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/math/matrix.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkSkeleton, prepare)
+{
+  using namespace BABYLON;
+
+  const size_t skeletonCount = 100;
+  const size_t frameCount    = 60;
+
+  // Engine without rendering context
+  auto engine = Engine::New(nullptr);
+  auto scene  = Scene::New(engine.get());
+
+  for (const size_t boneCount : {16, 64, 256}) {
+    // Skeletons made of limbs of 8 bones attached to the root, the scene owns
+    // the skeletons
+    std::vector<Skeleton*> skeletons;
+    for (size_t s = 0; s < skeletonCount; ++s) {
+      auto skeleton = new Skeleton("skeleton" + std::to_string(s),
+                                   "skeleton" + std::to_string(s), scene.get());
+      auto root = Bone::New("root", skeleton, nullptr, Matrix::Identity());
+      Bone* parent = root.get();
+      for (size_t b = 1; b < boneCount; ++b) {
+        if (b % 8 == 1) {
+          parent = root.get();
+        }
+        auto bone = Bone::New("bone" + std::to_string(b), skeleton, parent,
+                              Matrix::Translation(0.f, 1.f, 0.f));
+        parent    = bone.get();
+      }
+      skeletons.emplace_back(skeleton);
+    }
+
+    BenchmarkReporter::Instance().measure(
+      std::to_string(boneCount) + " bones", frameCount,
+      skeletonCount * boneCount, [&](size_t frame) {
+        const auto rotation
+          = Matrix::RotationY(0.01f * static_cast<float>(frame));
+        for (auto& skeleton : skeletons) {
+          skeleton->bones.front()->getLocalMatrix().copyFrom(rotation);
+          skeleton->_markAsDirty();
+          skeleton->prepare();
+        }
+      });
+
+    EXPECT_EQ(skeletons.back()->getTransformMatrices(nullptr).size(),
+              16 * (boneCount + 1));
+  }
+}
@@ -0,0 +1,66 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <babylon/core/logging.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkLogger, MessagesPerSecond)
+{
+  using namespace BABYLON;
+
+  const size_t messageCount = 200000;
+
+  // The listener only counts the messages, as a console would be the
+  // bottleneck
+  std::atomic<size_t> received{0};
+  auto onLogMessage = [&received](const LogMessage&) { ++received; };
+  SA::delegate<void(const LogMessage&)> listener{onLogMessage};
+  auto& logger = Logger::Instance();
+  logger.registerLogMessageListener(LogLevels::LEVEL_ERROR, listener);
+
+  const auto run = [&](const char* title, LogOverflowPolicy policy,
+                       size_t producerCount) {
+    logger.setOverflowPolicy(policy);
+    received           = 0;
+    const auto dropped = logger.droppedCount();
+    const auto before  = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < producerCount; ++p) {
+      producers.emplace_back([messageCount, p]() {
+        for (size_t i = 0; i < messageCount; ++i) {
+          BABYLON_LOGF_ERROR("BenchmarkLogger", "Producer %zu, message %zu", p,
+                             i);
+        }
+      });
+    }
+    for (auto& producer : producers) {
+      producer.join();
+    }
+    const auto after = std::chrono::high_resolution_clock::now();
+    logger.flush();
+    const auto milliseconds
+      = std::chrono::duration<double, std::milli>(after - before).count();
+    BenchmarkReporter::Instance().record(
+      std::string(title) + ", " + std::to_string(producerCount)
+        + " producer(s)",
+      1, milliseconds, producerCount * messageCount);
+    std::cout << received << " received, " << logger.droppedCount() - dropped
+              << " dropped" << std::endl;
+  };
+
+  for (size_t producerCount : {1, 2, 4, 8}) {
+    run("Drop", LogOverflowPolicy::DROP, producerCount);
+    run("Overwrite", LogOverflowPolicy::OVERWRITE, producerCount);
+  }
+
+  logger.unregisterLogMessageListener(listener);
+  logger.setOverflowPolicy(LogOverflowPolicy::DROP);
+  EXPECT_FALSE(logger.isSubscribed(LogLevels::LEVEL_ERROR, listener));
+}
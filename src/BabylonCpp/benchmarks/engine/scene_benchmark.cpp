@@ -0,0 +1,106 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <babylon/cameras/target_camera.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/null_canvas.h>
+#include <babylon/engine/null_gl_rendering_context.h>
+#include <babylon/engine/scene.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/mesh/mesh.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkScene, evaluateActiveMeshes)
+{
+  using namespace BABYLON;
+
+  const size_t frameCount = 30;
+
+  for (const size_t meshCount : {1000, 10000, 50000}) {
+    // Engine without rendering context
+    auto engine = Engine::New(nullptr);
+    auto scene  = Scene::New(engine.get());
+    auto camera
+      = TargetCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+    camera->setTarget(Vector3::Zero());
+    // The engine has no drawing buffer to compute the aspect ratio from
+    camera->freezeProjectionMatrix(
+      Matrix::PerspectiveFovLH(camera->fov, 16.f / 9.f, 0.1f, 1000.f));
+
+    // Meshes on a grid around the camera, about half of them in the frustum
+    std::vector<MeshPtr> meshes;
+    meshes.reserve(meshCount);
+    for (size_t i = 0; i < meshCount; ++i) {
+      auto mesh = Mesh::New("mesh" + std::to_string(i), scene.get());
+      mesh->position
+        = Vector3(static_cast<float>(i % 100) - 50.f,
+                  static_cast<float>((i / 100) % 10) - 5.f,
+                  static_cast<float>(i / 1000) * 2.f - 50.f);
+      meshes.emplace_back(mesh);
+    }
+
+    // Freezing evaluates the active meshes once
+    BenchmarkReporter::Instance().measure(
+      std::to_string(meshCount) + " meshes", frameCount, meshCount,
+      [&](size_t) {
+        scene->unfreezeActiveMeshes();
+        scene->freezeActiveMeshes();
+      });
+
+    EXPECT_LE(scene->getActiveMeshes().size(), meshCount);
+  }
+}
+
+TEST(BenchmarkScene, render)
+{
+  using namespace BABYLON;
+
+  const size_t frameCount = 30;
+
+  for (const size_t meshCount : {100, 1000, 5000}) {
+    // Engine rendering with a rendering context which only counts the calls
+    NullCanvas canvas(1280, 720);
+    auto gl            = canvas.renderingContext();
+    gl->recordCommands = false;
+    auto engine        = Engine::New(&canvas);
+    auto scene         = Scene::New(engine.get());
+    auto camera
+      = TargetCamera::New("camera", Vector3(0.f, 0.f, -60.f), scene.get());
+    camera->setTarget(Vector3::Zero());
+    HemisphericLight::New("light", Vector3(0.f, 1.f, 0.f), scene.get());
+
+    // Boxes sharing a few materials, most of them in the frustum
+    std::vector<StandardMaterialPtr> materials;
+    for (size_t i = 0; i < 4; ++i) {
+      materials.emplace_back(
+        StandardMaterial::New("material" + std::to_string(i), scene.get()));
+    }
+    for (size_t i = 0; i < meshCount; ++i) {
+      auto mesh
+        = Mesh::CreateBox("mesh" + std::to_string(i), 0.5f, scene.get());
+      mesh->position
+        = Vector3(static_cast<float>(i % 50) - 25.f,
+                  static_cast<float>((i / 50) % 20) - 10.f,
+                  static_cast<float>(i / 1000) * 2.f);
+      mesh->material = materials[i % materials.size()];
+    }
+
+    // The first frame compiles the effects
+    scene->render();
+    gl->reset();
+
+    BenchmarkReporter::Instance().measure(
+      std::to_string(meshCount) + " meshes", frameCount, meshCount,
+      [&](size_t) { scene->render(); });
+
+    // Calls per frame, the state caches skip the redundant ones
+    std::cout << "  " << gl->totalCallCount() / frameCount << " GL calls, "
+              << gl->drawCallCount() / frameCount << " draw calls per frame"
+              << std::endl;
+    EXPECT_GT(gl->drawCallCount(), 0ull);
+  }
+}
@@ -1,7 +1,29 @@
 #include <gmock/gmock.h>
 
+#include <cstring>
+
+#include "benchmark_reporter.h"
+
 int main(int argc, char* argv[])
 {
   ::testing::InitGoogleMock(&argc, argv);
-  return RUN_ALL_TESTS();
+
+  // --benchmark_json=<file> writes the results of the benchmarks as JSON
+  const char* jsonFlag = "--benchmark_json=";
+  std::string jsonFilename;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strncmp(argv[i], jsonFlag, std::strlen(jsonFlag)) == 0) {
+      jsonFilename = argv[i] + std::strlen(jsonFlag);
+    }
+  }
+
+  const auto result = RUN_ALL_TESTS();
+
+  if (!jsonFilename.empty()
+      && !BABYLON::BenchmarkReporter::Instance().writeJson(jsonFilename)) {
+    std::cerr << "Unable to write " << jsonFilename << std::endl;
+    return 1;
+  }
+
+  return result;
 }
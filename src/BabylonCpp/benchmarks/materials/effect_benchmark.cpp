@@ -0,0 +1,154 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/cameras/target_camera.h>
+#include <babylon/core/string.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/null_canvas.h>
+#include <babylon/engine/null_gl_rendering_context.h>
+#include <babylon/engine/scene.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/effect_creation_options.h>
+#include <babylon/materials/effect_shaders_store.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/sub_mesh.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkEffect, createEffects)
+{
+  using namespace BABYLON;
+
+  const size_t iterations = 20;
+
+  NullCanvas canvas;
+  canvas.renderingContext()->recordCommands = false;
+  auto engine = Engine::New(&canvas);
+
+  // Every effect of the shaders store, the fragment shaders without vertex
+  // shader are post processes
+  std::vector<std::unordered_map<std::string, std::string>> sources;
+  for (const auto& shaderName : EffectShadersStore::Names()) {
+    const std::string name{shaderName};
+    for (const std::string suffix : {"PixelShader", "FragmentShader"}) {
+      if (!String::endsWith(name, suffix)) {
+        continue;
+      }
+      const auto baseName = name.substr(0, name.size() - suffix.size());
+      const auto vertex
+        = Effect::GetShader(baseName + "VertexShader").empty() ? "postprocess" :
+                                                                 baseName;
+      sources.push_back({{"vertex", vertex}, {"fragment", baseName}});
+    }
+  }
+
+  for (const bool useUbo : {true, false}) {
+    engine->disableUniformBuffers = !useUbo;
+    size_t compiledCount          = 0;
+    BenchmarkReporter::Instance().measure(
+      std::string("create effects") + (useUbo ? " with UBO" : ""), iterations,
+      sources.size(), [&](size_t) {
+        for (const auto& source : sources) {
+          EffectCreationOptions options;
+          options.indexParameters = {{"maxSimultaneousLights", 4},
+                                     {"maxSimultaneousMorphTargets", 1},
+                                     {"varyingCount", 8},
+                                     {"depCount", 8}};
+          Effect effect(source, options, engine.get());
+          compiledCount += effect.isReady() ? 1 : 0;
+        }
+      });
+    EXPECT_EQ(compiledCount, iterations * sources.size());
+  }
+}
+
+TEST(BenchmarkEffect, findShaders)
+{
+  using namespace BABYLON;
+
+  const size_t iterations = 100000;
+
+  std::vector<std::string> names;
+  for (const auto& name : EffectShadersStore::Names()) {
+    names.emplace_back(name);
+  }
+
+  size_t foundCount = 0;
+  BenchmarkReporter::Instance().measure(
+    "find shaders", iterations, names.size(), [&](size_t) {
+      for (const auto& name : names) {
+        foundCount += Effect::GetShader(name).empty() ? 0 : 1;
+      }
+    });
+  EXPECT_EQ(foundCount, iterations * names.size());
+}
+
+TEST(BenchmarkEffect, setUniforms)
+{
+  using namespace BABYLON;
+
+  const size_t iterations = 1000000;
+
+  // Effect of a standard material, compiled by a rendering context which
+  // only counts the calls
+  NullCanvas canvas;
+  auto gl            = canvas.renderingContext();
+  gl->recordCommands = false;
+  auto engine        = Engine::New(&canvas);
+  auto scene         = Scene::New(engine.get());
+  auto camera
+    = TargetCamera::New("camera", Vector3(0.f, 5.f, -10.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+  HemisphericLight::New("light", Vector3(0.f, 1.f, 0.f), scene.get());
+  auto box      = Mesh::CreateBox("box", 1.f, scene.get());
+  box->material = StandardMaterial::New("material", scene.get());
+  scene->render();
+  auto effect = box->subMeshes[0]->effect();
+  ASSERT_NE(effect, nullptr);
+
+  // Redundant values, as set by the materials bound for each sub-mesh
+  const auto matrix = Matrix::Translation(1.f, 2.f, 3.f);
+  const Color3 color(0.5f, 0.5f, 0.5f);
+  gl->reset();
+  BenchmarkReporter::Instance().measure(
+    "set redundant uniforms by string", iterations, 3, [&](size_t) {
+      effect->setMatrix(std::string("world"), matrix);
+      effect->setColor4(std::string("vDiffuseColor"), color, 1.f);
+      effect->setFloat(std::string("pointSize"), 1.f);
+    });
+
+  static const UniformName world{"world"};
+  static const UniformName vDiffuseColor{"vDiffuseColor"};
+  static const UniformName pointSize{"pointSize"};
+  BenchmarkReporter::Instance().measure(
+    "set redundant uniforms by name", iterations, 3, [&](size_t) {
+      effect->setMatrix(world, matrix);
+      effect->setColor4(vDiffuseColor, color, 1.f);
+      effect->setFloat(pointSize, 1.f);
+    });
+
+  const auto worldSlot         = effect->getUniformIndex(world);
+  const auto vDiffuseColorSlot = effect->getUniformIndex(vDiffuseColor);
+  const auto pointSizeSlot     = effect->getUniformIndex(pointSize);
+  BenchmarkReporter::Instance().measure(
+    "set redundant uniforms by slot", iterations, 3, [&](size_t) {
+      effect->setMatrix(worldSlot, matrix);
+      effect->setColor4(vDiffuseColorSlot, color, 1.f);
+      effect->setFloat(pointSizeSlot, 1.f);
+    });
+
+  // The values were sent once
+  EXPECT_EQ(gl->callCount(GL::GLCall::UNIFORM_MATRIX4FV), 1ull);
+  EXPECT_EQ(gl->callCount(GL::GLCall::UNIFORM4F), 1ull);
+  EXPECT_EQ(gl->callCount(GL::GLCall::UNIFORM1F), 1ull);
+
+  // Changing values
+  gl->reset();
+  BenchmarkReporter::Instance().measure(
+    "set changing uniforms by slot", iterations, 1, [&](size_t i) {
+      effect->setFloat(pointSizeSlot, static_cast<float>(i));
+    });
+  EXPECT_EQ(gl->callCount(GL::GLCall::UNIFORM1F), iterations);
+}
@@ -0,0 +1,54 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/materials/pbr/pbr_material_defines.h>
+#include <babylon/materials/standard_material_defines.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkMaterialDefines, isReadyForSubMesh)
+{
+  using namespace BABYLON;
+
+  const size_t iterations = 100000;
+
+  // Defines built for every sub-mesh
+  size_t defineCount = 0;
+  BenchmarkReporter::Instance().measure(
+    "create PBRMaterialDefines", iterations, 1, [&](size_t) {
+      PBRMaterialDefines defines;
+      defineCount += defines.boolDef.size();
+    });
+  EXPECT_GT(defineCount, 0ull);
+
+  // Defines updated as in isReadyForSubMesh
+  StandardMaterialDefines defines;
+  StandardMaterialDefines previous;
+  BenchmarkReporter::Instance().measure(
+    "update StandardMaterialDefines", iterations, 8, [&](size_t i) {
+      defines.boolDef["DIFFUSE"]        = (i % 2) == 0;
+      defines.boolDef["SPECULAR"]       = (i % 3) == 0;
+      defines.boolDef["NORMAL"]         = true;
+      defines.boolDef["UV1"]            = true;
+      defines.boolDef["LIGHT0"]         = true;
+      defines.boolDef["HEMILIGHT0"]     = true;
+      defines.intDef["DIFFUSEDIRECTUV"] = 0;
+      defines.intDef["BonesPerMesh"]    = 0;
+    });
+
+  size_t equalCount = 0;
+  BenchmarkReporter::Instance().measure(
+    "compare StandardMaterialDefines", iterations, 1, [&](size_t i) {
+      defines.boolDef["DIFFUSE"] = (i % 2) == 0;
+      equalCount += defines.isEqual(previous) ? 1 : 0;
+    });
+  EXPECT_EQ(equalCount, 0ull);
+
+  size_t textSize = 0;
+  BenchmarkReporter::Instance().measure(
+    "toString StandardMaterialDefines", iterations, 1, [&](size_t i) {
+      defines.boolDef["DIFFUSE"] = (i % 2) == 0;
+      textSize += defines.toString().size();
+    });
+  EXPECT_GT(textSize, 0ull);
+}
@@ -0,0 +1,52 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <babylon/math/matrix.h>
+#include <babylon/math/quaternion.h>
+#include <babylon/math/vector3.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkMatrix, MultiplyAndInvert)
+{
+  using namespace BABYLON;
+
+  const size_t matrixCount    = 100000;
+  const size_t iterationCount = 20;
+
+  std::vector<Matrix> matrices;
+  matrices.reserve(matrixCount);
+  for (size_t i = 0; i < matrixCount; ++i) {
+    const auto f  = static_cast<float>(i % 360) * 0.01f;
+    auto rotation = Quaternion::RotationYawPitchRoll(f, 0.5f * f, 0.25f * f);
+    matrices.emplace_back(Matrix::Compose(Vector3(1.f + f, 1.f, 1.f + 0.5f * f),
+                                          rotation, Vector3(f, -f, 2.f * f)));
+  }
+  std::vector<Matrix> results(matrixCount);
+  const auto transform = Matrix::RotationYawPitchRoll(0.1f, 0.2f, 0.3f);
+
+  BenchmarkReporter::Instance().measure(
+    "multiplyToRef", iterationCount, matrixCount, [&](size_t) {
+      for (size_t i = 0; i < matrixCount; ++i) {
+        matrices[i].multiplyToRef(transform, results[i]);
+      }
+    });
+
+  BenchmarkReporter::Instance().measure(
+    "invertToRef", iterationCount, matrixCount, [&](size_t) {
+      for (size_t i = 0; i < matrixCount; ++i) {
+        matrices[i].invertToRef(results[i]);
+      }
+    });
+
+  // The inverse of the product is the product of the inverses
+  // The product of a matrix by its inverse is the identity
+  Matrix inverse, identity;
+  matrices.back().invertToRef(inverse);
+  matrices.back().multiplyToRef(inverse, identity);
+  for (size_t i = 0; i < 16; ++i) {
+    EXPECT_NEAR(identity.m[i], (i % 5 == 0) ? 1.f : 0.f, 1e-4f);
+  }
+}
@@ -0,0 +1,73 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/mesh/facet_parameters.h>
+#include <babylon/mesh/vertex_data.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkVertexData, ComputeNormals)
+{
+  using namespace BABYLON;
+
+  ThreadPool threadPool(
+    std::max(1u, std::thread::hardware_concurrency()) - 1);
+
+  // Wavy grids of about 100k, 1M and 10M triangles
+  for (const size_t subdivisions : {224, 707, 2236}) {
+    const size_t rowSize = subdivisions + 1;
+    Float32Array positions;
+    Uint32Array indices;
+    positions.reserve(rowSize * rowSize * 3);
+    indices.reserve(subdivisions * subdivisions * 6);
+    for (size_t row = 0; row < rowSize; ++row) {
+      for (size_t col = 0; col < rowSize; ++col) {
+        const auto x = static_cast<float>(col) * 0.01f;
+        const auto z = static_cast<float>(row) * 0.01f;
+        positions.insert(positions.end(),
+                         {x, std::sin(10.f * x) * std::cos(10.f * z), z});
+      }
+    }
+    for (size_t row = 0; row < subdivisions; ++row) {
+      for (size_t col = 0; col < subdivisions; ++col) {
+        const auto i = static_cast<uint32_t>(row * rowSize + col);
+        const auto j = static_cast<uint32_t>(i + rowSize);
+        indices.insert(indices.end(), {i, j + 1, i + 1, j, j + 1, i});
+      }
+    }
+    const auto facetCount = indices.size() / 3;
+
+    Float32Array normals(positions.size());
+    const auto run = [&](const char* title, ThreadPool* pool,
+                         bool facetData) {
+      FacetParameters options;
+      options.depthSort  = true;
+      options.distanceTo = Vector3(0.f, 10.f, 0.f);
+      BenchmarkReporter::Instance().measure(
+        std::string(title) + ", " + std::to_string(facetCount) + " triangles",
+        5, facetCount, [&](size_t) {
+          if (facetData) {
+            options.facetNormals.resize(facetCount);
+            options.facetPositions.resize(facetCount);
+            VertexData::ComputeNormals(positions, indices, normals, options,
+                                       pool);
+          }
+          else {
+            VertexData::ComputeNormals(positions, indices, normals, pool);
+          }
+        });
+    };
+
+    run("Serial", nullptr, false);
+    run("Thread pool", &threadPool, false);
+    run("Serial, facet data", nullptr, true);
+    run("Thread pool, facet data", &threadPool, true);
+  }
+
+  SUCCEED();
+}
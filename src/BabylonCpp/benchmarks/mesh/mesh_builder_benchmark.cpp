@@ -0,0 +1,59 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+
+#include <babylon/mesh/vertex_data.h>
+#include <babylon/mesh/vertex_data_options.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkMeshBuilder, primitives)
+{
+  using namespace BABYLON;
+
+  // The mesh builder computes the vertex data of a primitive before uploading
+  // it, only the vertex data is created here as the engine would need a
+  // rendering context
+  const size_t iterationCount = 20;
+
+  const auto run
+    = [&](const char* title,
+          const std::function<std::unique_ptr<VertexData>()>& create) {
+        size_t vertexCount = 0;
+        BenchmarkReporter::Instance().measure(
+          title, iterationCount, create()->positions.size() / 3,
+          [&](size_t) { vertexCount += create()->positions.size() / 3; });
+        EXPECT_GT(vertexCount, 0ull);
+      };
+
+  BoxOptions boxOptions(1.f);
+  run("Box", [&]() { return VertexData::CreateBox(boxOptions); });
+
+  SphereOptions sphereOptions(1.f);
+  sphereOptions.segments = 64;
+  run("Sphere, 64 segments",
+      [&]() { return VertexData::CreateSphere(sphereOptions); });
+
+  CylinderOptions cylinderOptions(1.f);
+  cylinderOptions.tessellation = 128;
+  cylinderOptions.subdivisions = 16;
+  run("Cylinder, 128 x 16",
+      [&]() { return VertexData::CreateCylinder(cylinderOptions); });
+
+  TorusOptions torusOptions;
+  torusOptions.tessellation = 128;
+  run("Torus, 128 segments",
+      [&]() { return VertexData::CreateTorus(torusOptions); });
+
+  TorusKnotOptions torusKnotOptions;
+  torusKnotOptions.radialSegments  = 256;
+  torusKnotOptions.tubularSegments = 64;
+  run("Torus knot, 256 x 64",
+      [&]() { return VertexData::CreateTorusKnot(torusKnotOptions); });
+
+  GroundOptions groundOptions(256);
+  run("Ground, 256 subdivisions",
+      [&]() { return VertexData::CreateGround(groundOptions); });
+}
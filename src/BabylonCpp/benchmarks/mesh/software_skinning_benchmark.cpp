@@ -0,0 +1,64 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/math/matrix.h>
+#include <babylon/mesh/software_skinning.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkSoftwareSkinning, apply)
+{
+  using namespace BABYLON;
+
+  const size_t vertexCount = 1000000;
+  const size_t boneCount   = 64;
+  const size_t frameCount  = 30;
+
+  Float32Array sourcePositions(vertexCount * 3, 1.f);
+  Float32Array sourceNormals(vertexCount * 3, 0.5f);
+  Float32Array matricesIndices(vertexCount * 4);
+  Float32Array matricesWeights(vertexCount * 4, 0.25f);
+  Float32Array positions(vertexCount * 3);
+  Float32Array normals(vertexCount * 3);
+  for (size_t i = 0; i < matricesIndices.size(); ++i) {
+    matricesIndices[i] = static_cast<float>((i / 4 + i % 4) % boneCount);
+  }
+
+  SoftwareSkinning::Vertices vertices;
+  vertices.sourcePositions = sourcePositions.data();
+  vertices.sourceNormals   = sourceNormals.data();
+  vertices.matricesIndices = matricesIndices.data();
+  vertices.matricesWeights = matricesWeights.data();
+  vertices.positions       = positions.data();
+  vertices.normals         = normals.data();
+  vertices.vertexCount     = vertexCount;
+
+  Float32Array boneMatrices(boneCount * 16);
+  const auto run = [&](const char* title, ThreadPool* threadPool,
+                       size_t movingBoneCount) {
+    SoftwareSkinning skinning;
+    BenchmarkReporter::Instance().measure(
+      title, frameCount, vertexCount, [&](size_t frame) {
+        for (size_t bone = 0; bone < boneCount; ++bone) {
+          const auto step  = (bone < movingBoneCount) ? frame : 0;
+          const auto angle = 0.01f * static_cast<float>(bone + step);
+          Matrix::RotationY(angle).copyToArray(
+            boneMatrices, static_cast<unsigned int>(bone * 16));
+        }
+        skinning.apply(boneMatrices, vertices, threadPool);
+      });
+  };
+
+  ThreadPool threadPool(
+    std::max(1u, std::thread::hardware_concurrency()) - 1);
+
+  run("Serial", nullptr, boneCount);
+  run("Thread pool", &threadPool, boneCount);
+  run("Serial, static bones skipped", nullptr, 1);
+  run("Thread pool, static bones skipped", &threadPool, 1);
+
+  EXPECT_FALSE(positions.empty());
+}
@@ -0,0 +1,81 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/culling/triangle_bvh.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/sub_mesh.h>
+#include <babylon/mesh/vertex_data.h>
+#include <babylon/mesh/vertex_data_options.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkSubMesh, intersects)
+{
+  using namespace BABYLON;
+
+  const size_t rayCount = 100;
+
+  // Engine without rendering context, the mesh has no geometry so that the
+  // sub-mesh tests the triangles one by one
+  auto engine    = Engine::New(nullptr);
+  auto scene     = Scene::New(engine.get());
+  auto mesh      = Mesh::New("mesh", scene.get());
+  mesh->material = StandardMaterial::New("material", scene.get());
+
+  for (const unsigned int segments : {32, 128, 256}) {
+    SphereOptions options(2.f);
+    options.segments = segments;
+    auto sphere      = VertexData::CreateSphere(options);
+
+    std::vector<Vector3> positions;
+    positions.reserve(sphere->positions.size() / 3);
+    for (size_t i = 0; i < sphere->positions.size(); i += 3) {
+      positions.emplace_back(Vector3::FromArray(sphere->positions, i));
+    }
+    const auto& indices  = sphere->indices;
+    const auto faceCount = indices.size() / 3;
+    auto subMesh = SubMesh::New(0u, 0u, positions.size(), 0u, indices.size(),
+                                mesh, nullptr, false);
+
+    // Rays shot from outside the sphere towards points around its center
+    std::vector<Ray> rays;
+    rays.reserve(rayCount);
+    for (size_t i = 0; i < rayCount; ++i) {
+      const auto angle = static_cast<float>(i) * 0.37f;
+      Vector3 origin(5.f * std::cos(angle), 0.5f * std::sin(3.f * angle),
+                     5.f * std::sin(angle));
+      Vector3 target(0.1f * std::sin(angle), 0.2f, 0.f);
+      rays.emplace_back(Ray(origin, target.subtract(origin).normalize()));
+    }
+
+    size_t hitCount = 0;
+    BenchmarkReporter::Instance().measure(
+      std::to_string(faceCount) + " triangles", rayCount, faceCount,
+      [&](size_t i) {
+        if (subMesh->intersects(rays[i], positions, indices, false)) {
+          ++hitCount;
+        }
+      });
+    EXPECT_EQ(hitCount, rayCount);
+
+    // Same rays with the triangle hierarchy used for picking
+    TriangleBVH bvh(positions, indices, 0, indices.size());
+    hitCount = 0;
+    BenchmarkReporter::Instance().measure(
+      std::to_string(faceCount) + " triangles, triangle BVH", rayCount,
+      faceCount, [&](size_t i) {
+        if (bvh.intersects(rays[i], positions, false)) {
+          ++hitCount;
+        }
+      });
+    EXPECT_EQ(hitCount, rayCount);
+  }
+}
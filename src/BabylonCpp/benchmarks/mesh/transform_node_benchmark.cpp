@@ -0,0 +1,55 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/mesh/transform_node.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkTransformNode, computeWorldMatrix)
+{
+  using namespace BABYLON;
+
+  const size_t nodeCount  = 10000;
+  const size_t frameCount = 60;
+
+  // Engine without rendering context
+  auto engine = Engine::New(nullptr);
+  auto scene  = Scene::New(engine.get());
+
+  // Chains of nodes, from a flat list to a single deep hierarchy
+  for (const size_t depth : {1, 16, 256}) {
+    std::vector<TransformNodePtr> nodes;
+    nodes.reserve(nodeCount);
+    for (size_t i = 0; i < nodeCount; ++i) {
+      auto node = std::make_shared<TransformNode>("node" + std::to_string(i),
+                                                  scene.get(), false);
+      node->position = Vector3(0.f, 1.f, 0.f);
+      if (i % depth != 0) {
+        node->parent = nodes.back().get();
+      }
+      nodes.emplace_back(node);
+    }
+
+    // The roots move on every frame, the children are recomputed from their
+    // ancestors
+    BenchmarkReporter::Instance().measure(
+      "depth " + std::to_string(depth), frameCount, nodeCount,
+      [&](size_t frame) {
+        const auto x = 0.01f * static_cast<float>(frame);
+        for (size_t i = 0; i < nodeCount; i += depth) {
+          nodes[i]->position = Vector3(x, 1.f, 0.f);
+        }
+        for (auto& node : nodes) {
+          node->computeWorldMatrix();
+        }
+      });
+
+    EXPECT_FLOAT_EQ(nodes.back()->getAbsolutePosition().y,
+                    static_cast<float>((nodeCount - 1) % depth + 1));
+  }
+}
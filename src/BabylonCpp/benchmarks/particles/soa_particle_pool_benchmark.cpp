@@ -0,0 +1,58 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/particles/soa_particle_pool.h>
+#include <babylon/tools/color_gradient.h>
+#include <babylon/tools/factor_gradient.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkSoAParticlePool, update)
+{
+  using namespace BABYLON;
+
+  const size_t particleCount = 1000000;
+  const size_t stepCount     = 60;
+
+  SoAParticlePool pool;
+  pool.reserve(particleCount);
+  for (size_t i = 0; i < particleCount; ++i) {
+    const auto index         = pool.add();
+    const auto f             = static_cast<float>(i % 1000) * 0.001f;
+    pool.directionX[index]   = f;
+    pool.directionY[index]   = 1.f;
+    pool.colorA[index]       = 1.f;
+    pool.colorStepA[index]   = -0.01f;
+    pool.angularSpeed[index] = f;
+    pool.gradientSeed[index] = f;
+    // Long enough for every particle to survive the whole run
+    pool.lifeTime[index] = 1000.f;
+  }
+
+  std::vector<FactorGradient> factorGradients(2);
+  factorGradients[0].gradient = 0.f;
+  factorGradients[0].factor1  = 1.f;
+  factorGradients[0].factor2  = 2.f;
+  factorGradients[1].gradient = 1.f;
+  factorGradients[1].factor1  = 0.5f;
+
+  const auto run = [&](const char* title,
+                       const SoAParticlePool::UpdateParameters& parameters) {
+    BenchmarkReporter::Instance().measure(
+      title, stepCount, particleCount,
+      [&](size_t) { pool.update(parameters); });
+  };
+
+  // Gravity and color step only
+  SoAParticlePool::UpdateParameters parameters;
+  parameters.deltaTime = 0.016f;
+  parameters.gravity   = Vector3(0.f, -9.81f, 0.f);
+  run("Gravity", parameters);
+
+  // Size and drag gradients
+  SoAParticlePool::BuildGradientTable(factorGradients, parameters.sizeGradient);
+  SoAParticlePool::BuildGradientTable(factorGradients, parameters.dragGradient);
+  run("Gravity, size and drag gradients", parameters);
+
+  EXPECT_EQ(pool.size(), particleCount);
+}
@@ -0,0 +1,59 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <thread>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/engine/engine_constants.h>
+#include <babylon/math/spherical_polynomial.h>
+#include <babylon/tools/hdr/cube_map_to_spherical_polynomial_tools.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkCubeMapToSphericalPolynomialTools,
+     ConvertCubeMapToSphericalPolynomial)
+{
+  using namespace BABYLON;
+
+  const size_t size = 256;
+
+  std::array<ArrayBufferView, 6> faces;
+  for (size_t face = 0; face < 6; ++face) {
+    Float32Array data(size * size * 4);
+    for (size_t i = 0; i < data.size(); ++i) {
+      data[i] = 1.f + std::sin(static_cast<float>(face * 31 + i) * 0.1f);
+    }
+    faces[face] = ArrayBufferView(data);
+  }
+
+  CubeMapInfo cubeInfo{
+    faces[4],                            //
+    faces[5],                            //
+    faces[1],                            //
+    faces[0],                            //
+    faces[2],                            //
+    faces[3],                            //
+    size,                                //
+    EngineConstants::TEXTUREFORMAT_RGBA, //
+    EngineConstants::TEXTURETYPE_FLOAT,  //
+    false,                               //
+  };
+
+  ThreadPool threadPool(
+    std::max(1u, std::thread::hardware_concurrency()) - 1);
+
+  const auto run = [&](const char* title, ThreadPool* pool) {
+    BenchmarkReporter::Instance().measure(
+      title, 10, 6 * size * size, [&](size_t) {
+        EXPECT_NE(CubeMapToSphericalPolynomialTools::
+                    ConvertCubeMapToSphericalPolynomial(cubeInfo, pool),
+                  nullptr);
+      });
+  };
+
+  run("Serial", nullptr);
+  run("Thread pool", &threadPool);
+}
@@ -0,0 +1,41 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/tools/hdr/pmrem_generator.h>
+
+#include "benchmark_reporter.h"
+
+TEST(BenchmarkPMREMGenerator, filterCubeMap)
+{
+  using namespace BABYLON;
+
+  const size_t size = 64;
+
+  std::vector<Float32Array> faces(6);
+  for (size_t face = 0; face < 6; ++face) {
+    faces[face].resize(size * size * 3);
+    for (size_t i = 0; i < faces[face].size(); ++i) {
+      faces[face][i] = 1.f + std::sin(static_cast<float>(face * 31 + i) * 0.1f);
+    }
+  }
+
+  ThreadPool threadPool(
+    std::max(1u, std::thread::hardware_concurrency()) - 1);
+
+  const auto run = [&](const char* title, ThreadPool* pool) {
+    BenchmarkReporter::Instance().measure(
+      title, 1, 6 * size * size, [&](size_t) {
+        PMREMGenerator<Float32Array> generator(faces, size, size, 0, 3, true,
+                                               2048.f, 0.25f, false, true);
+        EXPECT_FALSE(generator.filterCubeMap(pool).empty());
+      });
+  };
+
+  run("Serial", nullptr);
+  run("Thread pool", &threadPool);
+}
@@ -18,6 +18,8 @@ namespace BABYLON {
 
 class Animatable;
 class Animation;
+class AnimationTrack;
+struct AnimationTrackCursor;
 class IAnimatable;
 struct IAnimationKey;
 class IEasingFunction;
@@ -449,6 +451,13 @@ public:
    */
   std::vector<IAnimationKey>& getKeys();
 
+  /**
+   * @brief Gets the key frames from the animation without invalidating the
+   * compact track built from them.
+   * @returns The key frames of the animation
+   */
+  const std::vector<IAnimationKey>& getKeys() const;
+
   /**
    * @brief Gets the highest frame rate of the animation.
    * @returns Highest frame rate of the animation
@@ -602,6 +611,19 @@ public:
                const AnimationValue& offsetValue    = AnimationValue(),
                const AnimationValue& highLimitValue = AnimationValue());
 
+  /**
+   * @brief Hidden Internal use only.
+   * Interpolates the compact track of the keys into the result, the typed
+   * field of the animation data type is the only field written.
+   * @returns false if the keys can not be interpolated from a track, the
+   * result is left untouched in that case
+   */
+  bool _interpolateTrack(float currentFrame, int repeatCount,
+                         unsigned int loopMode,
+                         const AnimationValue& offsetValue,
+                         const AnimationValue& highLimitValue,
+                         AnimationTrackCursor& cursor, AnimationValue& result);
+
   /**
    * @brief Defines the function to use to interpolate matrices.
    * @param startValue defines the start matrix
@@ -748,6 +770,13 @@ private:
    */
   std::vector<IAnimationKey> _keys;
 
+  /**
+   * Compact copy of the key frames, rebuilt on the next interpolation when the
+   * keys were modified
+   */
+  std::unique_ptr<AnimationTrack> _track;
+  bool _isTrackDirty;
+
   /**
    * Stores the easing function of the animation
    */
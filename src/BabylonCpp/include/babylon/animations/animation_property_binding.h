@@ -0,0 +1,68 @@
+#ifndef BABYLON_ANIMATIONS_ANIMATION_PROPERTY_BINDING_H
+#define BABYLON_ANIMATIONS_ANIMATION_PROPERTY_BINDING_H
+
+#include <string>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class AnimationValue;
+class IAnimatable;
+
+/**
+ * @brief Setter of an animated property resolved once from the target
+ * property path, so that applying an animation value does not look up the
+ * property by name on every frame.
+ *
+ * The common properties of transform nodes, bones, lights and materials are
+ * supported, the other properties have to be set by reflection.
+ */
+class BABYLON_SHARED_EXPORT AnimationPropertyBinding {
+
+public:
+  using Setter = void (*)(IAnimatable* target, const AnimationValue& value);
+
+public:
+  AnimationPropertyBinding();
+  ~AnimationPropertyBinding();
+
+  /**
+   * @brief Resolves the setter of an animated property.
+   * @param target defines the animated object
+   * @param targetPropertyPath defines the path of the property in the target
+   * @param dataType defines the data type of the animation
+   * @returns an invalid binding if the property is not supported
+   */
+  static AnimationPropertyBinding
+  Compile(IAnimatable* target,
+          const std::vector<std::string>& targetPropertyPath, int dataType);
+
+  /**
+   * @brief Returns true if the setter of the property was resolved.
+   */
+  bool isValid() const;
+
+  /**
+   * @brief Returns the object owning the property.
+   */
+  IAnimatable* target() const;
+
+  /**
+   * @brief Sets the value of the property. The binding must be valid.
+   */
+  void setValue(const AnimationValue& value) const;
+
+private:
+  AnimationPropertyBinding(IAnimatable* target, Setter setter);
+
+private:
+  IAnimatable* _target;
+  Setter _setter;
+
+}; // end of class AnimationPropertyBinding
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ANIMATIONS_ANIMATION_PROPERTY_BINDING_H
@@ -0,0 +1,143 @@
+#ifndef BABYLON_ANIMATIONS_ANIMATION_TRACK_H
+#define BABYLON_ANIMATIONS_ANIMATION_TRACK_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class AnimationValue;
+struct IAnimationKey;
+class IEasingFunction;
+
+/**
+ * @brief Position of a runtime animation in the keys of a track. Consecutive
+ * frames usually stay in the same segment or move to the next one, so the
+ * cursor makes the key lookup constant time in the common case.
+ */
+struct BABYLON_SHARED_EXPORT AnimationTrackCursor {
+  /**
+   * Index of the key starting the current segment
+   */
+  size_t key = 0;
+}; // end of struct AnimationTrackCursor
+
+/**
+ * @brief Compact storage of the key frames of an animation with a numeric data
+ * type (float, vector2, vector3, quaternion, color3, size and matrix).
+ *
+ * The frames, values and tangents are stored in contiguous float arrays, one
+ * value being componentCount() consecutive floats, and the interpolation
+ * produces fixed size values.
+ */
+class BABYLON_SHARED_EXPORT AnimationTrack {
+
+public:
+  /**
+   * Number of floats of the largest value (matrix)
+   */
+  static constexpr size_t MaxComponentCount = 16;
+
+  using Value = std::array<float, MaxComponentCount>;
+
+public:
+  AnimationTrack();
+  ~AnimationTrack();
+
+  /**
+   * @brief Returns the number of floats of a value of the given animation data
+   * type, 0 if the data type can not be stored in a track.
+   */
+  static size_t ComponentCount(int dataType);
+
+  /**
+   * @brief Copies the floats of a value of the track data type.
+   */
+  static void ReadValue(int dataType, const AnimationValue& value,
+                        float* result);
+
+  /**
+   * @brief Stores the floats of a value in the field of the given data type.
+   */
+  static void WriteValue(int dataType, const float* value,
+                         AnimationValue& result);
+
+  /**
+   * @brief Fills the track from animation keys.
+   * @param dataType defines the data type of the animation
+   * @param keys defines the keys sorted by frame
+   * @returns false if the keys can not be stored in a track, the track is empty
+   * in that case
+   */
+  bool build(int dataType, const std::vector<IAnimationKey>& keys);
+
+  /**
+   * @brief Returns the data type of the track.
+   */
+  int dataType() const;
+
+  /**
+   * @brief Returns the number of floats of a value.
+   */
+  size_t componentCount() const;
+
+  /**
+   * @brief Returns the number of keys.
+   */
+  size_t keyCount() const;
+
+  /**
+   * @brief Returns the frames of the keys.
+   */
+  const std::vector<float>& frames() const;
+
+  /**
+   * @brief Returns the index of the key starting the segment containing the
+   * frame, and moves the cursor to it. The frame must not be past the last
+   * key.
+   */
+  size_t findKey(float frame, AnimationTrackCursor& cursor) const;
+
+  /**
+   * @brief Copies the value of a key.
+   */
+  void getKeyValue(size_t key, Value& result) const;
+
+  /**
+   * @brief Interpolates the keys at the given frame.
+   * @param frame defines the frame to evaluate
+   * @param cursor defines the cursor of the caller
+   * @param easingFunction defines the optional easing function applied to the
+   * gradient
+   * @param result defines the value receiving componentCount() floats
+   * @returns false if the value of a key was returned as is, past the last key
+   * or for a step interpolation
+   */
+  bool evaluate(float frame, AnimationTrackCursor& cursor,
+                IEasingFunction* easingFunction, Value& result) const;
+
+private:
+  const float* _value(const std::vector<float>& values, size_t key) const;
+
+private:
+  static constexpr std::uint8_t HasInTangent  = 1;
+  static constexpr std::uint8_t HasOutTangent = 2;
+  static constexpr std::uint8_t Step          = 4;
+
+  int _dataType;
+  size_t _componentCount;
+  std::vector<float> _frames;
+  // keyCount() * componentCount() floats each, tangents are zero when missing
+  std::vector<float> _values;
+  std::vector<float> _inTangents;
+  std::vector<float> _outTangents;
+  std::vector<std::uint8_t> _flags;
+
+}; // end of class AnimationTrack
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ANIMATIONS_ANIMATION_TRACK_H
@@ -3,6 +3,8 @@
 
 #include <unordered_map>
 
+#include <babylon/animations/animation_property_binding.h>
+#include <babylon/animations/animation_track.h>
 #include <babylon/animations/animation_value.h>
 #include <babylon/babylon_api.h>
 
@@ -142,9 +144,9 @@ private:
    * @param loopMode The type of looping mode to use
    * @param offsetValue Animation offset value
    * @param highLimitValue The high limit value
-   * @returns The interpolated value
+   * @returns The interpolated value, valid until the next interpolation
    */
-  AnimationValue
+  const AnimationValue&
   _interpolate(float currentFrame, int repeatCount, unsigned int loopMode,
                const AnimationValue& offsetValue    = AnimationValue(),
                const AnimationValue& highLimitValue = AnimationValue());
@@ -193,6 +195,16 @@ private:
    */
   float _currentFrame;
 
+  /**
+   * Position of the runtime animation in the keys of the animation
+   */
+  AnimationTrackCursor _trackCursor;
+
+  /**
+   * Value receiving the interpolations
+   */
+  AnimationValue _interpolatedValue;
+
   /**
    * The animation used by the runtime animation
    */
@@ -203,6 +215,11 @@ private:
    */
   IAnimatablePtr _target;
 
+  /**
+   * The setter of the animated property of the target, resolved once
+   */
+  AnimationPropertyBinding _propertyBinding;
+
   /**
    * The initiating animatable
    */
@@ -69,6 +69,9 @@ public:
    */
   AbstractMesh* collidedMesh;
 
+  /**
+   * Define the unique id of the last collided serialized mesh
+   */
   unsigned int collidedMeshId;
   /** Hidden */
   Vector3 _radius;
@@ -7,6 +7,7 @@
 #include <babylon/collisions/serialized_mesh.h>
 #include <babylon/collisions/worker.h>
 #include <babylon/math/vector3.h>
+#include <babylon/tools/observer.h>
 
 namespace BABYLON {
 
@@ -40,6 +41,7 @@ public:
 private:
   void _afterRender();
   void _onMessageFromWorker(const WorkerReply& returnData);
+  static bool _IsSameMesh(const SerializedMesh& a, const SerializedMesh& b);
 
 private:
   Scene* _scene;
@@ -51,7 +53,11 @@ private:
     _collisionsCallbackArray;
   bool _init;
   int _runningUpdated;
+  Observer<Scene>::Ptr _onAfterRenderObserver;
   Worker _worker;
+  // Last state of the meshes sent to the worker, unchanged meshes are not sent
+  // again
+  std::unordered_map<unsigned int, SerializedMesh> _workerMeshes;
   std::unordered_map<unsigned int, SerializedMesh> _addUpdateMeshesList;
   std::unordered_map<std::string, SerializedGeometry> _addUpdateGeometriesList;
   Uint32Array _toRemoveMeshesArray;
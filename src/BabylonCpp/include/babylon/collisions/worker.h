@@ -1,33 +1,70 @@
 #ifndef BABYLON_COLLISIONS_WORKER_H
 #define BABYLON_COLLISIONS_WORKER_H
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
+#include <thread>
 
 #include <babylon/babylon_api.h>
+#include <babylon/collisions/babylon_message.h>
 #include <babylon/collisions/collision_detector_transferable.h>
+#include <babylon/collisions/worker_reply.h>
+#include <babylon/core/lock_free_queue.h>
 #include <babylon/core/structs.h>
 
 namespace BABYLON {
 
-struct BabylonMessage;
-struct WorkerReply;
-
+/**
+ * @brief Background thread running the collision detector.
+ *
+ * The messages are posted from the render thread and processed in order on the
+ * worker thread, which keeps its own copy of the serialized meshes and
+ * geometries. The replies are queued until the render thread dispatches them
+ * to the callback handler with processReplies().
+ */
 class BABYLON_SHARED_EXPORT Worker {
 
 public:
   Worker();
+  Worker(const Worker& other) = delete;
+  Worker& operator=(const Worker& other) = delete;
   ~Worker();
 
   void postMessage(const BabylonMessage& message);
+  void postMessage(BabylonMessage&& message);
   void postMessage(const BabylonMessage& message,
                    const std::vector<ArrayBufferView>& serializable);
+
+  /**
+   * @brief Calls the callback handler with the replies received from the
+   * worker thread, from the calling thread.
+   * @returns the number of processed replies
+   */
+  size_t processReplies();
+
+  /**
+   * @brief Stops the worker thread, the pending messages are discarded.
+   */
   void terminate();
 
 public:
   std::function<void(const WorkerReply& e)> callbackHandler;
 
+private:
+  void _run();
+  WorkerReply _onMessage(const BabylonMessage& message);
+
 private:
   CollisionDetectorTransferable collisionDetector;
+  LockFreeQueue<BabylonMessage> _messages;
+  LockFreeQueue<WorkerReply> _replies;
+  // Only used to put the idle worker thread to sleep
+  std::mutex _mutex;
+  std::condition_variable _messageCondition;
+  std::thread _thread;
+  std::atomic<bool> _terminated;
 
 }; // end of struct Worker
 
@@ -0,0 +1,137 @@
+#ifndef BABYLON_CORE_BOUNDED_QUEUE_H
+#define BABYLON_CORE_BOUNDED_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Multiple producers, multiple consumers bounded lock-free queue.
+ *
+ * The items are stored in a ring buffer allocated once, whose capacity is
+ * rounded up to a power of two. Each cell holds a sequence number telling the
+ * producers and the consumers whose turn it is to use it (D. Vyukov's bounded
+ * MPMC queue), so that tryPush() and tryAndPop() only need one compare and
+ * swap on the shared position in the uncontended case.
+ */
+template <typename T>
+class BABYLON_SHARED_EXPORT BoundedQueue {
+
+public:
+  BoundedQueue& operator=(const BoundedQueue&) = delete;
+  BoundedQueue(const BoundedQueue& other)      = delete;
+
+  explicit BoundedQueue(size_t capacity)
+      : _mask{_RoundUpToPowerOfTwo(capacity) - 1}
+      , _cells{new Cell[_mask + 1]}
+      , _enqueuePosition{0}
+      , _dequeuePosition{0}
+  {
+    for (size_t i = 0; i <= _mask; ++i) {
+      _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  ~BoundedQueue() = default;
+
+  size_t capacity() const
+  {
+    return _mask + 1;
+  }
+
+  // return immediately, with false if the queue is full
+  bool tryPush(const T& item)
+  {
+    auto position = _enqueuePosition.load(std::memory_order_relaxed);
+    Cell* cell    = nullptr;
+    for (;;) {
+      cell          = &_cells[position & _mask];
+      auto sequence = cell->sequence.load(std::memory_order_acquire);
+      auto diff     = static_cast<std::ptrdiff_t>(sequence)
+                  - static_cast<std::ptrdiff_t>(position);
+      if (diff == 0) {
+        if (_enqueuePosition.compare_exchange_weak(
+              position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      }
+      else if (diff < 0) {
+        return false;
+      }
+      else {
+        position = _enqueuePosition.load(std::memory_order_relaxed);
+      }
+    }
+    cell->value = item;
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  // return immediately, with true if successful retrieval
+  bool tryAndPop(T& poppedItem)
+  {
+    auto position = _dequeuePosition.load(std::memory_order_relaxed);
+    Cell* cell    = nullptr;
+    for (;;) {
+      cell          = &_cells[position & _mask];
+      auto sequence = cell->sequence.load(std::memory_order_acquire);
+      auto diff     = static_cast<std::ptrdiff_t>(sequence)
+                  - static_cast<std::ptrdiff_t>(position + 1);
+      if (diff == 0) {
+        if (_dequeuePosition.compare_exchange_weak(
+              position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      }
+      else if (diff < 0) {
+        return false;
+      }
+      else {
+        position = _dequeuePosition.load(std::memory_order_relaxed);
+      }
+    }
+    poppedItem = std::move(cell->value);
+    cell->sequence.store(position + _mask + 1, std::memory_order_release);
+    return true;
+  }
+
+  // approximate when other threads are pushing or popping
+  bool empty() const
+  {
+    return _dequeuePosition.load(std::memory_order_acquire)
+           >= _enqueuePosition.load(std::memory_order_acquire);
+  }
+
+private:
+  static size_t _RoundUpToPowerOfTwo(size_t value)
+  {
+    size_t result = 2;
+    while (result < value) {
+      result <<= 1;
+    }
+    return result;
+  }
+
+private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    T value;
+  }; // end of struct Cell
+
+private:
+  const size_t _mask;
+  std::unique_ptr<Cell[]> _cells;
+  // Shared by the producers
+  alignas(64) std::atomic<size_t> _enqueuePosition;
+  // Shared by the consumers
+  alignas(64) std::atomic<size_t> _dequeuePosition;
+
+}; // end of class BoundedQueue
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_BOUNDED_QUEUE_H
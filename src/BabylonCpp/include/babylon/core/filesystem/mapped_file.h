@@ -0,0 +1,117 @@
+#ifndef BABYLON_CORE_FILESYSTEM_MAPPED_FILE_H
+#define BABYLON_CORE_FILESYSTEM_MAPPED_FILE_H
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class MappedFile;
+using MappedFilePtr = std::shared_ptr<MappedFile>;
+
+/**
+ * @brief Read-only contents of a binary file, memory-mapped when possible and
+ * read into memory otherwise.
+ *
+ * The pages of a mapped file are loaded by the system when they are accessed,
+ * so opening a file does not copy it. The pointer returned by data() stays
+ * valid as long as the object lives.
+ */
+class BABYLON_SHARED_EXPORT MappedFile {
+
+public:
+  using ProgressCallback = std::function<void(size_t loaded, size_t total)>;
+  using ChunkCallback
+    = std::function<bool(const uint8_t* chunk, size_t length)>;
+
+  /**
+   * Size of the chunks read into memory.
+   */
+  static constexpr size_t DefaultChunkSize = 4 * 1024 * 1024;
+
+public:
+  /**
+   * @brief Maps a file, or reads it when it cannot be mapped.
+   * @param filename defines the path of the file
+   * @param onProgress defines the callback called after each read chunk
+   * @returns the contents of the file, nullptr if it cannot be read
+   */
+  static MappedFilePtr Open(const std::string& filename,
+                            const ProgressCallback& onProgress = nullptr);
+
+  /**
+   * @brief Maps a file in memory.
+   * @param filename defines the path of the file
+   * @returns the contents of the file, nullptr if it cannot be mapped, e.g. if
+   * it is empty or not a regular file
+   */
+  static MappedFilePtr Map(const std::string& filename);
+
+  /**
+   * @brief Reads a file into memory, by chunks of DefaultChunkSize bytes.
+   * @param filename defines the path of the file
+   * @param onProgress defines the callback called after each chunk
+   * @returns the contents of the file, nullptr if it cannot be read
+   */
+  static MappedFilePtr Read(const std::string& filename,
+                            const ProgressCallback& onProgress = nullptr);
+
+  /**
+   * @brief Reads a file by chunks without keeping it in memory, e.g. for the
+   * files larger than the memory.
+   * @param filename defines the path of the file
+   * @param chunkSize defines the maximum size of a chunk in bytes
+   * @param onChunk defines the callback called with each chunk, reading stops
+   * when it returns false
+   * @param onProgress defines the callback called after each chunk
+   * @returns true if the whole file was read
+   */
+  static bool Stream(const std::string& filename, size_t chunkSize,
+                     const ChunkCallback& onChunk,
+                     const ProgressCallback& onProgress = nullptr);
+
+  MappedFile(const MappedFile& other) = delete;
+  MappedFile& operator=(const MappedFile& other) = delete;
+  ~MappedFile();
+
+  /**
+   * @brief Returns the contents of the file.
+   */
+  const uint8_t* data() const;
+
+  /**
+   * @brief Returns the size of the file in bytes.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns true if the file is memory-mapped.
+   */
+  bool isMapped() const;
+
+private:
+  MappedFile();
+
+  bool _map(const std::string& filename);
+  bool _read(const std::string& filename, const ProgressCallback& onProgress);
+  void _unmap();
+
+private:
+  const uint8_t* _data;
+  size_t _size;
+  bool _mapped;
+  // Contents of the files read into memory
+  ArrayBuffer _buffer;
+  // File and mapping handles on Windows
+  void* _fileHandle;
+  void* _mappingHandle;
+
+}; // end of class MappedFile
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_FILESYSTEM_MAPPED_FILE_H
@@ -0,0 +1,80 @@
+#ifndef BABYLON_CORE_LOCK_FREE_QUEUE_H
+#define BABYLON_CORE_LOCK_FREE_QUEUE_H
+
+#include <atomic>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Single producer, single consumer unbounded lock-free queue.
+ *
+ * push() must only be called from the producer thread, tryAndPop() and empty()
+ * only from the consumer thread. The items are stored in a linked list of
+ * nodes, the consumer keeps the node of the last popped item as sentinel so
+ * that both threads never touch the same node concurrently.
+ */
+template <typename T>
+class BABYLON_SHARED_EXPORT LockFreeQueue {
+
+public:
+  LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+  LockFreeQueue(const LockFreeQueue& other)      = delete;
+
+  LockFreeQueue() : _head{new Node()}, _tail{_head}
+  {
+  }
+
+  ~LockFreeQueue()
+  {
+    while (_head) {
+      auto next = _head->next.load(std::memory_order_relaxed);
+      delete _head;
+      _head = next;
+    }
+  }
+
+  void push(T item)
+  {
+    auto node   = new Node();
+    node->value = std::move(item);
+    _tail->next.store(node, std::memory_order_release);
+    _tail = node;
+  }
+
+  // return immediately, with true if successful retrieval
+  bool tryAndPop(T& poppedItem)
+  {
+    auto next = _head->next.load(std::memory_order_acquire);
+    if (!next) {
+      return false;
+    }
+    poppedItem = std::move(next->value);
+    delete _head;
+    _head = next;
+    return true;
+  }
+
+  bool empty() const
+  {
+    return _head->next.load(std::memory_order_acquire) == nullptr;
+  }
+
+private:
+  struct Node {
+    std::atomic<Node*> next{nullptr};
+    T value;
+  }; // end of struct Node
+
+private:
+  // Owned by the consumer
+  alignas(64) Node* _head;
+  // Owned by the producer
+  alignas(64) Node* _tail;
+
+}; // end of class LockFreeQueue
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_LOCK_FREE_QUEUE_H
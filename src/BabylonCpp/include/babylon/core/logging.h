@@ -3,6 +3,7 @@
 
 #include <babylon/core/logging/log_levels.h>
 #include <babylon/core/logging/log_message.h>
+#include <babylon/core/logging/log_record.h>
 #include <babylon/core/logging/logger.h>
 
 #endif // BABYLON_CORE_LOGGING_H
@@ -0,0 +1,127 @@
+#ifndef BABYLON_CORE_LOGGING_LOG_RECORD_H
+#define BABYLON_CORE_LOGGING_LOG_RECORD_H
+
+#include <ostream>
+#include <thread>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/core/logging/log_levels.h>
+
+// Use "-Wall" to generate warnings in case of illegal printf format.
+//      Ref:  http://www.unixwiz.net/techtips/gnu-c-attributes.html
+#ifndef __GNUC__
+#define                                                                        \
+  __attribute__(x) // Disable 'attributes' if compiler does not support 'em
+#endif
+
+namespace BABYLON {
+
+class LogMessage;
+
+/**
+ * @brief Output stream formatting into a fixed-size character buffer, without
+ * allocating. The characters which do not fit in the buffer are discarded.
+ */
+class BABYLON_SHARED_EXPORT LogRecordStream : public std::ostream {
+
+public:
+  /**
+   * @brief Returns the stream of the calling thread, it is reused by all the
+   * records formatted on that thread.
+   */
+  static LogRecordStream& ThreadInstance();
+
+  LogRecordStream();
+  ~LogRecordStream();
+
+  /**
+   * @brief Starts writing at the beginning of a buffer, null-terminated by
+   * close().
+   */
+  std::ostream& open(char* buffer, size_t size);
+  void close();
+
+private:
+  class Buffer : public std::streambuf {
+  public:
+    void reset(char* buffer, size_t size);
+    char* current() const;
+  }; // end of class Buffer
+
+private:
+  Buffer _buffer;
+
+}; // end of class LogRecordStream
+
+/**
+ * @brief Preformatted log message of a fixed size, copied as is in the queue
+ * of the logger. The file and function names must be string literals.
+ */
+class BABYLON_SHARED_EXPORT LogRecord {
+
+public:
+  static constexpr size_t ContextSize = 64;
+  static constexpr size_t MessageSize = 384;
+
+public:
+  LogRecord() = default;
+  LogRecord(unsigned int level, char const* file, int lineNumber,
+            char const* func, char const* prettyFunc);
+
+  template <typename T>
+  inline void setContext(T const& ctx)
+  {
+    auto& stream = LogRecordStream::ThreadInstance();
+    stream.open(context, ContextSize) << ctx;
+    stream.close();
+  }
+
+  template <typename... TR>
+  inline void write(TR&&... rest)
+  {
+    auto& stream = LogRecordStream::ThreadInstance();
+    writeMessages(stream.open(message, MessageSize),
+                  std::forward<TR>(rest)...);
+    stream.close();
+  }
+
+  void writef(const char* printf_like_message, ...)
+    __attribute__((format(printf, 2, 3)));
+
+  /**
+   * @brief Creates the log message of the record, for the listeners.
+   */
+  LogMessage toLogMessage() const;
+
+private:
+  template <typename TF, typename... TR>
+  static inline void writeMessages(std::ostream& os, TF&& msg, TR&&... rest)
+  {
+    os << msg;
+    if constexpr (sizeof...(rest) > 0) {
+      os << " ";
+      writeMessages(os, std::forward<TR>(rest)...);
+    }
+  }
+  static inline void writeMessages(std::ostream& /*os*/)
+  {
+    // Handle the empty params case
+  }
+
+public:
+  unsigned int level;
+  int lineNumber;
+  system_time_point_t timestamp;
+  std::thread::id threadId;
+  char const* file;
+  char const* function;
+  char const* prettyFunction;
+  char context[ContextSize];
+  char message[MessageSize];
+
+}; // end of class LogRecord
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_LOGGING_LOG_RECORD_H
@@ -1,10 +1,17 @@
 #ifndef BABYLON_CORE_LOGGING_LOGGER_H
 #define BABYLON_CORE_LOGGING_LOGGER_H
 
-#include <babylon/core/active.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include <babylon/core/bounded_queue.h>
 #include <babylon/core/delegates/delegate.h>
 #include <babylon/core/logging/log_levels.h>
 #include <babylon/core/logging/log_message.h>
+#include <babylon/core/logging/log_record.h>
 
 #if _MSC_VER && !__INTEL_COMPILER
 #ifndef __PRETTY_FUNCTION__
@@ -18,8 +25,29 @@
 #define thread_local __declspec(thread)
 #endif
 
+// Highest level compiled in the BABYLON_LOG_* macros, the messages of the
+// levels above it are removed at compile time:
+// 0 = quiet, 1 = error, 2 = warn, 3 = info, 4 = debug, 5 = trace
+#ifndef BABYLON_LOG_MAX_LEVEL
+#define BABYLON_LOG_MAX_LEVEL 5
+#endif
+
 namespace BABYLON {
 
+/**
+ * @brief Behavior of the logger when its queue of records is full.
+ */
+enum class LogOverflowPolicy {
+  /**
+   * The new record is dropped
+   */
+  DROP,
+  /**
+   * The oldest queued record is dropped to make room for the new one
+   */
+  OVERWRITE
+}; // end of enum class LogOverflowPolicy
+
 struct LogMessageHandler {
   using LogMessageListener = SA::delegate<void(const LogMessage&)>;
 
@@ -28,20 +56,33 @@ struct LogMessageHandler {
   LogMessageHandler(const LogMessageHandler&) = delete;
   LogMessageHandler& operator=(const LogMessageHandler&) = delete;
 
-  bool takes(unsigned int level);
-  void handle(const LogMessage& msg);
+  bool takes(unsigned int level) const;
+  void handle(const LogRecord& logRecord);
 
   std::unordered_map<unsigned int, std::vector<LogMessageListener*>>
     _logMessageListeners;
-  std::unique_ptr<Active> _bg;
+  std::mutex _listenersMutex;
   unsigned int _minLevel, _maxLevel;
 };
 
+/**
+ * @brief Asynchronous logger.
+ *
+ * The BABYLON_LOG_* macros format the messages on the calling thread into
+ * fixed-size records, which are pushed without locking nor allocating into a
+ * bounded queue. A background thread creates the log messages from the
+ * records and calls the listeners registered for their level.
+ */
 class BABYLON_SHARED_EXPORT Logger {
 
 public:
   using LogMessageListener = SA::delegate<void(const LogMessage&)>;
 
+  /**
+   * Number of records the queue can hold
+   */
+  static constexpr size_t QueueCapacity = 1024;
+
 public:
   static Logger& Instance()
   {
@@ -64,7 +105,26 @@ public:
                                   char const* file, int lineNumber,
                                   char const* func, char const* prettyFunc);
   void log(const LogMessage& logMessage);
-  bool takes(unsigned int level);
+  void log(const LogRecord& logRecord);
+  bool takes(unsigned int level) const;
+
+  /**
+   * @brief Blocks until the records logged before the call are handled by the
+   * listeners.
+   */
+  void flush();
+
+  /**
+   * @brief Sets the behavior of the logger when its queue is full, the new
+   * records are dropped by default.
+   */
+  void setOverflowPolicy(LogOverflowPolicy policy);
+  LogOverflowPolicy overflowPolicy() const;
+
+  /**
+   * @brief Returns the number of records dropped because the queue was full.
+   */
+  size_t droppedCount() const;
 
   bool isSubscribed(unsigned int level, LogMessageListener& logMsgListener);
   void registerLogMessageListener(LogMessageListener& logMsgListener);
@@ -78,8 +138,21 @@ protected:
   Logger();
   ~Logger();
 
+private:
+  void _run();
+  void _wakeUp();
+
 private:
   LogMessageHandler _impl;
+  BoundedQueue<LogRecord> _records;
+  std::atomic<LogOverflowPolicy> _overflowPolicy;
+  std::atomic<size_t> _droppedCount;
+  std::atomic<bool> _sleeping;
+  std::atomic<bool> _handling;
+  std::atomic<bool> _done;
+  std::mutex _mutex;
+  std::condition_variable _recordCondition;
+  std::thread _thread;
 
 }; // end of class LogChannel
 
@@ -87,71 +160,72 @@ private:
 
 #define BABYLON_LOG_MSG(level, context, ...)                                   \
   if (BABYLON::Logger::Instance().takes(level)) {                              \
-    std::ostringstream _ctx;                                                   \
-    _ctx << context;                                                           \
-    BABYLON::LogMessage _logMessage                                            \
-      = BABYLON::Logger::CreateMessage(level, _ctx.str(), __FILE__, __LINE__,  \
-                                       __FUNCTION__, __PRETTY_FUNCTION__);     \
-    _logMessage.write(__VA_ARGS__);                                            \
-    BABYLON::Logger::Instance().log(std::move(_logMessage));                 \
+    BABYLON::LogRecord _logRecord{level, __FILE__, __LINE__, __FUNCTION__,     \
+                                  __PRETTY_FUNCTION__};                        \
+    _logRecord.setContext(context);                                            \
+    _logRecord.write(__VA_ARGS__);                                             \
+    BABYLON::Logger::Instance().log(_logRecord);                               \
   }
 
 #define BABYLON_LOGF_MSG(level, context, printf_like_message, ...)             \
   if (BABYLON::Logger::Instance().takes(level)) {                              \
-    std::ostringstream _ctx;                                                   \
-    _ctx << context;                                                           \
-    BABYLON::LogMessage _logMessage                                            \
-      = BABYLON::Logger::CreateMessage(level, _ctx.str(), __FILE__, __LINE__,  \
-                                       __FUNCTION__, __PRETTY_FUNCTION__);     \
-    _logMessage.writef(printf_like_message, __VA_ARGS__);                      \
-    BABYLON::Logger::Instance().log(std::move(_logMessage));                 \
+    BABYLON::LogRecord _logRecord{level, __FILE__, __LINE__, __FUNCTION__,     \
+                                  __PRETTY_FUNCTION__};                        \
+    _logRecord.setContext(context);                                            \
+    _logRecord.writef(printf_like_message, __VA_ARGS__);                       \
+    BABYLON::Logger::Instance().log(_logRecord);                               \
   }
 
+// -- Messages of a level above BABYLON_LOG_MAX_LEVEL are discarded at compile
+// time, their arguments are still checked but not evaluated --
+#define BABYLON_LOG_LEVEL_MSG(level, context, ...)                             \
+  if constexpr ((level) <= BABYLON_LOG_MAX_LEVEL)                              \
+  BABYLON_LOG_MSG(level, context, __VA_ARGS__)
+#define BABYLON_LOGF_LEVEL_MSG(level, context, printf_like_message, ...)       \
+  if constexpr ((level) <= BABYLON_LOG_MAX_LEVEL)                              \
+  BABYLON_LOGF_MSG(level, context, printf_like_message, __VA_ARGS__)
+
 // -- Default API syntax with variadic input parameters --
 #define BABYLON_LOG_ERROR(context, ...)                                        \
-  BABYLON_LOG_MSG(BABYLON::LogLevels::LEVEL_ERROR, context, __VA_ARGS__)
+  BABYLON_LOG_LEVEL_MSG(BABYLON::LogLevels::LEVEL_ERROR, context, __VA_ARGS__)
 #define BABYLON_LOG_WARN(context, ...)                                         \
-  BABYLON_LOG_MSG(BABYLON::LogLevels::LEVEL_WARN, context, __VA_ARGS__)
+  BABYLON_LOG_LEVEL_MSG(BABYLON::LogLevels::LEVEL_WARN, context, __VA_ARGS__)
 #define BABYLON_LOG_INFO(context, ...)                                         \
-  BABYLON_LOG_MSG(BABYLON::LogLevels::LEVEL_INFO, context, __VA_ARGS__)
+  BABYLON_LOG_LEVEL_MSG(BABYLON::LogLevels::LEVEL_INFO, context, __VA_ARGS__)
 #define BABYLON_LOG_DEBUG(context, ...)                                        \
-  BABYLON_LOG_MSG(BABYLON::LogLevels::LEVEL_DEBUG, context, __VA_ARGS__)
+  BABYLON_LOG_LEVEL_MSG(BABYLON::LogLevels::LEVEL_DEBUG, context, __VA_ARGS__)
 
 // -- printf-like API syntax with variadic input parameters --
 #define BABYLON_LOGF_ERROR(context, printf_like_message, ...)                  \
-  BABYLON_LOGF_MSG(BABYLON::LogLevels::LEVEL_ERROR, context,                   \
-                   printf_like_message, __VA_ARGS__)
+  BABYLON_LOGF_LEVEL_MSG(BABYLON::LogLevels::LEVEL_ERROR, context,             \
+                         printf_like_message, __VA_ARGS__)
 #define BABYLON_LOGF_WARN(context, printf_like_message, ...)                   \
-  BABYLON_LOGF_MSG(BABYLON::LogLevels::LEVEL_WARN, context,                    \
-                   printf_like_message, __VA_ARGS__)
+  BABYLON_LOGF_LEVEL_MSG(BABYLON::LogLevels::LEVEL_WARN, context,              \
+                         printf_like_message, __VA_ARGS__)
 #define BABYLON_LOGF_INFO(context, printf_like_message, ...)                   \
-  BABYLON_LOGF_MSG(BABYLON::LogLevels::LEVEL_INFO, context,                    \
-                   printf_like_message, __VA_ARGS__)
+  BABYLON_LOGF_LEVEL_MSG(BABYLON::LogLevels::LEVEL_INFO, context,              \
+                         printf_like_message, __VA_ARGS__)
 #define BABYLON_LOGF_DEBUG(context, printf_like_message, ...)                  \
-  BABYLON_LOGF_MSG(BABYLON::LogLevels::LEVEL_DEBUG, context,                   \
-                   printf_like_message, __VA_ARGS__)
+  BABYLON_LOGF_LEVEL_MSG(BABYLON::LogLevels::LEVEL_DEBUG, context,             \
+                         printf_like_message, __VA_ARGS__)
 
 // -- Conditional log printf syntax --
 #define BABYLON_LOG_IF_ERROR(context, boolean_expression, printf_like_message, \
                              ...)                                              \
                                                                                \
   if (true == boolean_expression)                                              \
-  BABYLON_LOGF_MSG(BABYLON::LogLevels::LEVEL_ERROR, context,                   \
-                   printf_like_message, __VA_ARGS__)
+  BABYLON_LOGF_ERROR(context, printf_like_message, __VA_ARGS__)
 #define BABYLON_LOG_IF_WARN(context, boolean_expression, printf_like_message,  \
                             ...)                                               \
   if (true == boolean_expression)                                              \
-  BABYLON_LOGF_MSG(BABYLON::LogLevels::LEVEL_WARN, context,                    \
-                   printf_like_message, __VA_ARGS__)
+  BABYLON_LOGF_WARN(context, printf_like_message, __VA_ARGS__)
 #define BABYLON_LOG_IF_INFO(context, boolean_expression, printf_like_message,  \
                             ...)                                               \
   if (true == boolean_expression)                                              \
-  BABYLON_LOGF_MSG(BABYLON::LogLevels::LEVEL_INFO, context,                    \
-                   printf_like_message, __VA_ARGS__)
+  BABYLON_LOGF_INFO(context, printf_like_message, __VA_ARGS__)
 #define BABYLON_LOG_IF_DEBUG(context, boolean_expression, printf_like_message, \
                              ...)                                              \
   if (true == boolean_expression)                                              \
-  BABYLON_LOGF_MSG(BABYLON::LogLevels::LEVEL_DEBUG, context,                   \
-                   printf_like_message, __VA_ARGS__)
+  BABYLON_LOGF_DEBUG(context, printf_like_message, __VA_ARGS__)
 
 #endif // end of BABYLON_CORE_LOGGING_LOGGER_H
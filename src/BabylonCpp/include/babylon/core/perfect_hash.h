@@ -0,0 +1,52 @@
+#ifndef BABYLON_CORE_PERFECT_HASH_H
+#define BABYLON_CORE_PERFECT_HASH_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace BABYLON {
+
+/**
+ * @brief Minimal perfect hash of a set of keys known at compile time.
+ *
+ * The keys are distributed in buckets with the seed 0, each bucket stores the
+ * seed which sends all of its keys to free slots, or -(slot + 1) when it holds
+ * a single key. The seeds are computed by the code generator
+ * (codegeneration/generate_shader_store.py), which uses the same hash.
+ */
+struct PerfectHash {
+
+  /**
+   * @brief Returns the seeded 32-bit FNV-1a hash of a key.
+   */
+  static constexpr uint32_t Hash(std::string_view key, uint32_t seed)
+  {
+    uint32_t hash = (seed == 0) ? 0x811c9dc5u : seed;
+    for (const char c : key) {
+      hash = (hash ^ static_cast<unsigned char>(c)) * 0x01000193u;
+    }
+    return hash;
+  }
+
+  /**
+   * @brief Returns the slot of a key in a table of N keys.
+   * @param key The key, the slot of an unknown key is arbitrary.
+   * @param seeds The seeds of the buckets.
+   * @returns the slot of the key.
+   */
+  template <size_t N>
+  static constexpr size_t Slot(std::string_view key,
+                               const std::array<int32_t, N>& seeds)
+  {
+    const auto seed = seeds[Hash(key, 0) % N];
+    return (seed < 0) ? static_cast<size_t>(-seed - 1) :
+                        Hash(key, static_cast<uint32_t>(seed)) % N;
+  }
+
+}; // end of struct PerfectHash
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_PERFECT_HASH_H
@@ -1,6 +1,7 @@
 #ifndef BABYLON_CORE_RANDOM_H
 #define BABYLON_CORE_RANDOM_H
 
+#include <cstdint>
 #include <limits>
 #include <random>
 #include <vector>
@@ -99,6 +100,76 @@ private:
   }
 };
 
+/**
+ * @brief Seedable stream of pseudo random numbers (PCG XSH RR).
+ *
+ * A stream only depends on its seed and sequence, two streams with the same
+ * seed and sequence produce the same numbers whatever the thread they are used
+ * on. Each stream has its own state, so different streams can be used
+ * concurrently without synchronization.
+ */
+class RandomStream {
+
+public:
+  RandomStream(std::uint64_t initialState = 0, std::uint64_t sequence = 0)
+  {
+    seed(initialState, sequence);
+  }
+
+  /**
+   * @brief Restarts the stream.
+   * @param initialState defines the starting state
+   * @param sequence defines the sequence, streams with different sequences are
+   * independent
+   */
+  void seed(std::uint64_t initialState, std::uint64_t sequence = 0)
+  {
+    _state     = 0;
+    _increment = (sequence << 1u) | 1u;
+    nextUInt32();
+    _state += initialState;
+    nextUInt32();
+  }
+
+  /**
+   * @brief Returns the next 32 bits random number.
+   */
+  std::uint32_t nextUInt32()
+  {
+    const std::uint64_t oldState = _state;
+    _state = oldState * 6364136223846793005ULL + _increment;
+    const auto xorShifted
+      = static_cast<std::uint32_t>(((oldState >> 18u) ^ oldState) >> 27u);
+    const auto rot = static_cast<std::uint32_t>(oldState >> 59u);
+    return (xorShifted >> rot) | (xorShifted << ((32u - rot) & 31u));
+  }
+
+  /**
+   * @brief Returns a random float number in [0, 1).
+   */
+  float random()
+  {
+    // 24 bits of mantissa
+    return static_cast<float>(nextUInt32() >> 8) * (1.f / 16777216.f);
+  }
+
+  /**
+   * @brief Returns a random float number between and min and max values.
+   */
+  float randomRange(float min, float max)
+  {
+    if (min == max) {
+      return min;
+    }
+    return (random() * (max - min)) + min;
+  }
+
+private:
+  std::uint64_t _state;
+  std::uint64_t _increment;
+
+}; // end of class RandomStream
+
 template <typename T, typename Gen>
 constexpr auto distribution(Gen& g, T min, T max)
 {
@@ -0,0 +1,174 @@
+#ifndef BABYLON_CORE_THREAD_POOL_H
+#define BABYLON_CORE_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Fixed set of worker threads running graphs of tasks and parallel
+ * loops.
+ *
+ * Each worker owns a queue of tasks, it runs the tasks it submitted last first
+ * and steals the oldest tasks of the other workers when its queue is empty.
+ * The tasks submitted from other threads go to a shared queue. A thread
+ * waiting for a task or a loop runs the queued tasks in the meantime, so that
+ * tasks can wait for other tasks and loops can be nested.
+ *
+ * A pool without worker threads runs the tasks on the thread waiting for them,
+ * in the order they were submitted, and the loops on the calling thread in the
+ * order of their indices. The results are then deterministic, e.g. for tests.
+ */
+class BABYLON_SHARED_EXPORT ThreadPool {
+
+public:
+  using Callback      = std::function<void(size_t index)>;
+  using RangeCallback = std::function<void(size_t begin, size_t end)>;
+  using TaskFunction  = std::function<void()>;
+
+  /**
+   * @brief Node of a task graph, it is queued once all its dependencies
+   * completed.
+   */
+  class BABYLON_SHARED_EXPORT Task {
+
+  public:
+    Task(TaskFunction function);
+    Task(const Task& other) = delete;
+    Task& operator=(const Task& other) = delete;
+    ~Task();
+
+    /**
+     * @brief Returns true if the function of the task returned.
+     */
+    bool isCompleted() const;
+
+  private:
+    friend class ThreadPool;
+    TaskFunction _function;
+    // Number of dependencies not completed, plus one while being submitted
+    std::atomic<size_t> _pendingDependencies;
+    std::atomic<bool> _completed;
+    std::mutex _mutex;
+    std::vector<std::shared_ptr<Task>> _continuations;
+
+  }; // end of class Task
+
+  using TaskPtr = std::shared_ptr<Task>;
+
+public:
+  /**
+   * @brief Creates a pool.
+   * @param workerCount defines the number of worker threads, the calling
+   * thread is not included
+   */
+  ThreadPool(size_t workerCount);
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+
+  /**
+   * @brief Destructor, waits for the submitted tasks.
+   */
+  ~ThreadPool();
+
+  /**
+   * @brief Returns the number of worker threads.
+   */
+  size_t workerCount() const;
+
+  /**
+   * @brief Submits a task, run once all its dependencies completed. The
+   * function must not throw.
+   * @param function defines the function of the task
+   * @param dependencies defines the tasks which must be completed first
+   * @returns the task, to wait for it or to depend on it
+   */
+  TaskPtr submit(TaskFunction function,
+                 const std::vector<TaskPtr>& dependencies = {});
+
+  /**
+   * @brief Submits a continuation, run once the given task completed.
+   */
+  TaskPtr then(const TaskPtr& task, TaskFunction continuation);
+
+  /**
+   * @brief Runs the queued tasks until the given task completed.
+   */
+  void wait(const TaskPtr& task);
+
+  /**
+   * @brief Runs the queued tasks until all the submitted tasks completed.
+   */
+  void waitAll();
+
+  /**
+   * @brief Calls the callback once for every index in [0, count), from the
+   * calling thread and the worker threads, and waits for all the calls to
+   * return. The callback must not throw.
+   * @param count defines the number of iterations
+   * @param callback defines the function to call with the iteration index
+   */
+  void parallelFor(size_t count, const Callback& callback);
+
+  /**
+   * @brief Calls the callback on consecutive sub-ranges of [begin, end) of
+   * at most grainSize indices, and waits for all the calls to return.
+   * @param begin defines the first index
+   * @param end defines the index after the last one
+   * @param grainSize defines the maximum number of indices of a sub-range
+   * @param callback defines the function to call with the sub-range
+   */
+  void parallelFor(size_t begin, size_t end, size_t grainSize,
+                   const RangeCallback& callback);
+
+private:
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<TaskPtr> tasks;
+  }; // end of struct TaskQueue
+
+  struct WorkerContext {
+    ThreadPool* pool;
+    size_t workerIndex;
+  }; // end of struct WorkerContext
+
+private:
+  void _run(size_t workerIndex);
+  void _schedule(const TaskPtr& task);
+  bool _popTask(TaskPtr& task);
+  bool _runTask();
+  void _complete(const TaskPtr& task);
+  void _sleep(const std::function<bool()>& wakeUp);
+
+private:
+  /**
+   * @brief Returns the pool and the index of the worker running on the calling
+   * thread.
+   */
+  static WorkerContext& _CurrentWorker();
+
+private:
+  std::vector<std::thread> _workers;
+  // One queue per worker, followed by the shared queue
+  std::vector<std::unique_ptr<TaskQueue>> _queues;
+  std::atomic<size_t> _queuedTasks;
+  std::atomic<size_t> _pendingTasks;
+  std::atomic<size_t> _sleepingThreads;
+  std::atomic<bool> _done;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+
+}; // end of class ThreadPool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_THREAD_POOL_H
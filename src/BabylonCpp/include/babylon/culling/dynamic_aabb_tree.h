@@ -0,0 +1,134 @@
+#ifndef BABYLON_CULLING_DYNAMIC_AABB_TREE_H
+#define BABYLON_CULLING_DYNAMIC_AABB_TREE_H
+
+#include <functional>
+
+#include <babylon/babylon_api.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+class Ray;
+
+/**
+ * @brief Dynamic bounding volume hierarchy of axis aligned bounding boxes.
+ *
+ * Every entry (proxy) is stored in a leaf with a fattened box, so small
+ * movements of an entry only require a containment check instead of a
+ * re-insertion. The tree is kept balanced with tree rotations on insertion and
+ * removal.
+ */
+template <class T>
+class BABYLON_SHARED_EXPORT DynamicAABBTree {
+
+public:
+  static constexpr int NullNode = -1;
+
+public:
+  /**
+   * @brief Creates a new, empty tree.
+   * @param margin the distance by which the leaf boxes are fattened
+   */
+  DynamicAABBTree(float margin = 0.1f);
+  ~DynamicAABBTree();
+
+  /**
+   * @brief Creates a proxy for the given bounds and user data.
+   * @returns the proxy id
+   */
+  int createProxy(const Vector3& minimum, const Vector3& maximum,
+                  const T& userData);
+
+  /**
+   * @brief Removes the proxy from the tree.
+   */
+  void destroyProxy(int proxyId);
+
+  /**
+   * @brief Updates the bounds of a proxy. The proxy is only re-inserted when
+   * the new bounds leave its fattened box.
+   * @returns true if the proxy was re-inserted
+   */
+  bool moveProxy(int proxyId, const Vector3& minimum, const Vector3& maximum);
+
+  /**
+   * @brief Returns the user data of a proxy.
+   */
+  const T& getUserData(int proxyId) const;
+
+  /**
+   * @brief Returns the fattened minimum of a proxy.
+   */
+  const Vector3& getFatMinimum(int proxyId) const;
+
+  /**
+   * @brief Returns the fattened maximum of a proxy.
+   */
+  const Vector3& getFatMaximum(int proxyId) const;
+
+  /**
+   * @brief Visits the proxies hit by the ray in front-to-back order of their
+   * entry distance.
+   * @param ray the ray in world space
+   * @param callback called with the user data and the entry distance of each
+   * proxy hit, returns the distance up to which the query should continue (a
+   * negative value terminates the query)
+   */
+  void raycast(const Ray& ray,
+               const std::function<float(const T& userData, float distance)>&
+                 callback) const;
+
+  /**
+   * @brief Removes all proxies.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of proxies in the tree.
+   */
+  size_t proxyCount() const;
+
+  /**
+   * @brief Returns the height of the tree.
+   */
+  int height() const;
+
+private:
+  struct TreeNode {
+    bool isLeaf() const
+    {
+      return child1 == NullNode;
+    }
+
+    Vector3 minimum;
+    Vector3 maximum;
+    T userData;
+    // Parent node, or next free node when the node is in the free list
+    int parent;
+    int child1;
+    int child2;
+    // Leaf = 0, free node = -1
+    int height;
+  }; // end of struct TreeNode
+
+  int _allocateNode();
+  void _freeNode(int nodeId);
+  void _insertLeaf(int leaf);
+  void _removeLeaf(int leaf);
+  int _balance(int iA);
+  void _refit(int index);
+
+  static float _SurfaceArea(const Vector3& minimum, const Vector3& maximum);
+
+private:
+  std::vector<TreeNode> _nodes;
+  int _root;
+  int _freeList;
+  size_t _proxyCount;
+  float _margin;
+
+}; // end of class DynamicAABBTree
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_DYNAMIC_AABB_TREE_H
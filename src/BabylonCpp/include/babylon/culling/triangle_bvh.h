@@ -0,0 +1,127 @@
+#ifndef BABYLON_CULLING_TRIANGLE_BVH_H
+#define BABYLON_CULLING_TRIANGLE_BVH_H
+
+#include <array>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+class IntersectionInfo;
+class Ray;
+
+/**
+ * @brief Bounding volume hierarchy over the triangles of an index range, used
+ * to accelerate ray picking on large meshes.
+ *
+ * The hierarchy is built with a binned surface area heuristic and stored as a
+ * flattened node array. The two children of an inner node are stored next to
+ * each other, so a node only needs to reference its first child.
+ */
+class BABYLON_SHARED_EXPORT TriangleBVH {
+
+public:
+  /**
+   * Minimum number of triangles for which building a hierarchy pays off
+   * compared to a linear scan of the triangles
+   */
+  static constexpr size_t MinTriangleCount = 64;
+
+  /**
+   * Maximum number of triangles stored in a leaf node
+   */
+  static constexpr size_t MaxLeafSize = 4;
+
+  /**
+   * Maximum depth of the hierarchy, bounds the traversal stack size
+   */
+  static constexpr size_t MaxDepth = 64;
+
+  /**
+   * Number of bins used to evaluate the split candidates per axis
+   */
+  static constexpr size_t BinCount = 12;
+
+  struct Node {
+    std::array<float, 3> min;
+    // Index of the first child for inner nodes, of the first triangle for
+    // leaves
+    uint32_t leftFirst;
+    std::array<float, 3> max;
+    // Number of triangles, zero for inner nodes
+    uint32_t count;
+  }; // end of struct Node
+
+  struct Triangle {
+    uint32_t i0, i1, i2;
+    // Index of the face in the mesh indices (index / 3)
+    uint32_t faceId;
+  }; // end of struct Triangle
+
+public:
+  /**
+   * @brief Builds the hierarchy over the triangles in [indexStart, indexStart +
+   * indexCount) of the given indices.
+   * @param positions vertex positions in local space
+   * @param indices the mesh indices
+   * @param indexStart index of the first index of the range
+   * @param indexCount number of indices in the range
+   */
+  TriangleBVH(const std::vector<Vector3>& positions,
+              const IndicesArray& indices, size_t indexStart,
+              size_t indexCount);
+  ~TriangleBVH();
+
+  /**
+   * @brief Returns the number of nodes in the hierarchy.
+   */
+  size_t nodeCount() const;
+
+  /**
+   * @brief Returns the number of triangles referenced by the hierarchy.
+   */
+  size_t triangleCount() const;
+
+  /**
+   * @brief Intersects the ray with the triangles of the hierarchy.
+   * @param ray the ray in the local space of the positions
+   * @param positions the positions used to build the hierarchy
+   * @param fastCheck if true, returns the first intersection found instead of
+   * the closest one
+   * @returns the intersection info, or nullopt if the ray misses
+   */
+  std::optional<IntersectionInfo>
+  intersects(Ray& ray, const std::vector<Vector3>& positions,
+             bool fastCheck) const;
+
+private:
+  struct Bin {
+    Bin();
+    void grow(const float* bounds);
+    void grow(const Bin& other);
+    float area() const;
+
+    std::array<float, 3> min;
+    std::array<float, 3> max;
+    size_t count;
+  }; // end of struct Bin
+
+  static float _SurfaceArea(const std::array<float, 3>& min,
+                            const std::array<float, 3>& max);
+  void _build(const std::vector<Vector3>& positions);
+  void _updateNodeBounds(Node& node, const std::vector<float>& bounds) const;
+  float _findBestSplit(const Node& node, const std::vector<float>& centroids,
+                       const std::vector<float>& bounds, unsigned int& axis,
+                       float& splitPosition) const;
+
+private:
+  std::vector<Node> _nodes;
+  std::vector<Triangle> _triangles;
+
+}; // end of class TriangleBVH
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_TRIANGLE_BVH_H
@@ -51,6 +51,7 @@ using RenderTargetCreationOptions = IRenderTargetOptions;
 class RenderTargetTexture;
 class Scene;
 class Texture;
+class ThreadPool;
 class UniformBuffer;
 class VertexBuffer;
 using BaseTexturePtr = std::shared_ptr<BaseTexture>;
@@ -199,6 +200,13 @@ public:
    */
   PerformanceMonitor* performanceMonitor() const;
 
+  /**
+   * @brief Gets the thread pool of the engine, used by the scenes to spread
+   * their work over worker threads. It is created on first use with
+   * EngineOptions::threadPoolWorkerCount workers.
+   */
+  ThreadPool* threadPool();
+
   /**
    * @brief Returns true if the stencil buffer has been enabled through the
    * creation option of the context.
@@ -702,6 +710,21 @@ public:
    */
   GLBufferPtr createDynamicVertexBuffer(const Float32Array& vertices);
 
+  /**
+   * @brief Creates a vertex buffer from raw bytes, e.g. interleaved or
+   * quantized vertex data.
+   * @param data the raw data for the vertex buffer
+   * @returns the new WebGL static buffer
+   */
+  GLBufferPtr createVertexBuffer(const ArrayBuffer& data);
+
+  /**
+   * @brief Creates a dynamic vertex buffer from raw bytes.
+   * @param data the raw data for the dynamic vertex buffer
+   * @returns the new WebGL dynamic buffer
+   */
+  GLBufferPtr createDynamicVertexBuffer(const ArrayBuffer& data);
+
   /**
    * @brief Update a dynamic index buffer.
    * @param indexBuffer defines the target index buffer
@@ -723,6 +746,16 @@ public:
                                  const Float32Array& vertices,
                                  int byteOffset = -1, int byteLength = -1);
 
+  /**
+   * @brief Updates a dynamic vertex buffer with raw bytes.
+   * @param vertexBuffer the vertex buffer to update
+   * @param data the raw data used to update the vertex buffer
+   * @param byteOffset the byte offset in the vertex buffer where the update
+   * starts
+   */
+  void updateDynamicVertexBuffer(const GLBufferPtr& vertexBuffer,
+                                 const ArrayBuffer& data, int byteOffset = 0);
+
   /**
    * @brief Creates a new index buffer.
    * @param indices defines the content of the index buffer
@@ -2665,6 +2698,10 @@ private:
   float _fps;
   float _deltaTime;
 
+  // Tasks
+  int _threadPoolWorkerCount;
+  std::unique_ptr<ThreadPool> _threadPool;
+
   /**
    * Hidden
    */
@@ -61,6 +61,12 @@ struct BABYLON_SHARED_EXPORT EngineOptions {
    * option on or not.
    */
   bool premultipliedAlpha = true;
+  /**
+   * Defines the number of worker threads of the engine thread pool. A negative
+   * value creates one worker per hardware thread besides the rendering thread,
+   * 0 runs the tasks on the rendering thread in a deterministic order
+   */
+  int threadPoolWorkerCount = -1;
 }; // end of struct EngineOptions
 
 } // end of namespace BABYLON
@@ -0,0 +1,43 @@
+#ifndef BABYLON_ENGINE_NULL_CANVAS_H
+#define BABYLON_ENGINE_NULL_CANVAS_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/interfaces/icanvas.h>
+
+namespace BABYLON {
+
+namespace GL {
+class NullGLRenderingContext;
+} // end of namespace GL
+
+/**
+ * @brief Canvas without a window, rendering with a NullGLRenderingContext.
+ *
+ * It lets an engine run the full render loop on machines without a GPU, e.g.
+ * to profile the CPU side of the rendering.
+ */
+class BABYLON_SHARED_EXPORT NullCanvas : public ICanvas {
+
+public:
+  /**
+   * @brief Creates a canvas of the given size.
+   */
+  NullCanvas(int width = 1024, int height = 768);
+  ~NullCanvas() override;
+
+  ClientRect& getBoundingClientRect() override;
+  bool onlyRenderBoundingClientRect() const override;
+  bool initializeContext3d() override;
+  ICanvasRenderingContext2D* getContext2d() override;
+  GL::IGLRenderingContext* getContext3d(const EngineOptions& options) override;
+
+  /**
+   * @brief Returns the rendering context counting and recording the calls.
+   */
+  GL::NullGLRenderingContext* renderingContext();
+
+}; // end of class NullCanvas
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINE_NULL_CANVAS_H
@@ -0,0 +1,556 @@
+#ifndef BABYLON_ENGINE_NULL_GL_RENDERING_CONTEXT_H
+#define BABYLON_ENGINE_NULL_GL_RENDERING_CONTEXT_H
+
+#include <array>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <babylon/babylon_api.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+
+namespace BABYLON {
+namespace GL {
+
+/**
+ * @brief Calls of the rendering context, one per method of
+ * IGLRenderingContext.
+ */
+enum class GLCall : uint8_t {
+  INITIALIZE,
+  BACKUP_GL_STATE,
+  RESTORE_GL_STATE,
+  ACTIVE_TEXTURE,
+  ATTACH_SHADER,
+  BEGIN_QUERY,
+  BEGIN_TRANSFORM_FEEDBACK,
+  BIND_ATTRIB_LOCATION,
+  BIND_BUFFER,
+  BIND_FRAMEBUFFER,
+  BIND_BUFFER_BASE,
+  BIND_RENDERBUFFER,
+  BIND_TEXTURE,
+  BIND_TRANSFORM_FEEDBACK,
+  BLEND_COLOR,
+  BLEND_EQUATION,
+  BLEND_EQUATION_SEPARATE,
+  BLEND_FUNC,
+  BLEND_FUNC_SEPARATE,
+  BLIT_FRAMEBUFFER,
+  BUFFER_DATA,
+  BUFFER_SUB_DATA,
+  BIND_VERTEX_ARRAY,
+  CHECK_FRAMEBUFFER_STATUS,
+  CLEAR,
+  CLEAR_BUFFERFV,
+  CLEAR_BUFFERIV,
+  CLEAR_BUFFERUIV,
+  CLEAR_BUFFERFI,
+  CLEAR_COLOR,
+  CLEAR_DEPTH,
+  CLEAR_STENCIL,
+  COLOR_MASK,
+  COMPILE_SHADER,
+  COMPRESSED_TEX_IMAGE2D,
+  COMPRESSED_TEX_SUB_IMAGE2D,
+  COPY_TEX_IMAGE2D,
+  COPY_TEX_SUB_IMAGE2D,
+  CREATE_BUFFER,
+  CREATE_FRAMEBUFFER,
+  CREATE_PROGRAM,
+  CREATE_QUERY,
+  CREATE_RENDERBUFFER,
+  CREATE_SHADER,
+  CREATE_TEXTURE,
+  CREATE_TRANSFORM_FEEDBACK,
+  CREATE_VERTEX_ARRAY,
+  CULL_FACE,
+  DELETE_BUFFER,
+  DELETE_FRAMEBUFFER,
+  DELETE_PROGRAM,
+  DELETE_QUERY,
+  DELETE_RENDERBUFFER,
+  DELETE_SHADER,
+  DELETE_TEXTURE,
+  DELETE_TRANSFORM_FEEDBACK,
+  DELETE_VERTEX_ARRAY,
+  DEPTH_FUNC,
+  DEPTH_MASK,
+  DEPTH_RANGE,
+  DETACH_SHADER,
+  DISABLE,
+  DISABLE_VERTEX_ATTRIB_ARRAY,
+  DRAW_ARRAYS,
+  DRAW_ARRAYS_INSTANCED,
+  DRAW_BUFFERS,
+  DRAW_ELEMENTS,
+  DRAW_ELEMENTS_INSTANCED,
+  ENABLE,
+  ENABLE_VERTEX_ATTRIB_ARRAY,
+  END_QUERY,
+  END_TRANSFORM_FEEDBACK,
+  FINISH,
+  FLUSH,
+  FRAMEBUFFER_RENDERBUFFER,
+  FRAMEBUFFER_TEXTURE2D,
+  FRONT_FACE,
+  GENERATE_MIPMAP,
+  GET_ATTACHED_SHADERS,
+  GET_ATTRIB_LOCATION,
+  HAS_EXTENSION,
+  GET_SCISSOR_BOX_PARAMETER,
+  GET_PARAMETERI,
+  GET_PARAMETERF,
+  GET_QUERY_PARAMETERB,
+  GET_QUERY_PARAMETERI,
+  GET_STRING,
+  GET_TEX_PARAMETERI,
+  GET_TEX_PARAMETERF,
+  GET_ERROR,
+  GET_ERROR_STRING,
+  GET_PROGRAM_PARAMETER,
+  GET_PROGRAM_INFO_LOG,
+  GET_RENDERBUFFER_PARAMETER,
+  GET_SHADER_INFO_LOG,
+  GET_SHADER_PARAMETER,
+  GET_SHADER_PRECISION_FORMAT,
+  GET_SHADER_SOURCE,
+  GET_UNIFORM_BLOCK_INDEX,
+  GET_UNIFORM_LOCATION,
+  HINT,
+  IS_BUFFER,
+  IS_ENABLED,
+  IS_FRAMEBUFFER,
+  IS_PROGRAM,
+  IS_RENDERBUFFER,
+  IS_SHADER,
+  IS_TEXTURE,
+  LINE_WIDTH,
+  LINK_PROGRAM,
+  PIXEL_STOREI,
+  POLYGON_OFFSET,
+  READ_BUFFER,
+  READ_PIXELS,
+  RENDERBUFFER_STORAGE,
+  RENDERBUFFER_STORAGE_MULTISAMPLE,
+  SAMPLE_COVERAGE,
+  SCISSOR,
+  SHADER_SOURCE,
+  STENCIL_FUNC,
+  STENCIL_FUNC_SEPARATE,
+  STENCIL_MASK,
+  STENCIL_MASK_SEPARATE,
+  STENCIL_OP,
+  STENCIL_OP_SEPARATE,
+  TEX_IMAGE2D,
+  TEX_IMAGE3D,
+  TEX_PARAMETERF,
+  TEX_PARAMETERI,
+  TEX_SUB_IMAGE2D,
+  TRANSFORM_FEEDBACK_VARYINGS,
+  UNIFORM1F,
+  UNIFORM1FV,
+  UNIFORM1I,
+  UNIFORM1IV,
+  UNIFORM2F,
+  UNIFORM2FV,
+  UNIFORM2I,
+  UNIFORM2IV,
+  UNIFORM3F,
+  UNIFORM3FV,
+  UNIFORM3I,
+  UNIFORM3IV,
+  UNIFORM4F,
+  UNIFORM4FV,
+  UNIFORM4I,
+  UNIFORM4IV,
+  UNIFORM_BLOCK_BINDING,
+  UNIFORM_MATRIX2FV,
+  UNIFORM_MATRIX3FV,
+  UNIFORM_MATRIX4FV,
+  USE_PROGRAM,
+  VALIDATE_PROGRAM,
+  VERTEX_ATTRIB1F,
+  VERTEX_ATTRIB1FV,
+  VERTEX_ATTRIB2F,
+  VERTEX_ATTRIB2FV,
+  VERTEX_ATTRIB3F,
+  VERTEX_ATTRIB3FV,
+  VERTEX_ATTRIB4F,
+  VERTEX_ATTRIB4FV,
+  VERTEX_ATTRIB_DIVISOR,
+  VERTEX_ATTRIB_POINTER,
+  VIEWPORT,
+  COUNT
+}; // end of enum class GLCall
+
+/**
+ * @brief Compact record of a rendering context call.
+ *
+ * The arguments are the first integer arguments of the call, e.g. the target
+ * and the handle of a binding, or the size of the uploaded data.
+ */
+struct BABYLON_SHARED_EXPORT GLCommand {
+  GLCall call;
+  GLuint arg0;
+  GLuint arg1;
+}; // end of struct GLCommand
+
+/**
+ * @brief Rendering context which does not render anything.
+ *
+ * It implements the full rendering context interface without a GPU: objects
+ * get synthetic handles, shaders always compile and link, and the calls are
+ * counted and optionally recorded. It is used to measure the CPU cost of the
+ * render loop and the effectiveness of the engine state caches, and to
+ * compare the calls issued by different versions of a scene.
+ */
+class BABYLON_SHARED_EXPORT NullGLRenderingContext
+    : public IGLRenderingContext {
+
+public:
+  /**
+   * @brief Creates a rendering context with a drawing buffer of the given
+   * size.
+   */
+  NullGLRenderingContext(int width = 1024, int height = 768);
+  ~NullGLRenderingContext() override;
+
+  /**
+   * @brief Returns the name of a call, i.e. the name of the method.
+   */
+  static const char* CallName(GLCall call);
+
+  /**
+   * @brief Returns the recorded calls, when recordCommands is enabled.
+   */
+  const std::vector<GLCommand>& commands() const;
+
+  /**
+   * @brief Returns the number of times a method has been called.
+   */
+  size_t callCount(GLCall call) const;
+
+  /**
+   * @brief Returns the number of calls of all the methods.
+   */
+  size_t totalCallCount() const;
+
+  /**
+   * @brief Returns the number of draw calls, instanced or not.
+   */
+  size_t drawCallCount() const;
+
+  /**
+   * @brief Clears the recorded calls and the call counters.
+   */
+  void reset();
+
+  /**
+   * @brief Returns the number of calls of each called method, one
+   * "name count" line per method in a stable order so that two runs can be
+   * compared.
+   */
+  std::string countersToString() const;
+
+  bool initialize(bool enableGLDebugging = false) override;
+  void backupGLState() override;
+  void restoreGLState() override;
+  GLenum operator[](const std::string& name) override;
+  void activeTexture(GLenum texture) override;
+  void attachShader(const std::unique_ptr<IGLProgram>& program,
+                    const std::unique_ptr<IGLShader>& shader) override;
+  void beginQuery(GLenum target,
+                  const std::unique_ptr<IGLQuery>& query) override;
+  void beginTransformFeedback(GLenum primitiveMode) override;
+  void bindAttribLocation(IGLProgram* program, GLuint index,
+                          const std::string& name) override;
+  void bindBuffer(GLenum target, IGLBuffer* buffer) override;
+  void bindFramebuffer(GLenum target, IGLFramebuffer* framebuffer) override;
+  void bindBufferBase(GLenum target, GLuint index, IGLBuffer* buffer) override;
+  void bindRenderbuffer(
+    GLenum target,
+    const std::unique_ptr<IGLRenderbuffer>& renderbuffer) override;
+  void bindTexture(GLenum target, IGLTexture* texture) override;
+  void bindTransformFeedback(GLenum target,
+                             IGLTransformFeedback* transformFeedback) override;
+  void blendColor(GLclampf red, GLclampf green, GLclampf blue,
+                  GLclampf alpha) override;
+  void blendEquation(GLenum mode) override;
+  void blendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) override;
+  void blendFunc(GLenum sfactor, GLenum dfactor) override;
+  void blendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha,
+                         GLenum dstAlpha) override;
+  void blitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1,
+                       GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1,
+                       GLbitfield mask, GLenum filter) override;
+  void bufferData(GLenum target, GLsizeiptr size, GLenum usage) override;
+  void bufferData(GLenum target, const Float32Array& data,
+                  GLenum usage) override;
+  void bufferData(GLenum target, const Int32Array& data, GLenum usage) override;
+  void bufferData(GLenum target, const Uint16Array& data,
+                  GLenum usage) override;
+  void bufferData(GLenum target, const Uint32Array& data,
+                  GLenum usage) override;
+  void bufferData(GLenum target, const ArrayBuffer& data,
+                  GLenum usage) override;
+  void bufferSubData(GLenum target, GLintptr offset,
+                     const Float32Array& data) override;
+  void bufferSubData(GLenum target, GLintptr offset, Int32Array& data) override;
+  void bufferSubData(GLenum target, GLintptr offset,
+                     const ArrayBuffer& data) override;
+  void bindVertexArray(GL::IGLVertexArrayObject* vao) override;
+  GLenum checkFramebufferStatus(GLenum target) override;
+  void clear(GLbitfield mask) override;
+  void clearBufferfv(GLenum buffer, GLint drawbuffer,
+                     const std::vector<GLfloat>& values,
+                     GLint srcOffset = 0) override;
+  void clearBufferiv(GLenum buffer, GLint drawbuffer,
+                     const std::vector<GLint>& values,
+                     GLint srcOffset = 0) override;
+  void clearBufferuiv(GLenum buffer, GLint drawbuffer,
+                      const std::vector<GLuint>& values,
+                      GLint srcOffset = 0) override;
+  void clearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth,
+                     GLint stencil) override;
+  void clearColor(GLclampf red, GLclampf green, GLclampf blue,
+                  GLclampf alpha) override;
+  void clearDepth(GLclampf depth) override;
+  void clearStencil(GLint stencil) override;
+  void colorMask(GLboolean red, GLboolean green, GLboolean blue,
+                 GLboolean alpha) override;
+  void compileShader(const std::unique_ptr<IGLShader>& shader) override;
+  void compressedTexImage2D(GLenum target, GLint level, GLenum internalformat,
+                            GLsizei width, GLsizei height, GLint border,
+                            const Uint8Array& pixels) override;
+  void compressedTexSubImage2D(GLenum target, GLint level, GLint xoffset,
+                               GLint yoffset, GLsizei width, GLsizei height,
+                               GLenum format, GLsizeiptr size) override;
+  void copyTexImage2D(GLenum target, GLint level, GLenum internalformat,
+                      GLint x, GLint y, GLsizei width, GLsizei height,
+                      GLint border) override;
+  void copyTexSubImage2D(GLenum target, GLint level, GLint xoffset,
+                         GLint yoffset, GLint x, GLint y, GLint width,
+                         GLint height) override;
+  std::unique_ptr<IGLBuffer> createBuffer() override;
+  std::unique_ptr<IGLFramebuffer> createFramebuffer() override;
+  std::unique_ptr<IGLProgram> createProgram() override;
+  std::unique_ptr<IGLQuery> createQuery() override;
+  std::unique_ptr<IGLRenderbuffer> createRenderbuffer() override;
+  std::unique_ptr<IGLShader> createShader(GLenum type) override;
+  std::unique_ptr<IGLTexture> createTexture() override;
+  std::unique_ptr<IGLTransformFeedback> createTransformFeedback() override;
+  std::unique_ptr<IGLVertexArrayObject> createVertexArray() override;
+  void cullFace(GLenum mode) override;
+  void deleteBuffer(IGLBuffer* buffer) override;
+  void deleteFramebuffer(IGLFramebuffer* framebuffer) override;
+  void deleteProgram(IGLProgram* program) override;
+  void deleteQuery(const std::unique_ptr<IGLQuery>& query) override;
+  void deleteRenderbuffer(IGLRenderbuffer* renderbuffer) override;
+  void deleteShader(const std::unique_ptr<IGLShader>& shader) override;
+  void deleteTexture(IGLTexture* texture) override;
+  void
+  deleteTransformFeedback(IGLTransformFeedback* transformFeedback) override;
+  void deleteVertexArray(IGLVertexArrayObject* vao) override;
+  void depthFunc(GLenum func) override;
+  void depthMask(GLboolean flag) override;
+  void depthRange(GLclampf zNear, GLclampf zFar) override;
+  void detachShader(IGLProgram* program, IGLShader* shader) override;
+  void disable(GLenum cap) override;
+  void disableVertexAttribArray(GLuint index) override;
+  void drawArrays(GLenum mode, GLint first, GLint count) override;
+  void drawArraysInstanced(GLenum mode, GLint first, GLsizei count,
+                           GLsizei instanceCount) override;
+  void drawBuffers(const std::vector<GLenum>& buffers) override;
+  void drawElements(GLenum mode, GLsizei count, GLenum type,
+                    GLintptr offset) override;
+  void drawElementsInstanced(GLenum mode, GLsizei count, GLenum type,
+                             GLintptr offset, GLsizei instanceCount) override;
+  void enable(GLenum cap) override;
+  void enableVertexAttribArray(GLuint index) override;
+  void endQuery(GLenum target) override;
+  void endTransformFeedback() override;
+  void finish() override;
+  void flush() override;
+  void framebufferRenderbuffer(
+    GLenum target, GLenum attachment, GLenum renderbuffertarget,
+    const std::unique_ptr<IGLRenderbuffer>& renderbuffer) override;
+  void framebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget,
+                            IGLTexture* texture, GLint level) override;
+  void frontFace(GLenum mode) override;
+  void generateMipmap(GLenum target) override;
+  std::vector<IGLShader*> getAttachedShaders(IGLProgram* program) override;
+  GLint getAttribLocation(IGLProgram* program,
+                          const std::string& name) override;
+  GLboolean hasExtension(const std::string& extension) override;
+  std::array<int, 4> getScissorBoxParameter() override;
+  GLint getParameteri(GLenum pname) override;
+  GLfloat getParameterf(GLenum pname) override;
+  GLboolean getQueryParameterb(const std::unique_ptr<IGLQuery>& query,
+                               GLenum pname) override;
+  GLuint getQueryParameteri(const std::unique_ptr<IGLQuery>& query,
+                            GLenum pname) override;
+  std::string getString(GLenum pname) override;
+  GLint getTexParameteri(GLenum pname) override;
+  GLfloat getTexParameterf(GLenum pname) override;
+  GLenum getError() override;
+  const char* getErrorString(GLenum err) override;
+  GLint getProgramParameter(IGLProgram* program, GLenum pname) override;
+  std::string
+  getProgramInfoLog(const std::unique_ptr<IGLProgram>& program) override;
+  any getRenderbufferParameter(GLenum target, GLenum pname) override;
+  std::string
+  getShaderInfoLog(const std::unique_ptr<IGLShader>& shader) override;
+  GLint getShaderParameter(const std::unique_ptr<IGLShader>& shader,
+                           GLenum pname) override;
+  IGLShaderPrecisionFormat*
+  getShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype) override;
+  std::string getShaderSource(IGLShader* shader) override;
+  GLuint getUniformBlockIndex(IGLProgram* program,
+                              const std::string& uniformBlockName) override;
+  std::unique_ptr<IGLUniformLocation>
+  getUniformLocation(IGLProgram* program, const std::string& name) override;
+  void hint(GLenum target, GLenum mode) override;
+  GLboolean isBuffer(IGLBuffer* buffer) override;
+  GLboolean isEnabled(GLenum cap) override;
+  GLboolean isFramebuffer(IGLFramebuffer* framebuffer) override;
+  GLboolean isProgram(const std::unique_ptr<IGLProgram>& program) override;
+  GLboolean isRenderbuffer(IGLRenderbuffer* renderbuffer) override;
+  GLboolean isShader(IGLShader* shader) override;
+  GLboolean isTexture(IGLTexture* texture) override;
+  void lineWidth(GLfloat width) override;
+  bool linkProgram(const std::unique_ptr<IGLProgram>& program) override;
+  void pixelStorei(GLenum pname, GLint param) override;
+  void polygonOffset(GLfloat factor, GLfloat units) override;
+  void readBuffer(GLenum src) override;
+  void readPixels(GLint x, GLint y, GLsizei width, GLsizei height,
+                  GLenum format, GLenum type, Float32Array& pixels) override;
+  void readPixels(GLint x, GLint y, GLsizei width, GLsizei height,
+                  GLenum format, GLenum type, Uint8Array& pixels) override;
+  void renderbufferStorage(GLenum target, GLenum internalformat, GLsizei width,
+                           GLsizei height) override;
+  void renderbufferStorageMultisample(GLenum target, GLsizei samples,
+                                      GLenum internalFormat, GLsizei width,
+                                      GLsizei height) override;
+  void sampleCoverage(GLclampf value, GLboolean invert) override;
+  void scissor(GLint x, GLint y, GLsizei width, GLsizei height) override;
+  void shaderSource(const std::unique_ptr<IGLShader>& shader,
+                    const std::string& source) override;
+  void stencilFunc(GLenum func, GLint ref, GLuint mask) override;
+  void stencilFuncSeparate(GLenum face, GLenum func, GLint ref,
+                           GLuint mask) override;
+  void stencilMask(GLuint mask) override;
+  void stencilMaskSeparate(GLenum face, GLuint mask) override;
+  void stencilOp(GLenum fail, GLenum zfail, GLenum zpass) override;
+  void stencilOpSeparate(GLenum face, GLenum fail, GLenum zfail,
+                         GLenum zpass) override;
+  void texImage2D(GLenum target, GLint level, GLint internalformat,
+                  GLsizei width, GLsizei height, GLint border, GLenum format,
+                  GLenum type, const Uint8Array& pixels) override;
+  void texImage2D(GLenum target, GLint level, GLenum internalformat,
+                  GLenum format, GLenum type, ICanvas* pixels) override;
+  void texImage2D(GLenum target, GLint level, GLenum internalformat,
+                  GLsizei width, GLsizei height, GLsizei border, GLenum format,
+                  GLenum type, ICanvas* pixels) override;
+  void texImage3D(GLenum target, GLint level, GLint internalformat,
+                  GLsizei width, GLsizei height, GLsizei depth, GLint border,
+                  GLenum format, GLenum type,
+                  const Uint8Array& pixels) override;
+  void texParameterf(GLenum target, GLenum pname, GLfloat param) override;
+  void texParameteri(GLenum target, GLenum pname, GLint param) override;
+  void texSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset,
+                     GLsizei width, GLsizei height, GLenum format, GLenum type,
+                     any pixels) override;
+  void transformFeedbackVaryings(IGLProgram* program,
+                                 const std::vector<std::string>& varyings,
+                                 GLenum bufferMode) override;
+  void uniform1f(IGLUniformLocation* location, GLfloat v0) override;
+  void uniform1fv(GL::IGLUniformLocation* location,
+                  const Float32Array& array) override;
+  void uniform1i(IGLUniformLocation* location, GLint v0) override;
+  void uniform1iv(IGLUniformLocation* location, const Int32Array& v) override;
+  void uniform2f(IGLUniformLocation* location, GLfloat v0, GLfloat v1) override;
+  void uniform2fv(IGLUniformLocation* location, const Float32Array& v) override;
+  void uniform2i(IGLUniformLocation* location, GLint v0, GLint v1) override;
+  void uniform2iv(IGLUniformLocation* location, const Int32Array& v) override;
+  void uniform3f(IGLUniformLocation* location, GLfloat v0, GLfloat v1,
+                 GLfloat v2) override;
+  void uniform3fv(IGLUniformLocation* location, const Float32Array& v) override;
+  void uniform3i(IGLUniformLocation* location, GLint v0, GLint v1,
+                 GLint v2) override;
+  void uniform3iv(IGLUniformLocation* location, const Int32Array& v) override;
+  void uniform4f(IGLUniformLocation* location, GLfloat v0, GLfloat v1,
+                 GLfloat v2, GLfloat v3) override;
+  void uniform4fv(IGLUniformLocation* location, const Float32Array& v) override;
+  void uniform4i(IGLUniformLocation* location, GLint v0, GLint v1, GLint v2,
+                 GLint v3) override;
+  void uniform4iv(IGLUniformLocation* location, const Int32Array& v) override;
+  void uniformBlockBinding(IGLProgram* program, GLuint uniformBlockIndex,
+                           GLuint uniformBlockBinding) override;
+  void uniformMatrix2fv(IGLUniformLocation* location, GLboolean transpose,
+                        const Float32Array& value) override;
+  void uniformMatrix3fv(IGLUniformLocation* location, GLboolean transpose,
+                        const Float32Array& value) override;
+  void uniformMatrix4fv(IGLUniformLocation* location, GLboolean transpose,
+                        const Float32Array& value) override;
+  void uniformMatrix4fv(IGLUniformLocation* location, GLboolean transpose,
+                        const std::array<float, 16>& value) override;
+  void useProgram(IGLProgram* program) override;
+  void validateProgram(IGLProgram* program) override;
+  void vertexAttrib1f(GLuint index, GLfloat v0) override;
+  void vertexAttrib1fv(GLuint indx, Float32Array& values) override;
+  void vertexAttrib2f(GLuint index, GLfloat v0, GLfloat v1) override;
+  void vertexAttrib2fv(GLuint index, Float32Array& values) override;
+  void vertexAttrib3f(GLuint index, GLfloat v0, GLfloat v1,
+                      GLfloat v2) override;
+  void vertexAttrib3fv(GLuint index, Float32Array& values) override;
+  void vertexAttrib4f(GLuint index, GLfloat v0, GLfloat v1, GLfloat v2,
+                      GLfloat v3) override;
+  void vertexAttrib4fv(GLuint index, Float32Array& values) override;
+  void vertexAttribDivisor(GLuint index, GLuint divisor) override;
+  void vertexAttribPointer(GLuint index, GLint size, GLenum type,
+                           GLboolean normalized, GLint stride,
+                           GLintptr offset) override;
+  void viewport(GLint x, GLint y, GLsizei width, GLsizei height) override;
+
+public:
+  /**
+   * Whether the calls are recorded in addition to being counted
+   */
+  bool recordCommands;
+
+private:
+  void _record(GLCall call, GLuint arg0 = 0, GLuint arg1 = 0);
+  GLuint _createHandle();
+
+  template <typename T>
+  static GLuint _handle(const T* object)
+  {
+    return object ? static_cast<GLuint>(object->value) : 0;
+  }
+
+  template <typename T>
+  static GLuint _byteSize(const T& array)
+  {
+    return static_cast<GLuint>(array.size() * sizeof(typename T::value_type));
+  }
+
+private:
+  std::vector<GLCommand> _commands;
+  std::array<size_t, static_cast<size_t>(GLCall::COUNT)> _callCounts;
+  GLuint _lastHandle;
+  std::unordered_map<GLenum, GLint> _parameters;
+  std::unordered_set<GLenum> _enabledCaps;
+  std::array<int, 4> _scissorBox;
+  // Attribute locations per program handle
+  std::unordered_map<GLuint, std::unordered_map<std::string, GLint>>
+    _attribLocations;
+  std::unordered_map<GLuint, std::vector<IGLShader*>> _attachedShaders;
+  std::unordered_map<GLuint, std::string> _shaderSources;
+  IGLShaderPrecisionFormat _shaderPrecisionFormat;
+
+}; // end of class NullGLRenderingContext
+
+} // end of namespace GL
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINE_NULL_GL_RENDERING_CONTEXT_H
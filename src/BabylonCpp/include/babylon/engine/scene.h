@@ -7,6 +7,7 @@
 #include <babylon/babylon_api.h>
 #include <babylon/core/structs.h>
 #include <babylon/core/variant.h>
+#include <babylon/culling/dynamic_aabb_tree.h>
 #include <babylon/culling/octrees/octree.h>
 #include <babylon/engine/abstract_scene.h>
 #include <babylon/engine/stage.h>
@@ -63,6 +64,7 @@ class RuntimeAnimation;
 class SimplificationQueue;
 class SoundTrack;
 class SpriteManager;
+class ThreadPool;
 class UniformBuffer;
 using AnimatablePtr             = std::shared_ptr<Animatable>;
 using BoundingBoxRendererPtr    = std::shared_ptr<BoundingBoxRenderer>;
@@ -1244,6 +1246,23 @@ public:
   Octree<AbstractMesh*>* createOrUpdateSelectionOctree(size_t maxCapacity = 64,
                                                        size_t maxDepth    = 2);
 
+  /**
+   * @brief Creates or updates the dynamic bounding box tree used to boost
+   * picking. Once created, the tree is refit incrementally with the world
+   * bounding boxes of the meshes whose world matrix changed, and pick queries
+   * visit the meshes front-to-back instead of testing every mesh.
+   * @param margin defines the distance by which the mesh bounding boxes are
+   * fattened in the tree, larger values reduce the refit cost of moving meshes
+   * @returns the picking tree
+   */
+  DynamicAABBTree<AbstractMesh*>* createOrUpdatePickingTree(float margin
+                                                            = 0.1f);
+
+  /**
+   * @brief Hidden
+   */
+  void _markMeshAsDirtyForPickingTree(AbstractMesh* mesh);
+
   /** Picking **/
 
   /**
@@ -1648,6 +1667,7 @@ private:
   void _evaluateSubMesh(const SubMeshPtr& subMesh, AbstractMesh* mesh);
   void _evaluateActiveMeshes();
   void _activeMesh(const AbstractMeshPtr& sourceMesh, AbstractMesh* mesh);
+  void _animateParticleSystems();
   void _renderForCamera(const CameraPtr& camera,
                         const CameraPtr& rigParent = nullptr);
   void _processSubCameras(const CameraPtr& camera);
@@ -1665,6 +1685,7 @@ private:
   void _switchAudioModeForHeadphones();
   void _switchAudioModeForNormalSpeakers();
   /** Picking **/
+  void _updatePickingTree();
   std::optional<PickingInfo> _internalPick(
     const std::function<Ray(Matrix& world)>& rayFunction,
     const std::function<bool(const AbstractMeshPtr& mesh)>& predicate,
@@ -1889,6 +1910,26 @@ protected:
    */
   bool get_skeletonsEnabled() const;
 
+  /**
+   * @brief Sets the number of worker threads simulating the particle systems.
+   */
+  void set_particleWorkerCount(size_t value);
+
+  /**
+   * @brief Gets the number of worker threads simulating the particle systems.
+   */
+  size_t get_particleWorkerCount() const;
+
+  /**
+   * @brief Sets the number of worker threads skinning the meshes on the CPU.
+   */
+  void set_skinningWorkerCount(size_t value);
+
+  /**
+   * @brief Gets the number of worker threads skinning the meshes on the CPU.
+   */
+  size_t get_skinningWorkerCount() const;
+
   /**
    * @brief Gets the postprocess render pipeline manager.
    * @see http://doc.babylonjs.com/how_to/how_to_use_postprocessrenderpipeline
@@ -1968,6 +2009,11 @@ protected:
    */
   Octree<AbstractMesh*>*& get_selectionOctree();
 
+  /**
+   * @brief Gets the dynamic bounding box tree used to boost picking.
+   */
+  DynamicAABBTree<AbstractMesh*>*& get_pickingTree();
+
   /**
    * @brief Gets the mesh that is currently under the pointer.
    */
@@ -2610,6 +2656,22 @@ public:
    */
   bool particlesEnabled;
 
+  /**
+   * Gets or sets the number of worker threads used to simulate the active
+   * particle systems in parallel, in addition to the render thread. The
+   * default value 0 simulates them on the render thread. Every particle system
+   * has its own random stream, so the simulation does not depend on this
+   * value.
+   */
+  Property<Scene, size_t> particleWorkerCount;
+
+  /**
+   * Gets or sets the number of worker threads used to skin the vertices of the
+   * large software skinned meshes in parallel, in addition to the render
+   * thread. The default value 0 skins them on the render thread.
+   */
+  Property<Scene, size_t> skinningWorkerCount;
+
   // Sprites
 
   /**
@@ -2816,6 +2878,9 @@ public:
   /** Hidden */
   std::vector<IParticleSystem*> _activeParticleSystems;
 
+  /** Hidden */
+  std::unique_ptr<ThreadPool> _skinningThreadPool;
+
   /** Hidden */
   std::vector<AnimatablePtr> _activeAnimatables;
 
@@ -2883,6 +2948,11 @@ public:
    */
   ReadOnlyProperty<Scene, Octree<AbstractMesh*>*> selectionOctree;
 
+  /**
+   * Gets the dynamic bounding box tree used to boost picking
+   */
+  ReadOnlyProperty<Scene, DynamicAABBTree<AbstractMesh*>*> pickingTree;
+
   /**
    * Gets the mesh that is currently under the pointer
    */
@@ -3132,6 +3202,9 @@ private:
   bool _texturesEnabled;
   // Skeletons
   bool _skeletonsEnabled;
+  // Particles
+  std::unique_ptr<ThreadPool> _particleThreadPool;
+  std::vector<IParticleSystem*> _simulatedParticleSystems;
   // Postprocesses
   std::unique_ptr<PostProcessRenderPipelineManager>
     _postProcessRenderPipelineManager;
@@ -3196,6 +3269,8 @@ private:
   bool _frustumPlanesSet;
   std::array<Plane, 6> _frustumPlanes;
   Octree<AbstractMesh*>* _selectionOctree;
+  DynamicAABBTree<AbstractMesh*>* _pickingTree;
+  std::vector<AbstractMesh*> _pickingTreeDirtyMeshes;
   Vector2 _unTranslatedPointer;
   AbstractMesh* _pointerOverMesh;
   Sprite* _pointerOverSprite;
@@ -744,6 +744,7 @@ public:
   int TRANSFORM_FEEDBACK_BUFFER;
 
 public:
+  virtual ~IGLRenderingContext() = default;
   virtual bool initialize(bool enableGLDebugging = false) = 0;
   virtual void backupGLState()                            = 0;
   virtual void restoreGLState()                           = 0;
@@ -953,6 +954,16 @@ public:
   virtual void bufferData(GLenum target, const Uint32Array& data, GLenum usage)
     = 0;
 
+  /**
+   * @brief Initializes and creates the buffer object's data store.
+   * @param target A GLenum specifying the binding point (target).
+   * @param data An ArrayBuffer holding the raw bytes that will be copied into
+   * the data store.
+   * @param usage A GLenum specifying the usage pattern of the data store.
+   */
+  virtual void bufferData(GLenum target, const ArrayBuffer& data, GLenum usage)
+    = 0;
+
   /**
    * @brief Updates a subset of a buffer object's data store.
    * @param target A GLenum specifying the binding point (target).
@@ -976,6 +987,18 @@ public:
   virtual void bufferSubData(GLenum target, GLintptr offset, Int32Array& data)
     = 0;
 
+  /**
+   * @brief Updates a subset of a buffer object's data store.
+   * @param target A GLenum specifying the binding point (target).
+   * @param offset A GLintptr specifying an offset in bytes where the data
+   * replacement will start.
+   * @param data An ArrayBuffer holding the raw bytes that will be copied into
+   * the data store.
+   */
+  virtual void bufferSubData(GLenum target, GLintptr offset,
+                             const ArrayBuffer& data)
+    = 0;
+
   /**
    * @brief Binds a passed IGLVertexArrayObject object to the buffer.
    * @param vao A IGLVertexArrayObject (VAO) object to bind.
@@ -1539,7 +1562,7 @@ public:
    */
   virtual GLboolean hasExtension(const std::string& extension) = 0;
 
-  virtual std::array<int, 3> getScissorBoxParameter() = 0; // GL::SCISSOR_BOX
+  virtual std::array<int, 4> getScissorBoxParameter() = 0; // GL::SCISSOR_BOX
 
   /**
    * @brief Returns a value for the passed parameter name.
@@ -23,6 +23,10 @@ struct BABYLON_SHARED_EXPORT BackgroundMaterialDefines
 
   void reset() override;
 
+private:
+  static const MaterialDefinesLayout& _Layout();
+  static MaterialDefinesLayout _CreateLayout();
+
 }; // end of struct BackgroundMaterialDefines
 
 } // end of namespace BABYLON
@@ -1,8 +1,11 @@
 #ifndef BABYLON_MATERIALS_EFFECT_H
 #define BABYLON_MATERIALS_EFFECT_H
 
+#include <string_view>
+
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
+#include <babylon/materials/uniform_name.h>
 #include <babylon/tools/observable.h>
 #include <babylon/tools/observer.h>
 
@@ -41,16 +44,33 @@ class BABYLON_SHARED_EXPORT Effect {
 
 public:
   /**
-   * Store of each shader (The can be looked up using effect.key)
+   * Store of the shaders added at runtime, they take precedence over the
+   * shaders of the library (EffectShadersStore)
    */
   static std::unordered_map<std::string, std::string>& ShadersStore();
 
   /**
-   * Store of each included file for a shader (The can be looked up using
-   * effect.key)
+   * Store of the included files added at runtime, they take precedence over
+   * the included files of the library (EffectIncludesShadersStore)
    */
   static std::unordered_map<std::string, std::string>& IncludesShadersStore();
 
+  /**
+   * @brief Returns the source code of a shader added to the shaders store or
+   * built in the library.
+   * @param name The name of the shader (eg. "defaultVertexShader").
+   * @returns the source code, or an empty view if the shader is unknown.
+   */
+  static std::string_view GetShader(const std::string& name);
+
+  /**
+   * @brief Returns the source code of an included file added to the includes
+   * store or built in the library.
+   * @param name The name of the included file (eg. "bonesDeclaration").
+   * @returns the source code, or an empty view if the file is unknown.
+   */
+  static std::string_view GetIncludeShader(const std::string& name);
+
 public:
   /**
    * @brief Instantiates an effect.
@@ -130,18 +150,27 @@ public:
   size_t getAttributesCount();
 
   /**
-   * @brief Gets the index of a uniform variable.
+   * @brief Gets the index of a uniform variable, i.e. its slot. The slots are
+   * dense and fixed when the effect is created, they can be passed to the
+   * setters instead of the names.
    * @param uniformName of the uniform to look up.
-   * @returns the index.
+   * @returns the index, -1 if the uniform is not used by the effect.
    */
-  int getUniformIndex(const std::string& uniformName);
+  int getUniformIndex(const UniformName& uniformName) const;
 
   /**
    * @brief Returns the attribute based on the name of the variable.
    * @param uniformName of the uniform to look up.
    * @returns the location of the uniform.
    */
-  GL::IGLUniformLocation* getUniform(const std::string& uniformName);
+  GL::IGLUniformLocation* getUniform(const UniformName& uniformName);
+
+  /**
+   * @brief Returns the location of the uniform with the given slot.
+   * @param slot index of the uniform to look up.
+   * @returns the location of the uniform.
+   */
+  GL::IGLUniformLocation* getUniform(int slot);
 
   /**
    * @brief Returns an array of sampler variable names
@@ -169,14 +198,14 @@ public:
    */
   void
   _loadVertexShader(const std::string& vertex,
-                    const std::function<void(const std::string&)>& callback);
+                    const std::function<void(std::string_view)>& callback);
 
   /**
    * @brief Hidden
    */
   void
   _loadFragmentShader(const std::string& fragment,
-                      const std::function<void(const std::string&)>& callback);
+                      const std::function<void(std::string_view)>& callback);
 
   /**
    * @brief Hidden
@@ -270,11 +299,10 @@ public:
   void setTextureFromPostProcessOutput(const std::string& channel,
                                        PostProcess* postProcess);
 
-  bool _cacheMatrix(const std::string& uniformName, const Matrix& matrix);
-  bool _cacheFloat2(const std::string& uniformName, float x, float y);
-  bool _cacheFloat3(const std::string& uniformName, float x, float y, float z);
-  bool _cacheFloat4(const std::string& uniformName, float x, float y, float z,
-                    float w);
+  bool _cacheMatrix(int slot, const Matrix& matrix);
+  bool _cacheFloat2(int slot, float x, float y);
+  bool _cacheFloat3(int slot, float x, float y, float z);
+  bool _cacheFloat4(int slot, float x, float y, float z, float w);
 
   /**
    * @brief Binds a buffer to a uniform.
@@ -296,7 +324,12 @@ public:
    * @param value Value to be set.
    * @returns this effect.
    */
-  Effect& setInt(const std::string& uniformName, int value);
+  Effect& setInt(const UniformName& uniformName, int value);
+
+  /**
+   * @brief Same as setInt(), for the uniform with the given slot.
+   */
+  Effect& setInt(int slot, int value);
 
   /**
    * @brief Sets an int array on a uniform variable.
@@ -304,7 +337,12 @@ public:
    * @param array array to be set.
    * @returns this effect.
    */
-  Effect& setIntArray(const std::string& uniformName, const Int32Array& array);
+  Effect& setIntArray(const UniformName& uniformName, const Int32Array& array);
+
+  /**
+   * @brief Same as setIntArray(), for the uniform with the given slot.
+   */
+  Effect& setIntArray(int slot, const Int32Array& array);
 
   /**
    * @brief Sets an int array 2 on a uniform variable. (Array is specified as
@@ -313,7 +351,12 @@ public:
    * @param array array to be set.
    * @returns this effect.
    */
-  Effect& setIntArray2(const std::string& uniformName, const Int32Array& array);
+  Effect& setIntArray2(const UniformName& uniformName, const Int32Array& array);
+
+  /**
+   * @brief Same as setIntArray2(), for the uniform with the given slot.
+   */
+  Effect& setIntArray2(int slot, const Int32Array& array);
 
   /**
    * @brief Sets an int array 3 on a uniform variable. (Array is specified as
@@ -323,7 +366,12 @@ public:
    * @param array array to be set.
    * @returns this effect.
    */
-  Effect& setIntArray3(const std::string& uniformName, const Int32Array& array);
+  Effect& setIntArray3(const UniformName& uniformName, const Int32Array& array);
+
+  /**
+   * @brief Same as setIntArray3(), for the uniform with the given slot.
+   */
+  Effect& setIntArray3(int slot, const Int32Array& array);
 
   /**
    * @brief Sets an int array 4 on a uniform variable. (Array is specified as
@@ -333,7 +381,12 @@ public:
    * @param array array to be set.
    * @returns this effect.
    */
-  Effect& setIntArray4(const std::string& uniformName, const Int32Array& array);
+  Effect& setIntArray4(const UniformName& uniformName, const Int32Array& array);
+
+  /**
+   * @brief Same as setIntArray4(), for the uniform with the given slot.
+   */
+  Effect& setIntArray4(int slot, const Int32Array& array);
 
   /**
    * @brief Sets an float array on a uniform variable.
@@ -341,9 +394,14 @@ public:
    * @param array array to be set.
    * @returns this effect.
    */
-  Effect& setFloatArray(const std::string& uniformName,
+  Effect& setFloatArray(const UniformName& uniformName,
                         const Float32Array& array);
 
+  /**
+   * @brief Same as setFloatArray(), for the uniform with the given slot.
+   */
+  Effect& setFloatArray(int slot, const Float32Array& array);
+
   /**
    * @brief Sets an float array 2 on a uniform variable. (Array is specified as
    * single array eg. [1,2,3,4] will result in [[1,2],[3,4]] in the shader)
@@ -351,9 +409,14 @@ public:
    * @param array array to be set.
    * @returns this effect.
    */
-  Effect& setFloatArray2(const std::string& uniformName,
+  Effect& setFloatArray2(const UniformName& uniformName,
                          const Float32Array& array);
 
+  /**
+   * @brief Same as setFloatArray2(), for the uniform with the given slot.
+   */
+  Effect& setFloatArray2(int slot, const Float32Array& array);
+
   /**
    * @brief Sets an float array 3 on a uniform variable. (Array is specified as
    * single array eg. [1,2,3,4,5,6] will result in [[1,2,3],[4,5,6]] in the
@@ -362,9 +425,14 @@ public:
    * @param array array to be set.
    * @returns this effect.
    */
-  Effect& setFloatArray3(const std::string& uniformName,
+  Effect& setFloatArray3(const UniformName& uniformName,
                          const Float32Array& array);
 
+  /**
+   * @brief Same as setFloatArray3(), for the uniform with the given slot.
+   */
+  Effect& setFloatArray3(int slot, const Float32Array& array);
+
   /**
    * @brief Sets an float array 4 on a uniform variable. (Array is specified as
    * single array eg. [1,2,3,4,5,6,7,8] will result in [[1,2,3,4],[5,6,7,8]] in
@@ -373,16 +441,26 @@ public:
    * @param array array to be set.
    * @returns this effect.
    */
-  Effect& setFloatArray4(const std::string& uniformName,
+  Effect& setFloatArray4(const UniformName& uniformName,
                          const Float32Array& array);
 
+  /**
+   * @brief Same as setFloatArray4(), for the uniform with the given slot.
+   */
+  Effect& setFloatArray4(int slot, const Float32Array& array);
+
   /**
    * @brief Sets an array on a uniform variable.
    * @param uniformName Name of the variable.
    * @param array array to be set.
    * @returns this effect.
    */
-  Effect& setArray(const std::string& uniformName, Float32Array array);
+  Effect& setArray(const UniformName& uniformName, Float32Array array);
+
+  /**
+   * @brief Same as setArray(), for the uniform with the given slot.
+   */
+  Effect& setArray(int slot, Float32Array array);
 
   /**
    * @brief Sets an array 2 on a uniform variable. (Array is specified as single
@@ -391,7 +469,12 @@ public:
    * @param array array to be set.
    * @returns this effect.
    */
-  Effect& setArray2(const std::string& uniformName, Float32Array array);
+  Effect& setArray2(const UniformName& uniformName, Float32Array array);
+
+  /**
+   * @brief Same as setArray2(), for the uniform with the given slot.
+   */
+  Effect& setArray2(int slot, Float32Array array);
 
   /**
    * @brief Sets an array 3 on a uniform variable. (Array is specified as single
@@ -400,7 +483,12 @@ public:
    * @param array array to be set.
    * @returns this effect.
    */
-  Effect& setArray3(const std::string& uniformName, Float32Array array);
+  Effect& setArray3(const UniformName& uniformName, Float32Array array);
+
+  /**
+   * @brief Same as setArray3(), for the uniform with the given slot.
+   */
+  Effect& setArray3(int slot, Float32Array array);
 
   /**
    * @brief Sets an array 4 on a uniform variable. (Array is specified as single
@@ -410,7 +498,12 @@ public:
    * @param array array to be set.
    * @returns this effect.
    */
-  Effect& setArray4(const std::string& uniformName, Float32Array array);
+  Effect& setArray4(const UniformName& uniformName, Float32Array array);
+
+  /**
+   * @brief Same as setArray4(), for the uniform with the given slot.
+   */
+  Effect& setArray4(int slot, Float32Array array);
 
   /**
    * @brief Sets matrices on a uniform variable.
@@ -418,7 +511,12 @@ public:
    * @param matrices matrices to be set.
    * @returns this effect.
    */
-  Effect& setMatrices(const std::string& uniformName, Float32Array matrices);
+  Effect& setMatrices(const UniformName& uniformName, Float32Array matrices);
+
+  /**
+   * @brief Same as setMatrices(), for the uniform with the given slot.
+   */
+  Effect& setMatrices(int slot, Float32Array matrices);
 
   /**
    * @brief Sets matrix on a uniform variable.
@@ -426,7 +524,12 @@ public:
    * @param matrix matrix to be set.
    * @returns this effect.
    */
-  Effect& setMatrix(const std::string& uniformName, const Matrix& matrix);
+  Effect& setMatrix(const UniformName& uniformName, const Matrix& matrix);
+
+  /**
+   * @brief Same as setMatrix(), for the uniform with the given slot.
+   */
+  Effect& setMatrix(int slot, const Matrix& matrix);
 
   /**
    * @brief Sets a 3x3 matrix on a uniform variable. (Speicified as
@@ -435,9 +538,14 @@ public:
    * @param matrix matrix to be set.
    * @returns this effect.
    */
-  Effect& setMatrix3x3(const std::string& uniformName,
+  Effect& setMatrix3x3(const UniformName& uniformName,
                        const Float32Array& matrix);
 
+  /**
+   * @brief Same as setMatrix3x3(), for the uniform with the given slot.
+   */
+  Effect& setMatrix3x3(int slot, const Float32Array& matrix);
+
   /**
    * @brief Sets a 2x2 matrix on a uniform variable. (Speicified as [1,2,3,4]
    * will result in [1,2][3,4] matrix)
@@ -445,16 +553,26 @@ public:
    * @param matrix matrix to be set.
    * @returns this effect.
    */
-  Effect& setMatrix2x2(const std::string& uniformName,
+  Effect& setMatrix2x2(const UniformName& uniformName,
                        const Float32Array& matrix);
 
+  /**
+   * @brief Same as setMatrix2x2(), for the uniform with the given slot.
+   */
+  Effect& setMatrix2x2(int slot, const Float32Array& matrix);
+
   /**
    * @brief Sets a float on a uniform variable.
    * @param uniformName Name of the variable.
    * @param value value to be set.
    * @returns this effect.
    */
-  Effect& setFloat(const std::string& uniformName, float value);
+  Effect& setFloat(const UniformName& uniformName, float value);
+
+  /**
+   * @brief Same as setFloat(), for the uniform with the given slot.
+   */
+  Effect& setFloat(int slot, float value);
 
   /**
    * @brief Sets a boolean on a uniform variable.
@@ -462,7 +580,12 @@ public:
    * @param bool value to be set.
    * @returns this effect.
    */
-  Effect& setBool(const std::string& uniformName, bool _bool);
+  Effect& setBool(const UniformName& uniformName, bool _bool);
+
+  /**
+   * @brief Same as setBool(), for the uniform with the given slot.
+   */
+  Effect& setBool(int slot, bool _bool);
 
   /**
    * @brief Sets a Vector2 on a uniform variable.
@@ -470,7 +593,12 @@ public:
    * @param vector2 vector2 to be set.
    * @returns this effect.
    */
-  Effect& setVector2(const std::string& uniformName, const Vector2& vector2);
+  Effect& setVector2(const UniformName& uniformName, const Vector2& vector2);
+
+  /**
+   * @brief Same as setVector2(), for the uniform with the given slot.
+   */
+  Effect& setVector2(int slot, const Vector2& vector2);
 
   /**
    * @brief Sets a float2 on a uniform variable.
@@ -479,7 +607,12 @@ public:
    * @param y Second float in float2.
    * @returns this effect.
    */
-  Effect& setFloat2(const std::string& uniformName, float x, float y);
+  Effect& setFloat2(const UniformName& uniformName, float x, float y);
+
+  /**
+   * @brief Same as setFloat2(), for the uniform with the given slot.
+   */
+  Effect& setFloat2(int slot, float x, float y);
 
   /**
    * @brief Sets a Vector3 on a uniform variable.
@@ -487,7 +620,12 @@ public:
    * @param vector3 Value to be set.
    * @returns this effect.
    */
-  Effect& setVector3(const std::string& uniformName, const Vector3& vector3);
+  Effect& setVector3(const UniformName& uniformName, const Vector3& vector3);
+
+  /**
+   * @brief Same as setVector3(), for the uniform with the given slot.
+   */
+  Effect& setVector3(int slot, const Vector3& vector3);
 
   /**
    * @brief Sets a float3 on a uniform variable.
@@ -497,7 +635,12 @@ public:
    * @param z Third float in float3.
    * @returns this effect.
    */
-  Effect& setFloat3(const std::string& uniformName, float x, float y, float z);
+  Effect& setFloat3(const UniformName& uniformName, float x, float y, float z);
+
+  /**
+   * @brief Same as setFloat3(), for the uniform with the given slot.
+   */
+  Effect& setFloat3(int slot, float x, float y, float z);
 
   /**
    * @brief Sets a Vector4 on a uniform variable.
@@ -505,7 +648,12 @@ public:
    * @param vector4 Value to be set.
    * @returns this effect.
    */
-  Effect& setVector4(const std::string& uniformName, const Vector4& vector4);
+  Effect& setVector4(const UniformName& uniformName, const Vector4& vector4);
+
+  /**
+   * @brief Same as setVector4(), for the uniform with the given slot.
+   */
+  Effect& setVector4(int slot, const Vector4& vector4);
 
   /**
    * @brief Sets a float4 on a uniform variable.
@@ -516,16 +664,26 @@ public:
    * @param w Fourth float in float4.
    * @returns this effect.
    */
-  Effect& setFloat4(const std::string& uniformName, float x, float y, float z,
+  Effect& setFloat4(const UniformName& uniformName, float x, float y, float z,
                     float w);
 
+  /**
+   * @brief Same as setFloat4(), for the uniform with the given slot.
+   */
+  Effect& setFloat4(int slot, float x, float y, float z, float w);
+
   /**
    * @brief Sets a Color3 on a uniform variable.
    * @param uniformName Name of the variable.
    * @param color3 Value to be set.
    * @returns this effect.
    */
-  Effect& setColor3(const std::string& uniformName, const Color3& color3);
+  Effect& setColor3(const UniformName& uniformName, const Color3& color3);
+
+  /**
+   * @brief Same as setColor3(), for the uniform with the given slot.
+   */
+  Effect& setColor3(int slot, const Color3& color3);
 
   /**
    * @brief Sets a Color4 on a uniform variable.
@@ -534,16 +692,26 @@ public:
    * @param alpha Alpha value to be set.
    * @returns this effect.
    */
-  Effect& setColor4(const std::string& uniformName, const Color3& color3,
+  Effect& setColor4(const UniformName& uniformName, const Color3& color3,
                     float alpha);
 
+  /**
+   * @brief Same as setColor4(), for the uniform with the given slot.
+   */
+  Effect& setColor4(int slot, const Color3& color3, float alpha);
+
   /**
    * @brief Sets a Color4 on a uniform variable.
    * @param uniformName defines the name of the variable
    * @param color4 defines the value to be set
    * @returns this effect.
    */
-  Effect& setDirectColor4(const std::string& uniformName, const Color4& color4);
+  Effect& setDirectColor4(const UniformName& uniformName, const Color4& color4);
+
+  /**
+   * @brief Same as setDirectColor4(), for the uniform with the given slot.
+   */
+  Effect& setDirectColor4(int slot, const Color4& color4);
 
   // Statics
 
@@ -570,13 +738,12 @@ protected:
   Observable<Effect>& get_onBindObservable();
 
 private:
-  void _processShaderConversion(
-    const std::string& sourceCode, bool isFragment,
-    const std::function<void(const std::string&)>& callback);
   void
-  _processIncludes(const std::string& sourceCode,
-                   const std::function<void(const std::string&)>& callback);
-  std::string _processPrecision(std::string source);
+  _processShaderCode(std::string_view sourceCode, bool isFragment,
+                     const std::function<void(const std::string&)>& callback);
+  void _initializeUniformSlots();
+  bool _cacheValues(int slot, const float* values, uint8_t count);
+  void _clearCachedValue(int slot);
 
 public:
   /**
@@ -635,6 +802,8 @@ public:
   std::unique_ptr<GL::IGLProgram> _program;
 
 private:
+  static constexpr size_t _ValueCacheStride = 4;
+
   Observer<Effect>::Ptr _onCompileObserver;
   static std::size_t _uniqueIdSeed;
   Engine* _engine;
@@ -645,8 +814,10 @@ private:
   std::string _compilationError;
   std::vector<std::string> _attributesNames;
   Int32Array _attributes;
-  std::unordered_map<std::string, std::unique_ptr<GL::IGLUniformLocation>>
-    _uniforms;
+  // Slots of the uniforms indexed by the ids of their names, -1 if the effect
+  // does not use the uniform
+  std::vector<int> _uniformSlots;
+  std::vector<std::unique_ptr<GL::IGLUniformLocation>> _uniformLocations;
   std::unordered_map<std::string, unsigned int> _indexParameters;
   std::unique_ptr<EffectFallbacks> _fallbacks;
   std::string _vertexSourceCode;
@@ -654,7 +825,9 @@ private:
   std::string _vertexSourceCodeOverride;
   std::string _fragmentSourceCodeOverride;
   std::vector<std::string> _transformFeedbackVaryings;
-  std::unordered_map<std::string, Float32Array> _valueCache;
+  // Last values set on the uniforms, _ValueCacheStride floats per slot
+  std::vector<float> _valueCache;
+  std::vector<uint8_t> _valueCacheSizes;
   static std::unordered_map<unsigned int, GL::IGLBuffer*> _baseCache;
 
 }; // end of class Effect
@@ -1,24 +1,31 @@
 ﻿#ifndef BABYLON_MATERIALS_EFFECT_INCLUDES_SHADERS_STORE_H
 #define BABYLON_MATERIALS_EFFECT_INCLUDES_SHADERS_STORE_H
 
-#include <string>
-#include <unordered_map>
+#include <array>
+#include <string_view>
 
 #include <babylon/babylon_api.h>
 
 namespace BABYLON {
 
+/**
+ * @brief Shader includes of the library, in a table built at compile time.
+ */
 class BABYLON_SHARED_EXPORT EffectIncludesShadersStore {
 
 public:
-  EffectIncludesShadersStore();
-  ~EffectIncludesShadersStore();
-
-  std::unordered_map<std::string, std::string>& shaders();
-  const std::unordered_map<std::string, std::string>& shaders() const;
-
-private:
-  static std::unordered_map<std::string, std::string> _shaders;
+  static constexpr size_t Size = 57;
+
+  /**
+   * @brief Returns the source code of a shader, or an empty view if the shader
+   * is not in the store.
+   */
+  static std::string_view Find(std::string_view name);
+
+  /**
+   * @brief Returns the names of the shaders, in the order of the table.
+   */
+  static const std::array<std::string_view, Size>& Names();
 
 }; // end of class EffectIncludesShadersStore
 
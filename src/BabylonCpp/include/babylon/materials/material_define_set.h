@@ -0,0 +1,386 @@
+#ifndef BABYLON_MATERIALS_MATERIAL_DEFINE_SET_H
+#define BABYLON_MATERIALS_MATERIAL_DEFINE_SET_H
+
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class MaterialDefineNames;
+using MaterialDefineNamesPtr = std::shared_ptr<MaterialDefineNames>;
+
+/**
+ * @brief Names of the defines of a material class.
+ *
+ * A name is registered once and identified by its index afterwards. The
+ * tables are shared by all the defines of a material class and are not
+ * thread-safe, like the materials using them.
+ */
+class BABYLON_SHARED_EXPORT MaterialDefineNames {
+
+public:
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+public:
+  static MaterialDefineNamesPtr New();
+
+  /**
+   * @brief Returns the index of a define, npos if it is not registered.
+   */
+  size_t find(const std::string& name) const;
+
+  /**
+   * @brief Registers a define if needed and returns its index.
+   */
+  size_t insert(const std::string& name);
+
+  /**
+   * @brief Returns the number of registered defines.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the name of a define.
+   */
+  const std::string& name(size_t index) const;
+
+  /**
+   * @brief Returns the "#define NAME" text of a define.
+   */
+  const std::string& text(size_t index) const;
+
+  /**
+   * @brief Returns the random 64-bit key hashing the state of a define.
+   */
+  static uint64_t Key(size_t index);
+
+  /**
+   * @brief Mixes the bits of a 64-bit value.
+   */
+  static uint64_t Mix(uint64_t value);
+
+private:
+  MaterialDefineNames();
+
+private:
+  std::unordered_map<std::string, size_t> _indices;
+  std::vector<std::string> _names;
+  std::vector<std::string> _texts;
+
+}; // end of class MaterialDefineNames
+
+/**
+ * @brief Base class of the define values of a material, stores which of the
+ * registered defines are set in a bitset.
+ *
+ * The hash of the values is updated when a define changes, so comparing two
+ * sets of defines is O(words), and the define text is rebuilt once after the
+ * defines changed.
+ */
+class BABYLON_SHARED_EXPORT MaterialDefineSet {
+
+public:
+  MaterialDefineSet(const MaterialDefineNamesPtr& names);
+  virtual ~MaterialDefineSet();
+
+  /**
+   * @brief Returns true if the define is set.
+   */
+  bool contains(const std::string& name) const;
+
+  /**
+   * @brief Returns true if the define with the given index is set.
+   */
+  bool contains(size_t index) const;
+
+  /**
+   * @brief Returns the number of set defines.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns true if no define is set.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Returns the hash of the defines, equal defines have equal hashes.
+   */
+  uint64_t hash() const;
+
+  /**
+   * @brief Returns the names of the defines.
+   */
+  const MaterialDefineNamesPtr& names() const;
+
+  /**
+   * @brief Returns the "#define" lines of the set defines.
+   */
+  const std::string& toString() const;
+
+protected:
+  /**
+   * @brief Registers a define if needed, sets it and returns its index.
+   */
+  size_t _insert(const std::string& name);
+
+  /**
+   * @brief Sets a define, returns false if it was already set.
+   */
+  bool _insert(size_t index);
+
+  void _clear();
+  void _changed(uint64_t hashDelta);
+  bool _isEqual(const MaterialDefineSet& other) const;
+  virtual void _appendText(std::string& text, size_t index) const = 0;
+
+  static bool _Test(const std::vector<uint64_t>& words, size_t index);
+  static void _Flip(std::vector<uint64_t>& words, size_t index);
+  static bool _IsEqual(const std::vector<uint64_t>& lhs,
+                       const std::vector<uint64_t>& rhs);
+
+protected:
+  MaterialDefineNamesPtr _names;
+  std::vector<uint64_t> _contained;
+  size_t _size;
+  uint64_t _hash;
+
+private:
+  mutable std::string _text;
+  mutable bool _isTextDirty;
+
+}; // end of class MaterialDefineSet
+
+/**
+ * @brief Boolean defines of a material, a define is written when it is true.
+ */
+class BABYLON_SHARED_EXPORT MaterialDefineFlags : public MaterialDefineSet {
+
+public:
+  /**
+   * @brief Reference to a boolean define.
+   */
+  class BABYLON_SHARED_EXPORT Reference {
+
+  public:
+    Reference(MaterialDefineFlags& flags, size_t index);
+    Reference(const Reference& other) = default;
+
+    operator bool() const;
+    Reference& operator=(bool value);
+    Reference& operator=(const Reference& other);
+
+  private:
+    MaterialDefineFlags& _flags;
+    size_t _index;
+
+  }; // end of class Reference
+
+public:
+  MaterialDefineFlags(
+    const MaterialDefineNamesPtr& names = MaterialDefineNames::New());
+  ~MaterialDefineFlags() override;
+
+  /**
+   * @brief Replaces the defines.
+   */
+  MaterialDefineFlags&
+  operator=(std::initializer_list<std::pair<const std::string, bool>> defines);
+
+  /**
+   * @brief Returns a reference to a define, setting it to false if it was not
+   * set.
+   */
+  Reference operator[](const std::string& name);
+
+  bool operator==(const MaterialDefineFlags& other) const;
+  bool operator!=(const MaterialDefineFlags& other) const;
+
+  /**
+   * @brief Returns the value of the define with the given index.
+   */
+  bool test(size_t index) const;
+
+  /**
+   * @brief Sets the value of the define with the given index.
+   */
+  void set(size_t index, bool value);
+
+protected:
+  void _appendText(std::string& text, size_t index) const override;
+
+private:
+  std::vector<uint64_t> _values;
+
+}; // end of class MaterialDefineFlags
+
+/**
+ * @brief Numeric defines of a material, a define is written with its value
+ * when it is set.
+ */
+template <typename T>
+class MaterialDefineValues : public MaterialDefineSet {
+
+public:
+  /**
+   * @brief Reference to a numeric define.
+   */
+  class Reference {
+
+  public:
+    Reference(MaterialDefineValues& values, size_t index)
+        : _values{values}, _index{index}
+    {
+    }
+    Reference(const Reference& other) = default;
+
+    operator T() const
+    {
+      return _values.get(_index);
+    }
+
+    Reference& operator=(T value)
+    {
+      _values.set(_index, value);
+      return *this;
+    }
+
+    Reference& operator=(const Reference& other)
+    {
+      _values.set(_index, static_cast<T>(other));
+      return *this;
+    }
+
+  private:
+    MaterialDefineValues& _values;
+    size_t _index;
+
+  }; // end of class Reference
+
+public:
+  MaterialDefineValues(
+    const MaterialDefineNamesPtr& names = MaterialDefineNames::New())
+      : MaterialDefineSet{names}
+  {
+  }
+
+  ~MaterialDefineValues() override = default;
+
+  /**
+   * @brief Replaces the defines.
+   */
+  MaterialDefineValues&
+  operator=(std::initializer_list<std::pair<const std::string, T>> defines)
+  {
+    _clear();
+    _values.clear();
+    for (const auto& define : defines) {
+      set(_names->insert(define.first), define.second);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Returns a reference to a define, setting it to 0 if it was not set.
+   */
+  Reference operator[](const std::string& name)
+  {
+    return Reference(*this, _insertValue(_names->insert(name)));
+  }
+
+  bool operator==(const MaterialDefineValues& other) const
+  {
+    if (!_isEqual(other)) {
+      return false;
+    }
+    // The values of the defines which are not set are 0
+    const auto& shorter = _values.size() < other._values.size() ? *this : other;
+    const auto& longer  = _values.size() < other._values.size() ? other : *this;
+    const auto count    = shorter._values.size();
+    for (size_t i = 0; i < count; ++i) {
+      if (!(shorter._values[i] == longer._values[i])) {
+        return false;
+      }
+    }
+    for (size_t i = count; i < longer._values.size(); ++i) {
+      if (!(longer._values[i] == T(0))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool operator!=(const MaterialDefineValues& other) const
+  {
+    return !(operator==(other));
+  }
+
+  /**
+   * @brief Returns the value of the define with the given index, 0 if it is
+   * not set.
+   */
+  T get(size_t index) const
+  {
+    return index < _values.size() ? _values[index] : T(0);
+  }
+
+  /**
+   * @brief Sets the value of the define with the given index.
+   */
+  void set(size_t index, T value)
+  {
+    _insertValue(index);
+    auto& current = _values[index];
+    if (!(current == value)) {
+      const auto delta = _ValueHash(index, current) ^ _ValueHash(index, value);
+      current          = value;
+      _changed(delta);
+    }
+  }
+
+protected:
+  void _appendText(std::string& text, size_t index) const override
+  {
+    std::ostringstream oss;
+    oss << _names->text(index) << " " << _values[index] << "\n";
+    text += oss.str();
+  }
+
+private:
+  size_t _insertValue(size_t index)
+  {
+    if (index >= _values.size()) {
+      _values.resize(_names->size(), T(0));
+    }
+    if (_insert(index)) {
+      _changed(_ValueHash(index, T(0)));
+    }
+    return index;
+  }
+
+  static uint64_t _ValueHash(size_t index, T value)
+  {
+    // +0 and -0 are equal
+    value += T(0);
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(T) < sizeof(bits) ? sizeof(T) : 8);
+    return MaterialDefineNames::Mix(MaterialDefineNames::Key(index) ^ bits);
+  }
+
+private:
+  std::vector<T> _values;
+
+}; // end of class MaterialDefineValues
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATERIALS_MATERIAL_DEFINE_SET_H
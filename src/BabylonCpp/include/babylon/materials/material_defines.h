@@ -5,15 +5,35 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/materials/imaterial_defines.h>
+#include <babylon/materials/material_define_set.h>
 
 namespace BABYLON {
 
+/**
+ * @brief Defines registered once by a material class, with their initial
+ * values.
+ */
+struct BABYLON_SHARED_EXPORT MaterialDefinesLayout {
+  MaterialDefineFlags boolDef;
+  MaterialDefineValues<unsigned int> intDef;
+  MaterialDefineValues<float> floatDef;
+}; // end of struct MaterialDefinesLayout
+
 /**
  * @brief Manages the defines for the Material.
  */
 struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
 
+  /**
+   * @brief Creates defines registering their names in the tables shared by
+   * the materials without a layout.
+   */
   MaterialDefines();
+
+  /**
+   * @brief Creates defines sharing the names of a layout, with its values.
+   */
+  MaterialDefines(const MaterialDefinesLayout& layout);
   virtual ~MaterialDefines();
 
   bool operator[](const std::string& define) const;
@@ -104,10 +124,16 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
    */
   virtual std::string toString() const override;
 
+  /**
+   * @brief Returns a hash of the define values, equal defines have equal
+   * hashes.
+   */
+  uint64_t hash() const;
+
   // Properties
-  std::unordered_map<std::string, bool> boolDef;
-  std::unordered_map<std::string, unsigned int> intDef;
-  std::unordered_map<std::string, float> floatDef;
+  MaterialDefineFlags boolDef;
+  MaterialDefineValues<unsigned int> intDef;
+  MaterialDefineValues<float> floatDef;
   std::unordered_map<std::string, std::string> stringDef;
 
   bool _isDirty;
@@ -137,6 +163,9 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
   /** Hidden */
   bool _needUVs;
 
+  /** Hidden */
+  static const MaterialDefinesLayout& _DefaultLayout();
+
 }; // end of struct MaterialDefines
 
 } // end of namespace BABYLON
@@ -25,6 +25,10 @@ struct BABYLON_SHARED_EXPORT PBRMaterialDefines
    */
   void reset() override;
 
+private:
+  static const MaterialDefinesLayout& _Layout();
+  static MaterialDefinesLayout _CreateLayout();
+
 }; // end of struct PBRMaterialDefines
 
 } // end of namespace BABYLON
@@ -0,0 +1,122 @@
+#ifndef BABYLON_MATERIALS_SHADER_PROCESSOR_H
+#define BABYLON_MATERIALS_SHADER_PROCESSOR_H
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Options used to process the source code of a shader.
+ */
+struct BABYLON_SHARED_EXPORT ShaderProcessingOptions {
+  /**
+   * Whether the source code is the one of a fragment shader.
+   */
+  bool isFragment{false};
+  /**
+   * Whether the engine supports uniform buffers, used to select the uniform
+   * declarations.
+   */
+  bool supportsUniformBuffers{false};
+  /**
+   * Whether the engine supports high precision floats in shaders.
+   */
+  bool highPrecisionShaderSupported{true};
+  /**
+   * Whether the shader must be converted to GLSL 3.00 ES (WebGL 2).
+   */
+  bool convertToGLSL300{false};
+  /**
+   * Parameters used with the include syntax to iterate over an array
+   * (eg. {maxSimultaneousLights: 4}).
+   */
+  std::unordered_map<std::string, unsigned int> indexParameters{};
+}; // end of struct ShaderProcessingOptions
+
+/**
+ * @brief Preprocessor of the shaders source code: expands the includes, adds
+ * the precision qualifiers and converts the shaders to GLSL 3.00 ES.
+ *
+ * The source code is scanned by hand, without regular expressions. The
+ * expanded includes are memoized per include, substitutions and index range,
+ * and the processed shaders are memoized per source code and options, so
+ * creating another variant of an effect only pays for the shader compilation.
+ * The includes store is expected to be filled before the first effect is
+ * created, ClearCache() must be called after an include has been modified.
+ */
+class BABYLON_SHARED_EXPORT ShaderProcessor {
+
+public:
+  /**
+   * @brief Returns the processed source code of a shader, from the cache if
+   * it was already processed with the same options.
+   * @param sourceCode The source code of the shader.
+   * @param options The processing options.
+   * @returns the processed source code.
+   */
+  static std::string Process(std::string_view sourceCode,
+                             const ShaderProcessingOptions& options);
+
+  /**
+   * @brief Replaces the "#include<name>(search,replace,...)[min..max]"
+   * directives by the included files (Effect::GetIncludeShader).
+   * @param sourceCode The source code of the shader.
+   * @param options The processing options.
+   * @returns the source code with the includes expanded.
+   */
+  static std::string ProcessIncludes(std::string_view sourceCode,
+                                     const ShaderProcessingOptions& options);
+
+  /**
+   * @brief Adds the float precision qualifier if missing and lowers it when
+   * high precision is not supported.
+   * @param sourceCode The source code of the shader.
+   * @param highPrecisionShaderSupported Whether high precision is supported.
+   * @returns the source code with the precision qualifier.
+   */
+  static std::string
+  ProcessPrecision(std::string sourceCode, bool highPrecisionShaderSupported);
+
+  /**
+   * @brief Migrates a GLSL 1.00 ES shader to GLSL 3.00 ES.
+   * @param sourceCode The source code of the shader.
+   * @param isFragment Whether the shader is a fragment shader.
+   * @returns the converted source code.
+   */
+  static std::string ConvertToGLSL300(const std::string& sourceCode,
+                                      bool isFragment);
+
+  /**
+   * @brief Returns the number of processed shaders in the cache.
+   */
+  static size_t CacheSize();
+
+  /**
+   * @brief Clears the processed shaders and the expanded includes.
+   */
+  static void ClearCache();
+
+private:
+  static std::string _ExpandInclude(const std::string& includeName,
+                                    const std::string& substitutions,
+                                    bool hasIndex, const std::string& index,
+                                    bool supportsUniformBuffers);
+  static std::string _ReplaceLightUniforms(const std::string& content);
+  static std::string _RemoveExtensions(const std::string& sourceCode);
+  static std::string
+  _ReplaceAll(const std::string& sourceCode, const std::string& prefix,
+              const std::function<size_t(const std::string&, size_t)>& match,
+              const std::string& replacement);
+  static size_t _SkipWhitespaces(const std::string& sourceCode, size_t pos);
+  static bool _IsInteger(const std::string& value);
+
+}; // end of class ShaderProcessor
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATERIALS_SHADER_PROCESSOR_H
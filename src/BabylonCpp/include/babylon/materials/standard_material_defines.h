@@ -16,6 +16,10 @@ struct BABYLON_SHARED_EXPORT StandardMaterialDefines
 
   void setReflectionMode(const std::string& modeToEnable);
 
+private:
+  static const MaterialDefinesLayout& _Layout();
+  static MaterialDefinesLayout _CreateLayout();
+
 }; // end of struct StandardMaterialDefines
 
 } // end of namespace BABYLON
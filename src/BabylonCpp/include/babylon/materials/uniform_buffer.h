@@ -6,6 +6,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
+#include <babylon/materials/uniform_name.h>
 
 namespace BABYLON {
 
@@ -80,8 +81,8 @@ public:
    * the shader.
    * @param {number|number[]} size Data size, or data directly.
    */
-  void addUniform(const std::string& name, size_t size);
-  void addUniform(const std::string& name, const Float32Array& size);
+  void addUniform(const UniformName& name, size_t size);
+  void addUniform(const UniformName& name, const Float32Array& size);
 
   /**
    * @brief Wrapper for addUniform.
@@ -89,7 +90,7 @@ public:
    * the shader.
    * @param {Matrix} mat A 4x4 matrix.
    */
-  void addMatrix(const std::string& name, const Matrix& mat);
+  void addMatrix(const UniformName& name, const Matrix& mat);
 
   /**
    * @brief Wrapper for addUniform.
@@ -98,7 +99,7 @@ public:
    * @param {number} x
    * @param {number} y
    */
-  void addFloat2(const std::string& name, float x, float y);
+  void addFloat2(const UniformName& name, float x, float y);
 
   /**
    * @brief Wrapper for addUniform.
@@ -108,7 +109,7 @@ public:
    * @param {number} y
    * @param {number} z
    */
-  void addFloat3(const std::string& name, float x, float y, float z);
+  void addFloat3(const UniformName& name, float x, float y, float z);
 
   /**
    * @brief Wrapper for addUniform.
@@ -116,7 +117,7 @@ public:
    * the shader.
    * @param {Color3} color
    */
-  void addColor3(const std::string& name, const Color3& color);
+  void addColor3(const UniformName& name, const Color3& color);
 
   /**
    * @brief Wrapper for addUniform.
@@ -125,7 +126,7 @@ public:
    * @param {Color3} color
    * @param {number} alpha
    */
-  void addColor4(const std::string& name, const Color3& color, float alpha);
+  void addColor4(const UniformName& name, const Color3& color, float alpha);
 
   /**
    * @brief Wrapper for addUniform.
@@ -133,21 +134,21 @@ public:
    * the shader.
    * @param {Vector3} vector
    */
-  void addVector3(const std::string& name, const Vector3& vector);
+  void addVector3(const UniformName& name, const Vector3& vector);
 
   /**
    * @brief Wrapper for addUniform.
    * @param {string} name Name of the uniform, as used in the uniform block in
    * the shader.
    */
-  void addMatrix3x3(const std::string& name);
+  void addMatrix3x3(const UniformName& name);
 
   /**
    * @brief Wrapper for addUniform.
    * @param {string} name Name of the uniform, as used in the uniform block in
    * the shader.
    */
-  void addMatrix2x2(const std::string& name);
+  void addMatrix2x2(const UniformName& name);
 
   /**
    * @brief Effectively creates the WebGL Uniform Buffer, once layout is
@@ -175,7 +176,7 @@ public:
    * @param {number[]|Float32Array} data Flattened data
    * @param {number} size Size of the data.
    */
-  void updateUniform(const std::string& uniformName, const Float32Array& data,
+  void updateUniform(const UniformName& uniformName, const Float32Array& data,
                      size_t size);
 
   /**
@@ -192,7 +193,7 @@ public:
    * block in the shader.
    * @param {number[]|Float32Array} data Flattened data
    */
-  void updateUniformDirectly(const std::string& uniformName,
+  void updateUniformDirectly(const UniformName& uniformName,
                              const Float32Array& data);
 
   /**
@@ -216,43 +217,54 @@ private:
    */
   void _fillAlignment(size_t size);
 
+  /**
+   * @brief Returns the location of the uniform in the buffer, or
+   * UniformName::npos if the uniform was not added.
+   */
+  size_t _getUniformLocation(const UniformName& name) const;
+
+  /**
+   * @brief Reserves the location of a new uniform at the end of the layout.
+   */
+  void _addUniformLocation(const UniformName& name, size_t size);
+
   // Update methods
-  void _updateMatrix3x3ForUniform(const std::string& name,
+  void _updateMatrix3x3ForUniform(const UniformName& name,
                                   const Float32Array& matrix);
-  void _updateMatrix3x3ForEffect(const std::string& name,
+  void _updateMatrix3x3ForEffect(const UniformName& name,
                                  const Float32Array& matrix);
-  void _updateMatrix2x2ForEffect(const std::string& name,
+  void _updateMatrix2x2ForEffect(const UniformName& name,
                                  const Float32Array& matrix);
-  void _updateMatrix2x2ForUniform(const std::string& name,
+  void _updateMatrix2x2ForUniform(const UniformName& name,
                                   const Float32Array& matrix);
-  void _updateFloatForEffect(const std::string& name, float x);
-  void _updateFloatForUniform(const std::string& name, float x);
-  void _updateFloat2ForEffect(const std::string& name, float x, float y,
+  void _updateFloatForEffect(const UniformName& name, float x);
+  void _updateFloatForUniform(const UniformName& name, float x);
+  void _updateFloat2ForEffect(const UniformName& name, float x, float y,
                               const std::string& suffix = "");
-  void _updateFloat2ForUniform(const std::string& name, float x, float y,
+  void _updateFloat2ForUniform(const UniformName& name, float x, float y,
                                const std::string& suffix = "");
-  void _updateFloat3ForEffect(const std::string& name, float x, float y,
+  void _updateFloat3ForEffect(const UniformName& name, float x, float y,
                               float z, const std::string& suffix = "");
-  void _updateFloat3ForUniform(const std::string& name, float x, float y,
+  void _updateFloat3ForUniform(const UniformName& name, float x, float y,
                                float z, const std::string& suffix = "");
-  void _updateFloat4ForEffect(const std::string& name, float x, float y,
+  void _updateFloat4ForEffect(const UniformName& name, float x, float y,
                               float z, float w, const std::string& suffix = "");
-  void _updateFloat4ForUniform(const std::string& name, float x, float y,
+  void _updateFloat4ForUniform(const UniformName& name, float x, float y,
                                float z, float w,
                                const std::string& suffix = "");
-  void _updateMatrixForEffect(const std::string& name, const Matrix& mat);
-  void _updateMatrixForUniform(const std::string& name, const Matrix& mat);
-  void _updateVector3ForEffect(const std::string& name, const Vector3& vector);
-  void _updateVector3ForUniform(const std::string& name, const Vector3& vector);
-  void _updateVector4ForEffect(const std::string& name, const Vector4& vector);
-  void _updateVector4ForUniform(const std::string& name, const Vector4& vector);
-  void _updateColor3ForEffect(const std::string& name, const Color3& color,
+  void _updateMatrixForEffect(const UniformName& name, const Matrix& mat);
+  void _updateMatrixForUniform(const UniformName& name, const Matrix& mat);
+  void _updateVector3ForEffect(const UniformName& name, const Vector3& vector);
+  void _updateVector3ForUniform(const UniformName& name, const Vector3& vector);
+  void _updateVector4ForEffect(const UniformName& name, const Vector4& vector);
+  void _updateVector4ForUniform(const UniformName& name, const Vector4& vector);
+  void _updateColor3ForEffect(const UniformName& name, const Color3& color,
                               const std::string& suffix = "");
-  void _updateColor3ForUniform(const std::string& name, const Color3& color,
+  void _updateColor3ForUniform(const UniformName& name, const Color3& color,
                                const std::string& suffix = "");
-  void _updateColor4ForEffect(const std::string& name, const Color3& color,
+  void _updateColor4ForEffect(const UniformName& name, const Color3& color,
                               float alpha, const std::string& suffix = "");
-  void _updateColor4ForUniform(const std::string& name, const Color3& color,
+  void _updateColor4ForUniform(const UniformName& name, const Color3& color,
                                float alpha, const std::string& suffix = "");
 
 public:
@@ -263,7 +275,7 @@ public:
    * the shader.
    * @param {Float32Array} matrix
    */
-  std::function<void(const std::string& name, const Float32Array& matrix)>
+  std::function<void(const UniformName& name, const Float32Array& matrix)>
     updateMatrix3x3;
 
   /**
@@ -272,7 +284,7 @@ public:
    * the shader.
    * @param {Float32Array} matrix
    */
-  std::function<void(const std::string& name, const Float32Array& matrix)>
+  std::function<void(const UniformName& name, const Float32Array& matrix)>
     updateMatrix2x2;
 
   /**
@@ -281,7 +293,7 @@ public:
    * the shader.
    * @param {number} x
    */
-  std::function<void(const std::string& name, float x)> updateFloat;
+  std::function<void(const UniformName& name, float x)> updateFloat;
 
   /**
    * @brief Wrapper for updateUniform.
@@ -291,7 +303,7 @@ public:
    * @param {number} y
    * @param {string} [suffix] Suffix to add to the uniform name.
    */
-  std::function<void(const std::string& name, float x, float y,
+  std::function<void(const UniformName& name, float x, float y,
                      const std::string& suffix)>
     updateFloat2;
 
@@ -304,7 +316,7 @@ public:
    * @param {number} z
    * @param {string} [suffix] Suffix to add to the uniform name.
    */
-  std::function<void(const std::string& name, float x, float y, float z,
+  std::function<void(const UniformName& name, float x, float y, float z,
                      const std::string& suffix)>
     updateFloat3;
 
@@ -318,7 +330,7 @@ public:
    * @param {number} w
    * @param {string} [suffix] Suffix to add to the uniform name.
    */
-  std::function<void(const std::string& name, float x, float y, float z,
+  std::function<void(const UniformName& name, float x, float y, float z,
                      float w, const std::string& suffix)>
     updateFloat4;
 
@@ -328,7 +340,7 @@ public:
    * the shader.
    * @param {Matrix} A 4x4 matrix.
    */
-  std::function<void(const std::string& name, const Matrix& mat)> updateMatrix;
+  std::function<void(const UniformName& name, const Matrix& mat)> updateMatrix;
 
   /**
    * @brief Wrapper for updateUniform.
@@ -336,7 +348,7 @@ public:
    * the shader.
    * @param {Vector3} vector
    */
-  std::function<void(const std::string& name, const Vector3& vector)>
+  std::function<void(const UniformName& name, const Vector3& vector)>
     updateVector3;
 
   /**
@@ -345,7 +357,7 @@ public:
    * the shader.
    * @param {Vector4} vector
    */
-  std::function<void(const std::string& name, const Vector4& vector)>
+  std::function<void(const UniformName& name, const Vector4& vector)>
     updateVector4;
 
   /**
@@ -355,7 +367,7 @@ public:
    * @param {Color3} color
    * @param {string} [suffix] Suffix to add to the uniform name.
    */
-  std::function<void(const std::string& name, const Color3& color,
+  std::function<void(const UniformName& name, const Color3& color,
                      const std::string& suffix)>
     updateColor3;
 
@@ -367,7 +379,7 @@ public:
    * @param {number} alpha
    * @param {string} [suffix] Suffix to add to the uniform name.
    */
-  std::function<void(const std::string& name, const Color3& color, float alpha,
+  std::function<void(const UniformName& name, const Color3& color, float alpha,
                      const std::string& suffix)>
     updateColor4;
 
@@ -377,8 +389,9 @@ private:
   Float32Array _data;
   Float32Array _bufferData;
   bool _dynamic;
-  std::unordered_map<std::string, size_t> _uniformLocations;
-  std::unordered_map<std::string, size_t> _uniformSizes;
+  // Location and size of the uniforms, indexed by uniform name id
+  std::vector<size_t> _uniformLocations;
+  std::vector<size_t> _uniformSizes;
   size_t _uniformLocationPointer;
   bool _needSync;
   bool _noUBO;
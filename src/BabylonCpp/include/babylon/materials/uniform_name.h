@@ -0,0 +1,59 @@
+#ifndef BABYLON_MATERIALS_UNIFORM_NAME_H
+#define BABYLON_MATERIALS_UNIFORM_NAME_H
+
+#include <limits>
+#include <string>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Name of a uniform interned in a process-wide table.
+ *
+ * Each name gets a dense integer id the first time it is seen, the effects and
+ * uniform buffers resolve the id to the slot of the uniform with an array
+ * lookup. A name is hashed once when the object is created, so the hot bind
+ * paths keep their uniform names in static objects.
+ */
+class BABYLON_SHARED_EXPORT UniformName {
+
+public:
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+public:
+  UniformName(const char* name);
+  UniformName(const std::string& name);
+  UniformName(const UniformName& other) = default;
+  UniformName& operator=(const UniformName& other) = default;
+  ~UniformName();
+
+  bool operator==(const UniformName& other) const;
+  bool operator!=(const UniformName& other) const;
+
+  /**
+   * @brief Returns the id of the name.
+   */
+  size_t id() const;
+
+  /**
+   * @brief Returns the name.
+   */
+  const std::string& str() const;
+
+  /**
+   * @brief Returns the number of interned names.
+   */
+  static size_t Count();
+
+private:
+  static size_t _Intern(const std::string& name);
+
+private:
+  size_t _id;
+
+}; // end of class UniformName
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATERIALS_UNIFORM_NAME_H
@@ -54,6 +54,21 @@ public:
          bool postponeInternalCreation = false, bool instanced = false,
          bool useBytes = false);
 
+  /**
+   * @brief Constructor
+   * @param engine the engine
+   * @param data the raw bytes to use for this buffer, possibly holding
+   * interleaved components of different types
+   * @param updatable whether the data is updatable
+   * @param byteStride the stride in bytes
+   * @param postponeInternalCreation whether to postpone creating the internal
+   * WebGL buffer (optional)
+   * @param instanced whether the buffer is instanced (optional)
+   */
+  Buffer(Engine* engine, const ArrayBuffer& data, bool updatable,
+         size_t byteStride, bool postponeInternalCreation = false,
+         bool instanced = false);
+
   virtual ~Buffer();
 
   /**
@@ -66,17 +81,33 @@ public:
    * to apply to reach next value when data is interleaved)
    * @param instanced defines if the vertex buffer contains indexed data
    * @param useBytes defines if the offset and stride are in bytes
+   * @param type defines the type of the components (FLOAT by default)
+   * @param normalized defines if the integer components are normalized
    * @returns the new vertex buffer
    */
   std::unique_ptr<VertexBuffer>
   createVertexBuffer(unsigned int kind, size_t offset, int size,
-                     std::optional<size_t> stride  = std::nullopt,
-                     std::optional<bool> instanced = std::nullopt,
-                     bool useBytes                 = false);
+                     std::optional<size_t> stride     = std::nullopt,
+                     std::optional<bool> instanced    = std::nullopt,
+                     bool useBytes                    = false,
+                     std::optional<unsigned int> type = std::nullopt,
+                     bool normalized                  = false);
 
   // Properties
   bool isUpdatable() const;
   Float32Array& getData();
+
+  /**
+   * @brief Returns the raw bytes of the buffer, empty when the buffer holds
+   * float data.
+   */
+  ArrayBuffer& getRawData();
+
+  /**
+   * @brief Returns true if the buffer holds raw bytes instead of floats.
+   */
+  bool isRaw() const;
+
   GL::IGLBuffer* getBuffer();
 
   /**
@@ -96,6 +127,20 @@ public:
   GL::IGLBuffer* create(Float32Array data = {});
   GL::IGLBuffer* update(const Float32Array& data);
 
+  /**
+   * @brief Replaces the raw bytes of the buffer and uploads them.
+   * @param data the new raw data
+   * @returns the updated buffer
+   */
+  GL::IGLBuffer* update(const ArrayBuffer& data);
+
+  /**
+   * @brief Uploads the data kept on the CPU, after it was modified in place.
+   * Only updatable buffers can be updated.
+   * @returns the updated buffer
+   */
+  GL::IGLBuffer* update();
+
   /**
    * @brief Updates the data directly.
    * @param data the new data
@@ -116,6 +161,11 @@ public:
    */
   Float32Array _data;
 
+  /**
+   * Hidden
+   */
+  ArrayBuffer _rawData;
+
   /**
    * Gets the byte stride
    */
@@ -126,6 +176,7 @@ private:
   std::unique_ptr<GL::IGLBuffer> _buffer;
   bool _updatable;
   bool _instanced;
+  bool _isRaw;
 
 }; // end of class Buffer
 
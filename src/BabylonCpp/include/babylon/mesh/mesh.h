@@ -19,12 +19,15 @@ class IAnimatable;
 class IcoSphereOptions;
 class InstancedMesh;
 struct IParticleSystem;
+struct ISimplificationSettings;
 class LinesMesh;
 class Mesh;
 class MeshLODLevel;
 class MorphTargetManager;
 class PolyhedronOptions;
+class SoftwareSkinning;
 class VertexBuffer;
+class VertexDataView;
 using GroundMeshPtr         = std::shared_ptr<GroundMesh>;
 using IAnimatablePtr        = std::shared_ptr<IAnimatable>;
 using InstancedMeshPtr      = std::shared_ptr<InstancedMesh>;
@@ -222,6 +225,21 @@ public:
   Float32Array getVerticesData(unsigned int kind, bool copyWhenShared = false,
                                bool forceCopy = false) override;
 
+  /**
+   * @brief Returns a view over the vertex data of the requested `kind`,
+   * without copying it. The view is empty if the mesh has no geometry or if
+   * the data cannot be viewed in place, see getVerticesData() in that case.
+   * The view must be followed by a call to updateVerticesDataView() when the
+   * data is modified.
+   * @param kind defines the data kind (Position, normal, etc...)
+   * @param copyWhenShared defines if the geometry is made unique before
+   * returning the view when it is shared between multiple meshes, so that the
+   * modifications do not affect the other meshes
+   * @returns a view over the vertex data
+   */
+  VertexDataView getVerticesDataView(unsigned int kind,
+                                     bool copyWhenShared = false);
+
   /**
    * @brief Returns the mesh VertexBuffer object from the requested `kind` :
    * positions, indices, normals, etc.
@@ -392,6 +410,28 @@ public:
                            bool updateExtends = false,
                            bool makeItUnique  = false) override;
 
+  /**
+   * @brief Updates the vertex buffer of the requested `kind` with its data
+   * modified in place through getVerticesDataView().
+   * @param kind defines the data kind (Position, normal, etc...)
+   * @param updateExtends defines if the bounding info must be recomputed
+   * @returns The Mesh.
+   */
+  Mesh& updateVerticesDataView(unsigned int kind, bool updateExtends = false);
+
+  /**
+   * @brief Converts the vertex data of the requested `kind` to a more compact
+   * type, see Geometry::quantizeVerticesData(). The geometry is converted for
+   * all the meshes sharing it.
+   * @param kind defines the data kind (Position, normal, etc...)
+   * @param type defines the type of the stored components
+   * (VertexBuffer::HALF_FLOAT, VertexBuffer::BYTE, etc...)
+   * @param normalized defines if the integer components are normalized
+   * @returns The Mesh.
+   */
+  Mesh& quantizeVerticesData(unsigned int kind, unsigned int type,
+                             bool normalized);
+
   /**
    * @brief This method updates the vertex positions of an updatable mesh
    * according to
@@ -746,16 +786,43 @@ public:
    */
   Mesh& synchronizeInstances();
 
+  /**
+   * @brief Simplify the mesh according to the given array of settings.
+   * Function will return immediately and will simplify async. The decimation
+   * runs on background threads, the simplified meshes are added as LOD levels
+   * from the render loop.
+   * @param settings a collection of simplification settings
+   * @param parallelProcessing should all levels calculate parallel or one
+   * after the other
+   * @param simplificationType the type of simplification to run
+   * @param successCallback optional success callback to be called after the
+   * simplification finished processing all settings
+   * @returns the current mesh
+   */
+  Mesh& simplify(
+    const std::vector<ISimplificationSettings>& settings,
+    bool parallelProcessing               = true,
+    SimplificationType simplificationType = SimplificationType::QUADRATIC,
+    const std::function<void()>& successCallback = nullptr);
+
   /**
    * @brief Optimization of the mesh's indices, in case a mesh has duplicated
    * vertices. The function will only reorder the indices and will not remove
    * unused vertices to avoid problems with submeshes.
    * This should be used together with the simplification to avoid disappearing
    * triangles.
+   * The triangles of each submesh are also reordered for the vertex cache and
+   * the vertices in the order of their first use, see MeshOptimizer to
+   * optimize the vertex data offline or on a worker thread.
    * @param successCallback an optional success callback to be called after the
    * optimization finished.
+   * @param optimizeOverdraw defines if the triangles are also reordered to
+   * reduce the overdraw
+   * @returns the current mesh
    */
-  void optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback);
+  Mesh& optimizeIndices(
+    const std::function<void(Mesh* mesh)>& successCallback = nullptr,
+    bool optimizeOverdraw                                  = false);
 
   /**
    * @brief Hidden
@@ -1478,6 +1545,7 @@ protected:
 private:
   void _sortLODLevels();
   Float32Array _getPositionData(bool applySkeleton);
+  VertexDataView _getVerticesDataView(unsigned int kind, Float32Array& copy);
   Mesh& _onBeforeDraw(bool isInstance, Matrix& world,
                       Material* effectiveMaterial);
   Mesh& _queueLoad(Scene* scene);
@@ -1580,6 +1648,10 @@ private:
   Float32Array _sourcePositions;
   // Will be used to save original normals when using software skinning
   Float32Array _sourceNormals;
+  // Will be used to skin the vertices when using software skinning
+  std::unique_ptr<SoftwareSkinning> _softwareSkinning;
+  Float32Array _skinnedPositions;
+  Float32Array _skinnedNormals;
   // Will be used to save a source mesh reference, If any
   Mesh* _source;
   // For extrusion and tube
@@ -8,23 +8,24 @@
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief Triangle of a mesh being decimated.
  */
 class BABYLON_SHARED_EXPORT DecimationTriangle {
 
 public:
-  DecimationTriangle(const std::vector<DecimationVertex>& vertices);
+  DecimationTriangle(const std::array<DecimationVertex*, 3>& vertices);
   ~DecimationTriangle();
 
 public:
   Vector3 normal;
-  std::array<int, 4> error;
+  std::array<float, 4> error;
   bool deleted;
   bool isDirty;
   float borderFactor;
   bool deletePending;
-  float originalOffset;
-  std::vector<DecimationVertex> vertices;
+  size_t originalOffset;
+  // The vertices are shared with the adjacent triangles
+  std::array<DecimationVertex*, 3> vertices;
 
 }; // end of class DecimationTriangle
 
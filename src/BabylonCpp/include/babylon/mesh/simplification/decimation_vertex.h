@@ -8,7 +8,7 @@
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief Vertex of a mesh being decimated.
  */
 class BABYLON_SHARED_EXPORT DecimationVertex {
 
@@ -25,7 +25,8 @@ public:
   bool isBorder;
   int triangleStart;
   int triangleCount;
-  Float32Array originalOffsets;
+  // Offsets of the source vertices merged into this vertex
+  Uint32Array originalOffsets;
 
 }; // end of class DecimationVertex
 
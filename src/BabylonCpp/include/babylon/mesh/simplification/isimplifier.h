@@ -1,28 +1,51 @@
 #ifndef BABYLON_MESH_SIMPLIFICATION_ISIMPLIFIER_H
 #define BABYLON_MESH_SIMPLIFICATION_ISIMPLIFIER_H
 
+#include <functional>
+#include <memory>
+
 #include <babylon/babylon_api.h>
 
 namespace BABYLON {
 
+class Mesh;
+struct ISimplificationSettings;
+using MeshPtr = std::shared_ptr<Mesh>;
+
 /**
  * @brief A simplifier interface for future simplification implementations.
  */
 class BABYLON_SHARED_EXPORT ISimplifier {
 
 public:
+  virtual ~ISimplifier() = default;
+
   /**
    * Simplification of a given mesh according to the given settings.
-   * Since this requires computation, it is assumed that the function runs
-   * async.
    * @param settings The settings of the simplification, including quality and
    * distance
    * @param successCallback A callback that will be called after the mesh was
    * simplified.
-   * @param errorCallback in case of an error, this callback will be called.
-   * optional.
    */
-  virtual void simplify() = 0;
+  virtual void
+  simplify(const ISimplificationSettings& settings,
+           const std::function<void(const MeshPtr& simplifiedMesh)>&
+             successCallback)
+    = 0;
+
+  /**
+   * Runs the computation of the simplification on the data of the mesh copied
+   * when the simplifier was created. It does not access the mesh or the scene,
+   * so it can run on a worker thread.
+   * @param settings The settings of the simplification
+   */
+  virtual void decimate(const ISimplificationSettings& settings) = 0;
+
+  /**
+   * Creates the simplified mesh from the result of decimate(), from the render
+   * thread.
+   */
+  virtual MeshPtr createSimplifiedMesh() = 0;
 
 }; // end of class ISimplifier
 
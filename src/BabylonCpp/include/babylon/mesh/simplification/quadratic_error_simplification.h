@@ -1,11 +1,22 @@
 #ifndef BABYLON_MESH_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 #define BABYLON_MESH_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 
+#include <vector>
+
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/mesh/simplification/decimation_triangle.h>
+#include <babylon/mesh/simplification/decimation_vertex.h>
 #include <babylon/mesh/simplification/isimplifier.h>
+#include <babylon/mesh/simplification/reference.h>
 
 namespace BABYLON {
 
+class Material;
+class Node;
+class Scene;
+using MaterialPtr = std::shared_ptr<Material>;
+
 /**
  * @brief An implementation of the Quadratic Error simplification algorithm.
  * Original paper : http://www1.cs.columbia.edu/~cs4162/html05s/garland97.pdf
@@ -13,13 +24,90 @@ namespace BABYLON {
  * http://voxels.blogspot.de/2014/05/quadric-mesh-simplification-with-source.html
  * to babylon JS
  * @author RaananW
+ *
+ * The vertex data of the mesh is copied when the simplifier is created, so
+ * that the decimation can run on a worker thread.
  */
 class BABYLON_SHARED_EXPORT QuadraticErrorSimplification : public ISimplifier {
 
 public:
-  QuadraticErrorSimplification();
+  /**
+   * Range of vertices and indices of a submesh
+   */
+  struct SubMeshData {
+    unsigned int materialIndex;
+    size_t verticesStart;
+    size_t verticesCount;
+    size_t indexStart;
+    size_t indexCount;
+  }; // end of struct SubMeshData
+
+  /**
+   * Vertex data of a mesh
+   */
+  struct MeshData {
+    Float32Array positions;
+    Float32Array normals;
+    Float32Array uvs;
+    Float32Array colors;
+    IndicesArray indices;
+    std::vector<SubMeshData> subMeshes;
+  }; // end of struct MeshData
+
+public:
+  QuadraticErrorSimplification(Mesh* mesh);
+  QuadraticErrorSimplification(const MeshData& meshData);
   virtual ~QuadraticErrorSimplification();
 
+  void simplify(const ISimplificationSettings& settings,
+                const std::function<void(const MeshPtr& simplifiedMesh)>&
+                  successCallback) override;
+  void decimate(const ISimplificationSettings& settings) override;
+  MeshPtr createSimplifiedMesh() override;
+
+  /**
+   * @brief Returns the vertex data of the simplified mesh computed by
+   * decimate().
+   */
+  const MeshData& simplifiedData() const;
+
+private:
+  void runDecimation(const ISimplificationSettings& settings,
+                     size_t submeshIndex);
+  void initWithMesh(size_t submeshIndex, bool optimizeMesh);
+  void init();
+  void reconstructMesh(size_t submeshIndex);
+  bool isFlipped(DecimationVertex& vertex1, DecimationVertex& vertex2,
+                 const Vector3& point, std::vector<bool>& deletedArray,
+                 std::vector<DecimationTriangle*>& delTr);
+  size_t updateTriangles(DecimationVertex& origVertex,
+                         DecimationVertex& vertex,
+                         const std::vector<bool>& deletedArray,
+                         size_t deletedTriangles);
+  void identifyBorder();
+  void updateMesh(bool identifyBorders = false);
+  float vertexError(const QuadraticMatrix& q, const Vector3& point) const;
+  float calculateError(const DecimationVertex& vertex1,
+                       const DecimationVertex& vertex2,
+                       Vector3* pointResult = nullptr) const;
+
+public:
+  float aggressiveness;
+  unsigned int decimationIterations;
+
+private:
+  std::vector<DecimationTriangle> _triangles;
+  std::vector<DecimationVertex> _vertices;
+  std::vector<Reference> _references;
+  MeshData _source;
+  MeshData _simplified;
+  // Properties of the source mesh applied to the simplified mesh
+  std::string _name;
+  Scene* _scene;
+  Node* _parent;
+  MaterialPtr _material;
+  int _renderingGroupId;
+
 }; // end of class QuadraticErrorSimplification
 
 } // end of namespace BABYLON
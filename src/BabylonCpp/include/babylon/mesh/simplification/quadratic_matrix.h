@@ -8,7 +8,7 @@
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief Symmetric 4x4 matrix of the quadric error of a vertex.
  */
 class BABYLON_SHARED_EXPORT QuadraticMatrix {
 
@@ -24,16 +24,16 @@ public:
   float det(unsigned int a11, unsigned int a12, unsigned int a13, //
             unsigned int a21, unsigned int a22, int unsigned a23, //
             int unsigned a31, int unsigned a32, int unsigned a33  //
-  );
+  ) const;
   void addInPlace(const QuadraticMatrix& matrix);
   void addArrayInPlace(const std::array<float, 10>& data);
-  QuadraticMatrix add(const QuadraticMatrix& matrix);
+  QuadraticMatrix add(const QuadraticMatrix& matrix) const;
 
   static QuadraticMatrix FromData(float a, float b, float c, float d);
   static std::array<float, 10> DataFromNumbers(float a, float b, float c,
                                                float d);
 
-private:
+public:
   std::array<float, 10> data;
 
 }; // end of class QuadraticMatrix
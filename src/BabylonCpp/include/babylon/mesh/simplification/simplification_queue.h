@@ -1,6 +1,8 @@
 #ifndef BABYLON_MESH_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 #define BABYLON_MESH_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 
+#include <future>
+#include <memory>
 #include <queue>
 
 #include <babylon/babylon_api.h>
@@ -11,7 +13,12 @@ namespace BABYLON {
 class ISimplifier;
 
 /**
- * @brief
+ * @brief Queue used to order the simplification tasks.
+ *
+ * The tasks are run one after the other. The decimation of a task runs on
+ * background threads, the simplified meshes are created and added as LOD
+ * levels on the render thread by update().
+ * @see http://doc.babylonjs.com/how_to/in-browser_mesh_simplification
  */
 class BABYLON_SHARED_EXPORT SimplificationQueue {
 
@@ -23,14 +30,33 @@ public:
   void executeNext();
   void runSimplification(const ISimplificationTask& task);
 
+  /**
+   * @brief Adds the LOD levels of the finished decimations to the mesh of the
+   * running task, must be called from the render thread.
+   */
+  void update();
+
 private:
-  ISimplifier* getSimplifier(const ISimplificationTask& task);
+  /**
+   * Decimation of a mesh for one of the settings of a task
+   */
+  struct Simplification {
+    ISimplificationSettings settings;
+    // Declared before the future so that it outlives the decimation
+    std::unique_ptr<ISimplifier> simplifier;
+    std::future<void> future;
+  }; // end of struct Simplification
+
+  std::unique_ptr<ISimplifier> getSimplifier(const ISimplificationTask& task);
+  void startSimplification(Simplification& simplification);
 
 public:
   bool running;
 
 private:
   std::queue<ISimplificationTask> _simplificationQueue;
+  ISimplificationTask _runningTask;
+  std::vector<std::unique_ptr<Simplification>> _simplifications;
 
 }; // end of class SimplificationQueue
 
@@ -0,0 +1,86 @@
+#ifndef BABYLON_MESH_SOFTWARE_SKINNING_H
+#define BABYLON_MESH_SOFTWARE_SKINNING_H
+
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class ThreadPool;
+
+/**
+ * @brief Skinning of the positions and normals of a mesh on the CPU.
+ *
+ * The bone matrices of the previous update are kept, so that the vertices only
+ * influenced by bones which did not move are skipped. The skinned vertices are
+ * therefore expected to be written to the same arrays on every update.
+ */
+class BABYLON_SHARED_EXPORT SoftwareSkinning {
+
+public:
+  /**
+   * Number of vertices skinned by a parallel task
+   */
+  static constexpr size_t VerticesPerTask = 4096;
+
+  /**
+   * @brief Vertex arrays of a skinning update, the influence arrays hold 4
+   * floats per vertex and the extra influence arrays are null for meshes with
+   * at most 4 bone influencers.
+   */
+  struct Vertices {
+    const float* sourcePositions      = nullptr;
+    const float* sourceNormals        = nullptr;
+    const float* matricesIndices      = nullptr;
+    const float* matricesWeights      = nullptr;
+    const float* matricesIndicesExtra = nullptr;
+    const float* matricesWeightsExtra = nullptr;
+    float* positions                  = nullptr;
+    float* normals                    = nullptr;
+    size_t vertexCount                = 0;
+  }; // end of struct Vertices
+
+public:
+  SoftwareSkinning();
+  SoftwareSkinning(const SoftwareSkinning& other) = delete;
+  SoftwareSkinning& operator=(const SoftwareSkinning& other) = delete;
+  ~SoftwareSkinning();
+
+  /**
+   * @brief Skins the vertices with the given bone matrices.
+   * @param boneMatrices defines the 16 floats of every bone matrix
+   * @param vertices defines the source and destination arrays
+   * @param threadPool defines the optional pool skinning large meshes in
+   * parallel
+   * @returns false if no bone moved since the previous update, the vertices
+   * are left untouched in that case
+   */
+  bool apply(const Float32Array& boneMatrices, const Vertices& vertices,
+             ThreadPool* threadPool = nullptr);
+
+  /**
+   * @brief Forces the next update to skin all the vertices, to be called when
+   * the vertex arrays changed.
+   */
+  void invalidate();
+
+private:
+  bool _updateBones(const Float32Array& boneMatrices);
+  bool _isAffected(const float* matricesIndices, const float* matricesWeights,
+                   size_t offset) const;
+  void _skin(const Vertices& vertices, size_t start, size_t end) const;
+
+private:
+  Float32Array _boneMatrices;
+  // 1 if the matrix of the bone changed in the current update
+  std::vector<std::uint8_t> _changedBones;
+  bool _skinAllVertices;
+
+}; // end of class SoftwareSkinning
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESH_SOFTWARE_SKINNING_H
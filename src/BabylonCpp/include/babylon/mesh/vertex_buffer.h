@@ -12,6 +12,7 @@ namespace BABYLON {
 
 class Buffer;
 class DataView;
+class VertexDataView;
 class Engine;
 class Scene;
 
@@ -126,6 +127,11 @@ public:
    */
   static constexpr const unsigned int FLOAT = 5126;
 
+  /**
+   * The half float type.
+   */
+  static constexpr const unsigned int HALF_FLOAT = 5131;
+
 public:
   /**
    * @brief Constructor
@@ -155,6 +161,28 @@ public:
                bool normalized = false, bool useBytes = false);
   virtual ~VertexBuffer();
 
+  /**
+   * @brief Creates a vertex buffer storing its components with the given
+   * type, e.g. half float UVs, normalized bytes normals or unsigned bytes bone
+   * indices. The float data is encoded once, the buffer keeps the raw bytes
+   * only.
+   * @param engine the engine
+   * @param data the float data to encode
+   * @param kind the vertex buffer kind
+   * @param type the type of the stored components
+   * @param normalized whether the integer components are normalized
+   * @param updatable whether the data is updatable
+   * @param size the number of components (optional, deduced from the kind)
+   * @param postponeInternalCreation whether to postpone creating the internal
+   * WebGL buffer (optional)
+   * @returns the new vertex buffer
+   */
+  static std::unique_ptr<VertexBuffer>
+  CreateTyped(Engine* engine, const Float32Array& data, unsigned int kind,
+              unsigned int type, bool normalized, bool updatable,
+              const std::optional<size_t>& size = std::nullopt,
+              bool postponeInternalCreation     = false);
+
   /** Statics **/
   static std::string KindAsString(unsigned int kind);
 
@@ -187,6 +215,20 @@ public:
    */
   Float32Array& getData();
 
+  /**
+   * @brief Returns the raw bytes of the VertexBuffer, empty when the data is
+   * stored as floats.
+   */
+  ArrayBuffer& getRawData();
+
+  /**
+   * @brief Returns a view over the data of the VertexBuffer, without copying
+   * it. The view is empty if the data is not stored as floats or is not kept
+   * on the CPU.
+   * @param vertexCount defines the number of vertices to view
+   */
+  VertexDataView getDataView(size_t vertexCount);
+
   /**
    * @brief Returns the WebGLBuffer associated to the VertexBuffer.
    */
@@ -241,12 +283,20 @@ public:
    */
   GL::IGLBuffer* update(const Float32Array& data);
 
+  /**
+   * @brief Updates the underlying WebGLBuffer with the data of the
+   * VertexBuffer, after it was modified in place through a view.
+   * @returns The updated WebGLBuffer.
+   */
+  GL::IGLBuffer* update();
+
   /**
    *@brief  Updates directly the underlying WebGLBuffer according to the passed
    *numeric array or Float32Array. Returns the directly updated WebGLBuffer.
    * @param data the new data
    * @param offset the new offset
    * @param useBytes set to true if the offset is in bytes
+   * @returns nullptr for typed data, which can only be updated with update()
    */
   GL::IGLBuffer* updateDirectly(const Float32Array& data, size_t offset,
                                 bool useBytes = false);
@@ -271,6 +321,32 @@ public:
    */
   static unsigned int GetTypeByteLength(unsigned int type);
 
+  /**
+   * @brief Gets the byte stride of tightly packed vertices, rounded up to a
+   * multiple of 4 bytes as required for the alignment of vertex attributes.
+   * @param componentCount the number of components per vertex
+   * @param type the type of the components
+   * @returns the aligned byte stride
+   */
+  static size_t GetAlignedByteStride(size_t componentCount, unsigned int type);
+
+  /**
+   * @brief Encodes float data as components of the given type, the reverse of
+   * ForEach().
+   * @param data the float data to encode, holding componentCount values per
+   * vertex
+   * @param componentCount the number of components per vertex
+   * @param type the type of the encoded components
+   * @param normalized whether the integer components are normalized, values
+   * are then expected in [-1, 1] for signed types and [0, 1] for unsigned ones
+   * @param byteStride the byte stride of the encoded data (aligned byte stride
+   * by default)
+   * @returns the encoded bytes
+   */
+  static ArrayBuffer Encode(const Float32Array& data, size_t componentCount,
+                            unsigned int type, bool normalized,
+                            size_t byteStride = 0);
+
   /**
    * @brief Enumerates each value of the given parameters as numbers.
    * @param data the data to enumerate
@@ -320,6 +396,13 @@ private:
 
   static float _GetFloatValue(const DataView& dataView, unsigned int type,
                               size_t byteOffset, bool normalized);
+  static void _Encode(const Float32Array& data, size_t componentCount,
+                      unsigned int type, bool normalized, size_t byteOffset,
+                      size_t byteStride, ArrayBuffer& target);
+  static void _SetFloatValue(ArrayBuffer& data, unsigned int type,
+                             size_t byteOffset, float value, bool normalized);
+  static float _HalfToFloat(uint16_t value);
+  static uint16_t _FloatToHalf(float value);
 
 public:
   /**
@@ -20,6 +20,7 @@ class SphereOptions;
 class TiledGroundOptions;
 class TorusKnotOptions;
 class TorusOptions;
+class ThreadPool;
 
 /**
  * @brief This class contains the various kinds of data on every vertex of a
@@ -27,6 +28,12 @@ class TorusOptions;
  */
 class BABYLON_SHARED_EXPORT VertexData {
 
+public:
+  /**
+   * Number of facets processed by a task of ComputeNormals()
+   */
+  static constexpr size_t FacetsPerTask = 16384;
+
 public:
   VertexData();
   ~VertexData();
@@ -551,6 +558,39 @@ public:
                              std::optional<FacetParameters> options
                              = std::nullopt);
 
+  /**
+   * @brief Compute normals for given positions and indices, and the facet data
+   * requested by the options. The facet normals, positions, partitioning and
+   * depth sorted facets are written in the options.
+   * @param positions an array of vertex positions, [...., x, y, z, ......]
+   * @param indices an array of indices in groups of three for each triangular
+   * facet, [...., i, j, k, ......]
+   * @param normals an array of vertex normals, [...., x, y, z, ......]
+   * @param options the facet parameters, see above
+   * @param threadPool the pool used to process large meshes in parallel
+   * (optional)
+   */
+  static void ComputeNormals(const Float32Array& positions,
+                             const Uint32Array& indices, Float32Array& normals,
+                             FacetParameters& options,
+                             ThreadPool* threadPool = nullptr);
+
+  /**
+   * @brief Compute normals for given positions and indices, large meshes are
+   * processed in parallel with the given thread pool. The face normals are
+   * accumulated in a bucket per task holding the range of vertices referenced
+   * by its facets, the buckets are then summed per vertex in task order so
+   * the result does not depend on the scheduling.
+   * @param positions an array of vertex positions, [...., x, y, z, ......]
+   * @param indices an array of indices in groups of three for each triangular
+   * facet, [...., i, j, k, ......]
+   * @param normals an array of vertex normals, [...., x, y, z, ......]
+   * @param threadPool the pool used to process large meshes in parallel
+   */
+  static void ComputeNormals(const Float32Array& positions,
+                             const Uint32Array& indices, Float32Array& normals,
+                             ThreadPool* threadPool);
+
   /**
    * @brief Applies VertexData created from the imported parameters to the
    * geometry.
@@ -577,6 +617,13 @@ private:
   static std::unique_ptr<VertexData>
   _ExtractFrom(IGetSetVerticesData* meshOrGeometry, bool copyWhenShared = false,
                bool forceCopy = false);
+  static void _ComputeNormals(const Float32Array& positions,
+                              const Uint32Array& indices, Float32Array& normals,
+                              FacetParameters* options, ThreadPool* threadPool);
+  static void _PartitionFacets(const Float32Array& positions,
+                               const Uint32Array& indices,
+                               FacetParameters& options);
+  static void _NormalizeNormals(float* normals, size_t start, size_t end);
 
 public:
   /**
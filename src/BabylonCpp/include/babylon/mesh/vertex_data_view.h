@@ -0,0 +1,104 @@
+#ifndef BABYLON_MESH_VERTEX_DATA_VIEW_H
+#define BABYLON_MESH_VERTEX_DATA_VIEW_H
+
+#include <algorithm>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Non owning view over the float vertex data of one kind.
+ *
+ * The components of a vertex are addressed through the offset and the stride
+ * of the vertex buffer, so that interleaved buffers are viewed without being
+ * unpacked. The view points to the data kept on the CPU by the buffer, it is
+ * invalidated when that data is replaced, e.g. by setVerticesData().
+ */
+class BABYLON_SHARED_EXPORT VertexDataView {
+
+public:
+  VertexDataView() : _data{nullptr}, _vertexCount{0}, _size{0}, _stride{0}
+  {
+  }
+
+  /**
+   * @brief Constructor
+   * @param data defines the first component of the first vertex
+   * @param vertexCount defines the number of vertices
+   * @param size defines the number of components of a vertex
+   * @param stride defines the number of floats between two vertices
+   */
+  VertexDataView(float* data, size_t vertexCount, size_t size, size_t stride)
+      : _data{data}, _vertexCount{vertexCount}, _size{size}, _stride{stride}
+  {
+  }
+
+  bool empty() const
+  {
+    return _vertexCount == 0;
+  }
+
+  float* data() const
+  {
+    return _data;
+  }
+
+  size_t vertexCount() const
+  {
+    return _vertexCount;
+  }
+
+  size_t size() const
+  {
+    return _size;
+  }
+
+  size_t stride() const
+  {
+    return _stride;
+  }
+
+  /**
+   * @brief Returns true if the components of the vertices are contiguous.
+   */
+  bool isTightlyPacked() const
+  {
+    return _stride == _size;
+  }
+
+  /**
+   * @brief Returns the first component of a vertex.
+   */
+  float* operator[](size_t vertexIndex) const
+  {
+    return _data + vertexIndex * _stride;
+  }
+
+  /**
+   * @brief Returns a tightly packed copy of the viewed data.
+   */
+  Float32Array toArray() const
+  {
+    if (isTightlyPacked()) {
+      return Float32Array(_data, _data + _vertexCount * _size);
+    }
+    Float32Array result(_vertexCount * _size);
+    for (size_t i = 0; i < _vertexCount; ++i) {
+      std::copy_n((*this)[i], _size, result.data() + i * _size);
+    }
+    return result;
+  }
+
+private:
+  float* _data;
+  size_t _vertexCount;
+  size_t _size;
+  size_t _stride;
+
+}; // end of class VertexDataView
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESH_VERTEX_DATA_VIEW_H
@@ -326,6 +326,27 @@ struct BABYLON_SHARED_EXPORT IParticleSystem : public IDisposable {
    */
   virtual void animate(bool preWarmOnly = false) = 0;
 
+  /**
+   * @brief Hidden. Starts animating the particle system for this frame on the
+   * render thread. Systems that can not be simulated concurrently with other
+   * systems are entirely animated by this call.
+   * @returns true if _simulate and _endAnimate must be called to complete the
+   * frame
+   */
+  virtual bool _beginAnimate();
+
+  /**
+   * @brief Hidden. Advances the particles of the system for this frame. This
+   * can run on a worker thread, concurrently with the other systems.
+   */
+  virtual void _simulate();
+
+  /**
+   * @brief Hidden. Completes the animation of the particle system for this
+   * frame on the render thread.
+   */
+  virtual void _endAnimate();
+
   /**
    * @brief Renders the particle system in its current state.
    * @returns the current number of particles.
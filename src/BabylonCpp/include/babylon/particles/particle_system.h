@@ -3,8 +3,10 @@
 
 #include <babylon/animations/ianimatable.h>
 #include <babylon/babylon_api.h>
+#include <babylon/core/random.h>
 #include <babylon/particles/base_particle_system.h>
 #include <babylon/particles/iparticle_system.h>
+#include <babylon/particles/soa_particle_pool.h>
 #include <babylon/tools/observable.h>
 #include <babylon/tools/observer.h>
 
@@ -199,6 +201,19 @@ public:
    */
   std::vector<Particle*>& particles();
 
+  /**
+   * @brief Gets the structure of arrays pool holding the active particles when
+   * useStructureOfArrays is enabled.
+   */
+  SoAParticlePool& particlePool();
+
+  /**
+   * @brief Gets the random stream used to emit the particles of this system.
+   * Emitter types pick their random values from it so that the particles only
+   * depend on the random seed of the system.
+   */
+  Math::RandomStream& randomStream();
+
   /**
    * @brief Returns the string "ParticleSystem".
    * @returns a string containing the class name
@@ -290,6 +305,21 @@ public:
    */
   void animate(bool preWarmOnly = false) override;
 
+  /**
+   * @brief Hidden
+   */
+  bool _beginAnimate() override;
+
+  /**
+   * @brief Hidden
+   */
+  void _simulate() override;
+
+  /**
+   * @brief Hidden
+   */
+  void _endAnimate() override;
+
   /**
    * @brief Rebuilds the particle system.
    */
@@ -364,6 +394,28 @@ protected:
 
   void _reset() override;
 
+  /**
+   * @brief Gets whether the particles are stored in a structure of arrays
+   * pool.
+   */
+  bool get_useStructureOfArrays() const;
+
+  /**
+   * @brief Sets whether the particles are stored in a structure of arrays
+   * pool.
+   */
+  void set_useStructureOfArrays(bool value);
+
+  /**
+   * @brief Gets the seed of the random stream of the system.
+   */
+  std::uint64_t get_randomSeed() const;
+
+  /**
+   * @brief Sets the seed of the random stream of the system.
+   */
+  void set_randomSeed(std::uint64_t value);
+
 private:
   float _fetchR(float u, float v, float width, float height,
                 const Uint8Array& pixels);
@@ -381,7 +433,14 @@ private:
   void _removeFromRoot();
   void _emitFromParticle(Particle* particle);
   // End of sub system methods
+  bool _prepareStep(bool preWarmOnly);
+  void _simulateStep(bool preWarmOnly);
+  void _completeStep(bool preWarmOnly);
   void _update(int newParticles);
+  size_t _particleCount() const;
+  void _updateSoAParticles();
+  void _createSoAParticles(int newParticles);
+  void _appendSoAParticleVertices();
   Effect* _getEffect();
   void _appendParticleVertices(unsigned int offset, Particle* particle);
 
@@ -428,6 +487,23 @@ public:
                     std::function<void(ParticleSystem*, EventState&)>>
     onDispose;
 
+  /**
+   * Gets or sets whether the particles are stored in a structure of arrays pool
+   * and advanced by a vectorized kernel instead of one Particle object each.
+   * The pool supports the gravity, the color and factor gradients and the
+   * sprite sheets, but not the custom updateFunction, the noise texture and
+   * the sub-emitters. Changing it resets the active particles.
+   */
+  Property<ParticleSystem, bool> useStructureOfArrays;
+
+  /**
+   * Gets or sets the seed of the random stream used to emit the particles.
+   * Setting it restarts the stream, so a system emits the same particles for
+   * the same seed whatever the number of threads simulating the scene. The
+   * default seed is a scene unique id.
+   */
+  Property<ParticleSystem, std::uint64_t> randomSeed;
+
   unsigned int _vertexBufferSize;
 
   // Sub-emitters
@@ -471,6 +547,7 @@ private:
   bool _stopped;
   int _actualFrame;
   int _scaledUpdateSpeed;
+  int _newParticles;
 
   std::function<void(unsigned int offset, Particle* particle)>
     _appendParticleVertexes;
@@ -480,6 +557,15 @@ private:
 
   Matrix _emitterWorldMatrix;
 
+  bool _useStructureOfArrays;
+  SoAParticlePool _particlePool;
+  std::unique_ptr<SoAParticlePool::UpdateParameters> _poolUpdateParameters;
+  // Particle given to the start functions when emitting in the pool
+  std::unique_ptr<Particle> _poolSpawnParticle;
+
+  std::uint64_t _randomSeed;
+  Math::RandomStream _random;
+
 }; // end of class ParticleSystem
 
 } // end of namespace BABYLON
@@ -0,0 +1,177 @@
+#ifndef BABYLON_PARTICLES_SOA_PARTICLE_POOL_H
+#define BABYLON_PARTICLES_SOA_PARTICLE_POOL_H
+
+#include <array>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+class ColorGradient;
+struct FactorGradient;
+
+/**
+ * @brief Structure of arrays storage for the particles of a particle system.
+ *
+ * Every particle attribute is stored in its own contiguous array, so that the
+ * update kernel streams through memory and processes several particles per
+ * instruction. Dead particles are recycled by moving the last particle into
+ * their slot, the alive particles always occupy the range [0, size()).
+ */
+class BABYLON_SHARED_EXPORT SoAParticlePool {
+
+public:
+  /**
+   * Number of samples of the gradient tables
+   */
+  static constexpr size_t GradientTableSize = 64;
+
+  /**
+   * @brief Gradient sampled over the life time ratio of a particle. A particle
+   * interpolates between both sample sets using its gradient seed, which
+   * replaces the random pick between the two factors of a gradient.
+   */
+  struct GradientTable {
+    bool enabled = false;
+    std::array<float, GradientTableSize> values1;
+    std::array<float, GradientTableSize> values2;
+  }; // end of struct GradientTable
+
+  /**
+   * @brief Parameters of a simulation step.
+   */
+  struct UpdateParameters {
+    float deltaTime = 0.f;
+    Vector3 gravity;
+    // Red, green, blue and alpha
+    std::array<GradientTable, 4> colorGradient;
+    GradientTable sizeGradient;
+    GradientTable angularSpeedGradient;
+    GradientTable velocityGradient;
+    GradientTable limitVelocityGradient;
+    GradientTable dragGradient;
+    float limitVelocityDamping = 0.4f;
+    bool updateCellIndex        = false;
+    float spriteCellChangeSpeed = 1.f;
+  }; // end of struct UpdateParameters
+
+public:
+  SoAParticlePool();
+  SoAParticlePool(const SoAParticlePool& other) = delete;
+  SoAParticlePool& operator=(const SoAParticlePool& other) = delete;
+  ~SoAParticlePool();
+
+  /**
+   * @brief Allocates the storage for the given number of particles.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Returns the number of alive particles.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns true if the pool has no alive particle.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Removes all the particles, the storage is kept.
+   */
+  void clear();
+
+  /**
+   * @brief Appends a particle with default values.
+   * @returns the index of the new particle
+   */
+  size_t add();
+
+  /**
+   * @brief Removes a particle by moving the last particle in its slot.
+   */
+  void swapRemove(size_t index);
+
+  /**
+   * @brief Advances all the particles by one simulation step and recycles the
+   * particles that reached the end of their life.
+   * @returns the number of recycled particles
+   */
+  size_t update(const UpdateParameters& parameters);
+
+  /**
+   * @brief Samples factor gradients in a gradient table.
+   */
+  static void BuildGradientTable(const std::vector<FactorGradient>& gradients,
+                                 GradientTable& table);
+
+  /**
+   * @brief Samples color gradients in one gradient table per channel.
+   */
+  static void
+  BuildColorGradientTables(const std::vector<ColorGradient>& gradients,
+                           std::array<GradientTable, 4>& tables);
+
+  /**
+   * @brief Returns the value of a gradient table at the given life time ratio.
+   */
+  static float SampleGradientTable(const GradientTable& table, float ratio,
+                                   float seed);
+
+private:
+  template <typename F>
+  void _forEachArray(F&& f);
+  void _evaluateGradients(const UpdateParameters& parameters);
+  size_t _integrateSIMD(const UpdateParameters& parameters);
+  void _integrate(const UpdateParameters& parameters, size_t start);
+  void _updateCellIndices(const UpdateParameters& parameters);
+  size_t _recycleDeadParticles();
+
+public:
+  std::vector<float> positionX;
+  std::vector<float> positionY;
+  std::vector<float> positionZ;
+  std::vector<float> directionX;
+  std::vector<float> directionY;
+  std::vector<float> directionZ;
+  // Direction used for rendering when the particle was emitted without power,
+  // hasInitialDirection is 1 in that case and 0 otherwise
+  std::vector<float> initialDirectionX;
+  std::vector<float> initialDirectionY;
+  std::vector<float> initialDirectionZ;
+  std::vector<float> hasInitialDirection;
+  std::vector<float> colorR;
+  std::vector<float> colorG;
+  std::vector<float> colorB;
+  std::vector<float> colorA;
+  std::vector<float> colorStepR;
+  std::vector<float> colorStepG;
+  std::vector<float> colorStepB;
+  std::vector<float> colorStepA;
+  std::vector<float> age;
+  std::vector<float> lifeTime;
+  std::vector<float> particleSize;
+  std::vector<float> scaleX;
+  std::vector<float> scaleY;
+  std::vector<float> angle;
+  std::vector<float> angularSpeed;
+  std::vector<float> cellIndex;
+  std::vector<float> startCellIndex;
+  std::vector<float> endCellIndex;
+  std::vector<float> gradientSeed;
+
+private:
+  size_t _size;
+  // Per step scratch arrays
+  std::vector<float> _ratio;
+  std::vector<float> _velocity;
+  std::vector<float> _limitVelocity;
+  std::vector<float> _drag;
+
+}; // end of class SoAParticlePool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_SOA_PARTICLE_POOL_H
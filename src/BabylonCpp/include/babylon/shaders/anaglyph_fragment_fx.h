@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* anaglyphPixelShader;
-
-const char* anaglyphPixelShader
+constexpr const char* anaglyphPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* backgroundPixelShader;
-
-const char* backgroundPixelShader
+constexpr const char* backgroundPixelShader
   = "#ifdef TEXTURELODSUPPORT\n"
     "#extension GL_EXT_shader_texture_lod : enable\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* backgroundVertexShader;
-
-const char* backgroundVertexShader
+constexpr const char* backgroundVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* blackAndWhitePixelShader;
-
-const char* blackAndWhitePixelShader
+constexpr const char* blackAndWhitePixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* bloomMergePixelShader;
-
-const char* bloomMergePixelShader
+constexpr const char* bloomMergePixelShader
   = "uniform sampler2D textureSampler;\n"
     "uniform sampler2D bloomBlur;\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* blurPixelShader;
-
-const char* blurPixelShader
+constexpr const char* blurPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* chromaticAberrationPixelShader;
-
-const char* chromaticAberrationPixelShader
+constexpr const char* chromaticAberrationPixelShader
   = "// samplers\n"
     "uniform sampler2D textureSampler;  // original color\n"
     "\n"
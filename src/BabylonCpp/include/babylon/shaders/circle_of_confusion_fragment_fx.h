@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* circleOfConfusionPixelShader;
-
-const char* circleOfConfusionPixelShader
+constexpr const char* circleOfConfusionPixelShader
   = "// samplers\n"
     "uniform sampler2D depthSampler;\n"
     "\n"
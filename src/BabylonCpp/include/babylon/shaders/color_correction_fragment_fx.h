@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* colorCorrectionPixelShader;
-
-const char* colorCorrectionPixelShader
+constexpr const char* colorCorrectionPixelShader
   = "// samplers\n"
     "uniform sampler2D textureSampler;  // screen render\n"
     "uniform sampler2D colorTable;    // color table with modified colors\n"
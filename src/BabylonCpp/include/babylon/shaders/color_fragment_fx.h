@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* colorPixelShader;
-
-const char* colorPixelShader
+constexpr const char* colorPixelShader
   = "\n"
     "#ifdef VERTEXCOLOR\n"
     "varying vec4 vColor;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* colorVertexShader;
-
-const char* colorVertexShader
+constexpr const char* colorVertexShader
   = "// Attributes\n"
     "attribute vec3 position;\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* convolutionPixelShader;
-
-const char* convolutionPixelShader
+constexpr const char* convolutionPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
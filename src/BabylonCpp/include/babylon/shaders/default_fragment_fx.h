@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* defaultPixelShader;
-
-const char* defaultPixelShader
+constexpr const char* defaultPixelShader
   = "#include<__decl__defaultFragment>\n"
     "\n"
     "#if defined(BUMP) || !defined(NORMAL)\n"
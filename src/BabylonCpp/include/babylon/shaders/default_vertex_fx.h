@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* defaultVertexShader;
-
-const char* defaultVertexShader
+constexpr const char* defaultVertexShader
   = "#include<__decl__defaultVertex>\n"
     "// Attributes\n"
     "\n"
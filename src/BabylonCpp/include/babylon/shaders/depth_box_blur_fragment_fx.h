@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* depthBoxBlurPixelShader;
-
-const char* depthBoxBlurPixelShader
+constexpr const char* depthBoxBlurPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
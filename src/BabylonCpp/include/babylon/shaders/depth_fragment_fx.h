@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* depthPixelShader;
-
-const char* depthPixelShader
+constexpr const char* depthPixelShader
   = "#ifdef ALPHATEST\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D diffuseSampler;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* depthOfFieldPixelShader;
-
-const char* depthOfFieldPixelShader
+constexpr const char* depthOfFieldPixelShader
   = "// BABYLON.JS Depth-of-field GLSL Shader\n"
     "// Author: Olivier Guyot\n"
     "// Does depth-of-field blur, edge blur\n"
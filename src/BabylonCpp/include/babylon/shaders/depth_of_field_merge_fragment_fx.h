@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* depthOfFieldMergePixelShader;
-
-const char* depthOfFieldMergePixelShader
+constexpr const char* depthOfFieldMergePixelShader
   = "uniform sampler2D textureSampler;\n"
     "varying vec2 vUV;\n"
     "\n"
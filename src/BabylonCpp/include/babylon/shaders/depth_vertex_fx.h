@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* depthVertexShader;
-
-const char* depthVertexShader
+constexpr const char* depthVertexShader
   = "// Attribute\n"
     "attribute vec3 position;\n"
     "#include<bonesDeclaration>\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* displayPassPixelShader;
-
-const char* displayPassPixelShader
+constexpr const char* displayPassPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
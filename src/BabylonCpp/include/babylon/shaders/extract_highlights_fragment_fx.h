@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* extractHighlightsPixelShader;
-
-const char* extractHighlightsPixelShader
+constexpr const char* extractHighlightsPixelShader
   = "#include<helperFunctions>\n"
     "\n"
     "// Samplers\n"
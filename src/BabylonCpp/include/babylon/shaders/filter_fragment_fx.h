@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* filterPixelShader;
-
-const char* filterPixelShader
+constexpr const char* filterPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
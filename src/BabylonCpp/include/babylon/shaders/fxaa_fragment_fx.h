@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* fxaaPixelShader;
-
-const char* fxaaPixelShader
+constexpr const char* fxaaPixelShader
   = "uniform sampler2D textureSampler;\n"
     "uniform vec2 texelSize;\n"
     "\n"
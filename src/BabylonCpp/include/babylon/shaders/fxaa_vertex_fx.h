@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* fxaaVertexShader;
-
-const char* fxaaVertexShader
+constexpr const char* fxaaVertexShader
   = "// Attributes\n"
     "attribute vec2 position;\n"
     "uniform vec2 texelSize;\n"
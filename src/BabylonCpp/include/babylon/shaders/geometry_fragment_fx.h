@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* geometryPixelShader;
-
-const char* geometryPixelShader
+constexpr const char* geometryPixelShader
   = "#extension GL_EXT_draw_buffers : require\n"
     "\n"
     "#ifdef GL_ES\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* geometryVertexShader;
-
-const char* geometryVertexShader
+constexpr const char* geometryVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* glowBlurPostProcessPixelShader;
-
-const char* glowBlurPostProcessPixelShader
+constexpr const char* glowBlurPostProcessPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
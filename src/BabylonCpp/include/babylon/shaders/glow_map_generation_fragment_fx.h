@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* glowMapGenerationPixelShader;
-
-const char* glowMapGenerationPixelShader
+constexpr const char* glowMapGenerationPixelShader
   = "#ifdef ALPHATEST\n"
     "varying vec2 vUVDiffuse;\n"
     "uniform sampler2D diffuseSampler;\n"
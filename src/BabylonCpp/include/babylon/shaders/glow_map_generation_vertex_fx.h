@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* glowMapGenerationVertexShader;
-
-const char* glowMapGenerationVertexShader
+constexpr const char* glowMapGenerationVertexShader
   = "// Attribute\n"
     "attribute vec3 position;\n"
     "\n"
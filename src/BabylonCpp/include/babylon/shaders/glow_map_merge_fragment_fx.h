@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* glowMapMergePixelShader;
-
-const char* glowMapMergePixelShader
+constexpr const char* glowMapMergePixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
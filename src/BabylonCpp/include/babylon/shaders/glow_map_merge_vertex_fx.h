@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* glowMapMergeVertexShader;
-
-const char* glowMapMergeVertexShader
+constexpr const char* glowMapMergeVertexShader
   = "// Attributes\n"
     "attribute vec2 position;\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* gpuRenderParticlesPixelShader;
-
-const char* gpuRenderParticlesPixelShader
+constexpr const char* gpuRenderParticlesPixelShader
   = "#version 300 es\n"
     "\n"
     "uniform sampler2D textureSampler;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* gpuRenderParticlesVertexShader;
-
-const char* gpuRenderParticlesVertexShader
+constexpr const char* gpuRenderParticlesVertexShader
   = "#version 300 es\n"
     "\n"
     "\n"
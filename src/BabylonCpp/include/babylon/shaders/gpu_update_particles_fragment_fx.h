@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* gpuUpdateParticlesPixelShader;
-
-const char* gpuUpdateParticlesPixelShader
+constexpr const char* gpuUpdateParticlesPixelShader
   = "#version 300 es\n"
     "\n"
     "void main() {\n"
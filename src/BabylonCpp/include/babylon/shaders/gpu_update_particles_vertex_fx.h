@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* gpuUpdateParticlesVertexShader;
-
-const char* gpuUpdateParticlesVertexShader
+constexpr const char* gpuUpdateParticlesVertexShader
   = "#version 300 es\n"
     "\n"
     "#define PI 3.14159\n"
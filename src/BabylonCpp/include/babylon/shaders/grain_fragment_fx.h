@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* grainPixelShader;
-
-const char* grainPixelShader
+constexpr const char* grainPixelShader
   = "#include<helperFunctions>\n"
     "\n"
     "// samplers\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* highlightsPixelShader;
-
-const char* highlightsPixelShader
+constexpr const char* highlightsPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
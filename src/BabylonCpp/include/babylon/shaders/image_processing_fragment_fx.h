@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* imageProcessingPixelShader;
-
-const char* imageProcessingPixelShader
+constexpr const char* imageProcessingPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* kernelBlurPixelShader;
-
-const char* kernelBlurPixelShader
+constexpr const char* kernelBlurPixelShader
   = "// Parameters\n"
     "uniform sampler2D textureSampler;\n"
     "uniform vec2 delta;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* kernelBlurVertexShader;
-
-const char* kernelBlurVertexShader
+constexpr const char* kernelBlurVertexShader
   = "// Attributes\n"
     "attribute vec2 position;\n"
     "\n"
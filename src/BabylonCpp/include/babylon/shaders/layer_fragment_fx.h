@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* layerPixelShader;
-
-const char* layerPixelShader
+constexpr const char* layerPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
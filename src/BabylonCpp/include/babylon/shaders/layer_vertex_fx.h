@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* layerVertexShader;
-
-const char* layerVertexShader
+constexpr const char* layerVertexShader
   = "// Attributes\n"
     "attribute vec2 position;\n"
     "\n"
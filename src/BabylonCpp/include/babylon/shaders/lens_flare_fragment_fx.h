@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* lensFlarePixelShader;
-
-const char* lensFlarePixelShader
+constexpr const char* lensFlarePixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
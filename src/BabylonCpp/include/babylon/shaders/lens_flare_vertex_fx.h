@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* lensFlareVertexShader;
-
-const char* lensFlareVertexShader
+constexpr const char* lensFlareVertexShader
   = "// Attributes\n"
     "attribute vec2 position;\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* lensHighlightsPixelShader;
-
-const char* lensHighlightsPixelShader
+constexpr const char* lensHighlightsPixelShader
   = "// samplers\n"
     "uniform sampler2D textureSampler;  // original color\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* linePixelShader;
-
-const char* linePixelShader
+constexpr const char* linePixelShader
   = "uniform vec4 color;\n"
     "\n"
     "void main(void) {\n"
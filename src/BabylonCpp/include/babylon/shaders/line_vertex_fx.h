@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* lineVertexShader;
-
-const char* lineVertexShader
+constexpr const char* lineVertexShader
   = "// Attributes\n"
     "attribute vec3 position;\n"
     "attribute vec4 normal;\n"
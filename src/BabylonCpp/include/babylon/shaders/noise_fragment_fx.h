@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* noisePixelShader;
-
-const char* noisePixelShader
+constexpr const char* noisePixelShader
   = "// Source: https://www.shadertoy.com/view/4lB3zz\n"
     "\n"
     "// Uniforms\n"
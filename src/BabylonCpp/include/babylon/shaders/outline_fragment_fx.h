@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* outlinePixelShader;
-
-const char* outlinePixelShader
+constexpr const char* outlinePixelShader
   = "#ifdef LOGARITHMICDEPTH\n"
     "#extension GL_EXT_frag_depth : enable\n"
     "#endif\n"
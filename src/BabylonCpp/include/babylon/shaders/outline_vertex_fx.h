@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* outlineVertexShader;
-
-const char* outlineVertexShader
+constexpr const char* outlineVertexShader
   = "// Attribute\n"
     "attribute vec3 position;\n"
     "attribute vec3 normal;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* particlesPixelShader;
-
-const char* particlesPixelShader
+constexpr const char* particlesPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "varying vec4 vColor;\n"
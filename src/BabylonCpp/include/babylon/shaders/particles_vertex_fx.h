@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* particlesVertexShader;
-
-const char* particlesVertexShader
+constexpr const char* particlesVertexShader
   = "// Attributes\n"
     "attribute vec3 position;\n"
     "attribute vec4 color;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* passPixelShader;
-
-const char* passPixelShader
+constexpr const char* passPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
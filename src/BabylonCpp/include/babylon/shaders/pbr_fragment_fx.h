@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* pbrPixelShader;
-
-const char* pbrPixelShader
+constexpr const char* pbrPixelShader
   = "#if defined(BUMP) || !defined(NORMAL) || defined(FORCENORMALFORWARD) || defined(SPECULARAA)\n"
     "#extension GL_OES_standard_derivatives : enable\n"
     "#endif\n"
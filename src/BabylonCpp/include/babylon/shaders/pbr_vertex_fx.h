@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* pbrVertexShader;
-
-const char* pbrVertexShader
+constexpr const char* pbrVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
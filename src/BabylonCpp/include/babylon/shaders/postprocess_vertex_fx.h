@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* postprocessVertexShader;
-
-const char* postprocessVertexShader
+constexpr const char* postprocessVertexShader
   = "// Attributes\n"
     "attribute vec2 position;\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* proceduralVertexShader;
-
-const char* proceduralVertexShader
+constexpr const char* proceduralVertexShader
   = "// Attributes\n"
     "attribute vec2 position;\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* refractionPixelShader;
-
-const char* refractionPixelShader
+constexpr const char* refractionPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* rgbdDecodePixelShader;
-
-const char* rgbdDecodePixelShader
+constexpr const char* rgbdDecodePixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
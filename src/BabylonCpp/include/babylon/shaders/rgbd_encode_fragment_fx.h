@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* rgbdEncodePixelShader;
-
-const char* rgbdEncodePixelShader
+constexpr const char* rgbdEncodePixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* backgroundFragmentDeclaration;
-
-const char* backgroundFragmentDeclaration
+constexpr const char* backgroundFragmentDeclaration
   = "    uniform vec4 vPrimaryColor;\n"
     "#ifdef USEHIGHLIGHTANDSHADOWCOLORS\n"
     "  uniform vec4 vPrimaryColorShadow;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* backgroundUboDeclaration;
-
-const char* backgroundUboDeclaration
+constexpr const char* backgroundUboDeclaration
   = "layout(std140, column_major) uniform;\n"
     "\n"
     "uniform Material\n"
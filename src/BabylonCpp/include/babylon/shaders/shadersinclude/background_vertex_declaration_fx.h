@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* backgroundVertexDeclaration;
-
-const char* backgroundVertexDeclaration
+constexpr const char* backgroundVertexDeclaration
   = "uniform mat4 view;\n"
     "uniform mat4 viewProjection;\n"
     "uniform float shadowLevel;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* bones300Declaration;
-
-const char* bones300Declaration
+constexpr const char* bones300Declaration
   = "#if NUM_BONE_INFLUENCERS > 0\n"
     "  uniform mat4 mBones[BonesPerMesh];\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* bonesDeclaration;
-
-const char* bonesDeclaration
+constexpr const char* bonesDeclaration
   = "#if NUM_BONE_INFLUENCERS > 0\n"
     "  uniform mat4 mBones[BonesPerMesh];\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* bonesVertex;
-
-const char* bonesVertex
+constexpr const char* bonesVertex
   = "#if NUM_BONE_INFLUENCERS > 0\n"
     "  mat4 influence;\n"
     "  influence = mBones[int(matricesIndices[0])] * matricesWeights[0];\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* bumpFragmentFunctions;
-
-const char* bumpFragmentFunctions
+constexpr const char* bumpFragmentFunctions
   = "#ifdef BUMP\n"
     "  #if BUMPDIRECTUV == 1\n"
     "  #define vBumpUV vMainUV1\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* bumpFragment;
-
-const char* bumpFragment
+constexpr const char* bumpFragment
   = "vec2 uvOffset = vec2(0.0, 0.0);\n"
     "\n"
     "#if defined(BUMP) || defined(PARALLAX)\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* bumpVertexDeclaration;
-
-const char* bumpVertexDeclaration
+constexpr const char* bumpVertexDeclaration
   = "#if defined(BUMP) || defined(PARALLAX)\n"
     "  #if defined(TANGENT) && defined(NORMAL) \n"
     "  varying mat3 vTBN;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* bumpVertex;
-
-const char* bumpVertex
+constexpr const char* bumpVertex
   = "#if defined(BUMP) || defined(PARALLAX)\n"
     "  #if defined(TANGENT) && defined(NORMAL)\n"
     "  vec3 tbnNormal = normalize(normalUpdated);\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* clipPlaneFragmentDeclaration2;
-
-const char* clipPlaneFragmentDeclaration2
+constexpr const char* clipPlaneFragmentDeclaration2
   = "#ifdef CLIPPLANE\n"
     "  in float fClipDistance;\n"
     "#endif\n"
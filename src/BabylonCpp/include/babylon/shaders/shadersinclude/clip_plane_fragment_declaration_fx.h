@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* clipPlaneFragmentDeclaration;
-
-const char* clipPlaneFragmentDeclaration
+constexpr const char* clipPlaneFragmentDeclaration
   = "#ifdef CLIPPLANE\n"
     "  varying float fClipDistance;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* clipPlaneFragment;
-
-const char* clipPlaneFragment
+constexpr const char* clipPlaneFragment
   = "#ifdef CLIPPLANE\n"
     "  if (fClipDistance > 0.0)\n"
     "  {\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* clipPlaneVertexDeclaration2;
-
-const char* clipPlaneVertexDeclaration2
+constexpr const char* clipPlaneVertexDeclaration2
   = "#ifdef CLIPPLANE\n"
     "  uniform vec4 vClipPlane;\n"
     "  out float fClipDistance;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* clipPlaneVertexDeclaration;
-
-const char* clipPlaneVertexDeclaration
+constexpr const char* clipPlaneVertexDeclaration
   = "#ifdef CLIPPLANE\n"
     "  uniform vec4 vClipPlane;\n"
     "  varying float fClipDistance;\n"
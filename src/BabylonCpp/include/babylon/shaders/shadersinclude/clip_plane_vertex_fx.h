@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* clipPlaneVertex;
-
-const char* clipPlaneVertex
+constexpr const char* clipPlaneVertex
   = "#ifdef CLIPPLANE\n"
     "  fClipDistance = dot(worldPos, vClipPlane);\n"
     "#endif\n"
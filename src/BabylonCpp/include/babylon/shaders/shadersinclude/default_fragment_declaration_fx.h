@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* defaultFragmentDeclaration;
-
-const char* defaultFragmentDeclaration
+constexpr const char* defaultFragmentDeclaration
   = "uniform vec4 vDiffuseColor;\n"
     "#ifdef SPECULARTERM\n"
     "uniform vec4 vSpecularColor;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* defaultUboDeclaration;
-
-const char* defaultUboDeclaration
+constexpr const char* defaultUboDeclaration
   = "layout(std140, column_major) uniform;\n"
     "\n"
     "uniform Material\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* defaultVertexDeclaration;
-
-const char* defaultVertexDeclaration
+constexpr const char* defaultVertexDeclaration
   = "// Uniforms\n"
     "uniform mat4 viewProjection;\n"
     "uniform mat4 view;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* depthPrePass;
-
-const char* depthPrePass
+constexpr const char* depthPrePass
   = "#ifdef DEPTHPREPASS\n"
     "  gl_FragColor = vec4(0., 0., 0., 1.0);\n"
     "  return;\n"
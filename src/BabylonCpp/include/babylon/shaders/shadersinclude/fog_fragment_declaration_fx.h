@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* fogFragmentDeclaration;
-
-const char* fogFragmentDeclaration
+constexpr const char* fogFragmentDeclaration
   = "#ifdef FOG\n"
     "\n"
     "#define FOGMODE_NONE    0.\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* fogFragment;
-
-const char* fogFragment
+constexpr const char* fogFragment
   = "#ifdef FOG\n"
     "  float fog = CalcFogFactor();\n"
     "  color.rgb = fog * color.rgb + (1.0 - fog) * vFogColor;\n"
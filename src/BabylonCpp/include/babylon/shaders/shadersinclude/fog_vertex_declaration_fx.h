@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* fogVertexDeclaration;
-
-const char* fogVertexDeclaration
+constexpr const char* fogVertexDeclaration
   = "#ifdef FOG\n"
     "  varying vec3 vFogDistance;\n"
     "#endif\n";
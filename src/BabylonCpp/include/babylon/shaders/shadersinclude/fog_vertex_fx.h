@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* fogVertex;
-
-const char* fogVertex
+constexpr const char* fogVertex
   = "#ifdef FOG\n"
     "vFogDistance = (view * worldPos).xyz;\n"
     "#endif\n";
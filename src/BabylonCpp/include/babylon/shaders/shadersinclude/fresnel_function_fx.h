@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* fresnelFunction;
-
-const char* fresnelFunction
+constexpr const char* fresnelFunction
   = "#ifdef FRESNEL\n"
     "  float computeFresnelTerm(vec3 viewDirection, vec3 worldNormal, float bias, float power)\n"
     "  {\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* harmonicsFunctions;
-
-const char* harmonicsFunctions
+constexpr const char* harmonicsFunctions
   = "#ifdef USESPHERICALFROMREFLECTIONMAP\n"
     "  uniform vec3 vSphericalX;\n"
     "  uniform vec3 vSphericalY;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* helperFunctions;
-
-const char* helperFunctions
+constexpr const char* helperFunctions
   = "const float PI = 3.1415926535897932384626433832795;\n"
     "\n"
     "const float LinearEncodePowerApprox = 2.2;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* imageProcessingDeclaration;
-
-const char* imageProcessingDeclaration
+constexpr const char* imageProcessingDeclaration
   = "#ifdef EXPOSURE\n"
     "  uniform float exposureLinear;\n"
     "#endif\n"
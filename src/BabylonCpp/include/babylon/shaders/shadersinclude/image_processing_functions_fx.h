@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* imageProcessingFunctions;
-
-const char* imageProcessingFunctions
+constexpr const char* imageProcessingFunctions
   = "#if defined(COLORGRADING) && !defined(COLORGRADING3D)\n"
     "  /** \n"
     "  * Polyfill for SAMPLE_TEXTURE_3D, which is unsupported in WebGL.\n"
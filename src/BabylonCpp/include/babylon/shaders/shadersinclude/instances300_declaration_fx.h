@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* instances300Declaration;
-
-const char* instances300Declaration
+constexpr const char* instances300Declaration
   = "#ifdef INSTANCES\n"
     "  in vec4 world0;\n"
     "  in vec4 world1;\n"
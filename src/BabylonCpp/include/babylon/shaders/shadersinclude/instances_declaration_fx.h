@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* instancesDeclaration;
-
-const char* instancesDeclaration
+constexpr const char* instancesDeclaration
   = "#ifdef INSTANCES\n"
     "  attribute vec4 world0;\n"
     "  attribute vec4 world1;\n"
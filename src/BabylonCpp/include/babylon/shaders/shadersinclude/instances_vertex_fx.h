@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* instancesVertex;
-
-const char* instancesVertex
+constexpr const char* instancesVertex
   = "#ifdef INSTANCES\n"
     "  mat4 finalWorld = mat4(world0, world1, world2, world3);\n"
     "#else\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* kernelBlurFragment2;
-
-const char* kernelBlurFragment2
+constexpr const char* kernelBlurFragment2
   = "#ifdef DOF\n"
     "  factor = sampleCoC(sampleCenter + delta * KERNEL_DEP_OFFSET{X});\n"
     "  computedWeight = KERNEL_DEP_WEIGHT{X} * factor;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* kernelBlurFragment;
-
-const char* kernelBlurFragment
+constexpr const char* kernelBlurFragment
   = "#ifdef DOF\n"
     "  factor = sampleCoC(sampleCoord{X});  \n"
     "  computedWeight = KERNEL_WEIGHT{X} * factor;\n"
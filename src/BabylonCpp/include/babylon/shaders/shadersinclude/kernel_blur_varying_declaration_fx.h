@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* kernelBlurVaryingDeclaration;
-
-const char* kernelBlurVaryingDeclaration
+constexpr const char* kernelBlurVaryingDeclaration
   = "varying vec2 sampleCoord{X};\n"
     "varying vec2 sampleCoord{X};\n";
 
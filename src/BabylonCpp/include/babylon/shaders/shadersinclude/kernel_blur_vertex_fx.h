@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* kernelBlurVertex;
-
-const char* kernelBlurVertex
+constexpr const char* kernelBlurVertex
   = "sampleCoord{X} = sampleCenter + delta * KERNEL_OFFSET{X};\n"
     "sampleCoord{X} = sampleCenter + delta * KERNEL_OFFSET{X};\n";
 
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* lightFragmentDeclaration;
-
-const char* lightFragmentDeclaration
+constexpr const char* lightFragmentDeclaration
   = "#ifdef LIGHT{X}\n"
     "  uniform vec4 vLightData{X};\n"
     "  uniform vec4 vLightDiffuse{X};\n"
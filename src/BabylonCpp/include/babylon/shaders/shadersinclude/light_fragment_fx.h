@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* lightFragment;
-
-const char* lightFragment
+constexpr const char* lightFragment
   = "#ifdef LIGHT{X}\n"
     "  #if defined(SHADOWONLY) || (defined(LIGHTMAP) && defined(LIGHTMAPEXCLUDED{X}) && defined(LIGHTMAPNOSPECULAR{X}))\n"
     "  //No light calculation\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* lightUboDeclaration;
-
-const char* lightUboDeclaration
+constexpr const char* lightUboDeclaration
   = "#ifdef LIGHT{X}\n"
     "  uniform Light{X}\n"
     "  {\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* lightsFragmentFunctions;
-
-const char* lightsFragmentFunctions
+constexpr const char* lightsFragmentFunctions
   = "// Light Computing\n"
     "struct lightingInfo\n"
     "{\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* logDepthDeclaration;
-
-const char* logDepthDeclaration
+constexpr const char* logDepthDeclaration
   = "#ifdef LOGARITHMICDEPTH\n"
     "  uniform float logarithmicDepthConstant;\n"
     "  varying float vFragmentDepth;\n"
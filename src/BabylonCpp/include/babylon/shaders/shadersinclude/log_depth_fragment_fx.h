@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* logDepthFragment;
-
-const char* logDepthFragment
+constexpr const char* logDepthFragment
   = "#ifdef LOGARITHMICDEPTH\n"
     "  gl_FragDepthEXT = log2(vFragmentDepth) * logarithmicDepthConstant * 0.5;\n"
     "#endif\n";
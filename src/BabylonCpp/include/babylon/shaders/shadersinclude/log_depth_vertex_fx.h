@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* logDepthVertex;
-
-const char* logDepthVertex
+constexpr const char* logDepthVertex
   = "#ifdef LOGARITHMICDEPTH\n"
     "  vFragmentDepth = 1.0 + gl_Position.w;\n"
     "  gl_Position.z = log2(max(0.000001, vFragmentDepth)) * logarithmicDepthConstant;\n"
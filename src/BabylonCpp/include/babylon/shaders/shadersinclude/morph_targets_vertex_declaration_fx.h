@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* morphTargetsVertexDeclaration;
-
-const char* morphTargetsVertexDeclaration
+constexpr const char* morphTargetsVertexDeclaration
   = "#ifdef MORPHTARGETS\n"
     "  attribute vec3 position{X};\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* morphTargetsVertex;
-
-const char* morphTargetsVertex
+constexpr const char* morphTargetsVertex
   = "#ifdef MORPHTARGETS\n"
     "  positionUpdated += (position{X} - position) * morphTargetInfluences[{X}];\n"
     "  \n"
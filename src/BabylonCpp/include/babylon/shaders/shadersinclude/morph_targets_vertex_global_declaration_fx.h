@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* morphTargetsVertexGlobalDeclaration;
-
-const char* morphTargetsVertexGlobalDeclaration
+constexpr const char* morphTargetsVertexGlobalDeclaration
   = "#ifdef MORPHTARGETS\n"
     "  uniform float morphTargetInfluences[NUM_MORPH_INFLUENCERS];\n"
     "#endif\n";
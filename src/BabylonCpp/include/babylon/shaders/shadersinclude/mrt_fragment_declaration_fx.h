@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* mrtFragmentDeclaration;
-
-const char* mrtFragmentDeclaration
+constexpr const char* mrtFragmentDeclaration
   = "#if __VERSION__ >= 200\n"
     "layout(location = 0) out vec4 glFragData[{X}];\n"
     "#endif\n";
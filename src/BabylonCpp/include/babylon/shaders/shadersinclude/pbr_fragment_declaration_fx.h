@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* pbrFragmentDeclaration;
-
-const char* pbrFragmentDeclaration
+constexpr const char* pbrFragmentDeclaration
   = "uniform vec3 vReflectionColor;\n"
     "uniform vec4 vAlbedoColor;\n"
     "\n"
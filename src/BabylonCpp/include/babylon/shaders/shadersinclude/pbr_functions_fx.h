@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* pbrFunctions;
-
-const char* pbrFunctions
+constexpr const char* pbrFunctions
   = "// Constants\n"
     "#define RECIPROCAL_PI2 0.15915494\n"
     "#define FRESNEL_MAXIMUM_ON_ROUGH 0.25\n"
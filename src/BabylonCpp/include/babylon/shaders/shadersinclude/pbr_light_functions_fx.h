@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* pbrLightFunctions;
-
-const char* pbrLightFunctions
+constexpr const char* pbrLightFunctions
   = "// Light Computing\n"
     "struct lightingInfo\n"
     "{\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* pbrUboDeclaration;
-
-const char* pbrUboDeclaration
+constexpr const char* pbrUboDeclaration
   = "layout(std140, column_major) uniform;\n"
     "\n"
     "uniform Material\n"
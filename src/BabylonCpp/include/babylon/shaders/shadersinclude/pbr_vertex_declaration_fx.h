@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* pbrVertexDeclaration;
-
-const char* pbrVertexDeclaration
+constexpr const char* pbrVertexDeclaration
   = "uniform mat4 view;\n"
     "uniform mat4 viewProjection;\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* pointCloudVertexDeclaration;
-
-const char* pointCloudVertexDeclaration
+constexpr const char* pointCloudVertexDeclaration
   = "#ifdef POINTSIZE\n"
     "  uniform float pointSize;\n"
     "#endif\n";
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* pointCloudVertex;
-
-const char* pointCloudVertex
+constexpr const char* pointCloudVertex
   = "#ifdef POINTSIZE\n"
     "  gl_PointSize = pointSize;\n"
     "#endif\n";
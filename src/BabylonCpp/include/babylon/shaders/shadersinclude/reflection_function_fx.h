@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* reflectionFunction;
-
-const char* reflectionFunction
+constexpr const char* reflectionFunction
   = "#ifdef USE_LOCAL_REFLECTIONMAP_CUBIC\n"
     "vec3 parallaxCorrectNormal( vec3 vertexPos, vec3 origVec, vec3 cubeSize, vec3 cubePos ) {\n"
     "  // Find the ray intersection with box plane\n"
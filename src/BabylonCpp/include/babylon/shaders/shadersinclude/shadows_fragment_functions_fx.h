@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* shadowsFragmentFunctions;
-
-const char* shadowsFragmentFunctions
+constexpr const char* shadowsFragmentFunctions
   = "#ifdef SHADOWS\n"
     "  #ifndef SHADOWFLOAT\n"
     "  float unpack(vec4 color)\n"
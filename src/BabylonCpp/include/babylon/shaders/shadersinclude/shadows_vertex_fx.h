@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* shadowsVertex;
-
-const char* shadowsVertex
+constexpr const char* shadowsVertex
   = "#ifdef SHADOWS\n"
     "  #if defined(SHADOW{X}) && !defined(SHADOWCUBE{X})\n"
     "  vPositionFromLight{X} = lightMatrix{X} * worldPos;\n"
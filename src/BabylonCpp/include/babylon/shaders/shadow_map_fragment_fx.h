@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* shadowMapPixelShader;
-
-const char* shadowMapPixelShader
+constexpr const char* shadowMapPixelShader
   = "#ifndef FLOAT\n"
     "vec4 pack(float depth)\n"
     "{\n"
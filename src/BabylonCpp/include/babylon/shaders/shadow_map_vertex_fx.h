@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* shadowMapVertexShader;
-
-const char* shadowMapVertexShader
+constexpr const char* shadowMapVertexShader
   = "// Attribute\n"
     "attribute vec3 position;\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* sharpenPixelShader;
-
-const char* sharpenPixelShader
+constexpr const char* sharpenPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* spritesPixelShader;
-
-const char* spritesPixelShader
+constexpr const char* spritesPixelShader
   = "uniform bool alphaTest;\n"
     "\n"
     "varying vec4 vColor;\n"
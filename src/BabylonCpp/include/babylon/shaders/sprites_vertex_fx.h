@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* spritesVertexShader;
-
-const char* spritesVertexShader
+constexpr const char* spritesVertexShader
   = "// Attributes\n"
     "attribute vec4 position;\n"
     "attribute vec4 options;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* ssao2PixelShader;
-
-const char* ssao2PixelShader
+constexpr const char* ssao2PixelShader
   = "// SSAO 2 Shader\n"
     "#ifdef GL_ES\n"
     "precision highp float;\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* ssaoCombinePixelShader;
-
-const char* ssaoCombinePixelShader
+constexpr const char* ssaoCombinePixelShader
   = "uniform sampler2D textureSampler;\n"
     "uniform sampler2D originalColor;\n"
     "uniform vec4 viewport;\n"
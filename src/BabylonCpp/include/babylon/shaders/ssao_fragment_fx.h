@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* ssaoPixelShader;
-
-const char* ssaoPixelShader
+constexpr const char* ssaoPixelShader
   = "// SSAO Shader\n"
     "uniform sampler2D textureSampler;\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* standardPixelShader;
-
-const char* standardPixelShader
+constexpr const char* standardPixelShader
   = "uniform sampler2D textureSampler;\n"
     "varying vec2 vUV;\n"
     "\n"
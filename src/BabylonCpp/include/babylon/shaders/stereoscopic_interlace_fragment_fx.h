@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* stereoscopicInterlacePixelShader;
-
-const char* stereoscopicInterlacePixelShader
+constexpr const char* stereoscopicInterlacePixelShader
   = "const vec3 TWO = vec3(2.0, 2.0, 2.0);\n"
     "\n"
     "varying vec2 vUV;\n"
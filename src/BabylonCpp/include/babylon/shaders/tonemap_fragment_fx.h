@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* tonemapPixelShader;
-
-const char* tonemapPixelShader
+constexpr const char* tonemapPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
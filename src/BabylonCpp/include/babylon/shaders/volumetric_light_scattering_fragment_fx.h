@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* volumetricLightScatteringPixelShader;
-
-const char* volumetricLightScatteringPixelShader
+constexpr const char* volumetricLightScatteringPixelShader
   = "uniform sampler2D textureSampler;\n"
     "uniform sampler2D lightScatteringSampler;\n"
     "\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* volumetricLightScatteringPassPixelShader;
-
-const char* volumetricLightScatteringPassPixelShader
+constexpr const char* volumetricLightScatteringPassPixelShader
   = "#if defined(ALPHATEST) || defined(NEED_UV)\n"
     "varying vec2 vUV;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* vrDistortionCorrectionPixelShader;
-
-const char* vrDistortionCorrectionPixelShader
+constexpr const char* vrDistortionCorrectionPixelShader
   = "// Samplers\n"
     "varying vec2 vUV;\n"
     "uniform sampler2D textureSampler;\n"
@@ -7,6 +7,10 @@
 
 namespace BABYLON {
 
+namespace Math {
+class RandomStream;
+} // end of namespace Math
+
 /**
  * @brief Class used to store color gradient.
  */
@@ -23,6 +27,15 @@ public:
    */
   void getColorToRef(Color4& result);
 
+  /**
+   * @brief Will get a color picked randomly between color1 and color2 using
+   * the given random stream.
+   * If color2 is undefined then color1 will be used
+   * @param result defines the target Color4 to store the result in
+   * @param random defines the random stream to pick from
+   */
+  void getColorToRef(Color4& result, Math::RandomStream& random);
+
 public:
   /**
    * Gets or sets first associated color
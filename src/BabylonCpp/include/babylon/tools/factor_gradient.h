@@ -8,6 +8,10 @@
 
 namespace BABYLON {
 
+namespace Math {
+class RandomStream;
+} // end of namespace Math
+
 /**
  * @brief Class used to store factor gradient.
  */
@@ -33,6 +37,14 @@ struct BABYLON_SHARED_EXPORT FactorGradient : public IValueGradient {
    */
   float getFactor() const;
 
+  /**
+   * Will get a number picked randomly between factor1 and factor2 using the
+   * given random stream.
+   * @param random defines the random stream to pick from
+   * @returns the picked number
+   */
+  float getFactor(Math::RandomStream& random) const;
+
 }; // end of struct FactorGradient
 
 bool operator==(const FactorGradient& lhs, const FactorGradient& rhs);
@@ -1,6 +1,11 @@
 #ifndef BABYLON_TOOLS_HDR_CUBE_MAP_TO_SPHERICAL_POLYNOMIAL_TOOLS_H
 #define BABYLON_TOOLS_HDR_CUBE_MAP_TO_SPHERICAL_POLYNOMIAL_TOOLS_H
 
+#include <array>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include <babylon/babylon_api.h>
 #include <babylon/tools/hdr/cube_map_info.h>
 #include <babylon/tools/hdr/file_face_orientation.h>
@@ -9,6 +14,7 @@ namespace BABYLON {
 
 class BaseTexture;
 class SphericalPolynomial;
+class ThreadPool;
 
 /**
  * @brief Helper class dealing with the extraction of spherical polynomial
@@ -19,6 +25,30 @@ class BABYLON_SHARED_EXPORT CubeMapToSphericalPolynomialTools {
 private:
   static std::array<FileFaceOrientation, 6> FileFaces;
 
+  /**
+   * Normalized world direction and solid angle of the texels of a face.
+   */
+  struct FaceTexelWeights {
+    Float32Array directionX;
+    Float32Array directionY;
+    Float32Array directionZ;
+    Float32Array solidAngle;
+  }; // end of struct FaceTexelWeights
+
+  /**
+   * Texel weights of the faces of a cube map, they only depend on its size.
+   */
+  struct CubeTexelWeights {
+    std::array<FaceTexelWeights, 6> faces;
+    double totalSolidAngle;
+  }; // end of struct CubeTexelWeights
+
+  /**
+   * Sums of the texel colors weighted by the solid angle and by the monomials
+   * 1, y, z, x, xy, yz, xz, zz and xx - yy of the texel direction, per channel.
+   */
+  using ColorMoments = std::array<double, 27>;
+
 public:
   /**
    * @brief Converts a texture to the according Spherical Polynomial data.
@@ -26,21 +56,50 @@ public:
    * lighting.
    *
    * @param texture The texture to extract the information from.
+   * @param threadPool The optional pool projecting the rows of the faces in
+   * parallel.
    * @return The Spherical Polynomial data.
    */
   static std::unique_ptr<SphericalPolynomial>
-  ConvertCubeMapTextureToSphericalPolynomial(BaseTexture* texture);
+  ConvertCubeMapTextureToSphericalPolynomial(BaseTexture* texture,
+                                             ThreadPool* threadPool = nullptr);
 
   /**
    * @brief Converts a cubemap to the according Spherical Polynomial data.
    * This extracts the first 3 orders only as they are the only one used in
    * the lighting.
    *
+   * The faces are read in place, either as float or as 8 bits data, and the
+   * direction and solid angle of the texels are computed once per cube size.
+   *
    * @param cubeInfo The Cube map to extract the information from.
+   * @param threadPool The optional pool projecting the rows of the faces in
+   * parallel, the result does not depend on the number of threads.
    * @return The Spherical Polynomial data.
    */
   static std::unique_ptr<SphericalPolynomial>
-  ConvertCubeMapToSphericalPolynomial(const CubeMapInfo& cubeInfo);
+  ConvertCubeMapToSphericalPolynomial(const CubeMapInfo& cubeInfo,
+                                      ThreadPool* threadPool = nullptr);
+
+private:
+  /**
+   * @brief Returns the cached texel weights of the cube maps of the given
+   * size.
+   */
+  static std::shared_ptr<const CubeTexelWeights>
+  _GetTexelWeights(std::size_t size);
+
+  /**
+   * @brief Adds the moments of the given row of linear colors.
+   */
+  static void _AccumulateRow(const FaceTexelWeights& weights, size_t offset,
+                             const float* r, const float* g, const float* b,
+                             size_t count, ColorMoments& moments);
+
+private:
+  static std::unordered_map<std::size_t, std::shared_ptr<const CubeTexelWeights>>
+    _TexelWeights;
+  static std::mutex _TexelWeightsMutex;
 
 }; // end of class CubeMapToSphericalPolynomialTools
 
@@ -9,12 +9,17 @@
 #ifndef BABYLON_TOOLS_HDR_PMREM_GENERATOR_H
 #define BABYLON_TOOLS_HDR_PMREM_GENERATOR_H
 
+#include <array>
+#include <functional>
+
 #include <babylon/babylon_api.h>
 #include <babylon/math/vector4.h>
 #include <babylon/tools/hdr/cmg_bounding_box.h>
 
 namespace BABYLON {
 
+class ThreadPool;
+
 /**
  * Helper class to PreProcess a cubemap in order to generate mipmap according
  * to the level of blur required by the glossinees of a material.
@@ -28,6 +33,12 @@ namespace BABYLON {
 template <typename ArrayBufferView>
 class BABYLON_SHARED_EXPORT PMREMGenerator {
 
+public:
+  /**
+   * Callback receiving the progress of the filtering, from 0 to 1.
+   */
+  using ProgressCallback = std::function<void(float progress)>;
+
 private:
   static constexpr unsigned int CP_MAX_MIPLEVELS = 16;
 
@@ -141,9 +152,29 @@ public:
   /**
    * Launches the filter process and return the result.
    *
+   * The rows of the output faces are filtered in parallel when a thread pool
+   * is given. The progress callback is called after each filtered row, from
+   * the calling thread or the worker threads, but never concurrently.
+   *
+   * @param threadPool The thread pool used to filter the rows (optional)
+   * @param onProgress The callback receiving the progress (optional)
    * @return the filter cubemap in the form mip0 [faces1..6] .. mipN [faces1..6]
    */
-  std::vector<std::vector<ArrayBufferView>>& filterCubeMap();
+  std::vector<std::vector<ArrayBufferView>>&
+  filterCubeMap(ThreadPool* threadPool              = nullptr,
+                const ProgressCallback& onProgress = nullptr);
+
+private:
+  /**
+   * Directions and solid angles of the texels of a face, in separate tables
+   * so that the texels of a row are read with vector loads.
+   */
+  struct NormalizerFace {
+    Float32Array directionX;
+    Float32Array directionY;
+    Float32Array directionZ;
+    Float32Array solidAngle;
+  }; // end of struct NormalizerFace
 
 private:
   void init();
@@ -173,7 +204,8 @@ private:
   //   newAngle = oldAngle * a_MipAnglePerLevelScale;
   //
   //----------------------------------------------------------------------------
-  void filterCubeMapMipChain();
+  void filterCubeMapMipChain(ThreadPool* threadPool,
+                             const ProgressCallback& onProgress);
 
   //----------------------------------------------------------------------------
   // This function return the BaseFilterAngle require by PMREMGenerator to its
@@ -191,8 +223,8 @@ private:
   void precomputeFilterLookupTables(size_t srcCubeMapWidth);
 
   //----------------------------------------------------------------------------
-  // Builds a normalizer cubemap, with the texels solid angle stored in the
-  // fourth component
+  // Builds a normalizer cubemap, with the texels solid angle stored in a fourth
+  // table
   //
   // Takes in a cube face size, and an array of 6 surfaces to write the cube
   // faces into
@@ -285,12 +317,13 @@ private:
                           float srcSize,
                           std::vector<ArrayBufferView>& dstCubeMap,
                           size_t dstSize, float filterConeAngle,
-                          float specularPower);
+                          float specularPower, ThreadPool* threadPool,
+                          const std::function<void()>& onRowFiltered);
 
   //----------------------------------------------------------------------------
   // Clear filter extents for the 6 cube map faces
   //----------------------------------------------------------------------------
-  void clearFilterExtents(std::array<CMGBoundinBox, 6>& filterExtents);
+  void clearFilterExtents(std::array<CMGBoundinBox, 6>& filterExtents) const;
 
   //----------------------------------------------------------------------------
   // Define per-face bounding box filter extents
@@ -316,7 +349,18 @@ private:
   processFilterExtents(const Vector4& centerTapDir, float dotProdThresh,
                        const std::array<CMGBoundinBox, 6>& filterExtents,
                        const std::vector<ArrayBufferView>& srcCubeMap,
-                       size_t srcSize, size_t specularPower) const;
+                       size_t srcSize, float specularPower) const;
+
+  //----------------------------------------------------------------------------
+  // Accumulates the taps of the texels [uStart, uEnd] of a row of a face which
+  // are within the filter cone
+  //----------------------------------------------------------------------------
+  void accumulateFilterRow(const NormalizerFace& normalizerFace,
+                           const ArrayBufferView& srcFace, size_t rowStart,
+                           size_t uStart, size_t uEnd,
+                           const Vector4& centerTapDir, float dotProdThresh,
+                           float power, std::array<double, 4>& dstAccum,
+                           double& weightAccum) const;
 
   //----------------------------------------------------------------------------
   // Fixup cube edges
@@ -341,7 +385,7 @@ public:
 
 private:
   std::vector<std::vector<ArrayBufferView>> _outputSurface;
-  std::vector<ArrayBufferView> _normCubeMap;
+  std::array<NormalizerFace, 6> _normCubeMap;
   std::vector<std::vector<ArrayBufferView>> _filterLUT;
   int _numMipLevels;
 
@@ -2,6 +2,7 @@
 #define BABYLON_TOOLS_TOOLS_H
 
 #include <functional>
+#include <memory>
 
 #include <babylon/babylon_api.h>
 #include <babylon/core/structs.h>
@@ -12,7 +13,9 @@ namespace BABYLON {
 
 class Color4;
 class Engine;
+class MappedFile;
 class ProgressEvent;
+using MappedFilePtr = std::shared_ptr<MappedFile>;
 
 /**
  * @brief Represents the tools class.
@@ -79,10 +82,21 @@ struct BABYLON_SHARED_EXPORT Tools {
                                         size_t indexStart, size_t indexCount,
                                         const std::optional<Vector2>& bias
                                         = std::nullopt);
+  static MinMax ExtractMinAndMaxIndexed(const float* positions,
+                                        const Uint32Array& indices,
+                                        size_t indexStart, size_t indexCount,
+                                        const std::optional<Vector2>& bias
+                                        = std::nullopt,
+                                        size_t stride = 3);
   static MinMax
   ExtractMinAndMax(const Float32Array& positions, size_t start, size_t count,
                    const std::optional<Vector2>& bias = std::nullopt,
                    std::optional<unsigned int> stride = std::nullopt);
+  static MinMax ExtractMinAndMax(const float* positions, size_t start,
+                                 size_t count,
+                                 const std::optional<Vector2>& bias
+                                 = std::nullopt,
+                                 size_t stride = 3);
   static MinMaxVector2 ExtractMinAndMaxVector2(
     const std::function<std::optional<Vector2>(std::size_t index)>& feeder,
     const std::optional<Vector2>& bias = std::nullopt);
@@ -92,6 +106,11 @@ struct BABYLON_SHARED_EXPORT Tools {
   static std::string CleanUrl(std::string url);
   static std::string DecodeURIComponent(const std::string& s);
   static std::function<std::string(std::string url)> PreprocessUrl;
+  /**
+   * Maximum size in bytes of the binary files read into memory when they
+   * cannot be memory-mapped, half of the physical memory by default.
+   */
+  static size_t BinaryFileMemoryBudget;
   static void LoadImageFromUrl(
     std::string url, const std::function<void(const Image& img)>& onLoad,
     const std::function<void(const std::string& message,
@@ -111,6 +130,38 @@ struct BABYLON_SHARED_EXPORT Tools {
                                     const std::string& responseURL)>& callback,
            const std::function<void(const ProgressEvent& event)>& onProgress,
            bool useArrayBuffer);
+  /**
+   * @brief Loads a binary file without copying it, see ReadBinaryFile.
+   */
+  static void LoadBinaryFile(
+    std::string url,
+    const std::function<void(const MappedFilePtr& data,
+                             const std::string& responseURL)>& callback,
+    const std::function<void(const ProgressEvent& event)>& onProgress
+    = nullptr,
+    const std::function<void(const std::string& exception)>& onError = nullptr);
+  /**
+   * @brief Reads a binary file without copying it. The file is memory-mapped
+   * when possible, otherwise it is read into memory if it fits in
+   * BinaryFileMemoryBudget bytes. Larger files must be read with StreamFile.
+   */
+  static void ReadBinaryFile(
+    std::string fileToLoad,
+    const std::function<void(const MappedFilePtr& data,
+                             const std::string& responseURL)>& callback,
+    const std::function<void(const ProgressEvent& event)>& onProgress
+    = nullptr,
+    const std::function<void(const std::string& exception)>& onError = nullptr);
+  /**
+   * @brief Reads a file by chunks of at most chunkSize bytes without keeping
+   * it in memory, reading stops when onChunk returns false.
+   * @returns true if the whole file was read
+   */
+  static bool StreamFile(
+    const std::string& fileToLoad, size_t chunkSize,
+    const std::function<bool(const uint8_t* chunk, size_t length)>& onChunk,
+    const std::function<void(const ProgressEvent& event)>& onProgress
+    = nullptr);
   static void CheckExtends(Vector3& v, Vector3& min, Vector3& max);
   static std::string RandomId();
   static void SetImmediate(const std::function<void()>& immediate);
@@ -1,6 +1,7 @@
 #include <babylon/animations/animation.h>
 
 #include <babylon/animations/animatable.h>
+#include <babylon/animations/animation_track.h>
 #include <babylon/animations/easing/ieasing_function.h>
 #include <babylon/animations/ianimation_key.h>
 #include <babylon/animations/runtime_animation.h>
@@ -178,6 +179,7 @@ Animation::Animation(const std::string& iName,
     , enableBlending{false}
     , hasRunningRuntimeAnimations{this,
                                   &Animation::get_hasRunningRuntimeAnimations}
+    , _isTrackDirty{true}
     , _easingFunction{nullptr}
 {
 }
@@ -256,6 +258,7 @@ void Animation::deleteRange(const std::string& iName, bool deleteFrames)
                                    return key.frame >= from && key.frame <= to;
                                  }),
                   _keys.end());
+      _isTrackDirty = true;
     }
     _ranges.erase(iName);
   }
@@ -267,6 +270,13 @@ AnimationRange& Animation::getRange(const std::string& iName)
 }
 
 std::vector<IAnimationKey>& Animation::getKeys()
+{
+  // The keys can be modified through the returned reference
+  _isTrackDirty = true;
+  return _keys;
+}
+
+const std::vector<IAnimationKey>& Animation::getKeys() const
 {
   return _keys;
 }
@@ -600,6 +610,63 @@ AnimationValue Animation::_interpolate(float currentFrame, int repeatCount,
   return _getKeyValue(keys.back().value);
 }
 
+bool Animation::_interpolateTrack(float currentFrame, int repeatCount,
+                                  unsigned int loopMode,
+                                  const AnimationValue& offsetValue,
+                                  const AnimationValue& highLimitValue,
+                                  AnimationTrackCursor& cursor,
+                                  AnimationValue& result)
+{
+  if (_isTrackDirty) {
+    if (!_track) {
+      _track = std::make_unique<AnimationTrack>();
+    }
+    _track->build(dataType, _keys);
+    _isTrackDirty = false;
+  }
+
+  const auto componentCount = _track->componentCount();
+  if (componentCount == 0
+      || (loopMode != Animation::ANIMATIONLOOPMODE_CYCLE()
+          && loopMode != Animation::ANIMATIONLOOPMODE_CONSTANT()
+          && loopMode != Animation::ANIMATIONLOOPMODE_RELATIVE())) {
+    return false;
+  }
+
+  if (loopMode == Animation::ANIMATIONLOOPMODE_CONSTANT() && repeatCount > 0) {
+    result = highLimitValue;
+    return true;
+  }
+
+  AnimationTrack::Value value;
+  if (loopMode == Animation::ANIMATIONLOOPMODE_RELATIVE()
+      && dataType == Animation::ANIMATIONTYPE_MATRIX()) {
+    // Matrices are not offset, the start key is used as is
+    const auto& frames = _track->frames();
+    const auto key     = currentFrame > frames.back() ?
+                       frames.size() - 1 :
+                       _track->findKey(currentFrame, cursor);
+    _track->getKeyValue(key, value);
+  }
+  else {
+    // Key values returned as is are not offset
+    const auto interpolated
+      = _track->evaluate(currentFrame, cursor, _easingFunction.get(), value);
+    if (interpolated && loopMode == Animation::ANIMATIONLOOPMODE_RELATIVE()
+        && offsetValue.dataType == dataType && repeatCount != 0) {
+      AnimationTrack::Value offset;
+      AnimationTrack::ReadValue(dataType, offsetValue, offset.data());
+      const auto _repeatCount = static_cast<float>(repeatCount);
+      for (size_t i = 0; i < componentCount; ++i) {
+        value[i] += offset[i] * _repeatCount;
+      }
+    }
+  }
+
+  AnimationTrack::WriteValue(dataType, value.data(), result);
+  return true;
+}
+
 Matrix Animation::matrixInterpolateFunction(Matrix& startValue,
                                             Matrix& endValue,
                                             float gradient) const
@@ -647,7 +714,8 @@ AnimationPtr Animation::clone() const
 
 void Animation::setKeys(const std::vector<IAnimationKey>& values)
 {
-  _keys = values;
+  _keys         = values;
+  _isTrackDirty = true;
 }
 
 Json::object Animation::serialize() const
@@ -0,0 +1,191 @@
+#include <babylon/animations/animation_property_binding.h>
+
+#include <babylon/animations/animation.h>
+#include <babylon/bones/bone.h>
+#include <babylon/lights/light.h>
+#include <babylon/materials/pbr/pbr_material.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/mesh/transform_node.h>
+
+namespace BABYLON {
+
+AnimationPropertyBinding::AnimationPropertyBinding()
+    : _target{nullptr}, _setter{nullptr}
+{
+}
+
+AnimationPropertyBinding::AnimationPropertyBinding(IAnimatable* target,
+                                                   Setter setter)
+    : _target{target}, _setter{setter}
+{
+}
+
+AnimationPropertyBinding::~AnimationPropertyBinding()
+{
+}
+
+AnimationPropertyBinding AnimationPropertyBinding::Compile(
+  IAnimatable* target, const std::vector<std::string>& targetPropertyPath,
+  int dataType)
+{
+  if (!target || targetPropertyPath.size() != 1) {
+    return AnimationPropertyBinding();
+  }
+
+  const auto& property = targetPropertyPath[0];
+  const auto isFloat   = (dataType == Animation::ANIMATIONTYPE_FLOAT());
+  const auto isVector3 = (dataType == Animation::ANIMATIONTYPE_VECTOR3());
+  const auto isQuaternion
+    = (dataType == Animation::ANIMATIONTYPE_QUATERNION());
+  const auto isMatrix = (dataType == Animation::ANIMATIONTYPE_MATRIX());
+  const auto isColor3 = (dataType == Animation::ANIMATIONTYPE_COLOR3());
+
+  Setter setter = nullptr;
+
+  // Bones, the setters update the local matrix
+  if (dynamic_cast<Bone*>(target)) {
+    if (isMatrix && property == "_matrix") {
+      setter = [](IAnimatable* bone, const AnimationValue& value) {
+        static_cast<Bone*>(bone)->_matrix = value.matrixData;
+      };
+    }
+    else if (isVector3 && property == "position") {
+      setter = [](IAnimatable* bone, const AnimationValue& value) {
+        static_cast<Bone*>(bone)->position = value.vector3Data;
+      };
+    }
+    else if (isVector3 && property == "rotation") {
+      setter = [](IAnimatable* bone, const AnimationValue& value) {
+        static_cast<Bone*>(bone)->rotation = value.vector3Data;
+      };
+    }
+    else if (isVector3 && property == "scaling") {
+      setter = [](IAnimatable* bone, const AnimationValue& value) {
+        static_cast<Bone*>(bone)->scaling = value.vector3Data;
+      };
+    }
+    else if (isQuaternion && property == "rotationQuaternion") {
+      setter = [](IAnimatable* bone, const AnimationValue& value) {
+        static_cast<Bone*>(bone)->rotationQuaternion = value.quaternionData;
+      };
+    }
+  }
+  // Transform nodes and meshes
+  else if (dynamic_cast<TransformNode*>(target)) {
+    if (isVector3 && property == "position") {
+      setter = [](IAnimatable* node, const AnimationValue& value) {
+        static_cast<TransformNode*>(node)->position().copyFrom(
+          value.vector3Data);
+      };
+    }
+    else if (isVector3 && property == "rotation") {
+      setter = [](IAnimatable* node, const AnimationValue& value) {
+        static_cast<TransformNode*>(node)->rotation().copyFrom(
+          value.vector3Data);
+      };
+    }
+    else if (isVector3 && property == "scaling") {
+      setter = [](IAnimatable* node, const AnimationValue& value) {
+        static_cast<TransformNode*>(node)->scaling().copyFrom(
+          value.vector3Data);
+      };
+    }
+    else if (isQuaternion && property == "rotationQuaternion") {
+      setter = [](IAnimatable* node, const AnimationValue& value) {
+        static_cast<TransformNode*>(node)->rotationQuaternion
+          = value.quaternionData;
+      };
+    }
+  }
+  // Lights
+  else if (dynamic_cast<Light*>(target)) {
+    if (isFloat && property == "intensity") {
+      setter = [](IAnimatable* light, const AnimationValue& value) {
+        static_cast<Light*>(light)->intensity = value.floatData;
+      };
+    }
+    else if (isColor3 && property == "diffuse") {
+      setter = [](IAnimatable* light, const AnimationValue& value) {
+        static_cast<Light*>(light)->diffuse.copyFrom(value.color3Data);
+      };
+    }
+    else if (isColor3 && property == "specular") {
+      setter = [](IAnimatable* light, const AnimationValue& value) {
+        static_cast<Light*>(light)->specular.copyFrom(value.color3Data);
+      };
+    }
+  }
+  // Material colors
+  else if (dynamic_cast<StandardMaterial*>(target) && isColor3) {
+    if (property == "ambientColor") {
+      setter = [](IAnimatable* material, const AnimationValue& value) {
+        static_cast<StandardMaterial*>(material)->ambientColor.copyFrom(
+          value.color3Data);
+      };
+    }
+    else if (property == "diffuseColor") {
+      setter = [](IAnimatable* material, const AnimationValue& value) {
+        static_cast<StandardMaterial*>(material)->diffuseColor.copyFrom(
+          value.color3Data);
+      };
+    }
+    else if (property == "specularColor") {
+      setter = [](IAnimatable* material, const AnimationValue& value) {
+        static_cast<StandardMaterial*>(material)->specularColor.copyFrom(
+          value.color3Data);
+      };
+    }
+    else if (property == "emissiveColor") {
+      setter = [](IAnimatable* material, const AnimationValue& value) {
+        static_cast<StandardMaterial*>(material)->emissiveColor.copyFrom(
+          value.color3Data);
+      };
+    }
+  }
+  else if (dynamic_cast<PBRMaterial*>(target) && isColor3) {
+    if (property == "albedoColor") {
+      setter = [](IAnimatable* material, const AnimationValue& value) {
+        static_cast<PBRMaterial*>(material)->albedoColor.copyFrom(
+          value.color3Data);
+      };
+    }
+    else if (property == "ambientColor") {
+      setter = [](IAnimatable* material, const AnimationValue& value) {
+        static_cast<PBRMaterial*>(material)->ambientColor.copyFrom(
+          value.color3Data);
+      };
+    }
+    else if (property == "reflectivityColor") {
+      setter = [](IAnimatable* material, const AnimationValue& value) {
+        static_cast<PBRMaterial*>(material)->reflectivityColor.copyFrom(
+          value.color3Data);
+      };
+    }
+    else if (property == "emissiveColor") {
+      setter = [](IAnimatable* material, const AnimationValue& value) {
+        static_cast<PBRMaterial*>(material)->emissiveColor.copyFrom(
+          value.color3Data);
+      };
+    }
+  }
+
+  return setter ? AnimationPropertyBinding(target, setter) :
+                  AnimationPropertyBinding();
+}
+
+bool AnimationPropertyBinding::isValid() const
+{
+  return _setter != nullptr;
+}
+
+IAnimatable* AnimationPropertyBinding::target() const
+{
+  return _target;
+}
+
+void AnimationPropertyBinding::setValue(const AnimationValue& value) const
+{
+  _setter(_target, value);
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,345 @@
+#include <babylon/animations/animation_track.h>
+
+#include <algorithm>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/easing/ieasing_function.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/babylon_enums.h>
+
+namespace BABYLON {
+
+constexpr size_t AnimationTrack::MaxComponentCount;
+constexpr std::uint8_t AnimationTrack::HasInTangent;
+constexpr std::uint8_t AnimationTrack::HasOutTangent;
+constexpr std::uint8_t AnimationTrack::Step;
+
+AnimationTrack::AnimationTrack() : _dataType{-1}, _componentCount{0}
+{
+}
+
+AnimationTrack::~AnimationTrack()
+{
+}
+
+size_t AnimationTrack::ComponentCount(int dataType)
+{
+  switch (dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT():
+      return 1;
+    case Animation::ANIMATIONTYPE_VECTOR2():
+    case Animation::ANIMATIONTYPE_SIZE():
+      return 2;
+    case Animation::ANIMATIONTYPE_VECTOR3():
+    case Animation::ANIMATIONTYPE_COLOR3():
+      return 3;
+    case Animation::ANIMATIONTYPE_QUATERNION():
+      return 4;
+    case Animation::ANIMATIONTYPE_MATRIX():
+      return 16;
+    default:
+      return 0;
+  }
+}
+
+void AnimationTrack::ReadValue(int dataType, const AnimationValue& value,
+                               float* result)
+{
+  switch (dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT():
+      result[0] = value.floatData;
+      break;
+    case Animation::ANIMATIONTYPE_VECTOR2():
+      result[0] = value.vector2Data.x;
+      result[1] = value.vector2Data.y;
+      break;
+    case Animation::ANIMATIONTYPE_SIZE():
+      result[0] = value.sizeData.width;
+      result[1] = value.sizeData.height;
+      break;
+    case Animation::ANIMATIONTYPE_VECTOR3():
+      result[0] = value.vector3Data.x;
+      result[1] = value.vector3Data.y;
+      result[2] = value.vector3Data.z;
+      break;
+    case Animation::ANIMATIONTYPE_COLOR3():
+      result[0] = value.color3Data.r;
+      result[1] = value.color3Data.g;
+      result[2] = value.color3Data.b;
+      break;
+    case Animation::ANIMATIONTYPE_QUATERNION():
+      result[0] = value.quaternionData.x;
+      result[1] = value.quaternionData.y;
+      result[2] = value.quaternionData.z;
+      result[3] = value.quaternionData.w;
+      break;
+    case Animation::ANIMATIONTYPE_MATRIX():
+      std::copy(value.matrixData.m.begin(), value.matrixData.m.end(), result);
+      break;
+    default:
+      break;
+  }
+}
+
+void AnimationTrack::WriteValue(int dataType, const float* value,
+                                AnimationValue& result)
+{
+  result.dataType = dataType;
+  switch (dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT():
+      result.floatData = value[0];
+      break;
+    case Animation::ANIMATIONTYPE_VECTOR2():
+      result.vector2Data.x = value[0];
+      result.vector2Data.y = value[1];
+      break;
+    case Animation::ANIMATIONTYPE_SIZE():
+      result.sizeData.width  = value[0];
+      result.sizeData.height = value[1];
+      break;
+    case Animation::ANIMATIONTYPE_VECTOR3():
+      result.vector3Data.x = value[0];
+      result.vector3Data.y = value[1];
+      result.vector3Data.z = value[2];
+      break;
+    case Animation::ANIMATIONTYPE_COLOR3():
+      result.color3Data.r = value[0];
+      result.color3Data.g = value[1];
+      result.color3Data.b = value[2];
+      break;
+    case Animation::ANIMATIONTYPE_QUATERNION():
+      result.quaternionData.x = value[0];
+      result.quaternionData.y = value[1];
+      result.quaternionData.z = value[2];
+      result.quaternionData.w = value[3];
+      break;
+    case Animation::ANIMATIONTYPE_MATRIX():
+      std::copy(value, value + 16, result.matrixData.m.begin());
+      result.matrixData._markAsUpdated();
+      break;
+    default:
+      break;
+  }
+}
+
+bool AnimationTrack::build(int dataType, const std::vector<IAnimationKey>& keys)
+{
+  _dataType       = dataType;
+  _componentCount = ComponentCount(dataType);
+  _frames.clear();
+  _values.clear();
+  _inTangents.clear();
+  _outTangents.clear();
+  _flags.clear();
+
+  const auto isValid = [dataType](const AnimationValue& value) {
+    return value.dataType == dataType;
+  };
+
+  bool valid = (_componentCount > 0) && (keys.size() > 1);
+  for (size_t i = 0; valid && i < keys.size(); ++i) {
+    const auto& key = keys[i];
+    valid = isValid(key.value) && (!key.inTangent || isValid(*key.inTangent))
+            && (!key.outTangent || isValid(*key.outTangent));
+  }
+  if (!valid) {
+    _componentCount = 0;
+    return false;
+  }
+
+  const auto floatCount = keys.size() * _componentCount;
+  _frames.resize(keys.size());
+  _values.resize(floatCount);
+  _inTangents.resize(floatCount, 0.f);
+  _outTangents.resize(floatCount, 0.f);
+  _flags.resize(keys.size(), 0);
+
+  for (size_t i = 0; i < keys.size(); ++i) {
+    const auto& key = keys[i];
+    const auto offset = i * _componentCount;
+    _frames[i]        = key.frame;
+    ReadValue(dataType, key.value, &_values[offset]);
+    if (key.inTangent) {
+      ReadValue(dataType, *key.inTangent, &_inTangents[offset]);
+      _flags[i] |= HasInTangent;
+    }
+    if (key.outTangent) {
+      ReadValue(dataType, *key.outTangent, &_outTangents[offset]);
+      _flags[i] |= HasOutTangent;
+    }
+    if (key.interpolation
+        && key.interpolation->dataType
+             == static_cast<int>(AnimationKeyInterpolation::STEP)) {
+      _flags[i] |= Step;
+    }
+  }
+
+  return true;
+}
+
+int AnimationTrack::dataType() const
+{
+  return _dataType;
+}
+
+size_t AnimationTrack::componentCount() const
+{
+  return _componentCount;
+}
+
+size_t AnimationTrack::keyCount() const
+{
+  return _frames.size();
+}
+
+const std::vector<float>& AnimationTrack::frames() const
+{
+  return _frames;
+}
+
+size_t AnimationTrack::findKey(float frame, AnimationTrackCursor& cursor) const
+{
+  // The segment [key, key + 1] contains the frame when the frame is after the
+  // start key (or the start key is the first key) and not after the end key
+  const auto lastSegment = _frames.size() - 2;
+  const auto contains    = [&](size_t key) {
+    return (key == 0 || _frames[key] < frame) && _frames[key + 1] >= frame;
+  };
+
+  auto key = std::min(cursor.key, lastSegment);
+  if (!contains(key)) {
+    if (key < lastSegment && contains(key + 1)) {
+      ++key;
+    }
+    else {
+      const auto it
+        = std::lower_bound(_frames.begin() + 1,
+                           _frames.begin() + static_cast<long>(lastSegment + 1),
+                           frame);
+      key = static_cast<size_t>(it - _frames.begin()) - 1;
+    }
+  }
+
+  cursor.key = key;
+  return key;
+}
+
+void AnimationTrack::getKeyValue(size_t key, Value& result) const
+{
+  const auto value = _value(_values, key);
+  std::copy(value, value + _componentCount, result.begin());
+}
+
+bool AnimationTrack::evaluate(float frame, AnimationTrackCursor& cursor,
+                              IEasingFunction* easingFunction,
+                              Value& result) const
+{
+  // Past the last key
+  if (frame > _frames.back()) {
+    getKeyValue(_frames.size() - 1, result);
+    return false;
+  }
+
+  const auto key = findKey(frame, cursor);
+  if (_flags[key] & Step) {
+    getKeyValue(key, result);
+    return false;
+  }
+
+  const auto startValue = _value(_values, key);
+  const auto endValue   = _value(_values, key + 1);
+  const auto frameDelta = _frames[key + 1] - _frames[key];
+
+  // gradient : percent of currentFrame between the frame inf and the frame sup
+  auto gradient = (frame - _frames[key]) / frameDelta;
+  if (easingFunction) {
+    gradient = easingFunction->ease(gradient);
+  }
+
+  const bool useTangent
+    = (_flags[key] & HasOutTangent) && (_flags[key + 1] & HasInTangent);
+
+  switch (_dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT():
+    case Animation::ANIMATIONTYPE_VECTOR2():
+    case Animation::ANIMATIONTYPE_VECTOR3():
+    case Animation::ANIMATIONTYPE_QUATERNION(): {
+      if (!useTangent) {
+        if (_dataType == Animation::ANIMATIONTYPE_QUATERNION()) {
+          const auto quaternion = Quaternion::Slerp(
+            Quaternion(startValue[0], startValue[1], startValue[2],
+                       startValue[3]),
+            Quaternion(endValue[0], endValue[1], endValue[2], endValue[3]),
+            gradient);
+          result[0] = quaternion.x;
+          result[1] = quaternion.y;
+          result[2] = quaternion.z;
+          result[3] = quaternion.w;
+          return true;
+        }
+        break;
+      }
+
+      // Hermite spline, the tangents are expressed per frame
+      const auto outTangent = _value(_outTangents, key);
+      const auto inTangent  = _value(_inTangents, key + 1);
+      const auto squared    = gradient * gradient;
+      const auto cubed      = gradient * squared;
+      const auto part1      = ((2.f * cubed) - (3.f * squared)) + 1.f;
+      const auto part2      = (-2.f * cubed) + (3.f * squared);
+      const auto part3      = ((cubed - (2.f * squared)) + gradient) * frameDelta;
+      const auto part4      = (cubed - squared) * frameDelta;
+      for (size_t i = 0; i < _componentCount; ++i) {
+        result[i] = (((startValue[i] * part1) + (endValue[i] * part2))
+                     + (outTangent[i] * part3))
+                    + (inTangent[i] * part4);
+      }
+
+      if (_dataType == Animation::ANIMATIONTYPE_QUATERNION()) {
+        Quaternion quaternion(result[0], result[1], result[2], result[3]);
+        quaternion.normalize();
+        result[0] = quaternion.x;
+        result[1] = quaternion.y;
+        result[2] = quaternion.z;
+        result[3] = quaternion.w;
+      }
+      return true;
+    }
+    case Animation::ANIMATIONTYPE_MATRIX(): {
+      if (!Animation::AllowMatricesInterpolation()) {
+        getKeyValue(key, result);
+        return true;
+      }
+
+      Matrix start, end, matrix;
+      std::copy(startValue, startValue + 16, start.m.begin());
+      std::copy(endValue, endValue + 16, end.m.begin());
+      start._markAsUpdated();
+      end._markAsUpdated();
+      if (Animation::AllowMatrixDecomposeForInterpolation()) {
+        Matrix::DecomposeLerpToRef(start, end, gradient, matrix);
+      }
+      else {
+        Matrix::LerpToRef(start, end, gradient, matrix);
+      }
+      std::copy(matrix.m.begin(), matrix.m.end(), result.begin());
+      return true;
+    }
+    default:
+      break;
+  }
+
+  // Linear interpolation of the components
+  for (size_t i = 0; i < _componentCount; ++i) {
+    result[i] = startValue[i] + ((endValue[i] - startValue[i]) * gradient);
+  }
+  return true;
+}
+
+const float* AnimationTrack::_value(const std::vector<float>& values,
+                                    size_t key) const
+{
+  return values.data() + key * _componentCount;
+}
+
+} // end of namespace BABYLON
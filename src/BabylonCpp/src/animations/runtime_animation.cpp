@@ -1,6 +1,7 @@
 #include <babylon/animations/runtime_animation.h>
 
 #include <cmath>
+#include <utility>
 
 #include <babylon/animations/animatable.h>
 #include <babylon/animations/animation.h>
@@ -23,6 +24,8 @@ RuntimeAnimation::RuntimeAnimation(const IAnimatablePtr& target,
     , _currentFrame{0}
     , _animation{animation}
     , _target{target}
+    , _propertyBinding{AnimationPropertyBinding::Compile(
+        target.get(), animation->targetPropertyPath, animation->dataType)}
     , _host{host}
     , _stopped{false}
     , _blendingFactor{0.f}
@@ -34,6 +37,11 @@ RuntimeAnimation::RuntimeAnimation(const IAnimatablePtr& target,
     , _previousDelay{millisecond_t{0}}
     , _previousRatio{0.f}
 {
+  if (_propertyBinding.isValid()) {
+    _targetPath   = animation->targetPropertyPath[0];
+    _activeTarget = _propertyBinding.target();
+  }
+
   // Cloning events locally
   const auto& events = animation->getEvents();
   if (!events.empty()) {
@@ -119,19 +127,28 @@ void RuntimeAnimation::dispose()
     runtimeAnimations.end());
 }
 
-AnimationValue RuntimeAnimation::_interpolate(
+const AnimationValue& RuntimeAnimation::_interpolate(
   float iCurrentFrame, int repeatCount, unsigned int loopMode,
   const AnimationValue& offsetValue, const AnimationValue& highLimitValue)
 {
   _currentFrame = iCurrentFrame;
 
+  // Numeric keys are interpolated from the compact track of the animation
+  if (_animation->_interpolateTrack(_currentFrame, repeatCount, loopMode,
+                                    offsetValue, highLimitValue, _trackCursor,
+                                    _interpolatedValue)) {
+    return _interpolatedValue;
+  }
+
   if (_animation->dataType == Animation::ANIMATIONTYPE_MATRIX()
       && !_workValue) {
     _workValue = Matrix::Zero();
   }
 
-  return _animation->_interpolate(currentFrame, repeatCount, _workValue,
-                                  loopMode, offsetValue, highLimitValue);
+  _interpolatedValue
+    = _animation->_interpolate(currentFrame, repeatCount, _workValue, loopMode,
+                               offsetValue, highLimitValue);
+  return _interpolatedValue;
 }
 
 void RuntimeAnimation::setValue(const AnimationValue& currentValue,
@@ -144,30 +161,36 @@ void RuntimeAnimation::_setValue(const IAnimatablePtr& target,
                                  const AnimationValue& currentValue,
                                  float weight, unsigned int targetIndex)
 {
+  // The property of the target was resolved at construction
+  const auto isBound = _propertyBinding.isValid()
+                       && target.get() == _propertyBinding.target();
+
   // Set value
   std::string path = "";
   any destination  = nullptr;
 
-  const auto& targetPropertyPath = _animation->targetPropertyPath;
+  if (!isBound) {
+    const auto& targetPropertyPath = _animation->targetPropertyPath;
 
-  if (targetPropertyPath.size() > 1) {
-    auto property = target->getProperty(targetPropertyPath[0]);
+    if (targetPropertyPath.size() > 1) {
+      auto property = target->getProperty(targetPropertyPath[0]);
 
-    for (size_t index = 1; index < targetPropertyPath.size() - 1; ++index) {
-      property = target->getProperty(property, targetPropertyPath[index]);
+      for (size_t index = 1; index < targetPropertyPath.size() - 1; ++index) {
+        property = target->getProperty(property, targetPropertyPath[index]);
+      }
+
+      path        = targetPropertyPath.back();
+      destination = property;
+    }
+    else {
+      path        = targetPropertyPath[0];
+      destination = target;
     }
 
-    path        = targetPropertyPath.back();
-    destination = property;
-  }
-  else {
-    path        = targetPropertyPath[0];
-    destination = target;
+    _targetPath   = path;
+    _activeTarget = destination;
   }
-
-  _targetPath   = path;
-  _activeTarget = destination;
-  _weight       = weight;
+  _weight = weight;
 
   if (targetIndex >= _originalValue.size()) {
     _originalValue.resize(targetIndex + 1);
@@ -184,6 +207,9 @@ void RuntimeAnimation::_setValue(const IAnimatablePtr& target,
 
   if (!stl_util::almost_equal(weight, -1.f)) {
   }
+  else if (isBound) {
+    _propertyBinding.setValue(*_currentValue);
+  }
   else {
     any newValue = (*_currentValue).getValue();
     target->setProperty(destination, path, newValue);
@@ -197,7 +223,7 @@ std::optional<unsigned int> RuntimeAnimation::_getCorrectLoopMode() const
 
 void RuntimeAnimation::goToFrame(int frame)
 {
-  auto& keys = _animation->getKeys();
+  const auto& keys = std::as_const(*_animation).getKeys();
 
   float _frame = frame;
   if (_frame < keys[0].frame) {
@@ -207,7 +233,7 @@ void RuntimeAnimation::goToFrame(int frame)
     _frame = keys.back().frame;
   }
 
-  auto currentValue = _interpolate(_frame, 0, _animation->loopMode);
+  const auto& currentValue = _interpolate(_frame, 0, _animation->loopMode);
 
   setValue(currentValue);
 }
@@ -230,15 +256,19 @@ bool RuntimeAnimation::animate(millisecond_t delay, float from, float to,
 
   auto returnValue = true;
 
-  auto& keys = _animation->getKeys();
+  // Only the mutable keys invalidate the track of the animation
+  const auto& keys = std::as_const(*_animation).getKeys();
 
   // Adding a start key at frame 0 if missing
   if (keys[0].frame > 0.f) {
-    keys.insert(keys.begin(), IAnimationKey(0, keys[0].value));
+    auto& animationKeys = _animation->getKeys();
+    animationKeys.insert(animationKeys.begin(),
+                         IAnimationKey(0, animationKeys[0].value));
   }
   // Adding a duplicate key when there is only one key at frame zero
   else if (keys.size() == 1) {
-    keys.emplace_back(IAnimationKey(0.001f, keys[0].value));
+    auto& animationKeys = _animation->getKeys();
+    animationKeys.emplace_back(IAnimationKey(0.001f, animationKeys[0].value));
   }
 
   // Check limits
@@ -380,7 +410,7 @@ bool RuntimeAnimation::animate(millisecond_t delay, float from, float to,
     }
   }
 
-  auto currentValue
+  const auto& currentValue
     = _interpolate(_currentFrame, repeatCount, *_getCorrectLoopMode(),
                    offsetValue, highLimitValue);
 
@@ -293,7 +293,7 @@ void Skeleton::_computeTransformMatrices(Float32Array& targetMatrix,
       }
     }
 
-    if (*bone->_index != -1) {
+    if (!bone->_index.has_value() || *bone->_index != -1) {
       auto mappedIndex = !bone->_index.has_value() ?
                            index :
                            static_cast<unsigned int>(*bone->_index);
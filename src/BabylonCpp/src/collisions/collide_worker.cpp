@@ -8,8 +8,8 @@
 namespace BABYLON {
 
 CollideWorker::CollideWorker(Collider* _collider,
-                             const CollisionCache& collisionCache,
-                             const Vector3& _finalPosition)
+                             CollisionCache& collisionCache,
+                             Vector3& _finalPosition)
     : collider{_collider}
     , collisionsScalingMatrix{Matrix::Zero()}
     , collisionTranformationMatrix{Matrix::Zero()}
@@ -39,16 +39,14 @@ void CollideWorker::collideWithWorld(Vector3& position, Vector3& velocity,
   std::unordered_map<unsigned int, SerializedMesh>& meshes
     = _collisionCache.getMeshes();
 
-  if (excludedMeshUniqueId >= 0) {
-    unsigned _excludedMeshUniqueId
-      = static_cast<unsigned>(excludedMeshUniqueId);
-    for (auto& item : meshes) {
-      if (item.first != _excludedMeshUniqueId) {
-        SerializedMesh& mesh = item.second;
-        if (mesh.checkCollisions) {
-          checkCollision(mesh);
-        }
-      }
+  for (auto& item : meshes) {
+    if (excludedMeshUniqueId >= 0
+        && item.first == static_cast<unsigned>(excludedMeshUniqueId)) {
+      continue;
+    }
+    SerializedMesh& mesh = item.second;
+    if (mesh.checkCollisions) {
+      checkCollision(mesh);
     }
   }
 
@@ -137,7 +135,7 @@ void CollideWorker::collideForSubMesh(SerializedSubMesh& subMesh,
   }
 
   if (subMesh._lastColliderWorldVertices.empty()
-      || subMesh._lastColliderTransformMatrix.equals(transformMatrix)) {
+      || !subMesh._lastColliderTransformMatrix.equals(transformMatrix)) {
     subMesh._lastColliderTransformMatrix = transformMatrix;
     subMesh._lastColliderWorldVertices.clear();
     subMesh._trianglePlanes.clear();
@@ -1,6 +1,7 @@
 #include <babylon/collisions/collider.h>
 
 #include <cmath>
+#include <limits>
 
 #include <babylon/babylon_stl_util.h>
 #include <babylon/math/plane.h>
@@ -10,6 +11,7 @@ namespace BABYLON {
 Collider::Collider()
     : intersectionPointSet{false}
     , collidedMesh{nullptr}
+    , collidedMeshId{std::numeric_limits<unsigned int>::max()}
     , _radius{Vector3::One()}
     , _retry{0}
     , _basePointWorld{Vector3::Zero()}
@@ -26,6 +26,7 @@ CollisionCoordinatorWorker::CollisionCoordinatorWorker()
     , _scaledVelocity{Vector3::Zero()}
     , _init{false}
     , _runningUpdated{0}
+    , _onAfterRenderObserver{nullptr}
 {
 }
 
@@ -107,7 +108,9 @@ void CollisionCoordinatorWorker::getNewPosition(
   if (!_init) {
     return;
   }
-  if (collisionIndex < _collisionsCallbackArray.size()) {
+  // A collision is already being computed for this index
+  if (collisionIndex < _collisionsCallbackArray.size()
+      && _collisionsCallbackArray[collisionIndex]) {
     return;
   }
 
@@ -136,27 +139,30 @@ void CollisionCoordinatorWorker::getNewPosition(
   message.collidePayload = payload;
   message.taskType       = WorkerTaskType::COLLIDE;
 
-  _worker.postMessage(message);
+  _worker.postMessage(std::move(message));
 }
 
 void CollisionCoordinatorWorker::init(Scene* scene)
 {
-  _scene = scene;
-  _scene->registerAfterRender([this](Scene*, EventState&) { _afterRender(); });
+  _scene                 = scene;
+  _onAfterRenderObserver = _scene->onAfterRenderObservable.add(
+    [this](Scene*, EventState&) { _afterRender(); });
 
   _worker.callbackHandler
-    = [this](const WorkerReply e) { _onMessageFromWorker(e); };
+    = [this](const WorkerReply& e) { _onMessageFromWorker(e); };
 
   BabylonMessage message;
   message.taskType = WorkerTaskType::INIT;
 
-  _worker.postMessage(message);
+  _worker.postMessage(std::move(message));
 }
 
 void CollisionCoordinatorWorker::destroy()
 {
-  _scene->unregisterAfterRender(
-    [this](Scene*, EventState&) { _afterRender(); });
+  if (_onAfterRenderObserver) {
+    _scene->onAfterRenderObservable.remove(_onAfterRenderObserver);
+    _onAfterRenderObserver = nullptr;
+  }
   _worker.terminate();
 }
 
@@ -169,14 +175,27 @@ void CollisionCoordinatorWorker::onMeshAdded(AbstractMesh* mesh)
 
 void CollisionCoordinatorWorker::onMeshUpdated(TransformNode* transformNode)
 {
-  _addUpdateMeshesList[static_cast<unsigned>(transformNode->uniqueId)]
-    = CollisionCoordinatorWorker::SerializeMesh(
-      static_cast<AbstractMesh*>(transformNode));
+  const auto uniqueId = static_cast<unsigned>(transformNode->uniqueId);
+  auto serializedMesh = CollisionCoordinatorWorker::SerializeMesh(
+    static_cast<AbstractMesh*>(transformNode));
+
+  // Only the meshes which changed since the last update are sent
+  auto it = _workerMeshes.find(uniqueId);
+  if (it != _workerMeshes.end() && _IsSameMesh(it->second, serializedMesh)) {
+    _addUpdateMeshesList.erase(uniqueId);
+    return;
+  }
+
+  _addUpdateMeshesList[uniqueId] = serializedMesh;
+  _workerMeshes[uniqueId]        = std::move(serializedMesh);
 }
 
 void CollisionCoordinatorWorker::onMeshRemoved(AbstractMesh* mesh)
 {
-  _toRemoveMeshesArray.emplace_back(mesh->uniqueId);
+  const auto uniqueId = static_cast<unsigned>(mesh->uniqueId);
+  _addUpdateMeshesList.erase(uniqueId);
+  _workerMeshes.erase(uniqueId);
+  _toRemoveMeshesArray.emplace_back(uniqueId);
 }
 
 void CollisionCoordinatorWorker::onGeometryAdded(Geometry* geometry)
@@ -201,54 +220,66 @@ void CollisionCoordinatorWorker::onGeometryDeleted(Geometry* geometry)
 
 void CollisionCoordinatorWorker::_afterRender()
 {
+  // Dispatch the replies received from the worker thread since the last frame
+  _worker.processReplies();
+
   if (!_init) {
     return;
   }
 
-  if (_toRemoveGeometryArray.empty() && _toRemoveMeshesArray.empty()) {
+  if (_toRemoveGeometryArray.empty() && _toRemoveMeshesArray.empty()
+      && _addUpdateGeometriesList.empty() && _addUpdateMeshesList.empty()) {
     return;
   }
 
-  // 5 concurrent updates were sent to the web worker and were not yet
-  // processed. Abort next update.
-  // TODO make sure update runs as fast as possible to be able to update 60 FPS.
+  // 5 concurrent updates were sent to the worker thread and were not yet
+  // processed. Abort next update, the changes are sent with the next one.
   if (_runningUpdated > 4) {
     return;
   }
 
   ++_runningUpdated;
 
-  UpdatePayload payload;
-  payload.updatedMeshes     = _addUpdateMeshesList;
-  payload.updatedGeometries = _addUpdateGeometriesList;
-  payload.removedGeometries = _toRemoveGeometryArray;
-  payload.removedMeshes     = _toRemoveMeshesArray;
-
+  // The serialized data is moved to the worker thread
   BabylonMessage message;
-  message.updatePayload = payload;
-  message.taskType      = WorkerTaskType::UPDATE;
-
-  std::vector<ArrayBufferView> serializable;
-  for (auto item : payload.updatedGeometries) {
-    const std::string& id = item.first;
-    if (stl_util::contains(payload.updatedGeometries, id)) {
-      // prepare transferables
-      serializable.emplace_back(
-        ArrayBufferView(message.updatePayload.updatedGeometries[id].indices));
-      serializable.emplace_back(
-        ArrayBufferView(message.updatePayload.updatedGeometries[id].normals));
-      serializable.emplace_back(
-        ArrayBufferView(message.updatePayload.updatedGeometries[id].positions));
-    }
-  }
+  message.taskType                        = WorkerTaskType::UPDATE;
+  message.updatePayload.updatedMeshes     = std::move(_addUpdateMeshesList);
+  message.updatePayload.updatedGeometries = std::move(_addUpdateGeometriesList);
+  message.updatePayload.removedGeometries = std::move(_toRemoveGeometryArray);
+  message.updatePayload.removedMeshes     = std::move(_toRemoveMeshesArray);
 
-  _worker.postMessage(message, serializable);
+  _worker.postMessage(std::move(message));
   _addUpdateMeshesList.clear();
   _addUpdateGeometriesList.clear();
   _toRemoveGeometryArray.clear();
   _toRemoveMeshesArray.clear();
 }
 
+bool CollisionCoordinatorWorker::_IsSameMesh(const SerializedMesh& a,
+                                             const SerializedMesh& b)
+{
+  if (a.geometryId != b.geometryId || a.checkCollisions != b.checkCollisions
+      || a.worldMatrixFromCache != b.worldMatrixFromCache
+      || a.boxMinimum != b.boxMinimum || a.boxMaximum != b.boxMaximum
+      || a.subMeshes.size() != b.subMeshes.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < a.subMeshes.size(); ++i) {
+    const auto& sa = a.subMeshes[i];
+    const auto& sb = b.subMeshes[i];
+    if (sa.verticesStart != sb.verticesStart
+        || sa.verticesCount != sb.verticesCount
+        || sa.indexStart != sb.indexStart || sa.indexCount != sb.indexCount
+        || sa.hasMaterial != sb.hasMaterial || sa.boxMinimum != sb.boxMinimum
+        || sa.boxMaximum != sb.boxMaximum) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 void CollisionCoordinatorWorker::_onMessageFromWorker(
   const WorkerReply& returnData)
 {
@@ -263,6 +294,7 @@ void CollisionCoordinatorWorker::_onMessageFromWorker(
     case WorkerTaskType::INIT: {
       _init = true;
       // Update the worked with ALL of the scene's current state
+      _workerMeshes.clear();
       for (auto& mesh : _scene->meshes) {
         onMeshAdded(mesh.get());
       }
@@ -280,17 +312,17 @@ void CollisionCoordinatorWorker::_onMessageFromWorker(
         return;
       }
 
-      auto callback = _collisionsCallbackArray[returnPayload.collisionId];
+      // The callback is released before being called, so that it can request
+      // a new collision with the same index
+      auto callback = std::move(
+        _collisionsCallbackArray[returnPayload.collisionId]);
+      _collisionsCallbackArray[returnPayload.collisionId] = nullptr;
       if (callback) {
         auto mesh
           = _scene->getMeshByUniqueID(returnPayload.collidedMeshUniqueId);
-        if (mesh) {
-          auto newPosition = Vector3::FromArray(returnPayload.newPosition);
-          callback(returnPayload.collisionId, newPosition, mesh.get());
-        }
+        auto newPosition = Vector3::FromArray(returnPayload.newPosition);
+        callback(returnPayload.collisionId, newPosition, mesh.get());
       }
-      // cleanup
-      _collisionsCallbackArray[returnPayload.collisionId] = nullptr;
     } break;
   }
 }
@@ -59,16 +59,16 @@ CollisionDetectorTransferable::onCollision(const CollidePayload& payload)
 {
   Vector3 finalPosition = Vector3::Zero();
   // Create a new collider
-  Collider* collider = new Collider();
-  collider->_radius  = Vector3::FromArray(payload.collider.radius);
+  Collider collider;
+  collider._radius = Vector3::FromArray(payload.collider.radius);
   // Create new collide worker
-  CollideWorker colliderWorker(collider, *_collisionCache.get(), finalPosition);
+  CollideWorker colliderWorker(&collider, *_collisionCache, finalPosition);
   Vector3 position = Vector3::FromArray(payload.collider.position);
   Vector3 velocity = Vector3::FromArray(payload.collider.velocity);
   colliderWorker.collideWithWorld(position, velocity, payload.maximumRetry,
                                   payload.excludedMeshUniqueId);
   CollisionReplyPayload replyPayload;
-  replyPayload.collidedMeshUniqueId = collider->collidedMeshId;
+  replyPayload.collidedMeshUniqueId = collider.collidedMeshId;
   replyPayload.collisionId          = payload.collisionId;
   replyPayload.newPosition          = finalPosition.asArray();
 
@@ -1,41 +1,97 @@
 #include <babylon/collisions/worker.h>
 
-#include <babylon/collisions/babylon_message.h>
-#include <babylon/collisions/worker_reply.h>
-#include <babylon/engine/scene.h>
-
 namespace BABYLON {
 
-Worker::Worker()
+Worker::Worker() : _terminated{false}
 {
 }
 
 Worker::~Worker()
 {
+  terminate();
 }
 
 void Worker::postMessage(const BabylonMessage& message)
 {
-  switch (message.taskType) {
-    case WorkerTaskType::INIT:
-      callbackHandler(collisionDetector.onInit(message.initPayload));
-      break;
-    case WorkerTaskType::COLLIDE:
-      callbackHandler(collisionDetector.onCollision(message.collidePayload));
-      break;
-    case WorkerTaskType::UPDATE:
-      callbackHandler(collisionDetector.onUpdate(message.updatePayload));
-      break;
+  postMessage(BabylonMessage(message));
+}
+
+void Worker::postMessage(BabylonMessage&& message)
+{
+  if (_terminated) {
+    return;
   }
+
+  // The thread is started with the first message
+  if (!_thread.joinable()) {
+    _thread = std::thread(&Worker::_run, this);
+  }
+
+  _messages.push(std::move(message));
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+  }
+  _messageCondition.notify_one();
 }
 
-void Worker::postMessage(const BabylonMessage& /*message*/,
+void Worker::postMessage(const BabylonMessage& message,
                          const std::vector<ArrayBufferView>& /*serializable*/)
 {
+  // The buffers cannot be transferred, the message is copied
+  postMessage(message);
+}
+
+size_t Worker::processReplies()
+{
+  size_t count = 0;
+  WorkerReply reply;
+  while (_replies.tryAndPop(reply)) {
+    if (callbackHandler) {
+      callbackHandler(reply);
+    }
+    ++count;
+  }
+  return count;
 }
 
 void Worker::terminate()
 {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _terminated = true;
+  }
+  _messageCondition.notify_one();
+
+  if (_thread.joinable()) {
+    _thread.join();
+  }
+}
+
+void Worker::_run()
+{
+  BabylonMessage message;
+  while (!_terminated) {
+    if (!_messages.tryAndPop(message)) {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _messageCondition.wait(
+        lock, [this]() { return _terminated || !_messages.empty(); });
+      continue;
+    }
+    _replies.push(_onMessage(message));
+  }
+}
+
+WorkerReply Worker::_onMessage(const BabylonMessage& message)
+{
+  switch (message.taskType) {
+    case WorkerTaskType::INIT:
+      return collisionDetector.onInit(message.initPayload);
+    case WorkerTaskType::COLLIDE:
+      return collisionDetector.onCollision(message.collidePayload);
+    case WorkerTaskType::UPDATE:
+    default:
+      return collisionDetector.onUpdate(message.updatePayload);
+  }
 }
 
 } // end of namespace BABYLON
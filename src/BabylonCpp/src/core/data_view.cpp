@@ -1,5 +1,7 @@
 #include <babylon/core/data_view.h>
 
+#include <cstring>
+
 namespace BABYLON {
 
 DataView::DataView(const ArrayBuffer& buffer)
@@ -53,29 +55,40 @@ DataView::~DataView()
 {
 }
 
-int8_t DataView::getInt8(size_t /*byteOffset*/) const
+int8_t DataView::getInt8(size_t byteOffset) const
 {
-  return int8_t{0};
+  return static_cast<int8_t>(getUint8(byteOffset));
 }
 
-uint8_t DataView::getUint8(size_t /*byteOffset*/) const
+uint8_t DataView::getUint8(size_t byteOffset) const
 {
-  return uint8_t{0};
+  return _buffer[_byteOffset + byteOffset];
 }
 
-int16_t DataView::getInt16(size_t /*byteOffset*/, bool /*littleEndian*/) const
+int16_t DataView::getInt16(size_t byteOffset, bool littleEndian) const
 {
-  return int16_t{0};
+  return static_cast<int16_t>(getUint16(byteOffset, littleEndian));
 }
 
-uint16_t DataView::getUint16(size_t /*byteOffset*/, bool /*littleEndian*/) const
+uint16_t DataView::getUint16(size_t byteOffset, bool littleEndian) const
 {
-  return uint16_t{0};
+  const auto b0 = static_cast<uint16_t>(getUint8(byteOffset));
+  const auto b1 = static_cast<uint16_t>(getUint8(byteOffset + 1));
+  return littleEndian ? static_cast<uint16_t>(b0 | (b1 << 8)) :
+                        static_cast<uint16_t>((b0 << 8) | b1);
 }
 
-float DataView::getFloat32(size_t /*byteOffset*/, bool /*littleEndian*/) const
+float DataView::getFloat32(size_t byteOffset, bool littleEndian) const
 {
-  return float{0};
+  uint32_t bits = 0;
+  for (size_t i = 0; i < 4; ++i) {
+    const auto byte = static_cast<uint32_t>(getUint8(byteOffset + i));
+    bits |= byte << (littleEndian ? 8 * i : 8 * (3 - i));
+  }
+
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
 }
 
 } // end of namespace BABYLON
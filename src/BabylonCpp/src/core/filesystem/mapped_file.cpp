@@ -0,0 +1,214 @@
+#include <babylon/core/filesystem/mapped_file.h>
+
+#include <algorithm>
+#include <fstream>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace BABYLON {
+
+constexpr size_t MappedFile::DefaultChunkSize;
+
+MappedFile::MappedFile()
+    : _data{nullptr}
+    , _size{0}
+    , _mapped{false}
+    , _fileHandle{nullptr}
+    , _mappingHandle{nullptr}
+{
+}
+
+MappedFile::~MappedFile()
+{
+  _unmap();
+}
+
+MappedFilePtr MappedFile::Open(const std::string& filename,
+                               const ProgressCallback& onProgress)
+{
+  if (auto file = Map(filename)) {
+    if (onProgress) {
+      onProgress(file->_size, file->_size);
+    }
+    return file;
+  }
+  return Read(filename, onProgress);
+}
+
+MappedFilePtr MappedFile::Map(const std::string& filename)
+{
+  MappedFilePtr file(new MappedFile());
+  return file->_map(filename) ? file : nullptr;
+}
+
+MappedFilePtr MappedFile::Read(const std::string& filename,
+                               const ProgressCallback& onProgress)
+{
+  MappedFilePtr file(new MappedFile());
+  return file->_read(filename, onProgress) ? file : nullptr;
+}
+
+bool MappedFile::Stream(const std::string& filename, size_t chunkSize,
+                        const ChunkCallback& onChunk,
+                        const ProgressCallback& onProgress)
+{
+  std::ifstream in(filename, std::ios::in | std::ios::binary);
+  if (!in) {
+    return false;
+  }
+  in.seekg(0, std::ios::end);
+  const auto total = static_cast<size_t>(in.tellg());
+  in.seekg(0, std::ios::beg);
+
+  std::vector<uint8_t> chunk(std::max<size_t>(std::min(chunkSize, total), 1));
+  size_t loaded = 0;
+  while (loaded < total) {
+    const auto length = std::min(chunk.size(), total - loaded);
+    if (!in.read(reinterpret_cast<char*>(chunk.data()),
+                 static_cast<std::streamsize>(length))) {
+      return false;
+    }
+    loaded += length;
+    if (onChunk && !onChunk(chunk.data(), length)) {
+      return false;
+    }
+    if (onProgress) {
+      onProgress(loaded, total);
+    }
+  }
+  return true;
+}
+
+const uint8_t* MappedFile::data() const
+{
+  return _data;
+}
+
+size_t MappedFile::size() const
+{
+  return _size;
+}
+
+bool MappedFile::isMapped() const
+{
+  return _mapped;
+}
+
+bool MappedFile::_map(const std::string& filename)
+{
+#if defined(_WIN32)
+  auto fileHandle
+    = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                  OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (fileHandle == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  LARGE_INTEGER fileSize;
+  // Empty files cannot be mapped
+  if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+    CloseHandle(fileHandle);
+    return false;
+  }
+  auto mappingHandle
+    = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mappingHandle) {
+    CloseHandle(fileHandle);
+    return false;
+  }
+  auto view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+  if (!view) {
+    CloseHandle(mappingHandle);
+    CloseHandle(fileHandle);
+    return false;
+  }
+  _fileHandle    = fileHandle;
+  _mappingHandle = mappingHandle;
+  _data          = static_cast<const uint8_t*>(view);
+  _size          = static_cast<size_t>(fileSize.QuadPart);
+#else
+  const auto fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat buffer;
+  // Empty files and special files cannot be mapped
+  if (fstat(fd, &buffer) != 0 || !S_ISREG(buffer.st_mode)
+      || buffer.st_size == 0) {
+    ::close(fd);
+    return false;
+  }
+  const auto size = static_cast<size_t>(buffer.st_size);
+  auto view       = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping keeps a reference to the file
+  ::close(fd);
+  if (view == MAP_FAILED) {
+    return false;
+  }
+  _data = static_cast<const uint8_t*>(view);
+  _size = size;
+#endif
+  _mapped = true;
+  return true;
+}
+
+bool MappedFile::_read(const std::string& filename,
+                       const ProgressCallback& onProgress)
+{
+  std::ifstream in(filename, std::ios::in | std::ios::binary);
+  if (!in) {
+    return false;
+  }
+  in.seekg(0, std::ios::end);
+  const auto total = static_cast<size_t>(in.tellg());
+  in.seekg(0, std::ios::beg);
+
+  // Read in place, by chunks to report the progress
+  _buffer.resize(total);
+  size_t loaded = 0;
+  while (loaded < total) {
+    const auto length = std::min(DefaultChunkSize, total - loaded);
+    if (!in.read(reinterpret_cast<char*>(_buffer.data() + loaded),
+                 static_cast<std::streamsize>(length))) {
+      _buffer.clear();
+      return false;
+    }
+    loaded += length;
+    if (onProgress) {
+      onProgress(loaded, total);
+    }
+  }
+  _data = _buffer.data();
+  _size = _buffer.size();
+  return true;
+}
+
+void MappedFile::_unmap()
+{
+  if (!_mapped) {
+    return;
+  }
+#if defined(_WIN32)
+  UnmapViewOfFile(_data);
+  CloseHandle(_mappingHandle);
+  CloseHandle(_fileHandle);
+  _fileHandle    = nullptr;
+  _mappingHandle = nullptr;
+#else
+  munmap(const_cast<uint8_t*>(_data), _size);
+#endif
+  _data   = nullptr;
+  _size   = 0;
+  _mapped = false;
+}
+
+} // end of namespace BABYLON
@@ -118,6 +118,11 @@ system_time_point_t LogMessage::timestamp() const
   return _timestamp;
 }
 
+void LogMessage::setTimestamp(const system_time_point_t& timestamp)
+{
+  _timestamp = timestamp;
+}
+
 std::string LogMessage::getReadableTimestamp() const
 {
   return Time::toIso8601Ms(_timestamp);
@@ -148,6 +153,11 @@ std::string const& LogMessage::threadId() const
   return _threadId;
 }
 
+void LogMessage::setThreadId(const std::string& threadId)
+{
+  _threadId = threadId;
+}
+
 std::string const& LogMessage::context() const
 {
   return _context;
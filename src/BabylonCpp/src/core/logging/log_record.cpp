@@ -0,0 +1,109 @@
+#include <babylon/core/logging/log_record.h>
+
+#include <cstdarg>
+#include <cstdio>
+#include <sstream>
+
+#include <babylon/core/logging/log_message.h>
+#include <babylon/core/time.h>
+
+namespace BABYLON {
+
+constexpr size_t LogRecord::ContextSize;
+constexpr size_t LogRecord::MessageSize;
+
+LogRecordStream& LogRecordStream::ThreadInstance()
+{
+  static thread_local LogRecordStream stream;
+  return stream;
+}
+
+LogRecordStream::LogRecordStream() : std::ostream{&_buffer}
+{
+}
+
+LogRecordStream::~LogRecordStream()
+{
+}
+
+std::ostream& LogRecordStream::open(char* buffer, size_t size)
+{
+  // Keep the last character for the null terminator
+  _buffer.reset(buffer, size - 1);
+  clear();
+  return *this;
+}
+
+void LogRecordStream::close()
+{
+  *_buffer.current() = '\0';
+}
+
+void LogRecordStream::Buffer::reset(char* buffer, size_t size)
+{
+  setp(buffer, buffer + size);
+}
+
+char* LogRecordStream::Buffer::current() const
+{
+  return pptr();
+}
+
+LogRecord::LogRecord(unsigned int lvl, char const* f, int line,
+                     char const* func, char const* prettyFunc)
+    : level{lvl}
+    , lineNumber{line}
+    , timestamp{Time::systemTimepointNow()}
+    , threadId{std::this_thread::get_id()}
+    , file{f}
+    , function{func}
+    , prettyFunction{prettyFunc}
+{
+  context[0] = '\0';
+  message[0] = '\0';
+}
+
+/**
+ * capturef, used for "printf" like API in CHECKF, LOGF, LOGF_IF
+ * The message is truncated to the size of the record.
+ */
+void LogRecord::writef(const char* printf_like_message, ...)
+{
+  va_list arglist;
+  va_start(arglist, printf_like_message);
+#if (defined(WIN32) || defined(_WIN32)                                         \
+     || defined(__WIN32__) && !defined(__GNUC__))
+  const int nbrcharacters = vsnprintf_s(message, MessageSize, _TRUNCATE,
+                                        printf_like_message, arglist);
+#else
+  const int nbrcharacters
+    = vsnprintf(message, MessageSize, printf_like_message, arglist);
+#endif
+  va_end(arglist);
+
+  if (nbrcharacters < 0) {
+    snprintf(message, MessageSize,
+             "ERROR LOG MSG NOTIFICATION: Failure to parse successfully the "
+             "message \"%s\"",
+             printf_like_message);
+  }
+}
+
+LogMessage LogRecord::toLogMessage() const
+{
+  LogMessage logMessage{level, context};
+  logMessage.setTimestamp(timestamp);
+  std::ostringstream ss;
+  ss << std::hex << threadId;
+  logMessage.setThreadId(ss.str());
+  logMessage.setFile(file);
+  logMessage.setLineNumber(lineNumber);
+  logMessage.setFunction(function);
+  if (*prettyFunction) {
+    logMessage.setPrettyFunction(prettyFunction);
+  }
+  logMessage.write(message);
+  return logMessage;
+}
+
+} // end of namespace BABYLON
@@ -1,49 +1,64 @@
 #include <babylon/core/logging/logger.h>
 
-#include <babylon/core/future.h>
+#include <algorithm>
+
 #include <babylon/core/logging/log_message.h>
 
 namespace BABYLON {
 
 LogMessageHandler::LogMessageHandler()
-    : _bg(Active::createActive())
-    , _minLevel{LogLevels::LEVEL_QUIET}
-    , _maxLevel{LogLevels::LEVEL_TRACE}
+    : _minLevel{LogLevels::LEVEL_QUIET}, _maxLevel{LogLevels::LEVEL_TRACE}
 {
   for (unsigned int lvl = _minLevel; lvl <= _maxLevel; ++lvl) {
     _logMessageListeners[lvl] = std::vector<LogMessageListener*>();
   }
 }
 
-bool LogMessageHandler::takes(unsigned int level)
+bool LogMessageHandler::takes(unsigned int level) const
 {
   return (level >= _minLevel) && (level <= _maxLevel);
 }
 
-void LogMessageHandler::handle(const LogMessage& logMessage)
+void LogMessageHandler::handle(const LogRecord& logRecord)
 {
-  if (_logMessageListeners.find(logMessage.level())
-      != _logMessageListeners.end()) {
-    std::vector<LogMessageListener*> _logMsgListenersLvl
-      = _logMessageListeners[logMessage.level()];
-    for (auto& logMsgListener : _logMsgListenersLvl) {
-      (*logMsgListener)(LogMessage(logMessage));
+  std::lock_guard<std::mutex> lock(_listenersMutex);
+  auto it = _logMessageListeners.find(logRecord.level);
+  if (it != _logMessageListeners.end() && !it->second.empty()) {
+    // The message is created once and shared by all the listeners
+    const auto logMessage = logRecord.toLogMessage();
+    for (auto& logMsgListener : it->second) {
+      (*logMsgListener)(logMessage);
     }
   }
 }
 
+constexpr size_t Logger::QueueCapacity;
+
 Logger::Logger()
+    : _records{QueueCapacity}
+    , _overflowPolicy{LogOverflowPolicy::DROP}
+    , _droppedCount{0}
+    , _sleeping{false}
+    , _handling{false}
+    , _done{false}
+    , _thread{&Logger::_run, this}
 {
 }
 
 Logger::~Logger()
 {
-  using namespace std::literals;
-  // Cleanly shutting down log message handler
-  auto bg_clear_listeners_call = [this] { _impl._logMessageListeners.clear(); };
-  auto token_cleared = spawn_task(bg_clear_listeners_call, _impl._bg.get());
-  token_cleared.wait_for(1s);
-  _impl._bg.reset(nullptr);
+  // Cleanly shutting down log message handler, the queued records are handled
+  // before the thread exits
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _done = true;
+  }
+  _recordCondition.notify_one();
+  if (_thread.joinable()) {
+    _thread.join();
+  }
+  std::lock_guard<std::mutex> lock(_impl._listenersMutex);
+  _impl._logMessageListeners.clear();
 }
 
 LogMessage Logger::CreateMessage(unsigned int level, std::string context,
@@ -58,26 +73,117 @@ LogMessage Logger::CreateMessage(unsigned int level, std::string context,
   return logMessage;
 }
 
-void Logger::log(const LogMessage& msg)
+void Logger::log(const LogMessage& logMessage)
 {
-  _impl._bg->send([this, msg] { _impl.handle(msg); });
+  // The strings of the message do not outlive the call, only the level, the
+  // context and the text are kept
+  LogRecord logRecord{logMessage.level(), "", logMessage.lineNumber(), "", ""};
+  logRecord.timestamp = logMessage.timestamp();
+  logRecord.setContext(logMessage.context());
+  logRecord.write(logMessage.message());
+  log(logRecord);
 }
 
-bool Logger::takes(unsigned int level)
+void Logger::log(const LogRecord& logRecord)
+{
+  while (!_records.tryPush(logRecord)) {
+    if (_overflowPolicy.load(std::memory_order_relaxed)
+        == LogOverflowPolicy::DROP) {
+      ++_droppedCount;
+      return;
+    }
+    // Make room for the record by dropping the oldest one, the room can be
+    // taken by another producer in the meantime
+    LogRecord droppedRecord;
+    if (_records.tryAndPop(droppedRecord)) {
+      ++_droppedCount;
+    }
+  }
+  _wakeUp();
+}
+
+bool Logger::takes(unsigned int level) const
 {
   return _impl.takes(level);
 }
 
+void Logger::flush()
+{
+  // The record being handled is popped from the queue, so the queue is checked
+  // first
+  while (!_records.empty() || _handling) {
+    _wakeUp();
+    std::this_thread::yield();
+  }
+}
+
+void Logger::setOverflowPolicy(LogOverflowPolicy policy)
+{
+  _overflowPolicy = policy;
+}
+
+LogOverflowPolicy Logger::overflowPolicy() const
+{
+  return _overflowPolicy;
+}
+
+size_t Logger::droppedCount() const
+{
+  return _droppedCount;
+}
+
+void Logger::_run()
+{
+  LogRecord logRecord;
+  for (;;) {
+    _handling = true;
+    while (_records.tryAndPop(logRecord)) {
+      _impl.handle(logRecord);
+    }
+    _handling = false;
+    if (_done) {
+      // Handle the records pushed concurrently to the shutdown
+      while (_records.tryAndPop(logRecord)) {
+        _impl.handle(logRecord);
+      }
+      return;
+    }
+    // Sleep until a record is pushed, the producers only lock the mutex when
+    // the thread is sleeping
+    std::unique_lock<std::mutex> lock(_mutex);
+    _sleeping = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    _recordCondition.wait_for(lock, std::chrono::milliseconds(100), [this]() {
+      return _done || !_records.empty();
+    });
+    _sleeping = false;
+  }
+}
+
+void Logger::_wakeUp()
+{
+  // Orders the push of the record before the check, the sleeping thread also
+  // wakes up periodically
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_sleeping) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+    }
+    _recordCondition.notify_one();
+  }
+}
+
 bool Logger::isSubscribed(unsigned int level,
                           LogMessageListener& logMsgListener)
 {
+  std::lock_guard<std::mutex> lock(_impl._listenersMutex);
   bool subscribed = false;
   if (_impl._logMessageListeners.find(level)
       != _impl._logMessageListeners.end()) {
     std::vector<LogMessageListener*>& _logMsgListenersLvl
       = _impl._logMessageListeners[level];
     auto it    = std::find(_logMsgListenersLvl.begin(),
-                          _logMsgListenersLvl.end(), &logMsgListener);
+                        _logMsgListenersLvl.end(), &logMsgListener);
     subscribed = (it != _logMsgListenersLvl.end());
   }
   return subscribed;
@@ -85,59 +191,48 @@ bool Logger::isSubscribed(unsigned int level,
 
 void Logger::registerLogMessageListener(LogMessageListener& logMsgListener)
 {
-  auto bgAddMsgListenercall = [this, &logMsgListener] {
-    for (auto& keyVal : _impl._logMessageListeners) {
-      std::vector<LogMessageListener*>& _logMsgListenersLvl
-        = _impl._logMessageListeners[keyVal.first];
-      auto it = std::find(_logMsgListenersLvl.begin(),
-                            _logMsgListenersLvl.end(), &logMsgListener);
-      if (it == _logMsgListenersLvl.end()) {
-        LogMessageListener* l = &logMsgListener;
-        _logMsgListenersLvl.emplace_back(l);
-      }
+  std::lock_guard<std::mutex> lock(_impl._listenersMutex);
+  for (auto& keyVal : _impl._logMessageListeners) {
+    std::vector<LogMessageListener*>& _logMsgListenersLvl = keyVal.second;
+    auto it = std::find(_logMsgListenersLvl.begin(), _logMsgListenersLvl.end(),
+                        &logMsgListener);
+    if (it == _logMsgListenersLvl.end()) {
+      LogMessageListener* l = &logMsgListener;
+      _logMsgListenersLvl.emplace_back(l);
     }
-  };
-  auto token_done = spawn_task(bgAddMsgListenercall, _impl._bg.get());
-  token_done.wait();
+  }
 }
 
 void Logger::unregisterLogMessageListener(
   const LogMessageListener& logMsgListener)
 {
-  auto bgRemoveMsgListenercall = [this, logMsgListener] {
-    for (const auto& keyVal : _impl._logMessageListeners) {
-      std::vector<LogMessageListener*>& _logMsgListenersLvl
-        = _impl._logMessageListeners[keyVal.first];
-      auto it = std::find(_logMsgListenersLvl.begin(),
-                            _logMsgListenersLvl.end(), &logMsgListener);
-      if (it != _logMsgListenersLvl.end()) {
-        _logMsgListenersLvl.erase(it);
-      }
+  std::lock_guard<std::mutex> lock(_impl._listenersMutex);
+  for (auto& keyVal : _impl._logMessageListeners) {
+    std::vector<LogMessageListener*>& _logMsgListenersLvl = keyVal.second;
+    auto it = std::find(_logMsgListenersLvl.begin(), _logMsgListenersLvl.end(),
+                        &logMsgListener);
+    if (it != _logMsgListenersLvl.end()) {
+      _logMsgListenersLvl.erase(it);
     }
-  };
-  auto token_done = spawn_task(bgRemoveMsgListenercall, _impl._bg.get());
-  token_done.wait();
+  }
 }
 
 void Logger::registerLogMessageListener(unsigned int level,
                                         LogMessageListener& logMsgListener)
 {
   if (_impl.takes(level)) {
-    auto bgAddMsgListenercall = [this, &level, &logMsgListener] {
-      if (_impl._logMessageListeners.find(level)
-          != _impl._logMessageListeners.end()) {
-        std::vector<LogMessageListener*>& _logMsgListenersLvl
-          = _impl._logMessageListeners[level];
-        LogMessageListener* l = &logMsgListener;
-        auto it               = std::find(_logMsgListenersLvl.begin(),
-                              _logMsgListenersLvl.end(), l);
-        if (it == _logMsgListenersLvl.end()) {
-          _impl._logMessageListeners[level].emplace_back(l);
-        }
+    std::lock_guard<std::mutex> lock(_impl._listenersMutex);
+    if (_impl._logMessageListeners.find(level)
+        != _impl._logMessageListeners.end()) {
+      std::vector<LogMessageListener*>& _logMsgListenersLvl
+        = _impl._logMessageListeners[level];
+      LogMessageListener* l = &logMsgListener;
+      auto it               = std::find(_logMsgListenersLvl.begin(),
+                            _logMsgListenersLvl.end(), l);
+      if (it == _logMsgListenersLvl.end()) {
+        _logMsgListenersLvl.emplace_back(l);
       }
-    };
-    auto token_done = spawn_task(bgAddMsgListenercall, _impl._bg.get());
-    token_done.wait();
+    }
   }
 }
 
@@ -145,20 +240,17 @@ void Logger::unregisterLogMessageListener(
   unsigned int level, const LogMessageListener& logMsgListener)
 {
   if (_impl.takes(level)) {
-    auto bgRemoveMsgListenercall = [this, &level, &logMsgListener] {
-      if (_impl._logMessageListeners.find(level)
-          != _impl._logMessageListeners.end()) {
-        std::vector<LogMessageListener*>& _logMsgListenersLvl
-          = _impl._logMessageListeners[level];
-        auto it = std::find(_logMsgListenersLvl.begin(),
-                              _logMsgListenersLvl.end(), &logMsgListener);
-        if (it != _logMsgListenersLvl.end()) {
-          _logMsgListenersLvl.erase(it);
-        }
+    std::lock_guard<std::mutex> lock(_impl._listenersMutex);
+    if (_impl._logMessageListeners.find(level)
+        != _impl._logMessageListeners.end()) {
+      std::vector<LogMessageListener*>& _logMsgListenersLvl
+        = _impl._logMessageListeners[level];
+      auto it = std::find(_logMsgListenersLvl.begin(),
+                          _logMsgListenersLvl.end(), &logMsgListener);
+      if (it != _logMsgListenersLvl.end()) {
+        _logMsgListenersLvl.erase(it);
       }
-    };
-    auto token_done = spawn_task(bgRemoveMsgListenercall, _impl._bg.get());
-    token_done.wait();
+    }
   }
 }
 
@@ -0,0 +1,275 @@
+#include <babylon/core/thread_pool.h>
+
+#include <algorithm>
+
+namespace BABYLON {
+
+ThreadPool::Task::Task(TaskFunction function)
+    : _function{std::move(function)}, _pendingDependencies{1}, _completed{false}
+{
+}
+
+ThreadPool::Task::~Task()
+{
+}
+
+bool ThreadPool::Task::isCompleted() const
+{
+  return _completed;
+}
+
+ThreadPool::ThreadPool(size_t workerCount)
+    : _queuedTasks{0}, _pendingTasks{0}, _sleepingThreads{0}, _done{false}
+{
+  for (size_t i = 0; i <= workerCount; ++i) {
+    _queues.emplace_back(std::make_unique<TaskQueue>());
+  }
+  _workers.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; ++i) {
+    _workers.emplace_back(&ThreadPool::_run, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  waitAll();
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _done = true;
+  }
+  _condition.notify_all();
+
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+size_t ThreadPool::workerCount() const
+{
+  return _workers.size();
+}
+
+ThreadPool::TaskPtr
+ThreadPool::submit(TaskFunction function,
+                   const std::vector<TaskPtr>& dependencies)
+{
+  auto task = std::make_shared<Task>(std::move(function));
+  ++_pendingTasks;
+  for (const auto& dependency : dependencies) {
+    std::lock_guard<std::mutex> lock(dependency->_mutex);
+    if (!dependency->_completed) {
+      ++task->_pendingDependencies;
+      dependency->_continuations.emplace_back(task);
+    }
+  }
+  // Release the submission guard
+  if (--task->_pendingDependencies == 0) {
+    _schedule(task);
+  }
+  return task;
+}
+
+ThreadPool::TaskPtr ThreadPool::then(const TaskPtr& task,
+                                     TaskFunction continuation)
+{
+  return submit(std::move(continuation), {task});
+}
+
+void ThreadPool::wait(const TaskPtr& task)
+{
+  while (!task->_completed) {
+    if (!_runTask()) {
+      _sleep([&task]() { return task->_completed.load(); });
+    }
+  }
+}
+
+void ThreadPool::waitAll()
+{
+  while (_pendingTasks > 0) {
+    if (!_runTask()) {
+      _sleep([this]() { return _pendingTasks == 0; });
+    }
+  }
+}
+
+void ThreadPool::parallelFor(size_t count, const Callback& callback)
+{
+  if (count == 0) {
+    return;
+  }
+
+  if (_workers.empty() || count == 1) {
+    for (size_t index = 0; index < count; ++index) {
+      callback(index);
+    }
+    return;
+  }
+
+  // The indices are distributed dynamically between the calling thread and
+  // one task per available worker
+  std::atomic<size_t> nextIndex{0};
+  const auto execute = [&nextIndex, count, &callback]() {
+    for (size_t index = nextIndex++; index < count; index = nextIndex++) {
+      callback(index);
+    }
+  };
+  std::vector<TaskPtr> tasks;
+  const auto taskCount = std::min(_workers.size(), count - 1);
+  tasks.reserve(taskCount);
+  for (size_t i = 0; i < taskCount; ++i) {
+    tasks.emplace_back(submit(execute));
+  }
+
+  execute();
+
+  // Wait for the tasks to leave the loop before the callback goes away
+  for (const auto& task : tasks) {
+    wait(task);
+  }
+}
+
+void ThreadPool::parallelFor(size_t begin, size_t end, size_t grainSize,
+                             const RangeCallback& callback)
+{
+  if (end <= begin) {
+    return;
+  }
+
+  grainSize             = std::max<size_t>(grainSize, 1);
+  const auto rangeCount = (end - begin + grainSize - 1) / grainSize;
+  parallelFor(rangeCount, [begin, end, grainSize, &callback](size_t index) {
+    const auto rangeBegin = begin + index * grainSize;
+    callback(rangeBegin, std::min(rangeBegin + grainSize, end));
+  });
+}
+
+ThreadPool::WorkerContext& ThreadPool::_CurrentWorker()
+{
+  static thread_local WorkerContext context{nullptr, 0};
+  return context;
+}
+
+void ThreadPool::_run(size_t workerIndex)
+{
+  _CurrentWorker() = {this, workerIndex};
+  while (!_done) {
+    if (!_runTask()) {
+      _sleep([]() { return false; });
+    }
+  }
+}
+
+void ThreadPool::_schedule(const TaskPtr& task)
+{
+  // The tasks submitted by a worker are queued on its own queue
+  const auto& worker = _CurrentWorker();
+  auto& queue        = (worker.pool == this) ? *_queues[worker.workerIndex] :
+                                        *_queues.back();
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.emplace_back(task);
+    ++_queuedTasks;
+  }
+  if (_sleepingThreads > 0) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+    }
+    _condition.notify_all();
+  }
+}
+
+bool ThreadPool::_popTask(TaskPtr& task)
+{
+  if (_queuedTasks == 0) {
+    return false;
+  }
+
+  const auto tryPop = [this, &task](TaskQueue& queue, bool newest) {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+      return false;
+    }
+    if (newest) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    }
+    else {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+    --_queuedTasks;
+    return true;
+  };
+
+  // Own queue first, then the shared queue, then steal from the other workers
+  const auto& worker     = _CurrentWorker();
+  const auto workerCount = _workers.size();
+  const auto isWorker    = (worker.pool == this);
+  if (isWorker && tryPop(*_queues[worker.workerIndex], true)) {
+    return true;
+  }
+  if (tryPop(*_queues.back(), false)) {
+    return true;
+  }
+  const auto first = isWorker ? worker.workerIndex + 1 : 0;
+  for (size_t i = 0; i < workerCount; ++i) {
+    const auto victim = (first + i) % workerCount;
+    if ((!isWorker || victim != worker.workerIndex)
+        && tryPop(*_queues[victim], false)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ThreadPool::_runTask()
+{
+  TaskPtr task;
+  if (!_popTask(task)) {
+    return false;
+  }
+  task->_function();
+  // Release the captures of the function
+  task->_function = nullptr;
+  _complete(task);
+  return true;
+}
+
+void ThreadPool::_complete(const TaskPtr& task)
+{
+  std::vector<TaskPtr> continuations;
+  {
+    std::lock_guard<std::mutex> lock(task->_mutex);
+    task->_completed = true;
+    continuations.swap(task->_continuations);
+  }
+  for (const auto& continuation : continuations) {
+    if (--continuation->_pendingDependencies == 0) {
+      _schedule(continuation);
+    }
+  }
+  --_pendingTasks;
+  // Wake up the threads waiting for the task
+  if (_sleepingThreads > 0) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+    }
+    _condition.notify_all();
+  }
+}
+
+void ThreadPool::_sleep(const std::function<bool()>& wakeUp)
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  ++_sleepingThreads;
+  // The counters are sequentially consistent: either the thread scheduling
+  // or completing a task sees this thread sleeping and notifies it, or this
+  // thread sees the new state
+  _condition.wait(
+    lock, [this, &wakeUp]() { return _done || _queuedTasks > 0 || wakeUp(); });
+  --_sleepingThreads;
+}
+
+} // end of namespace BABYLON
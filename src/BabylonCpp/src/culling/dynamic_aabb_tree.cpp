@@ -0,0 +1,499 @@
+#include <babylon/culling/dynamic_aabb_tree.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <babylon/culling/ray.h>
+#include <babylon/mesh/abstract_mesh.h>
+
+namespace BABYLON {
+
+template <class T>
+constexpr int DynamicAABBTree<T>::NullNode;
+
+template <class T>
+DynamicAABBTree<T>::DynamicAABBTree(float margin)
+    : _root{NullNode}, _freeList{NullNode}, _proxyCount{0}, _margin{margin}
+{
+}
+
+template <class T>
+DynamicAABBTree<T>::~DynamicAABBTree()
+{
+}
+
+template <class T>
+int DynamicAABBTree<T>::createProxy(const Vector3& minimum,
+                                    const Vector3& maximum, const T& userData)
+{
+  const int proxyId = _allocateNode();
+
+  auto& node    = _nodes[static_cast<size_t>(proxyId)];
+  node.minimum  = minimum.subtract(Vector3(_margin, _margin, _margin));
+  node.maximum  = maximum.add(Vector3(_margin, _margin, _margin));
+  node.userData = userData;
+  node.height   = 0;
+
+  _insertLeaf(proxyId);
+  ++_proxyCount;
+
+  return proxyId;
+}
+
+template <class T>
+void DynamicAABBTree<T>::destroyProxy(int proxyId)
+{
+  _removeLeaf(proxyId);
+  _freeNode(proxyId);
+  --_proxyCount;
+}
+
+template <class T>
+bool DynamicAABBTree<T>::moveProxy(int proxyId, const Vector3& minimum,
+                                   const Vector3& maximum)
+{
+  auto& node = _nodes[static_cast<size_t>(proxyId)];
+
+  // Still enclosed by the fattened box
+  if (node.minimum.x <= minimum.x && node.minimum.y <= minimum.y
+      && node.minimum.z <= minimum.z && maximum.x <= node.maximum.x
+      && maximum.y <= node.maximum.y && maximum.z <= node.maximum.z) {
+    return false;
+  }
+
+  _removeLeaf(proxyId);
+
+  node.minimum = minimum.subtract(Vector3(_margin, _margin, _margin));
+  node.maximum = maximum.add(Vector3(_margin, _margin, _margin));
+
+  _insertLeaf(proxyId);
+
+  return true;
+}
+
+template <class T>
+const T& DynamicAABBTree<T>::getUserData(int proxyId) const
+{
+  return _nodes[static_cast<size_t>(proxyId)].userData;
+}
+
+template <class T>
+const Vector3& DynamicAABBTree<T>::getFatMinimum(int proxyId) const
+{
+  return _nodes[static_cast<size_t>(proxyId)].minimum;
+}
+
+template <class T>
+const Vector3& DynamicAABBTree<T>::getFatMaximum(int proxyId) const
+{
+  return _nodes[static_cast<size_t>(proxyId)].maximum;
+}
+
+template <class T>
+void DynamicAABBTree<T>::raycast(
+  const Ray& ray,
+  const std::function<float(const T& userData, float distance)>& callback) const
+{
+  if (_root == NullNode) {
+    return;
+  }
+
+  // Work with a normalized direction so that distances are in world units
+  const float directionLength = ray.direction.length();
+  if (directionLength == 0.f) {
+    return;
+  }
+  const Vector3 direction = ray.direction.scale(1.f / directionLength);
+  const Vector3 invDirection(
+    direction.x != 0.f ? 1.f / direction.x : std::numeric_limits<float>::max(),
+    direction.y != 0.f ? 1.f / direction.y : std::numeric_limits<float>::max(),
+    direction.z != 0.f ? 1.f / direction.z :
+                         std::numeric_limits<float>::max());
+  const Vector3& origin = ray.origin;
+
+  float maxDistance = ray.length * directionLength;
+
+  // Returns the entry distance of the ray into the node box, or infinity when
+  // the box is missed
+  const auto entryDistance = [&](const TreeNode& node) {
+    float t1   = (node.minimum.x - origin.x) * invDirection.x;
+    float t2   = (node.maximum.x - origin.x) * invDirection.x;
+    float tmin = std::min(t1, t2);
+    float tmax = std::max(t1, t2);
+    t1         = (node.minimum.y - origin.y) * invDirection.y;
+    t2         = (node.maximum.y - origin.y) * invDirection.y;
+    tmin       = std::max(tmin, std::min(t1, t2));
+    tmax       = std::min(tmax, std::max(t1, t2));
+    t1         = (node.minimum.z - origin.z) * invDirection.z;
+    t2         = (node.maximum.z - origin.z) * invDirection.z;
+    tmin       = std::max(tmin, std::min(t1, t2));
+    tmax       = std::min(tmax, std::max(t1, t2));
+    if (tmax < tmin || tmax < 0.f) {
+      return std::numeric_limits<float>::infinity();
+    }
+    return std::max(tmin, 0.f);
+  };
+
+  // Min-heap on the entry distance gives a front-to-back traversal
+  using Candidate = std::pair<float, int>;
+  const auto greater
+    = [](const Candidate& a, const Candidate& b) { return a.first > b.first; };
+  std::vector<Candidate> heap;
+  heap.reserve(64);
+
+  const float rootDistance = entryDistance(_nodes[static_cast<size_t>(_root)]);
+  if (rootDistance > maxDistance) {
+    return;
+  }
+  heap.emplace_back(rootDistance, _root);
+
+  while (!heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), greater);
+    const auto [distance, nodeId] = heap.back();
+    heap.pop_back();
+
+    // Every remaining candidate is farther than the current limit
+    if (distance > maxDistance) {
+      break;
+    }
+
+    const auto& node = _nodes[static_cast<size_t>(nodeId)];
+    if (node.isLeaf()) {
+      const float value = callback(node.userData, distance);
+      if (value < 0.f) {
+        return;
+      }
+      maxDistance = std::min(maxDistance, value);
+      continue;
+    }
+
+    for (const int childId : {node.child1, node.child2}) {
+      const float childDistance
+        = entryDistance(_nodes[static_cast<size_t>(childId)]);
+      if (childDistance <= maxDistance) {
+        heap.emplace_back(childDistance, childId);
+        std::push_heap(heap.begin(), heap.end(), greater);
+      }
+    }
+  }
+}
+
+template <class T>
+void DynamicAABBTree<T>::clear()
+{
+  _nodes.clear();
+  _root       = NullNode;
+  _freeList   = NullNode;
+  _proxyCount = 0;
+}
+
+template <class T>
+size_t DynamicAABBTree<T>::proxyCount() const
+{
+  return _proxyCount;
+}
+
+template <class T>
+int DynamicAABBTree<T>::height() const
+{
+  return (_root == NullNode) ? 0 : _nodes[static_cast<size_t>(_root)].height;
+}
+
+template <class T>
+int DynamicAABBTree<T>::_allocateNode()
+{
+  int nodeId;
+  if (_freeList == NullNode) {
+    nodeId = static_cast<int>(_nodes.size());
+    _nodes.emplace_back(TreeNode());
+  }
+  else {
+    nodeId    = _freeList;
+    _freeList = _nodes[static_cast<size_t>(nodeId)].parent;
+  }
+
+  auto& node    = _nodes[static_cast<size_t>(nodeId)];
+  node.userData = T();
+  node.parent   = NullNode;
+  node.child1   = NullNode;
+  node.child2   = NullNode;
+  node.height   = 0;
+
+  return nodeId;
+}
+
+template <class T>
+void DynamicAABBTree<T>::_freeNode(int nodeId)
+{
+  auto& node    = _nodes[static_cast<size_t>(nodeId)];
+  node.userData = T();
+  node.parent   = _freeList;
+  node.height   = -1;
+  _freeList     = nodeId;
+}
+
+template <class T>
+void DynamicAABBTree<T>::_insertLeaf(int leaf)
+{
+  if (_root == NullNode) {
+    _root                                   = leaf;
+    _nodes[static_cast<size_t>(leaf)].parent = NullNode;
+    return;
+  }
+
+  // Find the best sibling for the leaf, using the surface area heuristic
+  const Vector3 leafMinimum = _nodes[static_cast<size_t>(leaf)].minimum;
+  const Vector3 leafMaximum = _nodes[static_cast<size_t>(leaf)].maximum;
+  int index                 = _root;
+  while (!_nodes[static_cast<size_t>(index)].isLeaf()) {
+    const auto& node   = _nodes[static_cast<size_t>(index)];
+    const float area   = _SurfaceArea(node.minimum, node.maximum);
+    const float combinedArea
+      = _SurfaceArea(Vector3::Minimize(node.minimum, leafMinimum),
+                     Vector3::Maximize(node.maximum, leafMaximum));
+
+    // Cost of creating a new parent for this node and the new leaf
+    const float cost = 2.f * combinedArea;
+
+    // Minimum cost of pushing the leaf further down the tree
+    const float inheritanceCost = 2.f * (combinedArea - area);
+
+    const auto descendCost = [&](int childId) {
+      const auto& child = _nodes[static_cast<size_t>(childId)];
+      const float newArea
+        = _SurfaceArea(Vector3::Minimize(child.minimum, leafMinimum),
+                       Vector3::Maximize(child.maximum, leafMaximum));
+      return child.isLeaf() ?
+               newArea + inheritanceCost :
+               newArea - _SurfaceArea(child.minimum, child.maximum)
+                 + inheritanceCost;
+    };
+
+    const float cost1 = descendCost(node.child1);
+    const float cost2 = descendCost(node.child2);
+
+    // Descend according to the minimum cost
+    if (cost < cost1 && cost < cost2) {
+      break;
+    }
+    index = (cost1 < cost2) ? node.child1 : node.child2;
+  }
+
+  const int sibling = index;
+
+  // Create a new parent, this may reallocate the node storage
+  const int oldParent = _nodes[static_cast<size_t>(sibling)].parent;
+  const int newParent = _allocateNode();
+  {
+    auto& parentNode   = _nodes[static_cast<size_t>(newParent)];
+    auto& siblingNode  = _nodes[static_cast<size_t>(sibling)];
+    parentNode.parent  = oldParent;
+    parentNode.minimum = Vector3::Minimize(leafMinimum, siblingNode.minimum);
+    parentNode.maximum = Vector3::Maximize(leafMaximum, siblingNode.maximum);
+    parentNode.height  = siblingNode.height + 1;
+    parentNode.child1  = sibling;
+    parentNode.child2  = leaf;
+    siblingNode.parent = newParent;
+    _nodes[static_cast<size_t>(leaf)].parent = newParent;
+  }
+
+  if (oldParent != NullNode) {
+    // The sibling was not the root
+    auto& oldParentNode = _nodes[static_cast<size_t>(oldParent)];
+    if (oldParentNode.child1 == sibling) {
+      oldParentNode.child1 = newParent;
+    }
+    else {
+      oldParentNode.child2 = newParent;
+    }
+  }
+  else {
+    // The sibling was the root
+    _root = newParent;
+  }
+
+  // Walk back up the tree fixing heights and boxes
+  _refit(_nodes[static_cast<size_t>(leaf)].parent);
+}
+
+template <class T>
+void DynamicAABBTree<T>::_removeLeaf(int leaf)
+{
+  if (leaf == _root) {
+    _root = NullNode;
+    return;
+  }
+
+  const int parent      = _nodes[static_cast<size_t>(leaf)].parent;
+  const int grandParent = _nodes[static_cast<size_t>(parent)].parent;
+  const int sibling     = (_nodes[static_cast<size_t>(parent)].child1 == leaf) ?
+                        _nodes[static_cast<size_t>(parent)].child2 :
+                        _nodes[static_cast<size_t>(parent)].child1;
+
+  if (grandParent != NullNode) {
+    // Destroy the parent and connect the sibling to the grand parent
+    auto& grandParentNode = _nodes[static_cast<size_t>(grandParent)];
+    if (grandParentNode.child1 == parent) {
+      grandParentNode.child1 = sibling;
+    }
+    else {
+      grandParentNode.child2 = sibling;
+    }
+    _nodes[static_cast<size_t>(sibling)].parent = grandParent;
+    _freeNode(parent);
+
+    // Adjust ancestor bounds
+    _refit(grandParent);
+  }
+  else {
+    _root                                      = sibling;
+    _nodes[static_cast<size_t>(sibling)].parent = NullNode;
+    _freeNode(parent);
+  }
+}
+
+template <class T>
+void DynamicAABBTree<T>::_refit(int index)
+{
+  while (index != NullNode) {
+    index = _balance(index);
+
+    auto& node         = _nodes[static_cast<size_t>(index)];
+    const auto& child1 = _nodes[static_cast<size_t>(node.child1)];
+    const auto& child2 = _nodes[static_cast<size_t>(node.child2)];
+
+    node.height  = 1 + std::max(child1.height, child2.height);
+    node.minimum = Vector3::Minimize(child1.minimum, child2.minimum);
+    node.maximum = Vector3::Maximize(child1.maximum, child2.maximum);
+
+    index = node.parent;
+  }
+}
+
+template <class T>
+int DynamicAABBTree<T>::_balance(int iA)
+{
+  auto& A = _nodes[static_cast<size_t>(iA)];
+  if (A.isLeaf() || A.height < 2) {
+    return iA;
+  }
+
+  const int iB = A.child1;
+  const int iC = A.child2;
+  auto& B      = _nodes[static_cast<size_t>(iB)];
+  auto& C      = _nodes[static_cast<size_t>(iC)];
+
+  const int balance = C.height - B.height;
+
+  // Replaces the child iA of the parent of A (or the root) by iNew
+  const auto replaceInParent = [this](int parent, int iOld, int iNew) {
+    if (parent != NullNode) {
+      auto& parentNode = _nodes[static_cast<size_t>(parent)];
+      if (parentNode.child1 == iOld) {
+        parentNode.child1 = iNew;
+      }
+      else {
+        parentNode.child2 = iNew;
+      }
+    }
+    else {
+      _root = iNew;
+    }
+  };
+
+  // Rotate C up
+  if (balance > 1) {
+    const int iF = C.child1;
+    const int iG = C.child2;
+    auto& F      = _nodes[static_cast<size_t>(iF)];
+    auto& G      = _nodes[static_cast<size_t>(iG)];
+
+    // Swap A and C
+    C.child1 = iA;
+    C.parent = A.parent;
+    A.parent = iC;
+    replaceInParent(C.parent, iA, iC);
+
+    // Rotate
+    if (F.height > G.height) {
+      C.child2  = iF;
+      A.child2  = iG;
+      G.parent  = iA;
+      A.minimum = Vector3::Minimize(B.minimum, G.minimum);
+      A.maximum = Vector3::Maximize(B.maximum, G.maximum);
+      C.minimum = Vector3::Minimize(A.minimum, F.minimum);
+      C.maximum = Vector3::Maximize(A.maximum, F.maximum);
+      A.height  = 1 + std::max(B.height, G.height);
+      C.height  = 1 + std::max(A.height, F.height);
+    }
+    else {
+      C.child2  = iG;
+      A.child2  = iF;
+      F.parent  = iA;
+      A.minimum = Vector3::Minimize(B.minimum, F.minimum);
+      A.maximum = Vector3::Maximize(B.maximum, F.maximum);
+      C.minimum = Vector3::Minimize(A.minimum, G.minimum);
+      C.maximum = Vector3::Maximize(A.maximum, G.maximum);
+      A.height  = 1 + std::max(B.height, F.height);
+      C.height  = 1 + std::max(A.height, G.height);
+    }
+
+    return iC;
+  }
+
+  // Rotate B up
+  if (balance < -1) {
+    const int iD = B.child1;
+    const int iE = B.child2;
+    auto& D      = _nodes[static_cast<size_t>(iD)];
+    auto& E      = _nodes[static_cast<size_t>(iE)];
+
+    // Swap A and B
+    B.child1 = iA;
+    B.parent = A.parent;
+    A.parent = iB;
+    replaceInParent(B.parent, iA, iB);
+
+    // Rotate
+    if (D.height > E.height) {
+      B.child2  = iD;
+      A.child1  = iE;
+      E.parent  = iA;
+      A.minimum = Vector3::Minimize(C.minimum, E.minimum);
+      A.maximum = Vector3::Maximize(C.maximum, E.maximum);
+      B.minimum = Vector3::Minimize(A.minimum, D.minimum);
+      B.maximum = Vector3::Maximize(A.maximum, D.maximum);
+      A.height  = 1 + std::max(C.height, E.height);
+      B.height  = 1 + std::max(A.height, D.height);
+    }
+    else {
+      B.child2  = iE;
+      A.child1  = iD;
+      D.parent  = iA;
+      A.minimum = Vector3::Minimize(C.minimum, D.minimum);
+      A.maximum = Vector3::Maximize(C.maximum, D.maximum);
+      B.minimum = Vector3::Minimize(A.minimum, E.minimum);
+      B.maximum = Vector3::Maximize(A.maximum, E.maximum);
+      A.height  = 1 + std::max(C.height, D.height);
+      B.height  = 1 + std::max(A.height, E.height);
+    }
+
+    return iB;
+  }
+
+  return iA;
+}
+
+template <class T>
+float DynamicAABBTree<T>::_SurfaceArea(const Vector3& minimum,
+                                       const Vector3& maximum)
+{
+  const float ex = maximum.x - minimum.x;
+  const float ey = maximum.y - minimum.y;
+  const float ez = maximum.z - minimum.z;
+  return 2.f * (ex * ey + ey * ez + ez * ex);
+}
+
+template class DynamicAABBTree<AbstractMesh*>;
+
+} // end of namespace BABYLON
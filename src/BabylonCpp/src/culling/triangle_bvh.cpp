@@ -0,0 +1,379 @@
+#include <babylon/culling/triangle_bvh.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/culling/ray.h>
+
+namespace BABYLON {
+
+constexpr size_t TriangleBVH::MinTriangleCount;
+constexpr size_t TriangleBVH::MaxLeafSize;
+constexpr size_t TriangleBVH::MaxDepth;
+constexpr size_t TriangleBVH::BinCount;
+
+TriangleBVH::Bin::Bin()
+    : min{{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+           std::numeric_limits<float>::max()}}
+    , max{{std::numeric_limits<float>::lowest(),
+           std::numeric_limits<float>::lowest(),
+           std::numeric_limits<float>::lowest()}}
+    , count{0}
+{
+}
+
+void TriangleBVH::Bin::grow(const float* bounds)
+{
+  for (unsigned int a = 0; a < 3; ++a) {
+    min[a] = std::min(min[a], bounds[a]);
+    max[a] = std::max(max[a], bounds[a + 3]);
+  }
+}
+
+void TriangleBVH::Bin::grow(const Bin& other)
+{
+  for (unsigned int a = 0; a < 3; ++a) {
+    min[a] = std::min(min[a], other.min[a]);
+    max[a] = std::max(max[a], other.max[a]);
+  }
+}
+
+float TriangleBVH::Bin::area() const
+{
+  return count > 0 ? TriangleBVH::_SurfaceArea(min, max) : 0.f;
+}
+
+TriangleBVH::TriangleBVH(const std::vector<Vector3>& positions,
+                         const IndicesArray& indices, size_t indexStart,
+                         size_t indexCount)
+{
+  const size_t indexEnd = std::min(indexStart + indexCount, indices.size());
+  _triangles.reserve(indexCount / 3);
+  for (size_t index = indexStart; index + 2 < indexEnd; index += 3) {
+    _triangles.emplace_back(Triangle{indices[index], indices[index + 1],
+                                     indices[index + 2],
+                                     static_cast<uint32_t>(index / 3)});
+  }
+
+  _build(positions);
+}
+
+TriangleBVH::~TriangleBVH()
+{
+}
+
+float TriangleBVH::_SurfaceArea(const std::array<float, 3>& min,
+                                const std::array<float, 3>& max)
+{
+  const float ex = max[0] - min[0];
+  const float ey = max[1] - min[1];
+  const float ez = max[2] - min[2];
+  return ex * ey + ey * ez + ez * ex;
+}
+
+size_t TriangleBVH::nodeCount() const
+{
+  return _nodes.size();
+}
+
+size_t TriangleBVH::triangleCount() const
+{
+  return _triangles.size();
+}
+
+void TriangleBVH::_build(const std::vector<Vector3>& positions)
+{
+  const size_t count = _triangles.size();
+  if (count == 0) {
+    return;
+  }
+
+  // Per triangle centroids and bounds, kept in the same order as _triangles
+  std::vector<float> centroids(count * 3);
+  std::vector<float> bounds(count * 6);
+  for (size_t i = 0; i < count; ++i) {
+    const auto& triangle = _triangles[i];
+    const auto& p0       = positions[triangle.i0];
+    const auto& p1       = positions[triangle.i1];
+    const auto& p2       = positions[triangle.i2];
+    float* b             = &bounds[i * 6];
+    b[0]                 = std::min({p0.x, p1.x, p2.x});
+    b[1]                 = std::min({p0.y, p1.y, p2.y});
+    b[2]                 = std::min({p0.z, p1.z, p2.z});
+    b[3]                 = std::max({p0.x, p1.x, p2.x});
+    b[4]                 = std::max({p0.y, p1.y, p2.y});
+    b[5]                 = std::max({p0.z, p1.z, p2.z});
+    centroids[i * 3 + 0] = (p0.x + p1.x + p2.x) / 3.f;
+    centroids[i * 3 + 1] = (p0.y + p1.y + p2.y) / 3.f;
+    centroids[i * 3 + 2] = (p0.z + p1.z + p2.z) / 3.f;
+  }
+
+  // A binary tree with one triangle per leaf has 2n - 1 nodes, reserving them
+  // upfront keeps node references stable during the build
+  _nodes.clear();
+  _nodes.reserve(2 * count);
+  _nodes.emplace_back(Node{{}, 0, {}, static_cast<uint32_t>(count)});
+  _updateNodeBounds(_nodes[0], bounds);
+
+  std::vector<std::pair<uint32_t, size_t>> stack{{0, 1}};
+  while (!stack.empty()) {
+    const auto [nodeIndex, depth] = stack.back();
+    stack.pop_back();
+
+    auto& node = _nodes[nodeIndex];
+    if (node.count <= MaxLeafSize || depth >= MaxDepth) {
+      continue;
+    }
+
+    unsigned int axis   = 0;
+    float splitPosition = 0.f;
+    const float splitCost
+      = _findBestSplit(node, centroids, bounds, axis, splitPosition);
+    const float leafCost = static_cast<float>(node.count)
+                           * _SurfaceArea(node.min, node.max);
+    if (splitCost >= leafCost) {
+      continue;
+    }
+
+    // Partition the triangles around the split plane
+    size_t i = node.leftFirst;
+    size_t j = i + node.count;
+    while (i < j) {
+      if (centroids[i * 3 + axis] < splitPosition) {
+        ++i;
+      }
+      else {
+        --j;
+        std::swap(_triangles[i], _triangles[j]);
+        std::swap_ranges(&centroids[i * 3], &centroids[i * 3] + 3,
+                         &centroids[j * 3]);
+        std::swap_ranges(&bounds[i * 6], &bounds[i * 6] + 6, &bounds[j * 6]);
+      }
+    }
+
+    const size_t leftCount = i - node.leftFirst;
+    if (leftCount == 0 || leftCount == node.count) {
+      continue;
+    }
+
+    const auto leftChildIndex = static_cast<uint32_t>(_nodes.size());
+    _nodes.emplace_back(
+      Node{{}, node.leftFirst, {}, static_cast<uint32_t>(leftCount)});
+    _nodes.emplace_back(Node{{}, static_cast<uint32_t>(i), {},
+                             static_cast<uint32_t>(node.count - leftCount)});
+    node.leftFirst = leftChildIndex;
+    node.count     = 0;
+
+    _updateNodeBounds(_nodes[leftChildIndex], bounds);
+    _updateNodeBounds(_nodes[leftChildIndex + 1], bounds);
+
+    stack.emplace_back(leftChildIndex, depth + 1);
+    stack.emplace_back(leftChildIndex + 1, depth + 1);
+  }
+
+  _nodes.shrink_to_fit();
+}
+
+void TriangleBVH::_updateNodeBounds(Node& node,
+                                    const std::vector<float>& bounds) const
+{
+  node.min = {{std::numeric_limits<float>::max(),
+               std::numeric_limits<float>::max(),
+               std::numeric_limits<float>::max()}};
+  node.max = {{std::numeric_limits<float>::lowest(),
+               std::numeric_limits<float>::lowest(),
+               std::numeric_limits<float>::lowest()}};
+  for (size_t i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+    const float* b = &bounds[i * 6];
+    for (unsigned int a = 0; a < 3; ++a) {
+      node.min[a] = std::min(node.min[a], b[a]);
+      node.max[a] = std::max(node.max[a], b[a + 3]);
+    }
+  }
+}
+
+float TriangleBVH::_findBestSplit(const Node& node,
+                                  const std::vector<float>& centroids,
+                                  const std::vector<float>& bounds,
+                                  unsigned int& axis,
+                                  float& splitPosition) const
+{
+  // Bounds of the triangle centroids, the bins are laid out over them
+  std::array<float, 3> cmin{{std::numeric_limits<float>::max(),
+                             std::numeric_limits<float>::max(),
+                             std::numeric_limits<float>::max()}};
+  std::array<float, 3> cmax{{std::numeric_limits<float>::lowest(),
+                             std::numeric_limits<float>::lowest(),
+                             std::numeric_limits<float>::lowest()}};
+  const size_t first = node.leftFirst;
+  const size_t last  = node.leftFirst + node.count;
+  for (size_t i = first; i < last; ++i) {
+    for (unsigned int a = 0; a < 3; ++a) {
+      cmin[a] = std::min(cmin[a], centroids[i * 3 + a]);
+      cmax[a] = std::max(cmax[a], centroids[i * 3 + a]);
+    }
+  }
+
+  float bestCost = std::numeric_limits<float>::max();
+  for (unsigned int a = 0; a < 3; ++a) {
+    const float extent = cmax[a] - cmin[a];
+    if (extent <= 0.f) {
+      continue;
+    }
+
+    std::array<Bin, BinCount> bins;
+    const float scale = static_cast<float>(BinCount) / extent;
+    for (size_t i = first; i < last; ++i) {
+      const auto binIndex = std::min(
+        BinCount - 1,
+        static_cast<size_t>((centroids[i * 3 + a] - cmin[a]) * scale));
+      ++bins[binIndex].count;
+      bins[binIndex].grow(&bounds[i * 6]);
+    }
+
+    // Sweep from both sides to get the cost of each of the BinCount - 1
+    // candidate planes
+    std::array<float, BinCount - 1> leftArea, rightArea;
+    std::array<size_t, BinCount - 1> leftCount, rightCount;
+    Bin leftBox, rightBox;
+    size_t leftSum = 0, rightSum = 0;
+    for (size_t i = 0; i < BinCount - 1; ++i) {
+      leftSum += bins[i].count;
+      leftCount[i] = leftSum;
+      leftBox.count += bins[i].count;
+      leftBox.grow(bins[i]);
+      leftArea[i] = leftBox.area();
+
+      rightSum += bins[BinCount - 1 - i].count;
+      rightCount[BinCount - 2 - i] = rightSum;
+      rightBox.count += bins[BinCount - 1 - i].count;
+      rightBox.grow(bins[BinCount - 1 - i]);
+      rightArea[BinCount - 2 - i] = rightBox.area();
+    }
+
+    for (size_t i = 0; i < BinCount - 1; ++i) {
+      const float cost = static_cast<float>(leftCount[i]) * leftArea[i]
+                         + static_cast<float>(rightCount[i]) * rightArea[i];
+      if (cost < bestCost) {
+        bestCost      = cost;
+        axis          = a;
+        splitPosition = cmin[a] + static_cast<float>(i + 1) / scale;
+      }
+    }
+  }
+
+  return bestCost;
+}
+
+std::optional<IntersectionInfo>
+TriangleBVH::intersects(Ray& ray, const std::vector<Vector3>& positions,
+                        bool fastCheck) const
+{
+  std::optional<IntersectionInfo> intersectInfo = std::nullopt;
+
+  if (_nodes.empty()) {
+    return intersectInfo;
+  }
+
+  const std::array<float, 3> origin{{ray.origin.x, ray.origin.y, ray.origin.z}};
+  const std::array<float, 3> direction{
+    {ray.direction.x, ray.direction.y, ray.direction.z}};
+  std::array<float, 3> invDirection;
+  for (unsigned int a = 0; a < 3; ++a) {
+    invDirection[a] = direction[a] != 0.f ?
+                        1.f / direction[a] :
+                        std::numeric_limits<float>::max();
+  }
+
+  float closest = ray.length;
+
+  // Returns the entry distance of the ray into the node bounds, or infinity
+  // when the node is missed or farther than the closest hit so far
+  const auto intersectsNode = [&](const Node& node) {
+    float tmin = std::numeric_limits<float>::lowest();
+    float tmax = std::numeric_limits<float>::max();
+    for (unsigned int a = 0; a < 3; ++a) {
+      float t1 = (node.min[a] - origin[a]) * invDirection[a];
+      float t2 = (node.max[a] - origin[a]) * invDirection[a];
+      if (t1 > t2) {
+        std::swap(t1, t2);
+      }
+      tmin = std::max(tmin, t1);
+      tmax = std::min(tmax, t2);
+    }
+    return (tmax >= tmin && tmax >= 0.f && tmin <= closest) ?
+             tmin :
+             std::numeric_limits<float>::infinity();
+  };
+
+  if (intersectsNode(_nodes[0]) == std::numeric_limits<float>::infinity()) {
+    return intersectInfo;
+  }
+
+  // Nodes to visit together with their entry distance, nearest child first
+  std::array<std::pair<uint32_t, float>, MaxDepth + 1> stack;
+  size_t stackSize   = 0;
+  uint32_t nodeIndex = 0;
+  while (true) {
+    const auto& node = _nodes[nodeIndex];
+    if (node.count > 0) {
+      for (size_t i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+        const auto& triangle = _triangles[i];
+        auto currentIntersectInfo
+          = ray.intersectsTriangle(positions[triangle.i0],
+                                   positions[triangle.i1],
+                                   positions[triangle.i2]);
+        if (!currentIntersectInfo || currentIntersectInfo->distance < 0.f) {
+          continue;
+        }
+
+        if (fastCheck || !intersectInfo
+            || currentIntersectInfo->distance < intersectInfo->distance) {
+          intersectInfo         = currentIntersectInfo;
+          intersectInfo->faceId = triangle.faceId;
+          closest               = intersectInfo->distance;
+
+          if (fastCheck) {
+            return intersectInfo;
+          }
+        }
+      }
+    }
+    else {
+      uint32_t nearChild = node.leftFirst;
+      uint32_t farChild  = node.leftFirst + 1;
+      float nearDistance = intersectsNode(_nodes[nearChild]);
+      float farDistance  = intersectsNode(_nodes[farChild]);
+      if (nearDistance > farDistance) {
+        std::swap(nearChild, farChild);
+        std::swap(nearDistance, farDistance);
+      }
+      if (nearDistance != std::numeric_limits<float>::infinity()) {
+        if (farDistance != std::numeric_limits<float>::infinity()) {
+          stack[stackSize++] = {farChild, farDistance};
+        }
+        nodeIndex = nearChild;
+        continue;
+      }
+    }
+
+    // Pop the next node that can still contain a closer hit
+    bool found = false;
+    while (stackSize > 0) {
+      const auto& entry = stack[--stackSize];
+      if (entry.second <= closest) {
+        nodeIndex = entry.first;
+        found     = true;
+        break;
+      }
+    }
+    if (!found) {
+      break;
+    }
+  }
+
+  return intersectInfo;
+}
+
+} // end of namespace BABYLON
@@ -8,6 +8,7 @@
 #include <babylon/core/delegates/delegate.h>
 #include <babylon/core/logging.h>
 #include <babylon/core/string.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/core/time.h>
 #include <babylon/engine/depth_texture_creation_options.h>
 #include <babylon/engine/instancing_attribute_info.h>
@@ -102,6 +103,8 @@ Engine::Engine(ICanvas* canvas, const EngineOptions& options)
     , _performanceMonitor{std::make_unique<PerformanceMonitor>()}
     , _fps{60.f}
     , _deltaTime{0.f}
+    , _threadPoolWorkerCount{options.threadPoolWorkerCount}
+    , _threadPool{nullptr}
     , _currentTextureChannel{-1}
     , _cachedVertexArrayObject{nullptr}
     , _uintIndicesCurrentlySet{false}
@@ -441,6 +444,19 @@ PerformanceMonitor* Engine::performanceMonitor() const
   return _performanceMonitor.get();
 }
 
+ThreadPool* Engine::threadPool()
+{
+  if (!_threadPool) {
+    const auto workerCount
+      = (_threadPoolWorkerCount >= 0) ?
+          static_cast<size_t>(_threadPoolWorkerCount) :
+          static_cast<size_t>(
+            std::max(1u, std::thread::hardware_concurrency()) - 1);
+    _threadPool = std::make_unique<ThreadPool>(workerCount);
+  }
+  return _threadPool.get();
+}
+
 bool Engine::isStencilEnable() const
 {
   return _isStencilEnable;
@@ -1288,6 +1304,40 @@ Engine::createDynamicVertexBuffer(const Float32Array& vertices)
   return vbo;
 }
 
+Engine::GLBufferPtr Engine::createVertexBuffer(const ArrayBuffer& data)
+{
+  auto vbo = _gl->createBuffer();
+  if (!vbo) {
+    BABYLON_LOG_ERROR("Engine", "Unable to create vertex buffer");
+    return nullptr;
+  }
+
+  bindArrayBuffer(vbo.get());
+
+  _gl->bufferData(GL::ARRAY_BUFFER, data, GL::STATIC_DRAW);
+
+  _resetVertexBufferBinding();
+  vbo->references = 1;
+  return vbo;
+}
+
+Engine::GLBufferPtr Engine::createDynamicVertexBuffer(const ArrayBuffer& data)
+{
+  auto vbo = _gl->createBuffer();
+  if (!vbo) {
+    BABYLON_LOG_ERROR("Engine", "Unable to create dynamic vertex buffer");
+    return nullptr;
+  }
+
+  bindArrayBuffer(vbo.get());
+
+  _gl->bufferData(GL::ARRAY_BUFFER, data, GL::DYNAMIC_DRAW);
+
+  _resetVertexBufferBinding();
+  vbo->references = 1;
+  return vbo;
+}
+
 void Engine::updateDynamicIndexBuffer(const GLBufferPtr& indexBuffer,
                                       const IndicesArray& indices,
                                       int /*offset*/)
@@ -1295,9 +1345,16 @@ void Engine::updateDynamicIndexBuffer(const GLBufferPtr& indexBuffer,
   // Force cache update
   _currentBoundBuffer[GL::ELEMENT_ARRAY_BUFFER] = nullptr;
   bindIndexBuffer(indexBuffer.get());
-  auto arrayBuffer = indices;
 
-  _gl->bufferData(GL::ELEMENT_ARRAY_BUFFER, arrayBuffer, GL::DYNAMIC_DRAW);
+  // Keep the index type the buffer was created with
+  if (indexBuffer->is32Bits) {
+    Uint32Array arrayBuffer(indices.begin(), indices.end());
+    _gl->bufferData(GL::ELEMENT_ARRAY_BUFFER, arrayBuffer, GL::DYNAMIC_DRAW);
+  }
+  else {
+    Uint16Array arrayBuffer(indices.begin(), indices.end());
+    _gl->bufferData(GL::ELEMENT_ARRAY_BUFFER, arrayBuffer, GL::DYNAMIC_DRAW);
+  }
 
   _resetIndexBufferBinding();
 }
@@ -1326,6 +1383,16 @@ void Engine::updateDynamicVertexBuffer(const Engine::GLBufferPtr& vertexBuffer,
   _resetVertexBufferBinding();
 }
 
+void Engine::updateDynamicVertexBuffer(const Engine::GLBufferPtr& vertexBuffer,
+                                       const ArrayBuffer& data, int byteOffset)
+{
+  bindArrayBuffer(vertexBuffer.get());
+
+  _gl->bufferSubData(GL::ARRAY_BUFFER, byteOffset, data);
+
+  _resetVertexBufferBinding();
+}
+
 void Engine::_resetIndexBufferBinding()
 {
   bindIndexBuffer(nullptr);
@@ -1521,9 +1588,10 @@ void Engine::_bindVertexBuffersAttributes(
       auto buffer = vertexBuffer->getBuffer();
       if (buffer) {
         _vertexAttribPointer(
-          buffer, _order, static_cast<int>(vertexBuffer->getSize()), GL::FLOAT,
-          false, static_cast<int>(vertexBuffer->getStrideSize() * 4),
-          static_cast<int>(vertexBuffer->getOffset() * 4));
+          buffer, _order, static_cast<int>(vertexBuffer->getSize()),
+          vertexBuffer->type, vertexBuffer->normalized,
+          static_cast<int>(vertexBuffer->byteStride),
+          static_cast<int>(vertexBuffer->byteOffset));
 
         if (vertexBuffer->getIsInstanced()) {
           _gl->vertexAttribDivisor(_order, vertexBuffer->getInstanceDivisor());
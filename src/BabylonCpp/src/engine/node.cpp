@@ -94,9 +94,11 @@ void Node::set_parent(Node* const& parent)
   // Store new parent
   _parentNode = parent;
 
-  // Add as child to new parent
+  // Add as child to new parent, sharing the ownership of the node when it is
+  // already owned, a second owner would delete it twice
   if (_parentNode) {
-    _parentNode->_children.emplace_back(this);
+    auto self = weak_from_this().lock();
+    _parentNode->_children.emplace_back(self ? self : NodePtr(NodePtr(), this));
   }
 }
 
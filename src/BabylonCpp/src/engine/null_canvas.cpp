@@ -0,0 +1,62 @@
+#include <babylon/engine/null_canvas.h>
+
+#include <babylon/engine/null_gl_rendering_context.h>
+
+namespace BABYLON {
+
+NullCanvas::NullCanvas(int iWidth, int iHeight) : ICanvas{}
+{
+  width        = iWidth;
+  height       = iHeight;
+  clientWidth  = iWidth;
+  clientHeight = iHeight;
+  _renderingContext
+    = std::make_unique<GL::NullGLRenderingContext>(iWidth, iHeight);
+  _boundingClientRect.bottom = clientHeight;
+  _boundingClientRect.height = clientHeight;
+  _boundingClientRect.left   = 0;
+  _boundingClientRect.right  = clientWidth;
+  _boundingClientRect.top    = 0;
+  _boundingClientRect.width  = clientWidth;
+}
+
+NullCanvas::~NullCanvas()
+{
+}
+
+ClientRect& NullCanvas::getBoundingClientRect()
+{
+  return _boundingClientRect;
+}
+
+bool NullCanvas::onlyRenderBoundingClientRect() const
+{
+  return false;
+}
+
+bool NullCanvas::initializeContext3d()
+{
+  if (!_initialized) {
+    _initialized = _renderingContext->initialize();
+  }
+
+  return _initialized;
+}
+
+ICanvasRenderingContext2D* NullCanvas::getContext2d()
+{
+  return nullptr;
+}
+
+GL::IGLRenderingContext*
+NullCanvas::getContext3d(const EngineOptions& /*options*/)
+{
+  return _renderingContext.get();
+}
+
+GL::NullGLRenderingContext* NullCanvas::renderingContext()
+{
+  return static_cast<GL::NullGLRenderingContext*>(_renderingContext.get());
+}
+
+} // end of namespace BABYLON
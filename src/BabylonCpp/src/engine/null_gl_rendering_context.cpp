@@ -0,0 +1,1468 @@
+#include <babylon/engine/null_gl_rendering_context.h>
+
+#include <algorithm>
+#include <sstream>
+
+#include <babylon/core/string.h>
+
+namespace BABYLON {
+namespace GL {
+
+NullGLRenderingContext::NullGLRenderingContext(int width, int height)
+    : recordCommands{true}, _lastHandle{0}, _scissorBox{{0, 0, width, height}}
+{
+  drawingBufferWidth  = width;
+  drawingBufferHeight = height;
+  // WebGL2 values
+  RASTERIZER_DISCARD        = GL::RASTERIZER_DISCARD;
+  TEXTURE_3D                = GL::TEXTURE_3D;
+  TEXTURE_2D_ARRAY          = GL::TEXTURE_2D_ARRAY;
+  TEXTURE_WRAP_R            = GL::TEXTURE_WRAP_R;
+  TRANSFORM_FEEDBACK        = GL::TRANSFORM_FEEDBACK;
+  INTERLEAVED_ATTRIBS       = GL::INTERLEAVED_ATTRIBS;
+  TRANSFORM_FEEDBACK_BUFFER = GL::TRANSFORM_FEEDBACK_BUFFER;
+  // Capabilities of a common desktop GPU
+  _parameters[GL::MAX_TEXTURE_IMAGE_UNITS]          = 16;
+  _parameters[GL::MAX_COMBINED_TEXTURE_IMAGE_UNITS] = 32;
+  _parameters[GL::MAX_TEXTURE_SIZE]                 = 16384;
+  _parameters[GL::MAX_CUBE_MAP_TEXTURE_SIZE]        = 16384;
+  _parameters[GL::MAX_RENDERBUFFER_SIZE]            = 16384;
+  _parameters[GL::MAX_VERTEX_ATTRIBS]               = 16;
+  _parameters[GL::MAX_SAMPLES]                      = 8;
+  _parameters[GL::MAX_TEXTURE_MAX_ANISOTROPY_EXT]   = 16;
+  _parameters[GL::UNPACK_ALIGNMENT]                 = 4;
+  _parameters[GL::PACK_ALIGNMENT]                   = 4;
+  // Precision of an IEEE float
+  _shaderPrecisionFormat.rangeMin  = 127;
+  _shaderPrecisionFormat.rangeMax  = 127;
+  _shaderPrecisionFormat.precision = 23;
+  _callCounts.fill(0);
+}
+
+NullGLRenderingContext::~NullGLRenderingContext()
+{
+}
+
+const char* NullGLRenderingContext::CallName(GLCall call)
+{
+  static const std::array<const char*, static_cast<size_t>(GLCall::COUNT)>
+    names{{
+      "initialize",
+      "backupGLState",
+      "restoreGLState",
+      "activeTexture",
+      "attachShader",
+      "beginQuery",
+      "beginTransformFeedback",
+      "bindAttribLocation",
+      "bindBuffer",
+      "bindFramebuffer",
+      "bindBufferBase",
+      "bindRenderbuffer",
+      "bindTexture",
+      "bindTransformFeedback",
+      "blendColor",
+      "blendEquation",
+      "blendEquationSeparate",
+      "blendFunc",
+      "blendFuncSeparate",
+      "blitFramebuffer",
+      "bufferData",
+      "bufferSubData",
+      "bindVertexArray",
+      "checkFramebufferStatus",
+      "clear",
+      "clearBufferfv",
+      "clearBufferiv",
+      "clearBufferuiv",
+      "clearBufferfi",
+      "clearColor",
+      "clearDepth",
+      "clearStencil",
+      "colorMask",
+      "compileShader",
+      "compressedTexImage2D",
+      "compressedTexSubImage2D",
+      "copyTexImage2D",
+      "copyTexSubImage2D",
+      "createBuffer",
+      "createFramebuffer",
+      "createProgram",
+      "createQuery",
+      "createRenderbuffer",
+      "createShader",
+      "createTexture",
+      "createTransformFeedback",
+      "createVertexArray",
+      "cullFace",
+      "deleteBuffer",
+      "deleteFramebuffer",
+      "deleteProgram",
+      "deleteQuery",
+      "deleteRenderbuffer",
+      "deleteShader",
+      "deleteTexture",
+      "deleteTransformFeedback",
+      "deleteVertexArray",
+      "depthFunc",
+      "depthMask",
+      "depthRange",
+      "detachShader",
+      "disable",
+      "disableVertexAttribArray",
+      "drawArrays",
+      "drawArraysInstanced",
+      "drawBuffers",
+      "drawElements",
+      "drawElementsInstanced",
+      "enable",
+      "enableVertexAttribArray",
+      "endQuery",
+      "endTransformFeedback",
+      "finish",
+      "flush",
+      "framebufferRenderbuffer",
+      "framebufferTexture2D",
+      "frontFace",
+      "generateMipmap",
+      "getAttachedShaders",
+      "getAttribLocation",
+      "hasExtension",
+      "getScissorBoxParameter",
+      "getParameteri",
+      "getParameterf",
+      "getQueryParameterb",
+      "getQueryParameteri",
+      "getString",
+      "getTexParameteri",
+      "getTexParameterf",
+      "getError",
+      "getErrorString",
+      "getProgramParameter",
+      "getProgramInfoLog",
+      "getRenderbufferParameter",
+      "getShaderInfoLog",
+      "getShaderParameter",
+      "getShaderPrecisionFormat",
+      "getShaderSource",
+      "getUniformBlockIndex",
+      "getUniformLocation",
+      "hint",
+      "isBuffer",
+      "isEnabled",
+      "isFramebuffer",
+      "isProgram",
+      "isRenderbuffer",
+      "isShader",
+      "isTexture",
+      "lineWidth",
+      "linkProgram",
+      "pixelStorei",
+      "polygonOffset",
+      "readBuffer",
+      "readPixels",
+      "renderbufferStorage",
+      "renderbufferStorageMultisample",
+      "sampleCoverage",
+      "scissor",
+      "shaderSource",
+      "stencilFunc",
+      "stencilFuncSeparate",
+      "stencilMask",
+      "stencilMaskSeparate",
+      "stencilOp",
+      "stencilOpSeparate",
+      "texImage2D",
+      "texImage3D",
+      "texParameterf",
+      "texParameteri",
+      "texSubImage2D",
+      "transformFeedbackVaryings",
+      "uniform1f",
+      "uniform1fv",
+      "uniform1i",
+      "uniform1iv",
+      "uniform2f",
+      "uniform2fv",
+      "uniform2i",
+      "uniform2iv",
+      "uniform3f",
+      "uniform3fv",
+      "uniform3i",
+      "uniform3iv",
+      "uniform4f",
+      "uniform4fv",
+      "uniform4i",
+      "uniform4iv",
+      "uniformBlockBinding",
+      "uniformMatrix2fv",
+      "uniformMatrix3fv",
+      "uniformMatrix4fv",
+      "useProgram",
+      "validateProgram",
+      "vertexAttrib1f",
+      "vertexAttrib1fv",
+      "vertexAttrib2f",
+      "vertexAttrib2fv",
+      "vertexAttrib3f",
+      "vertexAttrib3fv",
+      "vertexAttrib4f",
+      "vertexAttrib4fv",
+      "vertexAttribDivisor",
+      "vertexAttribPointer",
+      "viewport",
+    }};
+  return call < GLCall::COUNT ? names[static_cast<size_t>(call)] : "";
+}
+
+const std::vector<GLCommand>& NullGLRenderingContext::commands() const
+{
+  return _commands;
+}
+
+size_t NullGLRenderingContext::callCount(GLCall call) const
+{
+  return _callCounts[static_cast<size_t>(call)];
+}
+
+size_t NullGLRenderingContext::totalCallCount() const
+{
+  size_t total = 0;
+  for (auto count : _callCounts) {
+    total += count;
+  }
+  return total;
+}
+
+size_t NullGLRenderingContext::drawCallCount() const
+{
+  return callCount(GLCall::DRAW_ARRAYS)
+         + callCount(GLCall::DRAW_ARRAYS_INSTANCED)
+         + callCount(GLCall::DRAW_ELEMENTS)
+         + callCount(GLCall::DRAW_ELEMENTS_INSTANCED);
+}
+
+void NullGLRenderingContext::reset()
+{
+  _commands.clear();
+  _callCounts.fill(0);
+}
+
+std::string NullGLRenderingContext::countersToString() const
+{
+  std::ostringstream oss;
+  for (size_t i = 0; i < _callCounts.size(); ++i) {
+    if (_callCounts[i] > 0) {
+      oss << CallName(static_cast<GLCall>(i)) << " " << _callCounts[i] << "\n";
+    }
+  }
+  return oss.str();
+}
+
+void NullGLRenderingContext::_record(GLCall call, GLuint arg0, GLuint arg1)
+{
+  ++_callCounts[static_cast<size_t>(call)];
+  if (recordCommands) {
+    _commands.emplace_back(GLCommand{call, arg0, arg1});
+  }
+}
+
+GLuint NullGLRenderingContext::_createHandle()
+{
+  return ++_lastHandle;
+}
+
+bool NullGLRenderingContext::initialize(bool /*enableGLDebugging*/)
+{
+  _record(GLCall::INITIALIZE);
+  return true;
+}
+
+void NullGLRenderingContext::backupGLState()
+{
+  _record(GLCall::BACKUP_GL_STATE);
+}
+
+void NullGLRenderingContext::restoreGLState()
+{
+  _record(GLCall::RESTORE_GL_STATE);
+}
+
+GLenum NullGLRenderingContext::operator[](const std::string& name)
+{
+  // Indexed enums, e.g. "TEXTURE0" or "COLOR_ATTACHMENT1"
+  const auto index = [&name](const std::string& prefix) {
+    return static_cast<GLenum>(std::stoi(name.substr(prefix.size())));
+  };
+  if (String::startsWith(name, "COLOR_ATTACHMENT")) {
+    return GL::COLOR_ATTACHMENT0 + index("COLOR_ATTACHMENT");
+  }
+  if (String::startsWith(name, "TEXTURE")) {
+    return GL::TEXTURE0 + index("TEXTURE");
+  }
+  return 0;
+}
+
+void NullGLRenderingContext::activeTexture(GLenum texture)
+{
+  _record(GLCall::ACTIVE_TEXTURE, texture);
+}
+
+void NullGLRenderingContext::attachShader(
+  const std::unique_ptr<IGLProgram>& program,
+  const std::unique_ptr<IGLShader>& shader)
+{
+  _record(GLCall::ATTACH_SHADER, _handle(program.get()), _handle(shader.get()));
+  if (program && shader) {
+    _attachedShaders[program->value].emplace_back(shader.get());
+  }
+}
+
+void NullGLRenderingContext::beginQuery(GLenum target,
+                                        const std::unique_ptr<IGLQuery>& query)
+{
+  _record(GLCall::BEGIN_QUERY, target, _handle(query.get()));
+}
+
+void NullGLRenderingContext::beginTransformFeedback(GLenum primitiveMode)
+{
+  _record(GLCall::BEGIN_TRANSFORM_FEEDBACK, primitiveMode);
+}
+
+void NullGLRenderingContext::bindAttribLocation(IGLProgram* program,
+                                                GLuint index,
+                                                const std::string& /*name*/)
+{
+  _record(GLCall::BIND_ATTRIB_LOCATION, _handle(program), index);
+}
+
+void NullGLRenderingContext::bindBuffer(GLenum target, IGLBuffer* buffer)
+{
+  _record(GLCall::BIND_BUFFER, target, _handle(buffer));
+}
+
+void NullGLRenderingContext::bindFramebuffer(GLenum target,
+                                             IGLFramebuffer* framebuffer)
+{
+  _record(GLCall::BIND_FRAMEBUFFER, target, _handle(framebuffer));
+}
+
+void NullGLRenderingContext::bindBufferBase(GLenum target, GLuint index,
+                                            IGLBuffer* /*buffer*/)
+{
+  _record(GLCall::BIND_BUFFER_BASE, target, index);
+}
+
+void NullGLRenderingContext::bindRenderbuffer(
+  GLenum target, const std::unique_ptr<IGLRenderbuffer>& renderbuffer)
+{
+  _record(GLCall::BIND_RENDERBUFFER, target, _handle(renderbuffer.get()));
+}
+
+void NullGLRenderingContext::bindTexture(GLenum target, IGLTexture* texture)
+{
+  _record(GLCall::BIND_TEXTURE, target, _handle(texture));
+}
+
+void NullGLRenderingContext::bindTransformFeedback(
+  GLenum target, IGLTransformFeedback* transformFeedback)
+{
+  _record(GLCall::BIND_TRANSFORM_FEEDBACK, target, _handle(transformFeedback));
+}
+
+void NullGLRenderingContext::blendColor(GLclampf /*red*/, GLclampf /*green*/,
+                                        GLclampf /*blue*/, GLclampf /*alpha*/)
+{
+  _record(GLCall::BLEND_COLOR);
+}
+
+void NullGLRenderingContext::blendEquation(GLenum mode)
+{
+  _record(GLCall::BLEND_EQUATION, mode);
+}
+
+void NullGLRenderingContext::blendEquationSeparate(GLenum modeRGB,
+                                                   GLenum modeAlpha)
+{
+  _record(GLCall::BLEND_EQUATION_SEPARATE, modeRGB, modeAlpha);
+}
+
+void NullGLRenderingContext::blendFunc(GLenum sfactor, GLenum dfactor)
+{
+  _record(GLCall::BLEND_FUNC, sfactor, dfactor);
+}
+
+void NullGLRenderingContext::blendFuncSeparate(GLenum srcRGB, GLenum dstRGB,
+                                               GLenum /*srcAlpha*/,
+                                               GLenum /*dstAlpha*/)
+{
+  _record(GLCall::BLEND_FUNC_SEPARATE, srcRGB, dstRGB);
+}
+
+void NullGLRenderingContext::blitFramebuffer(GLint srcX0, GLint srcY0,
+                                             GLint /*srcX1*/, GLint /*srcY1*/,
+                                             GLint /*dstX0*/, GLint /*dstY0*/,
+                                             GLint /*dstX1*/, GLint /*dstY1*/,
+                                             GLbitfield /*mask*/,
+                                             GLenum /*filter*/)
+{
+  _record(GLCall::BLIT_FRAMEBUFFER, static_cast<GLuint>(srcX0),
+          static_cast<GLuint>(srcY0));
+}
+
+void NullGLRenderingContext::bufferData(GLenum target, GLsizeiptr size,
+                                        GLenum /*usage*/)
+{
+  _record(GLCall::BUFFER_DATA, target, static_cast<GLuint>(size));
+}
+
+void NullGLRenderingContext::bufferData(GLenum target, const Float32Array& data,
+                                        GLenum /*usage*/)
+{
+  _record(GLCall::BUFFER_DATA, target, _byteSize(data));
+}
+
+void NullGLRenderingContext::bufferData(GLenum target, const Int32Array& data,
+                                        GLenum /*usage*/)
+{
+  _record(GLCall::BUFFER_DATA, target, _byteSize(data));
+}
+
+void NullGLRenderingContext::bufferData(GLenum target, const Uint16Array& data,
+                                        GLenum /*usage*/)
+{
+  _record(GLCall::BUFFER_DATA, target, _byteSize(data));
+}
+
+void NullGLRenderingContext::bufferData(GLenum target, const Uint32Array& data,
+                                        GLenum /*usage*/)
+{
+  _record(GLCall::BUFFER_DATA, target, _byteSize(data));
+}
+
+void NullGLRenderingContext::bufferData(GLenum target, const ArrayBuffer& data,
+                                        GLenum /*usage*/)
+{
+  _record(GLCall::BUFFER_DATA, target, _byteSize(data));
+}
+
+void NullGLRenderingContext::bufferSubData(GLenum target, GLintptr /*offset*/,
+                                           const Float32Array& data)
+{
+  _record(GLCall::BUFFER_SUB_DATA, target, _byteSize(data));
+}
+
+void NullGLRenderingContext::bufferSubData(GLenum target, GLintptr /*offset*/,
+                                           Int32Array& data)
+{
+  _record(GLCall::BUFFER_SUB_DATA, target, _byteSize(data));
+}
+
+void NullGLRenderingContext::bufferSubData(GLenum target, GLintptr /*offset*/,
+                                           const ArrayBuffer& data)
+{
+  _record(GLCall::BUFFER_SUB_DATA, target, _byteSize(data));
+}
+
+void NullGLRenderingContext::bindVertexArray(GL::IGLVertexArrayObject* vao)
+{
+  _record(GLCall::BIND_VERTEX_ARRAY, _handle(vao));
+}
+
+GLenum NullGLRenderingContext::checkFramebufferStatus(GLenum target)
+{
+  _record(GLCall::CHECK_FRAMEBUFFER_STATUS, target);
+  return GL::FRAMEBUFFER_COMPLETE;
+}
+
+void NullGLRenderingContext::clear(GLbitfield mask)
+{
+  _record(GLCall::CLEAR, mask);
+}
+
+void NullGLRenderingContext::clearBufferfv(
+  GLenum buffer, GLint drawbuffer, const std::vector<GLfloat>& /*values*/,
+  GLint /*srcOffset*/)
+{
+  _record(GLCall::CLEAR_BUFFERFV, buffer, static_cast<GLuint>(drawbuffer));
+}
+
+void NullGLRenderingContext::clearBufferiv(GLenum buffer, GLint drawbuffer,
+                                           const std::vector<GLint>& /*values*/,
+                                           GLint /*srcOffset*/)
+{
+  _record(GLCall::CLEAR_BUFFERIV, buffer, static_cast<GLuint>(drawbuffer));
+}
+
+void NullGLRenderingContext::clearBufferuiv(
+  GLenum buffer, GLint drawbuffer, const std::vector<GLuint>& /*values*/,
+  GLint /*srcOffset*/)
+{
+  _record(GLCall::CLEAR_BUFFERUIV, buffer, static_cast<GLuint>(drawbuffer));
+}
+
+void NullGLRenderingContext::clearBufferfi(GLenum buffer, GLint drawbuffer,
+                                           GLfloat /*depth*/, GLint /*stencil*/)
+{
+  _record(GLCall::CLEAR_BUFFERFI, buffer, static_cast<GLuint>(drawbuffer));
+}
+
+void NullGLRenderingContext::clearColor(GLclampf /*red*/, GLclampf /*green*/,
+                                        GLclampf /*blue*/, GLclampf /*alpha*/)
+{
+  _record(GLCall::CLEAR_COLOR);
+}
+
+void NullGLRenderingContext::clearDepth(GLclampf /*depth*/)
+{
+  _record(GLCall::CLEAR_DEPTH);
+}
+
+void NullGLRenderingContext::clearStencil(GLint stencil)
+{
+  _record(GLCall::CLEAR_STENCIL, static_cast<GLuint>(stencil));
+}
+
+void NullGLRenderingContext::colorMask(GLboolean red, GLboolean green,
+                                       GLboolean /*blue*/, GLboolean /*alpha*/)
+{
+  _record(GLCall::COLOR_MASK, static_cast<GLuint>(red),
+          static_cast<GLuint>(green));
+}
+
+void
+NullGLRenderingContext::compileShader(const std::unique_ptr<IGLShader>& shader)
+{
+  _record(GLCall::COMPILE_SHADER, _handle(shader.get()));
+}
+
+void NullGLRenderingContext::compressedTexImage2D(GLenum target, GLint level,
+                                                  GLenum /*internalformat*/,
+                                                  GLsizei /*width*/,
+                                                  GLsizei /*height*/,
+                                                  GLint /*border*/,
+                                                  const Uint8Array& /*pixels*/)
+{
+  _record(GLCall::COMPRESSED_TEX_IMAGE2D, target, static_cast<GLuint>(level));
+}
+
+void NullGLRenderingContext::compressedTexSubImage2D(GLenum target, GLint level,
+                                                     GLint /*xoffset*/,
+                                                     GLint /*yoffset*/,
+                                                     GLsizei /*width*/,
+                                                     GLsizei /*height*/,
+                                                     GLenum /*format*/,
+                                                     GLsizeiptr /*size*/)
+{
+  _record(GLCall::COMPRESSED_TEX_SUB_IMAGE2D, target,
+          static_cast<GLuint>(level));
+}
+
+void NullGLRenderingContext::copyTexImage2D(GLenum target, GLint level,
+                                            GLenum /*internalformat*/,
+                                            GLint /*x*/, GLint /*y*/,
+                                            GLsizei /*width*/,
+                                            GLsizei /*height*/,
+                                            GLint /*border*/)
+{
+  _record(GLCall::COPY_TEX_IMAGE2D, target, static_cast<GLuint>(level));
+}
+
+void NullGLRenderingContext::copyTexSubImage2D(GLenum target, GLint level,
+                                               GLint /*xoffset*/,
+                                               GLint /*yoffset*/, GLint /*x*/,
+                                               GLint /*y*/, GLint /*width*/,
+                                               GLint /*height*/)
+{
+  _record(GLCall::COPY_TEX_SUB_IMAGE2D, target, static_cast<GLuint>(level));
+}
+
+std::unique_ptr<IGLBuffer> NullGLRenderingContext::createBuffer()
+{
+  const auto handle = _createHandle();
+  _record(GLCall::CREATE_BUFFER, handle);
+  return std::make_unique<IGLBuffer>(handle);
+}
+
+std::unique_ptr<IGLFramebuffer> NullGLRenderingContext::createFramebuffer()
+{
+  const auto handle = _createHandle();
+  _record(GLCall::CREATE_FRAMEBUFFER, handle);
+  return std::make_unique<IGLFramebuffer>(handle);
+}
+
+std::unique_ptr<IGLProgram> NullGLRenderingContext::createProgram()
+{
+  const auto handle = _createHandle();
+  _record(GLCall::CREATE_PROGRAM, handle);
+  return std::make_unique<IGLProgram>(handle);
+}
+
+std::unique_ptr<IGLQuery> NullGLRenderingContext::createQuery()
+{
+  const auto handle = _createHandle();
+  _record(GLCall::CREATE_QUERY, handle);
+  return std::make_unique<IGLQuery>(handle);
+}
+
+std::unique_ptr<IGLRenderbuffer> NullGLRenderingContext::createRenderbuffer()
+{
+  const auto handle = _createHandle();
+  _record(GLCall::CREATE_RENDERBUFFER, handle);
+  return std::make_unique<IGLRenderbuffer>(handle);
+}
+
+std::unique_ptr<IGLShader> NullGLRenderingContext::createShader(GLenum type)
+{
+  const auto handle = _createHandle();
+  _record(GLCall::CREATE_SHADER, type, handle);
+  return std::make_unique<IGLShader>(handle);
+}
+
+std::unique_ptr<IGLTexture> NullGLRenderingContext::createTexture()
+{
+  const auto handle = _createHandle();
+  _record(GLCall::CREATE_TEXTURE, handle);
+  return std::make_unique<IGLTexture>(handle);
+}
+
+std::unique_ptr<IGLTransformFeedback>
+NullGLRenderingContext::createTransformFeedback()
+{
+  const auto handle = _createHandle();
+  _record(GLCall::CREATE_TRANSFORM_FEEDBACK, handle);
+  return std::make_unique<IGLTransformFeedback>(handle);
+}
+
+std::unique_ptr<IGLVertexArrayObject>
+NullGLRenderingContext::createVertexArray()
+{
+  const auto handle = _createHandle();
+  _record(GLCall::CREATE_VERTEX_ARRAY, handle);
+  return std::make_unique<IGLVertexArrayObject>(handle);
+}
+
+void NullGLRenderingContext::cullFace(GLenum mode)
+{
+  _record(GLCall::CULL_FACE, mode);
+}
+
+void NullGLRenderingContext::deleteBuffer(IGLBuffer* buffer)
+{
+  _record(GLCall::DELETE_BUFFER, _handle(buffer));
+}
+
+void NullGLRenderingContext::deleteFramebuffer(IGLFramebuffer* framebuffer)
+{
+  _record(GLCall::DELETE_FRAMEBUFFER, _handle(framebuffer));
+}
+
+void NullGLRenderingContext::deleteProgram(IGLProgram* program)
+{
+  _record(GLCall::DELETE_PROGRAM, _handle(program));
+  if (program) {
+    _attribLocations.erase(program->value);
+    _attachedShaders.erase(program->value);
+  }
+}
+
+void NullGLRenderingContext::deleteQuery(const std::unique_ptr<IGLQuery>& query)
+{
+  _record(GLCall::DELETE_QUERY, _handle(query.get()));
+}
+
+void NullGLRenderingContext::deleteRenderbuffer(IGLRenderbuffer* renderbuffer)
+{
+  _record(GLCall::DELETE_RENDERBUFFER, _handle(renderbuffer));
+}
+
+void NullGLRenderingContext::deleteShader(
+  const std::unique_ptr<IGLShader>& shader)
+{
+  _record(GLCall::DELETE_SHADER, _handle(shader.get()));
+  if (shader) {
+    _shaderSources.erase(shader->value);
+    for (auto& item : _attachedShaders) {
+      auto& shaders = item.second;
+      shaders.erase(std::remove(shaders.begin(), shaders.end(), shader.get()),
+                    shaders.end());
+    }
+  }
+}
+
+void NullGLRenderingContext::deleteTexture(IGLTexture* texture)
+{
+  _record(GLCall::DELETE_TEXTURE, _handle(texture));
+}
+
+void NullGLRenderingContext::deleteTransformFeedback(
+  IGLTransformFeedback* transformFeedback)
+{
+  _record(GLCall::DELETE_TRANSFORM_FEEDBACK, _handle(transformFeedback));
+}
+
+void NullGLRenderingContext::deleteVertexArray(IGLVertexArrayObject* vao)
+{
+  _record(GLCall::DELETE_VERTEX_ARRAY, _handle(vao));
+}
+
+void NullGLRenderingContext::depthFunc(GLenum func)
+{
+  _record(GLCall::DEPTH_FUNC, func);
+}
+
+void NullGLRenderingContext::depthMask(GLboolean flag)
+{
+  _record(GLCall::DEPTH_MASK, static_cast<GLuint>(flag));
+}
+
+void NullGLRenderingContext::depthRange(GLclampf /*zNear*/, GLclampf /*zFar*/)
+{
+  _record(GLCall::DEPTH_RANGE);
+}
+
+void NullGLRenderingContext::detachShader(IGLProgram* program,
+                                          IGLShader* shader)
+{
+  _record(GLCall::DETACH_SHADER, _handle(program), _handle(shader));
+}
+
+void NullGLRenderingContext::disable(GLenum cap)
+{
+  _record(GLCall::DISABLE, cap);
+  _enabledCaps.erase(cap);
+}
+
+void NullGLRenderingContext::disableVertexAttribArray(GLuint index)
+{
+  _record(GLCall::DISABLE_VERTEX_ATTRIB_ARRAY, index);
+}
+
+void NullGLRenderingContext::drawArrays(GLenum mode, GLint /*first*/,
+                                        GLint count)
+{
+  _record(GLCall::DRAW_ARRAYS, mode, static_cast<GLuint>(count));
+}
+
+void NullGLRenderingContext::drawArraysInstanced(GLenum /*mode*/,
+                                                 GLint /*first*/, GLsizei count,
+                                                 GLsizei instanceCount)
+{
+  _record(GLCall::DRAW_ARRAYS_INSTANCED, static_cast<GLuint>(count),
+          static_cast<GLuint>(instanceCount));
+}
+
+void NullGLRenderingContext::drawBuffers(const std::vector<GLenum>& buffers)
+{
+  _record(GLCall::DRAW_BUFFERS, static_cast<GLuint>(buffers.size()));
+}
+
+void NullGLRenderingContext::drawElements(GLenum mode, GLsizei count,
+                                          GLenum /*type*/, GLintptr /*offset*/)
+{
+  _record(GLCall::DRAW_ELEMENTS, mode, static_cast<GLuint>(count));
+}
+
+void NullGLRenderingContext::drawElementsInstanced(GLenum mode, GLsizei count,
+                                                   GLenum /*type*/,
+                                                   GLintptr /*offset*/,
+                                                   GLsizei /*instanceCount*/)
+{
+  _record(GLCall::DRAW_ELEMENTS_INSTANCED, mode, static_cast<GLuint>(count));
+}
+
+void NullGLRenderingContext::enable(GLenum cap)
+{
+  _record(GLCall::ENABLE, cap);
+  _enabledCaps.insert(cap);
+}
+
+void NullGLRenderingContext::enableVertexAttribArray(GLuint index)
+{
+  _record(GLCall::ENABLE_VERTEX_ATTRIB_ARRAY, index);
+}
+
+void NullGLRenderingContext::endQuery(GLenum target)
+{
+  _record(GLCall::END_QUERY, target);
+}
+
+void NullGLRenderingContext::endTransformFeedback()
+{
+  _record(GLCall::END_TRANSFORM_FEEDBACK);
+}
+
+void NullGLRenderingContext::finish()
+{
+  _record(GLCall::FINISH);
+}
+
+void NullGLRenderingContext::flush()
+{
+  _record(GLCall::FLUSH);
+}
+
+void NullGLRenderingContext::framebufferRenderbuffer(
+  GLenum target, GLenum attachment, GLenum /*renderbuffertarget*/,
+  const std::unique_ptr<IGLRenderbuffer>& /*renderbuffer*/)
+{
+  _record(GLCall::FRAMEBUFFER_RENDERBUFFER, target, attachment);
+}
+
+void NullGLRenderingContext::framebufferTexture2D(GLenum target,
+                                                  GLenum attachment,
+                                                  GLenum /*textarget*/,
+                                                  IGLTexture* /*texture*/,
+                                                  GLint /*level*/)
+{
+  _record(GLCall::FRAMEBUFFER_TEXTURE2D, target, attachment);
+}
+
+void NullGLRenderingContext::frontFace(GLenum mode)
+{
+  _record(GLCall::FRONT_FACE, mode);
+}
+
+void NullGLRenderingContext::generateMipmap(GLenum target)
+{
+  _record(GLCall::GENERATE_MIPMAP, target);
+}
+
+std::vector<IGLShader*>
+NullGLRenderingContext::getAttachedShaders(IGLProgram* program)
+{
+  _record(GLCall::GET_ATTACHED_SHADERS, _handle(program));
+  if (!program || _attachedShaders.find(program->value)
+                    == _attachedShaders.end()) {
+    return {};
+  }
+  return _attachedShaders[program->value];
+}
+
+GLint NullGLRenderingContext::getAttribLocation(IGLProgram* program,
+                                                const std::string& name)
+{
+  _record(GLCall::GET_ATTRIB_LOCATION, _handle(program));
+  if (!program) {
+    return -1;
+  }
+  // Consecutive locations in the order of the queries
+  auto& locations = _attribLocations[program->value];
+  const auto it   = locations.find(name);
+  if (it != locations.end()) {
+    return it->second;
+  }
+  const auto location = static_cast<GLint>(locations.size());
+  locations[name]     = location;
+  return location;
+}
+
+GLboolean NullGLRenderingContext::hasExtension(const std::string& /*extension*/)
+{
+  _record(GLCall::HAS_EXTENSION);
+  return false;
+}
+
+std::array<int, 4> NullGLRenderingContext::getScissorBoxParameter()
+{
+  _record(GLCall::GET_SCISSOR_BOX_PARAMETER);
+  return _scissorBox;
+}
+
+GLint NullGLRenderingContext::getParameteri(GLenum pname)
+{
+  _record(GLCall::GET_PARAMETERI, pname);
+  if (_enabledCaps.find(pname) != _enabledCaps.end()) {
+    return 1;
+  }
+  const auto it = _parameters.find(pname);
+  return (it != _parameters.end()) ? it->second : 0;
+}
+
+GLfloat NullGLRenderingContext::getParameterf(GLenum pname)
+{
+  _record(GLCall::GET_PARAMETERF, pname);
+  const auto it = _parameters.find(pname);
+  return (it != _parameters.end()) ? static_cast<GLfloat>(it->second) : 0.f;
+}
+
+GLboolean NullGLRenderingContext::getQueryParameterb(
+  const std::unique_ptr<IGLQuery>& query, GLenum pname)
+{
+  _record(GLCall::GET_QUERY_PARAMETERB, _handle(query.get()), pname);
+  // Results are available immediately
+  return true;
+}
+
+GLuint NullGLRenderingContext::getQueryParameteri(
+  const std::unique_ptr<IGLQuery>& query, GLenum pname)
+{
+  _record(GLCall::GET_QUERY_PARAMETERI, _handle(query.get()), pname);
+  return 0;
+}
+
+std::string NullGLRenderingContext::getString(GLenum pname)
+{
+  _record(GLCall::GET_STRING, pname);
+  switch (pname) {
+    case GL::VENDOR:
+      return "BabylonCpp";
+    case GL::RENDERER:
+      return "Null renderer";
+    case GL::VERSION:
+      return "OpenGL ES 3.0 Null";
+    case GL::SHADING_LANGUAGE_VERSION:
+      return "OpenGL ES GLSL ES 3.00 Null";
+    default:
+      return "";
+  }
+}
+
+GLint NullGLRenderingContext::getTexParameteri(GLenum pname)
+{
+  _record(GLCall::GET_TEX_PARAMETERI, pname);
+  return 0;
+}
+
+GLfloat NullGLRenderingContext::getTexParameterf(GLenum pname)
+{
+  _record(GLCall::GET_TEX_PARAMETERF, pname);
+  return 0.f;
+}
+
+GLenum NullGLRenderingContext::getError()
+{
+  _record(GLCall::GET_ERROR);
+  return 0;
+}
+
+const char* NullGLRenderingContext::getErrorString(GLenum err)
+{
+  _record(GLCall::GET_ERROR_STRING, err);
+  return err == 0 ? "No error" : "Unknown error";
+}
+
+GLint NullGLRenderingContext::getProgramParameter(IGLProgram* program,
+                                                  GLenum pname)
+{
+  _record(GLCall::GET_PROGRAM_PARAMETER, _handle(program), pname);
+  switch (pname) {
+    case GL::LINK_STATUS:
+    case GL::VALIDATE_STATUS:
+      return 1;
+    case GL::ATTACHED_SHADERS:
+      return program ? static_cast<GLint>(
+                         _attachedShaders[program->value].size()) :
+                       0;
+    default:
+      return 0;
+  }
+}
+
+std::string NullGLRenderingContext::getProgramInfoLog(
+  const std::unique_ptr<IGLProgram>& program)
+{
+  _record(GLCall::GET_PROGRAM_INFO_LOG, _handle(program.get()));
+  return "";
+}
+
+any NullGLRenderingContext::getRenderbufferParameter(GLenum target,
+                                                     GLenum pname)
+{
+  _record(GLCall::GET_RENDERBUFFER_PARAMETER, target, pname);
+  return nullptr;
+}
+
+std::string NullGLRenderingContext::getShaderInfoLog(
+  const std::unique_ptr<IGLShader>& shader)
+{
+  _record(GLCall::GET_SHADER_INFO_LOG, _handle(shader.get()));
+  return "";
+}
+
+GLint NullGLRenderingContext::getShaderParameter(
+  const std::unique_ptr<IGLShader>& shader, GLenum pname)
+{
+  _record(GLCall::GET_SHADER_PARAMETER, _handle(shader.get()), pname);
+  return (pname == GL::COMPILE_STATUS) ? 1 : 0;
+}
+
+IGLShaderPrecisionFormat*
+NullGLRenderingContext::getShaderPrecisionFormat(GLenum shadertype,
+                                                 GLenum precisiontype)
+{
+  _record(GLCall::GET_SHADER_PRECISION_FORMAT, shadertype, precisiontype);
+  return &_shaderPrecisionFormat;
+}
+
+std::string NullGLRenderingContext::getShaderSource(IGLShader* shader)
+{
+  _record(GLCall::GET_SHADER_SOURCE, _handle(shader));
+  if (!shader) {
+    return "";
+  }
+  const auto it = _shaderSources.find(shader->value);
+  return (it != _shaderSources.end()) ? it->second : "";
+}
+
+GLuint NullGLRenderingContext::getUniformBlockIndex(
+  IGLProgram* program, const std::string& /*uniformBlockName*/)
+{
+  _record(GLCall::GET_UNIFORM_BLOCK_INDEX, _handle(program));
+  return _createHandle();
+}
+
+std::unique_ptr<IGLUniformLocation>
+NullGLRenderingContext::getUniformLocation(IGLProgram* program,
+                                           const std::string& /*name*/)
+{
+  const auto handle = _createHandle();
+  _record(GLCall::GET_UNIFORM_LOCATION, _handle(program), handle);
+  return std::make_unique<IGLUniformLocation>(static_cast<GLint>(handle));
+}
+
+void NullGLRenderingContext::hint(GLenum target, GLenum mode)
+{
+  _record(GLCall::HINT, target, mode);
+}
+
+GLboolean NullGLRenderingContext::isBuffer(IGLBuffer* buffer)
+{
+  _record(GLCall::IS_BUFFER, _handle(buffer));
+  return buffer != nullptr;
+}
+
+GLboolean NullGLRenderingContext::isEnabled(GLenum cap)
+{
+  _record(GLCall::IS_ENABLED, cap);
+  return _enabledCaps.find(cap) != _enabledCaps.end();
+}
+
+GLboolean NullGLRenderingContext::isFramebuffer(IGLFramebuffer* framebuffer)
+{
+  _record(GLCall::IS_FRAMEBUFFER, _handle(framebuffer));
+  return framebuffer != nullptr;
+}
+
+GLboolean
+NullGLRenderingContext::isProgram(const std::unique_ptr<IGLProgram>& program)
+{
+  _record(GLCall::IS_PROGRAM, _handle(program.get()));
+  return program != nullptr;
+}
+
+GLboolean NullGLRenderingContext::isRenderbuffer(IGLRenderbuffer* renderbuffer)
+{
+  _record(GLCall::IS_RENDERBUFFER, _handle(renderbuffer));
+  return renderbuffer != nullptr;
+}
+
+GLboolean NullGLRenderingContext::isShader(IGLShader* shader)
+{
+  _record(GLCall::IS_SHADER, _handle(shader));
+  return shader != nullptr;
+}
+
+GLboolean NullGLRenderingContext::isTexture(IGLTexture* texture)
+{
+  _record(GLCall::IS_TEXTURE, _handle(texture));
+  return texture != nullptr;
+}
+
+void NullGLRenderingContext::lineWidth(GLfloat /*width*/)
+{
+  _record(GLCall::LINE_WIDTH);
+}
+
+bool NullGLRenderingContext::linkProgram(
+  const std::unique_ptr<IGLProgram>& program)
+{
+  _record(GLCall::LINK_PROGRAM, _handle(program.get()));
+  return program != nullptr;
+}
+
+void NullGLRenderingContext::pixelStorei(GLenum pname, GLint param)
+{
+  _record(GLCall::PIXEL_STOREI, pname, static_cast<GLuint>(param));
+  _parameters[pname] = param;
+}
+
+void NullGLRenderingContext::polygonOffset(GLfloat /*factor*/,
+                                           GLfloat /*units*/)
+{
+  _record(GLCall::POLYGON_OFFSET);
+}
+
+void NullGLRenderingContext::readBuffer(GLenum src)
+{
+  _record(GLCall::READ_BUFFER, src);
+}
+
+void NullGLRenderingContext::readPixels(GLint /*x*/, GLint /*y*/,
+                                        GLsizei width, GLsizei height,
+                                        GLenum /*format*/, GLenum /*type*/,
+                                        Float32Array& /*pixels*/)
+{
+  _record(GLCall::READ_PIXELS, static_cast<GLuint>(width),
+          static_cast<GLuint>(height));
+}
+
+void NullGLRenderingContext::readPixels(GLint /*x*/, GLint /*y*/,
+                                        GLsizei width, GLsizei height,
+                                        GLenum /*format*/, GLenum /*type*/,
+                                        Uint8Array& /*pixels*/)
+{
+  _record(GLCall::READ_PIXELS, static_cast<GLuint>(width),
+          static_cast<GLuint>(height));
+}
+
+void NullGLRenderingContext::renderbufferStorage(GLenum target,
+                                                 GLenum internalformat,
+                                                 GLsizei /*width*/,
+                                                 GLsizei /*height*/)
+{
+  _record(GLCall::RENDERBUFFER_STORAGE, target, internalformat);
+}
+
+void NullGLRenderingContext::renderbufferStorageMultisample(
+  GLenum target, GLsizei samples, GLenum /*internalFormat*/, GLsizei /*width*/,
+  GLsizei /*height*/)
+{
+  _record(GLCall::RENDERBUFFER_STORAGE_MULTISAMPLE, target,
+          static_cast<GLuint>(samples));
+}
+
+void NullGLRenderingContext::sampleCoverage(GLclampf /*value*/,
+                                            GLboolean invert)
+{
+  _record(GLCall::SAMPLE_COVERAGE, static_cast<GLuint>(invert));
+}
+
+void NullGLRenderingContext::scissor(GLint x, GLint y, GLsizei width,
+                                     GLsizei height)
+{
+  _record(GLCall::SCISSOR, static_cast<GLuint>(width),
+          static_cast<GLuint>(height));
+  _scissorBox = {{x, y, width, height}};
+}
+
+void NullGLRenderingContext::shaderSource(
+  const std::unique_ptr<IGLShader>& shader, const std::string& source)
+{
+  _record(GLCall::SHADER_SOURCE, _handle(shader.get()),
+          static_cast<GLuint>(source.size()));
+  if (shader) {
+    _shaderSources[shader->value] = source;
+  }
+}
+
+void NullGLRenderingContext::stencilFunc(GLenum func, GLint ref,
+                                         GLuint /*mask*/)
+{
+  _record(GLCall::STENCIL_FUNC, func, static_cast<GLuint>(ref));
+}
+
+void NullGLRenderingContext::stencilFuncSeparate(GLenum face, GLenum func,
+                                                 GLint /*ref*/, GLuint /*mask*/)
+{
+  _record(GLCall::STENCIL_FUNC_SEPARATE, face, func);
+}
+
+void NullGLRenderingContext::stencilMask(GLuint mask)
+{
+  _record(GLCall::STENCIL_MASK, mask);
+}
+
+void NullGLRenderingContext::stencilMaskSeparate(GLenum face, GLuint mask)
+{
+  _record(GLCall::STENCIL_MASK_SEPARATE, face, mask);
+}
+
+void NullGLRenderingContext::stencilOp(GLenum fail, GLenum zfail,
+                                       GLenum /*zpass*/)
+{
+  _record(GLCall::STENCIL_OP, fail, zfail);
+}
+
+void NullGLRenderingContext::stencilOpSeparate(GLenum face, GLenum fail,
+                                               GLenum /*zfail*/,
+                                               GLenum /*zpass*/)
+{
+  _record(GLCall::STENCIL_OP_SEPARATE, face, fail);
+}
+
+void NullGLRenderingContext::texImage2D(GLenum target, GLint level,
+                                        GLint /*internalformat*/,
+                                        GLsizei /*width*/, GLsizei /*height*/,
+                                        GLint /*border*/, GLenum /*format*/,
+                                        GLenum /*type*/,
+                                        const Uint8Array& /*pixels*/)
+{
+  _record(GLCall::TEX_IMAGE2D, target, static_cast<GLuint>(level));
+}
+
+void NullGLRenderingContext::texImage2D(GLenum target, GLint level,
+                                        GLenum /*internalformat*/,
+                                        GLenum /*format*/, GLenum /*type*/,
+                                        ICanvas* /*pixels*/)
+{
+  _record(GLCall::TEX_IMAGE2D, target, static_cast<GLuint>(level));
+}
+
+void NullGLRenderingContext::texImage2D(GLenum target, GLint level,
+                                        GLenum /*internalformat*/,
+                                        GLsizei /*width*/, GLsizei /*height*/,
+                                        GLsizei /*border*/, GLenum /*format*/,
+                                        GLenum /*type*/, ICanvas* /*pixels*/)
+{
+  _record(GLCall::TEX_IMAGE2D, target, static_cast<GLuint>(level));
+}
+
+void NullGLRenderingContext::texImage3D(GLenum target, GLint level,
+                                        GLint /*internalformat*/,
+                                        GLsizei /*width*/, GLsizei /*height*/,
+                                        GLsizei /*depth*/, GLint /*border*/,
+                                        GLenum /*format*/, GLenum /*type*/,
+                                        const Uint8Array& /*pixels*/)
+{
+  _record(GLCall::TEX_IMAGE3D, target, static_cast<GLuint>(level));
+}
+
+void NullGLRenderingContext::texParameterf(GLenum target, GLenum pname,
+                                           GLfloat /*param*/)
+{
+  _record(GLCall::TEX_PARAMETERF, target, pname);
+}
+
+void NullGLRenderingContext::texParameteri(GLenum target, GLenum pname,
+                                           GLint /*param*/)
+{
+  _record(GLCall::TEX_PARAMETERI, target, pname);
+}
+
+void NullGLRenderingContext::texSubImage2D(GLenum target, GLint level,
+                                           GLint /*xoffset*/, GLint /*yoffset*/,
+                                           GLsizei /*width*/,
+                                           GLsizei /*height*/,
+                                           GLenum /*format*/, GLenum /*type*/,
+                                           any /*pixels*/)
+{
+  _record(GLCall::TEX_SUB_IMAGE2D, target, static_cast<GLuint>(level));
+}
+
+void NullGLRenderingContext::transformFeedbackVaryings(
+  IGLProgram* program, const std::vector<std::string>& /*varyings*/,
+  GLenum bufferMode)
+{
+  _record(GLCall::TRANSFORM_FEEDBACK_VARYINGS, _handle(program), bufferMode);
+}
+
+void NullGLRenderingContext::uniform1f(IGLUniformLocation* location,
+                                       GLfloat /*v0*/)
+{
+  _record(GLCall::UNIFORM1F, _handle(location));
+}
+
+void NullGLRenderingContext::uniform1fv(GL::IGLUniformLocation* location,
+                                        const Float32Array& array)
+{
+  _record(GLCall::UNIFORM1FV, _handle(location), _byteSize(array));
+}
+
+void NullGLRenderingContext::uniform1i(IGLUniformLocation* location, GLint v0)
+{
+  _record(GLCall::UNIFORM1I, _handle(location), static_cast<GLuint>(v0));
+}
+
+void NullGLRenderingContext::uniform1iv(IGLUniformLocation* location,
+                                        const Int32Array& v)
+{
+  _record(GLCall::UNIFORM1IV, _handle(location), _byteSize(v));
+}
+
+void NullGLRenderingContext::uniform2f(IGLUniformLocation* location,
+                                       GLfloat /*v0*/, GLfloat /*v1*/)
+{
+  _record(GLCall::UNIFORM2F, _handle(location));
+}
+
+void NullGLRenderingContext::uniform2fv(IGLUniformLocation* location,
+                                        const Float32Array& v)
+{
+  _record(GLCall::UNIFORM2FV, _handle(location), _byteSize(v));
+}
+
+void NullGLRenderingContext::uniform2i(IGLUniformLocation* location, GLint v0,
+                                       GLint /*v1*/)
+{
+  _record(GLCall::UNIFORM2I, _handle(location), static_cast<GLuint>(v0));
+}
+
+void NullGLRenderingContext::uniform2iv(IGLUniformLocation* location,
+                                        const Int32Array& v)
+{
+  _record(GLCall::UNIFORM2IV, _handle(location), _byteSize(v));
+}
+
+void NullGLRenderingContext::uniform3f(IGLUniformLocation* location,
+                                       GLfloat /*v0*/, GLfloat /*v1*/,
+                                       GLfloat /*v2*/)
+{
+  _record(GLCall::UNIFORM3F, _handle(location));
+}
+
+void NullGLRenderingContext::uniform3fv(IGLUniformLocation* location,
+                                        const Float32Array& v)
+{
+  _record(GLCall::UNIFORM3FV, _handle(location), _byteSize(v));
+}
+
+void NullGLRenderingContext::uniform3i(IGLUniformLocation* location, GLint v0,
+                                       GLint /*v1*/, GLint /*v2*/)
+{
+  _record(GLCall::UNIFORM3I, _handle(location), static_cast<GLuint>(v0));
+}
+
+void NullGLRenderingContext::uniform3iv(IGLUniformLocation* location,
+                                        const Int32Array& v)
+{
+  _record(GLCall::UNIFORM3IV, _handle(location), _byteSize(v));
+}
+
+void NullGLRenderingContext::uniform4f(IGLUniformLocation* location,
+                                       GLfloat /*v0*/, GLfloat /*v1*/,
+                                       GLfloat /*v2*/, GLfloat /*v3*/)
+{
+  _record(GLCall::UNIFORM4F, _handle(location));
+}
+
+void NullGLRenderingContext::uniform4fv(IGLUniformLocation* location,
+                                        const Float32Array& v)
+{
+  _record(GLCall::UNIFORM4FV, _handle(location), _byteSize(v));
+}
+
+void NullGLRenderingContext::uniform4i(IGLUniformLocation* location, GLint v0,
+                                       GLint /*v1*/, GLint /*v2*/, GLint /*v3*/)
+{
+  _record(GLCall::UNIFORM4I, _handle(location), static_cast<GLuint>(v0));
+}
+
+void NullGLRenderingContext::uniform4iv(IGLUniformLocation* location,
+                                        const Int32Array& v)
+{
+  _record(GLCall::UNIFORM4IV, _handle(location), _byteSize(v));
+}
+
+void NullGLRenderingContext::uniformBlockBinding(IGLProgram* program,
+                                                 GLuint uniformBlockIndex,
+                                                 GLuint /*uniformBlockBinding*/)
+{
+  _record(GLCall::UNIFORM_BLOCK_BINDING, _handle(program), uniformBlockIndex);
+}
+
+void NullGLRenderingContext::uniformMatrix2fv(IGLUniformLocation* location,
+                                              GLboolean /*transpose*/,
+                                              const Float32Array& value)
+{
+  _record(GLCall::UNIFORM_MATRIX2FV, _handle(location), _byteSize(value));
+}
+
+void NullGLRenderingContext::uniformMatrix3fv(IGLUniformLocation* location,
+                                              GLboolean /*transpose*/,
+                                              const Float32Array& value)
+{
+  _record(GLCall::UNIFORM_MATRIX3FV, _handle(location), _byteSize(value));
+}
+
+void NullGLRenderingContext::uniformMatrix4fv(IGLUniformLocation* location,
+                                              GLboolean /*transpose*/,
+                                              const Float32Array& value)
+{
+  _record(GLCall::UNIFORM_MATRIX4FV, _handle(location), _byteSize(value));
+}
+
+void NullGLRenderingContext::uniformMatrix4fv(
+  IGLUniformLocation* location, GLboolean /*transpose*/,
+  const std::array<float, 16>& value)
+{
+  _record(GLCall::UNIFORM_MATRIX4FV, _handle(location), _byteSize(value));
+}
+
+void NullGLRenderingContext::useProgram(IGLProgram* program)
+{
+  _record(GLCall::USE_PROGRAM, _handle(program));
+}
+
+void NullGLRenderingContext::validateProgram(IGLProgram* program)
+{
+  _record(GLCall::VALIDATE_PROGRAM, _handle(program));
+}
+
+void NullGLRenderingContext::vertexAttrib1f(GLuint index, GLfloat /*v0*/)
+{
+  _record(GLCall::VERTEX_ATTRIB1F, index);
+}
+
+void NullGLRenderingContext::vertexAttrib1fv(GLuint indx, Float32Array& values)
+{
+  _record(GLCall::VERTEX_ATTRIB1FV, indx, _byteSize(values));
+}
+
+void NullGLRenderingContext::vertexAttrib2f(GLuint index, GLfloat /*v0*/,
+                                            GLfloat /*v1*/)
+{
+  _record(GLCall::VERTEX_ATTRIB2F, index);
+}
+
+void NullGLRenderingContext::vertexAttrib2fv(GLuint index, Float32Array& values)
+{
+  _record(GLCall::VERTEX_ATTRIB2FV, index, _byteSize(values));
+}
+
+void NullGLRenderingContext::vertexAttrib3f(GLuint index, GLfloat /*v0*/,
+                                            GLfloat /*v1*/, GLfloat /*v2*/)
+{
+  _record(GLCall::VERTEX_ATTRIB3F, index);
+}
+
+void NullGLRenderingContext::vertexAttrib3fv(GLuint index, Float32Array& values)
+{
+  _record(GLCall::VERTEX_ATTRIB3FV, index, _byteSize(values));
+}
+
+void NullGLRenderingContext::vertexAttrib4f(GLuint index, GLfloat /*v0*/,
+                                            GLfloat /*v1*/, GLfloat /*v2*/,
+                                            GLfloat /*v3*/)
+{
+  _record(GLCall::VERTEX_ATTRIB4F, index);
+}
+
+void NullGLRenderingContext::vertexAttrib4fv(GLuint index, Float32Array& values)
+{
+  _record(GLCall::VERTEX_ATTRIB4FV, index, _byteSize(values));
+}
+
+void NullGLRenderingContext::vertexAttribDivisor(GLuint index, GLuint divisor)
+{
+  _record(GLCall::VERTEX_ATTRIB_DIVISOR, index, divisor);
+}
+
+void NullGLRenderingContext::vertexAttribPointer(GLuint index, GLint size,
+                                                 GLenum /*type*/,
+                                                 GLboolean /*normalized*/,
+                                                 GLint /*stride*/,
+                                                 GLintptr /*offset*/)
+{
+  _record(GLCall::VERTEX_ATTRIB_POINTER, index, static_cast<GLuint>(size));
+}
+
+void NullGLRenderingContext::viewport(GLint /*x*/, GLint /*y*/, GLsizei width,
+                                      GLsizei height)
+{
+  _record(GLCall::VIEWPORT, static_cast<GLuint>(width),
+          static_cast<GLuint>(height));
+}
+
+} // end of namespace GL
+} // end of namespace BABYLON
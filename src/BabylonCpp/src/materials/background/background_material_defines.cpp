@@ -2,9 +2,22 @@
 
 namespace BABYLON {
 
-BackgroundMaterialDefines::BackgroundMaterialDefines() : MaterialDefines{}
+BackgroundMaterialDefines::BackgroundMaterialDefines() : MaterialDefines{_Layout()}
 {
-  boolDef = {
+}
+
+const MaterialDefinesLayout& BackgroundMaterialDefines::_Layout()
+{
+  // The defines are registered once
+  static const auto layout = _CreateLayout();
+  return layout;
+}
+
+MaterialDefinesLayout BackgroundMaterialDefines::_CreateLayout()
+{
+  MaterialDefinesLayout layout;
+
+  layout.boolDef = {
     /**
      * True if the diffuse texture is in use.
      */
@@ -128,7 +141,7 @@ BackgroundMaterialDefines::BackgroundMaterialDefines() : MaterialDefines{}
     {"SHADOWFLOAT", false}, //
   };
 
-  intDef = {
+  layout.intDef = {
     /**
      * The direct UV channel to use.
      */
@@ -136,6 +149,8 @@ BackgroundMaterialDefines::BackgroundMaterialDefines() : MaterialDefines{}
     {"NUM_BONE_INFLUENCERS", 0}, //
     {"BonesPerMesh", 0},         //
   };
+
+  return layout;
 }
 
 BackgroundMaterialDefines::~BackgroundMaterialDefines()
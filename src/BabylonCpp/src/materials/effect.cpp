@@ -1,5 +1,8 @@
 #include <babylon/materials/effect.h>
 
+#include <algorithm>
+#include <cstring>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/logging.h>
 #include <babylon/core/string.h>
@@ -10,6 +13,7 @@
 #include <babylon/materials/effect_includes_shaders_store.h>
 #include <babylon/materials/effect_shaders_store.h>
 #include <babylon/materials/material.h>
+#include <babylon/materials/shader_processor.h>
 #include <babylon/math/color3.h>
 #include <babylon/math/vector2.h>
 #include <babylon/math/vector4.h>
@@ -20,16 +24,43 @@ namespace BABYLON {
 
 std::unordered_map<std::string, std::string>& Effect::ShadersStore()
 {
-  return EffectShadersStore().shaders();
+  static std::unordered_map<std::string, std::string> shaders;
+  return shaders;
 }
 
 std::unordered_map<std::string, std::string>& Effect::IncludesShadersStore()
 {
-  return EffectIncludesShadersStore().shaders();
+  static std::unordered_map<std::string, std::string> includes;
+  return includes;
+}
+
+std::string_view Effect::GetShader(const std::string& name)
+{
+  const auto& shaders = Effect::ShadersStore();
+  if (!shaders.empty()) {
+    const auto it = shaders.find(name);
+    if (it != shaders.end()) {
+      return it->second;
+    }
+  }
+  return EffectShadersStore::Find(name);
+}
+
+std::string_view Effect::GetIncludeShader(const std::string& name)
+{
+  const auto& includes = Effect::IncludesShadersStore();
+  if (!includes.empty()) {
+    const auto it = includes.find(name);
+    if (it != includes.end()) {
+      return it->second;
+    }
+  }
+  return EffectIncludesShadersStore::Find(name);
 }
 
 std::size_t Effect::_uniqueIdSeed = 0;
 std::unordered_map<unsigned int, GL::IGLBuffer*> Effect::_baseCache{};
+constexpr size_t Effect::_ValueCacheStride;
 
 Effect::Effect(const std::string& baseName, EffectCreationOptions& options,
                Engine* engine)
@@ -54,6 +85,7 @@ Effect::Effect(const std::string& baseName, EffectCreationOptions& options,
     , _transformFeedbackVaryings{options.transformFeedbackVaryings}
 {
   stl_util::concat(_uniformsNames, options.samplers);
+  _initializeUniformSlots();
 
   if (!options.uniformBuffersNames.empty()) {
     for (unsigned int i = 0; i < options.uniformBuffersNames.size(); ++i) {
@@ -65,44 +97,36 @@ Effect::Effect(const std::string& baseName, EffectCreationOptions& options,
   const auto& fragmentSource = baseName;
 
   _loadVertexShader(vertexSource, [this, &fragmentSource,
-                                   &baseName](const std::string& vertexCode) {
-    _processIncludes(vertexCode, [this, &fragmentSource, &baseName](
-                                   const std::string& vertexCodeWithIncludes) {
-      _processShaderConversion(
-        vertexCodeWithIncludes, false,
-        [this, &fragmentSource,
-         &baseName](const std::string& migratedVertexCode) {
-          _loadFragmentShader(
-            fragmentSource, [this, &migratedVertexCode,
-                             &baseName](const std::string& fragmentCode) {
-              _processIncludes(
-                fragmentCode, [this, &migratedVertexCode, &baseName](
-                                const std::string& fragmentCodeWithIncludes) {
-                  _processShaderConversion(
-                    fragmentCodeWithIncludes, true,
-                    [this, &migratedVertexCode,
-                     &baseName](const std::string& migratedFragmentCode) {
-                      if (!baseName.empty()) {
-                        const auto& vertex   = baseName;
-                        const auto& fragment = baseName;
-
-                        _vertexSourceCode
-                          = "#define SHADER_NAME vertex:" + vertex + "\n"
-                            + migratedVertexCode;
-                        _fragmentSourceCode
-                          = "#define SHADER_NAME fragment:" + fragment + "\n"
-                            + migratedFragmentCode;
-                      }
-                      else {
-                        _vertexSourceCode   = migratedVertexCode;
-                        _fragmentSourceCode = migratedFragmentCode;
-                      }
-                      _prepareEffect();
-                    });
-                });
-            });
-        });
-    });
+                                   &baseName](std::string_view vertexCode) {
+    _processShaderCode(
+      vertexCode, false,
+      [this, &fragmentSource,
+       &baseName](const std::string& migratedVertexCode) {
+        _loadFragmentShader(
+          fragmentSource, [this, &migratedVertexCode,
+                           &baseName](std::string_view fragmentCode) {
+            _processShaderCode(
+              fragmentCode, true,
+              [this, &migratedVertexCode,
+               &baseName](const std::string& migratedFragmentCode) {
+                if (!baseName.empty()) {
+                  const auto& vertex   = baseName;
+                  const auto& fragment = baseName;
+
+                  _vertexSourceCode = "#define SHADER_NAME vertex:" + vertex
+                                      + "\n" + migratedVertexCode;
+                  _fragmentSourceCode
+                    = "#define SHADER_NAME fragment:" + fragment + "\n"
+                      + migratedFragmentCode;
+                }
+                else {
+                  _vertexSourceCode   = migratedVertexCode;
+                  _fragmentSourceCode = migratedFragmentCode;
+                }
+                _prepareEffect();
+              });
+          });
+      });
   });
 }
 
@@ -128,6 +152,7 @@ Effect::Effect(const std::unordered_map<std::string, std::string>& baseName,
     , _transformFeedbackVaryings{options.transformFeedbackVaryings}
 {
   stl_util::concat(_uniformsNames, options.samplers);
+  _initializeUniformSlots();
 
   if (!options.uniformBuffersNames.empty()) {
     for (unsigned int i = 0; i < options.uniformBuffersNames.size(); ++i) {
@@ -156,46 +181,37 @@ Effect::Effect(const std::unordered_map<std::string, std::string>& baseName,
     return;
   }
 
-  _loadVertexShader(vertexSource, [this, &fragmentSource, &vertexSource](
-                                    const std::string& vertexCode) {
-    _processIncludes(vertexCode, [this, &fragmentSource, &vertexSource](
-                                   const std::string& vertexCodeWithIncludes) {
-      _processShaderConversion(
-        vertexCodeWithIncludes, false,
-        [this, &fragmentSource,
-         &vertexSource](const std::string& migratedVertexCode) {
-          _loadFragmentShader(
-            fragmentSource, [this, &migratedVertexCode, &fragmentSource,
-                             &vertexSource](const std::string& fragmentCode) {
-              _processIncludes(
-                fragmentCode,
-                [this, &migratedVertexCode, &fragmentSource,
-                 &vertexSource](const std::string& fragmentCodeWithIncludes) {
-                  _processShaderConversion(
-                    fragmentCodeWithIncludes, true,
-                    [this, &migratedVertexCode, &fragmentSource,
-                     &vertexSource](const std::string& migratedFragmentCode) {
-                      if (!vertexSource.empty()) {
-                        const auto& vertex   = vertexSource;
-                        const auto& fragment = fragmentSource;
-
-                        _vertexSourceCode
-                          = "#define SHADER_NAME vertex:" + vertex + "\n"
-                            + migratedVertexCode;
-                        _fragmentSourceCode
-                          = "#define SHADER_NAME fragment:" + fragment + "\n"
-                            + migratedFragmentCode;
-                      }
-                      else {
-                        _vertexSourceCode   = migratedVertexCode;
-                        _fragmentSourceCode = migratedFragmentCode;
-                      }
-                      _prepareEffect();
-                    });
-                });
-            });
-        });
-    });
+  _loadVertexShader(vertexSource, [this, &fragmentSource,
+                                   &vertexSource](std::string_view vertexCode) {
+    _processShaderCode(
+      vertexCode, false,
+      [this, &fragmentSource,
+       &vertexSource](const std::string& migratedVertexCode) {
+        _loadFragmentShader(
+          fragmentSource, [this, &migratedVertexCode, &fragmentSource,
+                           &vertexSource](std::string_view fragmentCode) {
+            _processShaderCode(
+              fragmentCode, true,
+              [this, &migratedVertexCode, &fragmentSource,
+               &vertexSource](const std::string& migratedFragmentCode) {
+                if (!vertexSource.empty()) {
+                  const auto& vertex   = vertexSource;
+                  const auto& fragment = fragmentSource;
+
+                  _vertexSourceCode = "#define SHADER_NAME vertex:" + vertex
+                                      + "\n" + migratedVertexCode;
+                  _fragmentSourceCode
+                    = "#define SHADER_NAME fragment:" + fragment + "\n"
+                      + migratedFragmentCode;
+                }
+                else {
+                  _vertexSourceCode   = migratedVertexCode;
+                  _fragmentSourceCode = migratedFragmentCode;
+                }
+                _prepareEffect();
+              });
+          });
+      });
   });
 }
 
@@ -254,18 +270,24 @@ size_t Effect::getAttributesCount()
   return _attributes.size();
 }
 
-int Effect::getUniformIndex(const std::string& uniformName)
+int Effect::getUniformIndex(const UniformName& uniformName) const
+{
+  const auto id = uniformName.id();
+  return id < _uniformSlots.size() ? _uniformSlots[id] : -1;
+}
+
+GL::IGLUniformLocation* Effect::getUniform(const UniformName& uniformName)
 {
-  return stl_util::index_of(_uniformsNames, uniformName);
+  return getUniform(getUniformIndex(uniformName));
 }
 
-GL::IGLUniformLocation* Effect::getUniform(const std::string& uniformName)
+GL::IGLUniformLocation* Effect::getUniform(int slot)
 {
-  if (stl_util::contains(_uniforms, uniformName)) {
-    return _uniforms[uniformName].get();
+  if (slot < 0 || static_cast<size_t>(slot) >= _uniformLocations.size()) {
+    return nullptr;
   }
 
-  return nullptr;
+  return _uniformLocations[static_cast<size_t>(slot)].get();
 }
 
 std::vector<std::string>& Effect::getSamplers()
@@ -291,7 +313,7 @@ void Effect::executeWhenCompiled(
 
 void Effect::_loadVertexShader(
   const std::string& vertex,
-  const std::function<void(const std::string&)>& callback)
+  const std::function<void(std::string_view)>& callback)
 {
   // Base64 encoded ?
   if (vertex.substr(0, 7) == "base64:") {
@@ -301,10 +323,9 @@ void Effect::_loadVertexShader(
   }
 
   // Is in local store ?
-  const std::string vertexShaderName = vertex + "VertexShader";
-  if (stl_util::contains(Effect::ShadersStore(), vertexShaderName)) {
-    const std::string vertexShaderName = vertex + "VertexShader";
-    callback(Effect::ShadersStore()[vertexShaderName]);
+  const auto vertexCode = Effect::GetShader(vertex + "VertexShader");
+  if (!vertexCode.empty()) {
+    callback(vertexCode);
     return;
   }
 
@@ -324,7 +345,7 @@ void Effect::_loadVertexShader(
 
 void Effect::_loadFragmentShader(
   const std::string& fragment,
-  const std::function<void(const std::string&)>& callback)
+  const std::function<void(std::string_view)>& callback)
 {
   // Base64 encoded ?
   if (fragment.substr(0, 7) == "base64:") {
@@ -334,15 +355,15 @@ void Effect::_loadFragmentShader(
   }
 
   // Is in local store ?
-  std::string fragmentShaderName = fragment + "PixelShader";
-  if (stl_util::contains(Effect::ShadersStore(), fragmentShaderName)) {
-    callback(Effect::ShadersStore()[fragmentShaderName]);
+  auto fragmentCode = Effect::GetShader(fragment + "PixelShader");
+  if (!fragmentCode.empty()) {
+    callback(fragmentCode);
     return;
   }
 
-  fragmentShaderName = fragment + "FragmentShader";
-  if (stl_util::contains(Effect::ShadersStore(), fragmentShaderName)) {
-    callback(Effect::ShadersStore()[fragmentShaderName]);
+  fragmentCode = Effect::GetShader(fragment + "FragmentShader");
+  if (!fragmentCode.empty()) {
+    callback(fragmentCode);
     return;
   }
 
@@ -393,219 +414,19 @@ void Effect::_dumpShadersSource(std::string vertexCode,
                      formattedFragmentCode.c_str());
 }
 
-void Effect::_processShaderConversion(
-  const std::string& sourceCode, bool isFragment,
+void Effect::_processShaderCode(
+  std::string_view sourceCode, bool isFragment,
   const std::function<void(const std::string&)>& callback)
 {
+  ShaderProcessingOptions options;
+  options.isFragment             = isFragment;
+  options.supportsUniformBuffers = _engine->supportsUniformBuffers();
+  options.highPrecisionShaderSupported
+    = _engine->getCaps().highPrecisionShaderSupported;
+  options.convertToGLSL300 = _engine->webGLVersion() != 1.f;
+  options.indexParameters  = _indexParameters;
 
-  auto preparedSourceCode = _processPrecision(sourceCode);
-
-  if (_engine->webGLVersion() == 1.f) {
-    callback(preparedSourceCode);
-    return;
-  }
-
-  // Already converted
-  if (String::contains(preparedSourceCode, "#version 3")) {
-    String::replaceInPlace(preparedSourceCode, "#version 300 es", "");
-    callback(preparedSourceCode);
-    return;
-  }
-
-  const auto hasDrawBuffersExtension = String::contains(
-    preparedSourceCode, "#extension.+GL_EXT_draw_buffers.+require");
-
-  // Remove extensions
-  // #extension GL_OES_standard_derivatives : enable
-  // #extension GL_EXT_shader_texture_lod : enable
-  // #extension GL_EXT_frag_depth : enable
-  // #extension GL_EXT_draw_buffers : require
-  const std::string regex(
-    "#extension.+(GL_OES_standard_derivatives|GL_EXT_shader_texture_lod|GL_EXT_"
-    "frag_depth|GL_EXT_draw_buffers).+(enable|require)");
-  auto result = String::regexReplace(preparedSourceCode, regex, "");
-
-  // Migrate to GLSL v300
-  result = String::regexReplace(result, "varying(?![\n\r])\\s",
-                                isFragment ? "in " : "out ");
-  result = String::regexReplace(result, "attribute[ \t]", "in ");
-  result = String::regexReplace(result, "[ \t]attribute", " in");
-
-  if (isFragment) {
-    const std::vector<std::pair<std::string, std::string>> fragmentMappings{
-      std::make_pair("texture2DLodEXT\\s*\\(", "textureLod("),   //
-      std::make_pair("textureCubeLodEXT\\s*\\(", "textureLod("), //
-      std::make_pair("texture2D\\s*\\(", "texture("),            //
-      std::make_pair("textureCube\\s*\\(", "texture("),          //
-      std::make_pair("gl_FragDepthEXT", "gl_FragDepth"),         //
-      std::make_pair("gl_FragColor", "glFragColor"),             //
-      std::make_pair("gl_FragData", "glFragData"),
-      std::make_pair(
-        "void\\s+?main\\s*\\(", //
-        String::concat(
-          (hasDrawBuffersExtension ? "" : "out vec4 glFragColor;\n"),
-          "void main(")),
-
-    };
-    for (const auto& fragmentMapping : fragmentMappings) {
-      result = String::regexReplace(result, fragmentMapping.first,
-                                    fragmentMapping.second);
-    }
-  }
-
-  callback(result);
-}
-
-void Effect::_processIncludes(
-  const std::string& sourceCode,
-  const std::function<void(const std::string&)>& callback)
-{
-  const std::regex regex("#include<(.+)>(\\((.*)\\))*(\\[(.*)\\])*",
-                         std::regex::optimize);
-  auto lines = String::split(sourceCode, '\n');
-
-  std::ostringstream returnValue;
-
-  for (auto& line : lines) {
-    auto match = String::regexMatch(line, regex);
-    if (match.size() != 6) {
-      returnValue << line << std::endl;
-      continue;
-    }
-
-    auto includeFile = match[1];
-
-    // Uniform declaration
-    if (String::contains(includeFile, "__decl__")) {
-      String::replaceInPlace(includeFile, "__decl__", "");
-      if (_engine->supportsUniformBuffers()) {
-        String::replaceInPlace(includeFile, "Vertex", "Ubo");
-        String::replaceInPlace(includeFile, "Fragment", "Ubo");
-      }
-      includeFile += "Declaration";
-    }
-
-    if (stl_util::contains(Effect::IncludesShadersStore(), includeFile)) {
-      // Substitution
-      std::string includeContent = Effect::IncludesShadersStore()[includeFile];
-      if (!match[2].empty()) {
-        auto splits = String::split(match[3], ',');
-
-        for (std::size_t index = 0; index < splits.size(); index += 2) {
-          const std::string source{splits[index]};
-          const std::string dest{splits[index + 1]};
-
-          includeContent = String::regexReplace(includeContent, source, dest);
-        }
-      }
-
-      if (!match[4].empty()) {
-        auto indexString = match[5];
-
-        if (String::contains(indexString, "..")) {
-          String::replaceInPlace(indexString, "..", ".");
-          auto indexSplits = String::split(indexString, '.');
-          if (indexSplits.size() == 2) {
-            auto minIndex             = indexSplits[0];
-            auto maxIndex             = indexSplits[1];
-            auto sourceIncludeContent = includeContent;
-            includeContent            = "";
-
-            if ((!String::isDigit(maxIndex))
-                && stl_util::contains(_indexParameters, maxIndex)) {
-              maxIndex = std::to_string(_indexParameters[maxIndex]);
-            }
-
-            if (String::isDigit(minIndex) && String::isDigit(maxIndex)) {
-              const size_t _minIndex = std::stoul(minIndex, nullptr, 0);
-              const size_t _maxIndex = std::stoul(maxIndex, nullptr, 0);
-              for (size_t i = _minIndex; i < _maxIndex; ++i) {
-                const auto istr = std::to_string(i);
-                if (!_engine->supportsUniformBuffers()) {
-                  // Ubo replacement
-                  const auto callback = [](const std::smatch& m) {
-                    if (m.size() == 2) {
-                      return m.str(1) + "{X}";
-                    }
-                    return m.str(0);
-                  };
-                  const std::regex regex{"light\\{X\\}.(\\w*)",
-                                         std::regex::optimize};
-                  sourceIncludeContent = String::regexReplace(
-                    sourceIncludeContent, regex, callback);
-                }
-                includeContent
-                  += String::regexReplace(sourceIncludeContent, "\\{X\\}", istr)
-                     + "\n";
-              }
-            }
-          }
-        }
-        else {
-          if (!_engine->supportsUniformBuffers()) {
-            // Ubo replacement
-            const auto callback = [](const std::smatch& m) {
-              if (m.size() == 2) {
-                return m.str(1) + "{X}";
-              }
-              return m.str(0);
-            };
-            const std::regex regex{"light\\{X\\}.(\\w*)", std::regex::optimize};
-            includeContent
-              = String::regexReplace(includeContent, regex, callback);
-          }
-          includeContent
-            = String::regexReplace(includeContent, "\\{X\\}", indexString);
-        }
-      }
-
-      // Replace
-      String::replaceInPlace(line, match[0], includeContent);
-      returnValue << line << std::endl;
-    }
-    else {
-      // Load from file
-    }
-  }
-
-  callback(returnValue.str());
-}
-
-std::string Effect::_processPrecision(std::string source)
-{
-  if (!String::contains(source, "precision highp float")
-      && !String::contains(source, "precision mediump float")) {
-    if (!_engine->getCaps().highPrecisionShaderSupported) {
-      source = "precision mediump float;\n" + source;
-    }
-    else {
-      source = "precision highp float;\n" + source;
-    }
-  }
-  else {
-    if (!_engine->getCaps().highPrecisionShaderSupported) {
-      // Moving highp to mediump
-      String::replaceInPlace(source, "precision highp float",
-                             "precision mediump float");
-    }
-  }
-
-  // Add GL_ES define
-  // -- precision mediump float
-  const std::string mediump{"#ifdef GL_ES\nprecision mediump float;\n#endif\n"};
-  if (String::contains(source, "precision mediump float;")
-      && !String::contains(source, mediump)) {
-    String::replaceInPlace(source, "precision mediump float;", mediump);
-  }
-
-  // -- precision highp float
-  const std::string highp{"#ifdef GL_ES\nprecision highp float;\n#endif\n"};
-  if (String::contains(source, "precision highp float;")
-      && !String::contains(source, highp)) {
-    String::replaceInPlace(source, "precision highp float;", highp);
-  }
-
-  return source;
+  callback(ShaderProcessor::Process(sourceCode, options));
 }
 
 void Effect::_rebuildProgram(
@@ -641,12 +462,32 @@ Effect::getSpecificUniformLocations(const std::vector<std::string>& names)
   return _engine->getUniforms(_program.get(), names);
 }
 
+void Effect::_initializeUniformSlots()
+{
+  // The first uniform with a given name owns the slot
+  _uniformSlots.clear();
+  for (size_t slot = 0; slot < _uniformsNames.size(); ++slot) {
+    const auto id = UniformName(_uniformsNames[slot]).id();
+    if (id >= _uniformSlots.size()) {
+      _uniformSlots.resize(id + 1, -1);
+    }
+    if (_uniformSlots[id] < 0) {
+      _uniformSlots[id] = static_cast<int>(slot);
+    }
+  }
+
+  _uniformLocations.clear();
+  _uniformLocations.resize(_uniformsNames.size());
+  _valueCache.assign(_uniformsNames.size() * _ValueCacheStride, 0.f);
+  _valueCacheSizes.assign(_uniformsNames.size(), 0);
+}
+
 void Effect::_prepareEffect()
 {
   auto attributesNames = _attributesNames;
   auto& _defines       = defines;
   auto& fallbacks      = _fallbacks;
-  _valueCache.clear();
+  std::fill(_valueCacheSizes.begin(), _valueCacheSizes.end(), uint8_t{0});
 
   auto& previousProgram = _program;
 
@@ -686,7 +527,12 @@ void Effect::_prepareEffect()
       }
     }
 
-    _uniforms   = engine->getUniforms(_program.get(), _uniformsNames);
+    auto uniforms = engine->getUniforms(_program.get(), _uniformsNames);
+    for (size_t slot = 0; slot < _uniformsNames.size(); ++slot) {
+      auto it = uniforms.find(_uniformsNames[slot]);
+      _uniformLocations[slot]
+        = it != uniforms.end() ? std::move(it->second) : nullptr;
+    }
     _attributes = engine->getAttributes(_program.get(), attributesNames);
 
     for (unsigned int index = 0; index < _samplers.size(); ++index) {
@@ -808,100 +654,60 @@ void Effect::setTextureFromPostProcessOutput(const std::string& channel,
     stl_util::index_of(_samplers, channel), postProcess);
 }
 
-bool Effect::_cacheMatrix(const std::string& uniformName, const Matrix& matrix)
+bool Effect::_cacheValues(int slot, const float* values, uint8_t count)
 {
-  auto flag = matrix.updateFlag;
-  if (stl_util::contains(_valueCache, uniformName)
-      && !_valueCache[uniformName].empty()
-      && static_cast<int>(_valueCache[uniformName][0]) == flag) {
+  if (slot < 0) {
     return false;
   }
 
-  if (_valueCache[uniformName].empty()) {
-    _valueCache[uniformName].emplace_back(static_cast<float>(flag));
-  }
-  else {
-    _valueCache[uniformName][0] = static_cast<float>(flag);
+  // The values are compared bitwise, in place
+  const auto index = static_cast<size_t>(slot);
+  auto cache       = _valueCache.data() + index * _ValueCacheStride;
+  auto& size       = _valueCacheSizes[index];
+  if (size == count
+      && std::memcmp(cache, values, count * sizeof(float)) == 0) {
+    return false;
   }
 
+  std::memcpy(cache, values, count * sizeof(float));
+  size = count;
+
   return true;
 }
 
-bool Effect::_cacheFloat2(const std::string& uniformName, float x, float y)
+void Effect::_clearCachedValue(int slot)
 {
-  if (!stl_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y};
-    return true;
-  }
-
-  bool changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
+  if (slot >= 0) {
+    _valueCacheSizes[static_cast<size_t>(slot)] = 0;
   }
-
-  return changed;
 }
 
-bool Effect::_cacheFloat3(const std::string& uniformName, float x, float y,
-                          float z)
+bool Effect::_cacheMatrix(int slot, const Matrix& matrix)
 {
-  if (!stl_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y, z};
-    return true;
-  }
-
-  bool changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
-  }
-
-  return changed;
+  // The update flag is cached with its bits, floats would round large flags
+  float flag;
+  static_assert(sizeof(flag) == sizeof(matrix.updateFlag),
+                "the update flag must fit in a float");
+  std::memcpy(&flag, &matrix.updateFlag, sizeof(flag));
+  return _cacheValues(slot, &flag, 1);
 }
 
-bool Effect::_cacheFloat4(const std::string& uniformName, float x, float y,
-                          float z, float w)
+bool Effect::_cacheFloat2(int slot, float x, float y)
 {
-  if (!stl_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y, z, w};
-    return true;
-  }
+  const float values[2] = {x, y};
+  return _cacheValues(slot, values, 2);
+}
 
-  bool changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[3], w)) {
-    cache[3] = w;
-    changed  = true;
-  }
+bool Effect::_cacheFloat3(int slot, float x, float y, float z)
+{
+  const float values[3] = {x, y, z};
+  return _cacheValues(slot, values, 3);
+}
 
-  return changed;
+bool Effect::_cacheFloat4(int slot, float x, float y, float z, float w)
+{
+  const float values[4] = {x, y, z, w};
+  return _cacheValues(slot, values, 4);
 }
 
 void Effect::bindUniformBuffer(GL::IGLBuffer* _buffer, const std::string& name)
@@ -927,279 +733,404 @@ void Effect::bindUniformBlock(const std::string& blockName, unsigned index)
   _engine->bindUniformBlock(_program.get(), blockName, index);
 }
 
-Effect& Effect::setInt(const std::string& uniformName, int value)
+Effect& Effect::setInt(const UniformName& uniformName, int value)
 {
-  Float32Array _value{static_cast<float>(value)};
-  if (stl_util::contains(_valueCache, uniformName)
-      && (_valueCache[uniformName] == _value)) {
-    return *this;
-  }
-
-  _valueCache[uniformName] = _value;
+  return setInt(getUniformIndex(uniformName), value);
+}
 
-  _engine->setInt(getUniform(uniformName), value);
+Effect& Effect::setInt(int slot, int value)
+{
+  float bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  if (_cacheValues(slot, &bits, 1)) {
+    _engine->setInt(getUniform(slot), value);
+  }
 
   return *this;
 }
 
-Effect& Effect::setIntArray(const std::string& uniformName,
+Effect& Effect::setIntArray(const UniformName& uniformName,
                             const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setIntArray(getUniform(uniformName), array);
+  return setIntArray(getUniformIndex(uniformName), array);
+}
+
+Effect& Effect::setIntArray(int slot, const Int32Array& array)
+{
+  _clearCachedValue(slot);
+  _engine->setIntArray(getUniform(slot), array);
 
   return *this;
 }
 
-Effect& Effect::setIntArray2(const std::string& uniformName,
+Effect& Effect::setIntArray2(const UniformName& uniformName,
                              const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setIntArray2(getUniform(uniformName), array);
+  return setIntArray2(getUniformIndex(uniformName), array);
+}
+
+Effect& Effect::setIntArray2(int slot, const Int32Array& array)
+{
+  _clearCachedValue(slot);
+  _engine->setIntArray2(getUniform(slot), array);
 
   return *this;
 }
 
-Effect& Effect::setIntArray3(const std::string& uniformName,
+Effect& Effect::setIntArray3(const UniformName& uniformName,
                              const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setIntArray3(getUniform(uniformName), array);
+  return setIntArray3(getUniformIndex(uniformName), array);
+}
+
+Effect& Effect::setIntArray3(int slot, const Int32Array& array)
+{
+  _clearCachedValue(slot);
+  _engine->setIntArray3(getUniform(slot), array);
 
   return *this;
 }
 
-Effect& Effect::setIntArray4(const std::string& uniformName,
+Effect& Effect::setIntArray4(const UniformName& uniformName,
                              const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setIntArray4(getUniform(uniformName), array);
+  return setIntArray4(getUniformIndex(uniformName), array);
+}
+
+Effect& Effect::setIntArray4(int slot, const Int32Array& array)
+{
+  _clearCachedValue(slot);
+  _engine->setIntArray4(getUniform(slot), array);
 
   return *this;
 }
 
-Effect& Effect::setFloatArray(const std::string& uniformName,
+Effect& Effect::setFloatArray(const UniformName& uniformName,
                               const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setFloatArray(getUniform(uniformName), array);
+  return setFloatArray(getUniformIndex(uniformName), array);
+}
+
+Effect& Effect::setFloatArray(int slot, const Float32Array& array)
+{
+  _clearCachedValue(slot);
+  _engine->setFloatArray(getUniform(slot), array);
 
   return *this;
 }
 
-Effect& Effect::setFloatArray2(const std::string& uniformName,
+Effect& Effect::setFloatArray2(const UniformName& uniformName,
                                const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setFloatArray2(getUniform(uniformName), array);
+  return setFloatArray2(getUniformIndex(uniformName), array);
+}
+
+Effect& Effect::setFloatArray2(int slot, const Float32Array& array)
+{
+  _clearCachedValue(slot);
+  _engine->setFloatArray2(getUniform(slot), array);
 
   return *this;
 }
 
-Effect& Effect::setFloatArray3(const std::string& uniformName,
+Effect& Effect::setFloatArray3(const UniformName& uniformName,
                                const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setFloatArray3(getUniform(uniformName), array);
+  return setFloatArray3(getUniformIndex(uniformName), array);
+}
+
+Effect& Effect::setFloatArray3(int slot, const Float32Array& array)
+{
+  _clearCachedValue(slot);
+  _engine->setFloatArray3(getUniform(slot), array);
 
   return *this;
 }
 
-Effect& Effect::setFloatArray4(const std::string& uniformName,
+Effect& Effect::setFloatArray4(const UniformName& uniformName,
                                const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setFloatArray4(getUniform(uniformName), array);
+  return setFloatArray4(getUniformIndex(uniformName), array);
+}
+
+Effect& Effect::setFloatArray4(int slot, const Float32Array& array)
+{
+  _clearCachedValue(slot);
+  _engine->setFloatArray4(getUniform(slot), array);
 
   return *this;
 }
 
-Effect& Effect::setArray(const std::string& uniformName, Float32Array array)
+Effect& Effect::setArray(const UniformName& uniformName, Float32Array array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray(getUniform(uniformName), array);
+  return setArray(getUniformIndex(uniformName), array);
+}
+
+Effect& Effect::setArray(int slot, Float32Array array)
+{
+  _clearCachedValue(slot);
+  _engine->setArray(getUniform(slot), array);
 
   return *this;
 }
 
-Effect& Effect::setArray2(const std::string& uniformName, Float32Array array)
+Effect& Effect::setArray2(const UniformName& uniformName, Float32Array array)
+{
+  return setArray2(getUniformIndex(uniformName), array);
+}
+
+Effect& Effect::setArray2(int slot, Float32Array array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray2(getUniform(uniformName), array);
+  _clearCachedValue(slot);
+  _engine->setArray2(getUniform(slot), array);
 
   return *this;
 }
 
-Effect& Effect::setArray3(const std::string& uniformName, Float32Array array)
+Effect& Effect::setArray3(const UniformName& uniformName, Float32Array array)
+{
+  return setArray3(getUniformIndex(uniformName), array);
+}
+
+Effect& Effect::setArray3(int slot, Float32Array array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray3(getUniform(uniformName), array);
+  _clearCachedValue(slot);
+  _engine->setArray3(getUniform(slot), array);
 
   return *this;
 }
 
-Effect& Effect::setArray4(const std::string& uniformName, Float32Array array)
+Effect& Effect::setArray4(const UniformName& uniformName, Float32Array array)
+{
+  return setArray4(getUniformIndex(uniformName), array);
+}
+
+Effect& Effect::setArray4(int slot, Float32Array array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray4(getUniform(uniformName), array);
+  _clearCachedValue(slot);
+  _engine->setArray4(getUniform(slot), array);
 
   return *this;
 }
 
-Effect& Effect::setMatrices(const std::string& uniformName,
+Effect& Effect::setMatrices(const UniformName& uniformName,
                             Float32Array matrices)
+{
+  return setMatrices(getUniformIndex(uniformName), matrices);
+}
+
+Effect& Effect::setMatrices(int slot, Float32Array matrices)
 {
   if (matrices.empty()) {
     return *this;
   }
 
-  _valueCache.erase(uniformName);
-  _engine->setMatrices(getUniform(uniformName), matrices);
+  _clearCachedValue(slot);
+  _engine->setMatrices(getUniform(slot), matrices);
 
   return *this;
 }
 
-Effect& Effect::setMatrix(const std::string& uniformName, const Matrix& matrix)
+Effect& Effect::setMatrix(const UniformName& uniformName, const Matrix& matrix)
+{
+  return setMatrix(getUniformIndex(uniformName), matrix);
+}
+
+Effect& Effect::setMatrix(int slot, const Matrix& matrix)
 {
-  if (_cacheMatrix(uniformName, matrix)) {
-    _engine->setMatrix(getUniform(uniformName), matrix);
+  if (_cacheMatrix(slot, matrix)) {
+    _engine->setMatrix(getUniform(slot), matrix);
   }
 
   return *this;
 }
 
-Effect& Effect::setMatrix3x3(const std::string& uniformName,
+Effect& Effect::setMatrix3x3(const UniformName& uniformName,
                              const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
-  _engine->setMatrix3x3(getUniform(uniformName), matrix);
+  return setMatrix3x3(getUniformIndex(uniformName), matrix);
+}
+
+Effect& Effect::setMatrix3x3(int slot, const Float32Array& matrix)
+{
+  _clearCachedValue(slot);
+  _engine->setMatrix3x3(getUniform(slot), matrix);
 
   return *this;
 }
 
-Effect& Effect::setMatrix2x2(const std::string& uniformName,
+Effect& Effect::setMatrix2x2(const UniformName& uniformName,
                              const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
-  _engine->setMatrix2x2(getUniform(uniformName), matrix);
+  return setMatrix2x2(getUniformIndex(uniformName), matrix);
+}
+
+Effect& Effect::setMatrix2x2(int slot, const Float32Array& matrix)
+{
+  _clearCachedValue(slot);
+  _engine->setMatrix2x2(getUniform(slot), matrix);
 
   return *this;
 }
 
-Effect& Effect::setFloat(const std::string& uniformName, float value)
+Effect& Effect::setFloat(const UniformName& uniformName, float value)
 {
-  if (stl_util::contains(_valueCache, uniformName)
-      && stl_util::almost_equal(_valueCache[uniformName][0], value)) {
-    return *this;
-  }
-
-  _valueCache[uniformName] = {value};
+  return setFloat(getUniformIndex(uniformName), value);
+}
 
-  _engine->setFloat(getUniform(uniformName), value);
+Effect& Effect::setFloat(int slot, float value)
+{
+  if (_cacheValues(slot, &value, 1)) {
+    _engine->setFloat(getUniform(slot), value);
+  }
 
   return *this;
 }
 
-Effect& Effect::setBool(const std::string& uniformName, bool _bool)
+Effect& Effect::setBool(const UniformName& uniformName, bool _bool)
 {
-  if (stl_util::contains(_valueCache, uniformName)
-      && stl_util::almost_equal(_valueCache[uniformName][0],
-                                _bool ? 1.f : 0.f)) {
-    return *this;
-  }
-
-  _valueCache[uniformName] = {_bool ? 1.f : 0.f};
+  return setBool(getUniformIndex(uniformName), _bool);
+}
 
-  _engine->setBool(getUniform(uniformName), _bool ? 1 : 0);
+Effect& Effect::setBool(int slot, bool _bool)
+{
+  const auto value = _bool ? 1.f : 0.f;
+  if (_cacheValues(slot, &value, 1)) {
+    _engine->setBool(getUniform(slot), _bool ? 1 : 0);
+  }
 
   return *this;
 }
 
-Effect& Effect::setVector2(const std::string& uniformName,
+Effect& Effect::setVector2(const UniformName& uniformName,
                            const Vector2& vector2)
 {
-  if (_cacheFloat2(uniformName, vector2.x, vector2.y)) {
-    _engine->setFloat2(getUniform(uniformName), vector2.x, vector2.y);
+  return setVector2(getUniformIndex(uniformName), vector2);
+}
+
+Effect& Effect::setVector2(int slot, const Vector2& vector2)
+{
+  if (_cacheFloat2(slot, vector2.x, vector2.y)) {
+    _engine->setFloat2(getUniform(slot), vector2.x, vector2.y);
   }
 
   return *this;
 }
 
-Effect& Effect::setFloat2(const std::string& uniformName, float x, float y)
+Effect& Effect::setFloat2(const UniformName& uniformName, float x, float y)
 {
-  if (_cacheFloat2(uniformName, x, y)) {
-    _engine->setFloat2(getUniform(uniformName), x, y);
+  return setFloat2(getUniformIndex(uniformName), x, y);
+}
+
+Effect& Effect::setFloat2(int slot, float x, float y)
+{
+  if (_cacheFloat2(slot, x, y)) {
+    _engine->setFloat2(getUniform(slot), x, y);
   }
 
   return *this;
 }
 
-Effect& Effect::setVector3(const std::string& uniformName,
+Effect& Effect::setVector3(const UniformName& uniformName,
                            const Vector3& vector3)
 {
-  if (_cacheFloat3(uniformName, vector3.x, vector3.y, vector3.z)) {
-    _engine->setFloat3(getUniform(uniformName), vector3.x, vector3.y,
-                       vector3.z);
+  return setVector3(getUniformIndex(uniformName), vector3);
+}
+
+Effect& Effect::setVector3(int slot, const Vector3& vector3)
+{
+  if (_cacheFloat3(slot, vector3.x, vector3.y, vector3.z)) {
+    _engine->setFloat3(getUniform(slot), vector3.x, vector3.y, vector3.z);
   }
 
   return *this;
 }
 
-Effect& Effect::setFloat3(const std::string& uniformName, float x, float y,
+Effect& Effect::setFloat3(const UniformName& uniformName, float x, float y,
                           float z)
 {
-  if (_cacheFloat3(uniformName, x, y, z)) {
-    _engine->setFloat3(getUniform(uniformName), x, y, z);
+  return setFloat3(getUniformIndex(uniformName), x, y, z);
+}
+
+Effect& Effect::setFloat3(int slot, float x, float y, float z)
+{
+  if (_cacheFloat3(slot, x, y, z)) {
+    _engine->setFloat3(getUniform(slot), x, y, z);
   }
 
   return *this;
 }
 
-Effect& Effect::setVector4(const std::string& uniformName,
+Effect& Effect::setVector4(const UniformName& uniformName,
                            const Vector4& vector4)
 {
-  if (_cacheFloat4(uniformName, vector4.x, vector4.y, vector4.z, vector4.w)) {
-    _engine->setFloat4(getUniform(uniformName), vector4.x, vector4.y, vector4.z,
+  return setVector4(getUniformIndex(uniformName), vector4);
+}
+
+Effect& Effect::setVector4(int slot, const Vector4& vector4)
+{
+  if (_cacheFloat4(slot, vector4.x, vector4.y, vector4.z, vector4.w)) {
+    _engine->setFloat4(getUniform(slot), vector4.x, vector4.y, vector4.z,
                        vector4.w);
   }
 
   return *this;
 }
 
-Effect& Effect::setFloat4(const std::string& uniformName, float x, float y,
+Effect& Effect::setFloat4(const UniformName& uniformName, float x, float y,
                           float z, float w)
 {
-  if (_cacheFloat4(uniformName, x, y, z, w)) {
-    _engine->setFloat4(getUniform(uniformName), x, y, z, w);
+  return setFloat4(getUniformIndex(uniformName), x, y, z, w);
+}
+
+Effect& Effect::setFloat4(int slot, float x, float y, float z, float w)
+{
+  if (_cacheFloat4(slot, x, y, z, w)) {
+    _engine->setFloat4(getUniform(slot), x, y, z, w);
   }
 
   return *this;
 }
 
-Effect& Effect::setColor3(const std::string& uniformName, const Color3& color3)
+Effect& Effect::setColor3(const UniformName& uniformName, const Color3& color3)
+{
+  return setColor3(getUniformIndex(uniformName), color3);
+}
+
+Effect& Effect::setColor3(int slot, const Color3& color3)
 {
-  if (_cacheFloat3(uniformName, color3.r, color3.g, color3.b)) {
-    _engine->setColor3(getUniform(uniformName), color3);
+  if (_cacheFloat3(slot, color3.r, color3.g, color3.b)) {
+    _engine->setColor3(getUniform(slot), color3);
   }
 
   return *this;
 }
 
-Effect& Effect::setColor4(const std::string& uniformName, const Color3& color3,
+Effect& Effect::setColor4(const UniformName& uniformName, const Color3& color3,
                           float alpha)
 {
-  if (_cacheFloat4(uniformName, color3.r, color3.g, color3.b, alpha)) {
-    _engine->setColor4(getUniform(uniformName), color3, alpha);
+  return setColor4(getUniformIndex(uniformName), color3, alpha);
+}
+
+Effect& Effect::setColor4(int slot, const Color3& color3, float alpha)
+{
+  if (_cacheFloat4(slot, color3.r, color3.g, color3.b, alpha)) {
+    _engine->setColor4(getUniform(slot), color3, alpha);
   }
 
   return *this;
 }
 
-Effect& Effect::setDirectColor4(const std::string& uniformName,
+Effect& Effect::setDirectColor4(const UniformName& uniformName,
                                 const Color4& color4)
 {
-  if (_cacheFloat4(uniformName, color4.r, color4.g, color4.b, color4.a)) {
-    _engine->setDirectColor4(getUniform(uniformName), color4);
+  return setDirectColor4(getUniformIndex(uniformName), color4);
+}
+
+Effect& Effect::setDirectColor4(int slot, const Color4& color4)
+{
+  if (_cacheFloat4(slot, color4.r, color4.g, color4.b, color4.a)) {
+    _engine->setDirectColor4(getUniform(slot), color4);
   }
 
   return *this;
@@ -1,5 +1,6 @@
 ﻿#include <babylon/materials/effect_includes_shaders_store.h>
 
+#include <babylon/core/perfect_hash.h>
 #include <babylon/shaders/shadersinclude/background_fragment_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/background_ubo_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/background_vertex_declaration_fx.h>
@@ -60,85 +61,167 @@
 
 namespace BABYLON {
 
-EffectIncludesShadersStore::EffectIncludesShadersStore()
-{
-}
+/**
+ * @brief Shaders of the store, ordered by slot of the perfect hash.
+ */
+struct EffectIncludesShadersStoreTable {
+  using Views = std::array<std::string_view, EffectIncludesShadersStore::Size>;
+  using Seeds = std::array<int32_t, EffectIncludesShadersStore::Size>;
 
-EffectIncludesShadersStore::~EffectIncludesShadersStore()
-{
-}
+  static constexpr Views names{{
+    "bonesDeclaration",
+    "imageProcessingFunctions",
+    "pbrFragmentDeclaration",
+    "harmonicsFunctions",
+    "bones300Declaration",
+    "mrtFragmentDeclaration",
+    "reflectionFunction",
+    "bumpVertex",
+    "pbrLightFunctions",
+    "morphTargetsVertexGlobalDeclaration",
+    "backgroundUboDeclaration",
+    "clipPlaneVertexDeclaration",
+    "morphTargetsVertex",
+    "instancesVertex",
+    "kernelBlurFragment",
+    "bumpFragment",
+    "fogVertexDeclaration",
+    "defaultVertexDeclaration",
+    "logDepthFragment",
+    "depthPrePass",
+    "logDepthVertex",
+    "bumpVertexDeclaration",
+    "lightFragmentDeclaration",
+    "shadowsFragmentFunctions",
+    "imageProcessingDeclaration",
+    "kernelBlurFragment2",
+    "pbrFunctions",
+    "clipPlaneFragmentDeclaration2",
+    "fogFragment",
+    "morphTargetsVertexDeclaration",
+    "instancesDeclaration",
+    "lightUboDeclaration",
+    "logDepthDeclaration",
+    "backgroundFragmentDeclaration",
+    "kernelBlurVaryingDeclaration",
+    "kernelBlurVertex",
+    "clipPlaneVertexDeclaration2",
+    "helperFunctions",
+    "instances300Declaration",
+    "pbrUboDeclaration",
+    "defaultFragmentDeclaration",
+    "bumpFragmentFunctions",
+    "defaultUboDeclaration",
+    "lightsFragmentFunctions",
+    "clipPlaneFragmentDeclaration",
+    "backgroundVertexDeclaration",
+    "fogFragmentDeclaration",
+    "pointCloudVertexDeclaration",
+    "fogVertex",
+    "bonesVertex",
+    "clipPlaneFragment",
+    "shadowsVertex",
+    "pointCloudVertex",
+    "lightFragment",
+    "fresnelFunction",
+    "pbrVertexDeclaration",
+    "clipPlaneVertex",
+  }};
+  static constexpr Views sources{{
+    bonesDeclaration,
+    imageProcessingFunctions,
+    pbrFragmentDeclaration,
+    harmonicsFunctions,
+    bones300Declaration,
+    mrtFragmentDeclaration,
+    reflectionFunction,
+    bumpVertex,
+    pbrLightFunctions,
+    morphTargetsVertexGlobalDeclaration,
+    backgroundUboDeclaration,
+    clipPlaneVertexDeclaration,
+    morphTargetsVertex,
+    instancesVertex,
+    kernelBlurFragment,
+    bumpFragment,
+    fogVertexDeclaration,
+    defaultVertexDeclaration,
+    logDepthFragment,
+    depthPrePass,
+    logDepthVertex,
+    bumpVertexDeclaration,
+    lightFragmentDeclaration,
+    shadowsFragmentFunctions,
+    imageProcessingDeclaration,
+    kernelBlurFragment2,
+    pbrFunctions,
+    clipPlaneFragmentDeclaration2,
+    fogFragment,
+    morphTargetsVertexDeclaration,
+    instancesDeclaration,
+    lightUboDeclaration,
+    logDepthDeclaration,
+    backgroundFragmentDeclaration,
+    kernelBlurVaryingDeclaration,
+    kernelBlurVertex,
+    clipPlaneVertexDeclaration2,
+    helperFunctions,
+    instances300Declaration,
+    pbrUboDeclaration,
+    defaultFragmentDeclaration,
+    bumpFragmentFunctions,
+    defaultUboDeclaration,
+    lightsFragmentFunctions,
+    clipPlaneFragmentDeclaration,
+    backgroundVertexDeclaration,
+    fogFragmentDeclaration,
+    pointCloudVertexDeclaration,
+    fogVertex,
+    bonesVertex,
+    clipPlaneFragment,
+    shadowsVertex,
+    pointCloudVertex,
+    lightFragment,
+    fresnelFunction,
+    pbrVertexDeclaration,
+    clipPlaneVertex,
+  }};
+  static constexpr Seeds seeds{{
+    0, 0, -2, -6, 0, 0, 0, 1, -7, -14, -15, 0,
+    -17, 0, 0, 1, -20, -24, -25, 0, -26, 1, 2, -29,
+    -31, 0, 0, 2, 3, -33, 0, 0, 1, -35, 0, 0,
+    0, 5, 6, -38, 0, 8, -39, 0, 3, -43, 1, 0,
+    -51, -52, 9, 40, 1, 0, 0, -56, 3,
+  }};
 
-std::unordered_map<std::string, std::string>&
-EffectIncludesShadersStore::shaders()
+  static constexpr bool IsPerfect()
+  {
+    for (size_t i = 0; i < EffectIncludesShadersStore::Size; ++i) {
+      if (PerfectHash::Slot(names[i], seeds) != i) {
+        return false;
+      }
+    }
+    return true;
+  }
+}; // end of struct EffectIncludesShadersStoreTable
+
+static_assert(EffectIncludesShadersStoreTable::IsPerfect(),
+              "The seeds do not match the shader names");
+
+constexpr size_t EffectIncludesShadersStore::Size;
+
+std::string_view EffectIncludesShadersStore::Find(std::string_view name)
 {
-  return _shaders;
+  using Table     = EffectIncludesShadersStoreTable;
+  const auto slot = PerfectHash::Slot(name, Table::seeds);
+  return (Table::names[slot] == name) ? Table::sources[slot] :
+                                        std::string_view{};
 }
 
-const std::unordered_map<std::string, std::string>&
-EffectIncludesShadersStore::shaders() const
+const std::array<std::string_view, EffectIncludesShadersStore::Size>&
+EffectIncludesShadersStore::Names()
 {
-  return _shaders;
+  return EffectIncludesShadersStoreTable::names;
 }
 
-std::unordered_map<std::string, std::string>
-  EffectIncludesShadersStore::_shaders
-  = {{"backgroundFragmentDeclaration", backgroundFragmentDeclaration},
-     {"backgroundUboDeclaration", backgroundUboDeclaration},
-     {"backgroundVertexDeclaration", backgroundVertexDeclaration},
-     {"bones300Declaration", bones300Declaration},
-     {"bonesDeclaration", bonesDeclaration},
-     {"bonesVertex", bonesVertex},
-     {"bumpFragment", bumpFragment},
-     {"bumpFragmentFunctions", bumpFragmentFunctions},
-     {"bumpVertex", bumpVertex},
-     {"bumpVertexDeclaration", bumpVertexDeclaration},
-     {"clipPlaneFragment", clipPlaneFragment},
-     {"clipPlaneFragmentDeclaration", clipPlaneFragmentDeclaration},
-     {"clipPlaneFragmentDeclaration2", clipPlaneFragmentDeclaration2},
-     {"clipPlaneVertex", clipPlaneVertex},
-     {"clipPlaneVertexDeclaration", clipPlaneVertexDeclaration},
-     {"clipPlaneVertexDeclaration2", clipPlaneVertexDeclaration2},
-     {"defaultFragmentDeclaration", defaultFragmentDeclaration},
-     {"defaultUboDeclaration", defaultUboDeclaration},
-     {"defaultVertexDeclaration", defaultVertexDeclaration},
-     {"depthPrePass", depthPrePass},
-     {"fogFragment", fogFragment},
-     {"fogFragmentDeclaration", fogFragmentDeclaration},
-     {"fogVertex", fogVertex},
-     {"fogVertexDeclaration", fogVertexDeclaration},
-     {"fresnelFunction", fresnelFunction},
-     {"harmonicsFunctions", harmonicsFunctions},
-     {"helperFunctions", helperFunctions},
-     {"imageProcessingDeclaration", imageProcessingDeclaration},
-     {"imageProcessingFunctions", imageProcessingFunctions},
-     {"instances300Declaration", instances300Declaration},
-     {"instancesDeclaration", instancesDeclaration},
-     {"instancesVertex", instancesVertex},
-     {"kernelBlurFragment", kernelBlurFragment},
-     {"kernelBlurFragment2", kernelBlurFragment2},
-     {"kernelBlurVaryingDeclaration", kernelBlurVaryingDeclaration},
-     {"kernelBlurVertex", kernelBlurVertex},
-     {"lightFragment", lightFragment},
-     {"lightFragmentDeclaration", lightFragmentDeclaration},
-     {"lightUboDeclaration", lightUboDeclaration},
-     {"lightsFragmentFunctions", lightsFragmentFunctions},
-     {"logDepthDeclaration", logDepthDeclaration},
-     {"logDepthFragment", logDepthFragment},
-     {"logDepthVertex", logDepthVertex},
-     {"morphTargetsVertex", morphTargetsVertex},
-     {"morphTargetsVertexDeclaration", morphTargetsVertexDeclaration},
-     {"morphTargetsVertexGlobalDeclaration",
-      morphTargetsVertexGlobalDeclaration},
-     {"mrtFragmentDeclaration", mrtFragmentDeclaration},
-     {"pbrFragmentDeclaration", pbrFragmentDeclaration},
-     {"pbrFunctions", pbrFunctions},
-     {"pbrLightFunctions", pbrLightFunctions},
-     {"pbrUboDeclaration", pbrUboDeclaration},
-     {"pbrVertexDeclaration", pbrVertexDeclaration},
-     {"pointCloudVertex", pointCloudVertex},
-     {"pointCloudVertexDeclaration", pointCloudVertexDeclaration},
-     {"reflectionFunction", reflectionFunction},
-     {"shadowsFragmentFunctions", shadowsFragmentFunctions},
-     {"shadowsVertex", shadowsVertex}};
-
 } // end of namespace BABYLON
@@ -1,5 +1,6 @@
 ﻿#include <babylon/materials/effect_shaders_store.h>
 
+#include <babylon/core/perfect_hash.h>
 #include <babylon/shaders/anaglyph_fragment_fx.h>
 #include <babylon/shaders/background_fragment_fx.h>
 #include <babylon/shaders/background_vertex_fx.h>
@@ -77,101 +78,203 @@
 
 namespace BABYLON {
 
-EffectShadersStore::EffectShadersStore()
-{
-}
+/**
+ * @brief Shaders of the store, ordered by slot of the perfect hash.
+ */
+struct EffectShadersStoreTable {
+  using Views = std::array<std::string_view, EffectShadersStore::Size>;
+  using Seeds = std::array<int32_t, EffectShadersStore::Size>;
 
-EffectShadersStore::~EffectShadersStore()
-{
-}
+  static constexpr Views names{{
+    "outlinePixelShader",
+    "glowBlurPostProcessPixelShader",
+    "highlightsPixelShader",
+    "standardPixelShader",
+    "sharpenPixelShader",
+    "blackAndWhitePixelShader",
+    "chromaticAberrationPixelShader",
+    "glowMapGenerationVertexShader",
+    "gpuRenderParticlesVertexShader",
+    "lensFlareVertexShader",
+    "spritesVertexShader",
+    "circleOfConfusionPixelShader",
+    "shadowMapPixelShader",
+    "depthBoxBlurPixelShader",
+    "imageProcessingPixelShader",
+    "gpuRenderParticlesPixelShader",
+    "volumetricLightScatteringPassPixelShader",
+    "vrDistortionCorrectionPixelShader",
+    "pbrPixelShader",
+    "stereoscopicInterlacePixelShader",
+    "depthVertexShader",
+    "filterPixelShader",
+    "fxaaPixelShader",
+    "depthPixelShader",
+    "tonemapPixelShader",
+    "spritesPixelShader",
+    "glowMapMergePixelShader",
+    "colorVertexShader",
+    "glowMapMergeVertexShader",
+    "glowMapGenerationPixelShader",
+    "lensHighlightsPixelShader",
+    "layerVertexShader",
+    "proceduralVertexShader",
+    "defaultVertexShader",
+    "pbrVertexShader",
+    "passPixelShader",
+    "backgroundVertexShader",
+    "refractionPixelShader",
+    "ssaoPixelShader",
+    "volumetricLightScatteringPixelShader",
+    "postprocessVertexShader",
+    "extractHighlightsPixelShader",
+    "particlesVertexShader",
+    "noisePixelShader",
+    "shadowMapVertexShader",
+    "gpuUpdateParticlesVertexShader",
+    "rgbdEncodePixelShader",
+    "geometryPixelShader",
+    "depthOfFieldPixelShader",
+    "particlesPixelShader",
+    "lensFlarePixelShader",
+    "grainPixelShader",
+    "ssaoCombinePixelShader",
+    "layerPixelShader",
+    "displayPassPixelShader",
+    "ssao2PixelShader",
+    "blurPixelShader",
+    "colorCorrectionPixelShader",
+    "bloomMergePixelShader",
+    "outlineVertexShader",
+    "kernelBlurVertexShader",
+    "gpuUpdateParticlesPixelShader",
+    "rgbdDecodePixelShader",
+    "defaultPixelShader",
+    "geometryVertexShader",
+    "kernelBlurPixelShader",
+    "backgroundPixelShader",
+    "lineVertexShader",
+    "fxaaVertexShader",
+    "colorPixelShader",
+    "depthOfFieldMergePixelShader",
+    "anaglyphPixelShader",
+    "linePixelShader",
+    "convolutionPixelShader",
+  }};
+  static constexpr Views sources{{
+    outlinePixelShader,
+    glowBlurPostProcessPixelShader,
+    highlightsPixelShader,
+    standardPixelShader,
+    sharpenPixelShader,
+    blackAndWhitePixelShader,
+    chromaticAberrationPixelShader,
+    glowMapGenerationVertexShader,
+    gpuRenderParticlesVertexShader,
+    lensFlareVertexShader,
+    spritesVertexShader,
+    circleOfConfusionPixelShader,
+    shadowMapPixelShader,
+    depthBoxBlurPixelShader,
+    imageProcessingPixelShader,
+    gpuRenderParticlesPixelShader,
+    volumetricLightScatteringPassPixelShader,
+    vrDistortionCorrectionPixelShader,
+    pbrPixelShader,
+    stereoscopicInterlacePixelShader,
+    depthVertexShader,
+    filterPixelShader,
+    fxaaPixelShader,
+    depthPixelShader,
+    tonemapPixelShader,
+    spritesPixelShader,
+    glowMapMergePixelShader,
+    colorVertexShader,
+    glowMapMergeVertexShader,
+    glowMapGenerationPixelShader,
+    lensHighlightsPixelShader,
+    layerVertexShader,
+    proceduralVertexShader,
+    defaultVertexShader,
+    pbrVertexShader,
+    passPixelShader,
+    backgroundVertexShader,
+    refractionPixelShader,
+    ssaoPixelShader,
+    volumetricLightScatteringPixelShader,
+    postprocessVertexShader,
+    extractHighlightsPixelShader,
+    particlesVertexShader,
+    noisePixelShader,
+    shadowMapVertexShader,
+    gpuUpdateParticlesVertexShader,
+    rgbdEncodePixelShader,
+    geometryPixelShader,
+    depthOfFieldPixelShader,
+    particlesPixelShader,
+    lensFlarePixelShader,
+    grainPixelShader,
+    ssaoCombinePixelShader,
+    layerPixelShader,
+    displayPassPixelShader,
+    ssao2PixelShader,
+    blurPixelShader,
+    colorCorrectionPixelShader,
+    bloomMergePixelShader,
+    outlineVertexShader,
+    kernelBlurVertexShader,
+    gpuUpdateParticlesPixelShader,
+    rgbdDecodePixelShader,
+    defaultPixelShader,
+    geometryVertexShader,
+    kernelBlurPixelShader,
+    backgroundPixelShader,
+    lineVertexShader,
+    fxaaVertexShader,
+    colorPixelShader,
+    depthOfFieldMergePixelShader,
+    anaglyphPixelShader,
+    linePixelShader,
+    convolutionPixelShader,
+  }};
+  static constexpr Seeds seeds{{
+    0, -8, 0, 0, -13, -14, -19, 0, -20, 1, 0, 0,
+    0, 0, -22, 2, 0, 0, -23, -24, 0, 1, -25, -30,
+    5, 3, 0, -33, -39, -41, -42, 1, 0, -43, 0, 0,
+    -46, 0, -48, 2, 5, 8, -49, 3, 0, -50, -51, -53,
+    -56, 0, 2, 0, -62, -64, -65, 0, 1, 2, -66, -70,
+    -72, 0, -74, 0, 0, 0, 0, 0, 3, 0, 9, 9,
+    2, 2,
+  }};
 
-std::unordered_map<std::string, std::string>& EffectShadersStore::shaders()
+  static constexpr bool IsPerfect()
+  {
+    for (size_t i = 0; i < EffectShadersStore::Size; ++i) {
+      if (PerfectHash::Slot(names[i], seeds) != i) {
+        return false;
+      }
+    }
+    return true;
+  }
+}; // end of struct EffectShadersStoreTable
+
+static_assert(EffectShadersStoreTable::IsPerfect(),
+              "The seeds do not match the shader names");
+
+constexpr size_t EffectShadersStore::Size;
+
+std::string_view EffectShadersStore::Find(std::string_view name)
 {
-  return _shaders;
+  using Table     = EffectShadersStoreTable;
+  const auto slot = PerfectHash::Slot(name, Table::seeds);
+  return (Table::names[slot] == name) ? Table::sources[slot] :
+                                        std::string_view{};
 }
 
-const std::unordered_map<std::string, std::string>&
-EffectShadersStore::shaders() const
+const std::array<std::string_view, EffectShadersStore::Size>&
+EffectShadersStore::Names()
 {
-  return _shaders;
+  return EffectShadersStoreTable::names;
 }
 
-std::unordered_map<std::string, std::string> EffectShadersStore::_shaders
-  = {{"anaglyphPixelShader", anaglyphPixelShader},
-     {"backgroundPixelShader", backgroundPixelShader},
-     {"backgroundVertexShader", backgroundVertexShader},
-     {"blackAndWhitePixelShader", blackAndWhitePixelShader},
-     {"bloomMergePixelShader", bloomMergePixelShader},
-     {"blurPixelShader", blurPixelShader},
-     {"chromaticAberrationPixelShader", chromaticAberrationPixelShader},
-     {"circleOfConfusionPixelShader", circleOfConfusionPixelShader},
-     {"colorPixelShader", colorPixelShader},
-     {"colorVertexShader", colorVertexShader},
-     {"colorCorrectionPixelShader", colorCorrectionPixelShader},
-     {"convolutionPixelShader", convolutionPixelShader},
-     {"defaultPixelShader", defaultPixelShader},
-     {"defaultVertexShader", defaultVertexShader},
-     {"depthPixelShader", depthPixelShader},
-     {"depthVertexShader", depthVertexShader},
-     {"depthBoxBlurPixelShader", depthBoxBlurPixelShader},
-     {"depthOfFieldPixelShader", depthOfFieldPixelShader},
-     {"depthOfFieldMergePixelShader", depthOfFieldMergePixelShader},
-     {"displayPassPixelShader", displayPassPixelShader},
-     {"extractHighlightsPixelShader", extractHighlightsPixelShader},
-     {"filterPixelShader", filterPixelShader},
-     {"fxaaPixelShader", fxaaPixelShader},
-     {"fxaaVertexShader", fxaaVertexShader},
-     {"geometryPixelShader", geometryPixelShader},
-     {"geometryVertexShader", geometryVertexShader},
-     {"glowBlurPostProcessPixelShader", glowBlurPostProcessPixelShader},
-     {"glowMapGenerationPixelShader", glowMapGenerationPixelShader},
-     {"glowMapGenerationVertexShader", glowMapGenerationVertexShader},
-     {"glowMapMergePixelShader", glowMapMergePixelShader},
-     {"glowMapMergeVertexShader", glowMapMergeVertexShader},
-     {"gpuRenderParticlesPixelShader", gpuRenderParticlesPixelShader},
-     {"gpuRenderParticlesVertexShader", gpuRenderParticlesVertexShader},
-     {"gpuUpdateParticlesPixelShader", gpuUpdateParticlesPixelShader},
-     {"gpuUpdateParticlesVertexShader", gpuUpdateParticlesVertexShader},
-     {"grainPixelShader", grainPixelShader},
-     {"highlightsPixelShader", highlightsPixelShader},
-     {"imageProcessingPixelShader", imageProcessingPixelShader},
-     {"kernelBlurPixelShader", kernelBlurPixelShader},
-     {"kernelBlurVertexShader", kernelBlurVertexShader},
-     {"layerPixelShader", layerPixelShader},
-     {"layerVertexShader", layerVertexShader},
-     {"lensFlarePixelShader", lensFlarePixelShader},
-     {"lensFlareVertexShader", lensFlareVertexShader},
-     {"lensHighlightsPixelShader", lensHighlightsPixelShader},
-     {"linePixelShader", linePixelShader},
-     {"lineVertexShader", lineVertexShader},
-     {"noisePixelShader", noisePixelShader},
-     {"outlinePixelShader", outlinePixelShader},
-     {"outlineVertexShader", outlineVertexShader},
-     {"particlesPixelShader", particlesPixelShader},
-     {"particlesVertexShader", particlesVertexShader},
-     {"passPixelShader", passPixelShader},
-     {"pbrPixelShader", pbrPixelShader},
-     {"pbrVertexShader", pbrVertexShader},
-     {"postprocessVertexShader", postprocessVertexShader},
-     {"proceduralVertexShader", proceduralVertexShader},
-     {"refractionPixelShader", refractionPixelShader},
-     {"rgbdDecodePixelShader", rgbdDecodePixelShader},
-     {"rgbdEncodePixelShader", rgbdEncodePixelShader},
-     {"shadowMapPixelShader", shadowMapPixelShader},
-     {"shadowMapVertexShader", shadowMapVertexShader},
-     {"sharpenPixelShader", sharpenPixelShader},
-     {"spritesPixelShader", spritesPixelShader},
-     {"spritesVertexShader", spritesVertexShader},
-     {"ssaoPixelShader", ssaoPixelShader},
-     {"ssao2PixelShader", ssao2PixelShader},
-     {"ssaoCombinePixelShader", ssaoCombinePixelShader},
-     {"standardPixelShader", standardPixelShader},
-     {"stereoscopicInterlacePixelShader", stereoscopicInterlacePixelShader},
-     {"tonemapPixelShader", tonemapPixelShader},
-     {"volumetricLightScatteringPixelShader",
-      volumetricLightScatteringPixelShader},
-     {"volumetricLightScatteringPassPixelShader",
-      volumetricLightScatteringPassPixelShader},
-     {"vrDistortionCorrectionPixelShader", vrDistortionCorrectionPixelShader}};
-
 } // end of namespace BABYLON
@@ -381,7 +381,8 @@ void Material::bindSceneUniformBuffer(Effect* effect, UniformBuffer* sceneUbo)
 void Material::bindView(Effect* effect)
 {
   if (!_useUBO) {
-    effect->setMatrix("view", getScene()->getViewMatrix());
+    static const UniformName view{"view"};
+    effect->setMatrix(view, getScene()->getViewMatrix());
   }
   else {
     bindSceneUniformBuffer(effect, getScene()->getSceneUniformBuffer());
@@ -391,7 +392,8 @@ void Material::bindView(Effect* effect)
 void Material::bindViewProjection(Effect* effect)
 {
   if (!_useUBO) {
-    effect->setMatrix("viewProjection", getScene()->getTransformMatrix());
+    static const UniformName viewProjection{"viewProjection"};
+    effect->setMatrix(viewProjection, getScene()->getTransformMatrix());
   }
   else {
     bindSceneUniformBuffer(effect, getScene()->getSceneUniformBuffer());
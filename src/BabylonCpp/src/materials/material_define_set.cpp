@@ -0,0 +1,275 @@
+#include <babylon/materials/material_define_set.h>
+
+namespace BABYLON {
+
+constexpr size_t MaterialDefineNames::npos;
+
+MaterialDefineNames::MaterialDefineNames()
+{
+}
+
+MaterialDefineNamesPtr MaterialDefineNames::New()
+{
+  return MaterialDefineNamesPtr(new MaterialDefineNames());
+}
+
+size_t MaterialDefineNames::find(const std::string& name) const
+{
+  const auto it = _indices.find(name);
+  return it != _indices.end() ? it->second : npos;
+}
+
+size_t MaterialDefineNames::insert(const std::string& name)
+{
+  const auto it = _indices.find(name);
+  if (it != _indices.end()) {
+    return it->second;
+  }
+  const auto index = _names.size();
+  _indices.emplace(name, index);
+  _names.emplace_back(name);
+  _texts.emplace_back("#define " + name);
+  return index;
+}
+
+size_t MaterialDefineNames::size() const
+{
+  return _names.size();
+}
+
+const std::string& MaterialDefineNames::name(size_t index) const
+{
+  return _names[index];
+}
+
+const std::string& MaterialDefineNames::text(size_t index) const
+{
+  return _texts[index];
+}
+
+uint64_t MaterialDefineNames::Key(size_t index)
+{
+  return Mix(static_cast<uint64_t>(index) + 0x9e3779b97f4a7c15ull);
+}
+
+uint64_t MaterialDefineNames::Mix(uint64_t value)
+{
+  // SplitMix64 finalizer
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+  return value ^ (value >> 31);
+}
+
+MaterialDefineSet::MaterialDefineSet(const MaterialDefineNamesPtr& names)
+    : _names{names}, _size{0}, _hash{0}, _isTextDirty{false}
+{
+}
+
+MaterialDefineSet::~MaterialDefineSet()
+{
+}
+
+bool MaterialDefineSet::contains(const std::string& name) const
+{
+  return contains(_names->find(name));
+}
+
+bool MaterialDefineSet::contains(size_t index) const
+{
+  return index != MaterialDefineNames::npos && _Test(_contained, index);
+}
+
+size_t MaterialDefineSet::size() const
+{
+  return _size;
+}
+
+bool MaterialDefineSet::empty() const
+{
+  return _size == 0;
+}
+
+uint64_t MaterialDefineSet::hash() const
+{
+  return _hash;
+}
+
+const MaterialDefineNamesPtr& MaterialDefineSet::names() const
+{
+  return _names;
+}
+
+const std::string& MaterialDefineSet::toString() const
+{
+  if (_isTextDirty) {
+    _text.clear();
+    for (size_t w = 0; w < _contained.size(); ++w) {
+      const auto word = _contained[w];
+      for (size_t bit = 0; bit < 64 && (word >> bit); ++bit) {
+        if ((word >> bit) & 1ull) {
+          _appendText(_text, w * 64 + bit);
+        }
+      }
+    }
+    _isTextDirty = false;
+  }
+  return _text;
+}
+
+size_t MaterialDefineSet::_insert(const std::string& name)
+{
+  const auto index = _names->insert(name);
+  _insert(index);
+  return index;
+}
+
+bool MaterialDefineSet::_insert(size_t index)
+{
+  if (_Test(_contained, index)) {
+    return false;
+  }
+  _Flip(_contained, index);
+  ++_size;
+  const auto key = MaterialDefineNames::Key(index);
+  _changed((key << 32) | (key >> 32));
+  return true;
+}
+
+void MaterialDefineSet::_clear()
+{
+  _contained.clear();
+  _size        = 0;
+  _hash        = 0;
+  _isTextDirty = true;
+}
+
+void MaterialDefineSet::_changed(uint64_t hashDelta)
+{
+  _hash ^= hashDelta;
+  _isTextDirty = true;
+}
+
+bool MaterialDefineSet::_isEqual(const MaterialDefineSet& other) const
+{
+  return (_names == other._names) && (_hash == other._hash)
+         && (_size == other._size) && _IsEqual(_contained, other._contained);
+}
+
+bool MaterialDefineSet::_Test(const std::vector<uint64_t>& words, size_t index)
+{
+  const auto word = index / 64;
+  return word < words.size() && ((words[word] >> (index % 64)) & 1ull);
+}
+
+void MaterialDefineSet::_Flip(std::vector<uint64_t>& words, size_t index)
+{
+  const auto word = index / 64;
+  if (word >= words.size()) {
+    words.resize(word + 1, 0ull);
+  }
+  words[word] ^= 1ull << (index % 64);
+}
+
+bool MaterialDefineSet::_IsEqual(const std::vector<uint64_t>& lhs,
+                                 const std::vector<uint64_t>& rhs)
+{
+  // Missing words are 0
+  const auto& shorter = lhs.size() < rhs.size() ? lhs : rhs;
+  const auto& longer  = lhs.size() < rhs.size() ? rhs : lhs;
+  for (size_t i = 0; i < shorter.size(); ++i) {
+    if (shorter[i] != longer[i]) {
+      return false;
+    }
+  }
+  for (size_t i = shorter.size(); i < longer.size(); ++i) {
+    if (longer[i] != 0ull) {
+      return false;
+    }
+  }
+  return true;
+}
+
+MaterialDefineFlags::Reference::Reference(MaterialDefineFlags& flags,
+                                          size_t index)
+    : _flags{flags}, _index{index}
+{
+}
+
+MaterialDefineFlags::Reference::operator bool() const
+{
+  return _flags.test(_index);
+}
+
+MaterialDefineFlags::Reference& MaterialDefineFlags::Reference::
+operator=(bool value)
+{
+  _flags.set(_index, value);
+  return *this;
+}
+
+MaterialDefineFlags::Reference& MaterialDefineFlags::Reference::
+operator=(const Reference& other)
+{
+  _flags.set(_index, static_cast<bool>(other));
+  return *this;
+}
+
+MaterialDefineFlags::MaterialDefineFlags(const MaterialDefineNamesPtr& names)
+    : MaterialDefineSet{names}
+{
+}
+
+MaterialDefineFlags::~MaterialDefineFlags()
+{
+}
+
+MaterialDefineFlags& MaterialDefineFlags::
+operator=(std::initializer_list<std::pair<const std::string, bool>> defines)
+{
+  _clear();
+  _values.clear();
+  for (const auto& define : defines) {
+    set(_names->insert(define.first), define.second);
+  }
+  return *this;
+}
+
+MaterialDefineFlags::Reference MaterialDefineFlags::
+operator[](const std::string& name)
+{
+  return Reference(*this, _insert(name));
+}
+
+bool MaterialDefineFlags::operator==(const MaterialDefineFlags& other) const
+{
+  return _isEqual(other) && _IsEqual(_values, other._values);
+}
+
+bool MaterialDefineFlags::operator!=(const MaterialDefineFlags& other) const
+{
+  return !(operator==(other));
+}
+
+bool MaterialDefineFlags::test(size_t index) const
+{
+  return _Test(_values, index);
+}
+
+void MaterialDefineFlags::set(size_t index, bool value)
+{
+  _insert(index);
+  if (_Test(_values, index) != value) {
+    _Flip(_values, index);
+    _changed(MaterialDefineNames::Key(index));
+  }
+}
+
+void MaterialDefineFlags::_appendText(std::string& text, size_t index) const
+{
+  if (_Test(_values, index)) {
+    text += _names->text(index);
+    text += '\n';
+  }
+}
+
+} // end of namespace BABYLON
@@ -1,11 +1,17 @@
 #include <babylon/materials/material_defines.h>
 
-#include <babylon/babylon_stl_util.h>
-
 namespace BABYLON {
 
 MaterialDefines::MaterialDefines()
-    : _isDirty{true}
+    : MaterialDefines{_DefaultLayout()}
+{
+}
+
+MaterialDefines::MaterialDefines(const MaterialDefinesLayout& layout)
+    : boolDef{layout.boolDef}
+    , intDef{layout.intDef}
+    , floatDef{layout.floatDef}
+    , _isDirty{true}
     , _renderId{-1}
     , _areLightsDirty{true}
     , _areAttributesDirty{true}
@@ -24,9 +30,16 @@ MaterialDefines::~MaterialDefines()
 {
 }
 
+const MaterialDefinesLayout& MaterialDefines::_DefaultLayout()
+{
+  static const MaterialDefinesLayout layout;
+  return layout;
+}
+
 bool MaterialDefines::operator[](const std::string& define) const
 {
-  return stl_util::contains(boolDef, define) && boolDef.at(define);
+  const auto index = boolDef.names()->find(define);
+  return index != MaterialDefineNames::npos && boolDef.test(index);
 }
 
 bool MaterialDefines::operator==(const MaterialDefines& rhs) const
@@ -42,19 +55,9 @@ bool MaterialDefines::operator!=(const MaterialDefines& rhs) const
 std::ostream& operator<<(std::ostream& os,
                          const MaterialDefines& materialDefines)
 {
-  for (const auto& item : materialDefines.boolDef) {
-    if (item.second) {
-      os << "#define " << item.first << "\n";
-    }
-  }
-
-  for (const auto& item : materialDefines.intDef) {
-    os << "#define " << item.first << " " << item.second << "\n";
-  }
-
-  for (const auto& item : materialDefines.floatDef) {
-    os << "#define " << item.first << " " << item.second << "\n";
-  }
+  os << materialDefines.boolDef.toString();
+  os << materialDefines.intDef.toString();
+  os << materialDefines.floatDef.toString();
 
   for (const auto& item : materialDefines.stringDef) {
     os << "#define " << item.first << " " << item.second << "\n";
@@ -137,9 +140,9 @@ void MaterialDefines::rebuild()
 
 bool MaterialDefines::isEqual(const MaterialDefines& other) const
 {
-  if ((boolDef.size() != other.boolDef.size())
-      || (intDef.size() != other.intDef.size())
-      || (floatDef.size() != other.floatDef.size())
+  if ((boolDef.hash() != other.boolDef.hash())
+      || (intDef.hash() != other.intDef.hash())
+      || (floatDef.hash() != other.floatDef.hash())
       || (stringDef.size() != other.stringDef.size())) {
     return false;
   }
@@ -200,12 +203,26 @@ void MaterialDefines::reset()
   _needUVs            = false;
 }
 
+uint64_t MaterialDefines::hash() const
+{
+  auto hash = boolDef.hash();
+  hash      = MaterialDefineNames::Mix(hash ^ intDef.hash());
+  hash      = MaterialDefineNames::Mix(hash ^ floatDef.hash());
+  for (const auto& item : stringDef) {
+    hash ^= std::hash<std::string>()(item.first + "=" + item.second);
+  }
+  return hash;
+}
+
 std::string MaterialDefines::toString() const
 {
-  std::ostringstream oss;
-  oss << *this;
+  // The define lines are cached by the sets
+  auto text = boolDef.toString() + intDef.toString() + floatDef.toString();
+  for (const auto& item : stringDef) {
+    text += "#define " + item.first + " " + item.second + "\n";
+  }
 
-  return oss.str();
+  return text;
 }
 
 } // end of namespace BABYLON
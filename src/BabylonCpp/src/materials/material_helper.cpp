@@ -27,13 +27,14 @@ namespace BABYLON {
 
 void MaterialHelper::BindEyePosition(Effect* effect, Scene* scene)
 {
+  static const UniformName vEyePosition{"vEyePosition"};
   if (scene->_forcedViewPosition) {
-    effect->setVector3("vEyePosition", *scene->_forcedViewPosition.get());
+    effect->setVector3(vEyePosition, *scene->_forcedViewPosition.get());
     return;
   }
-  effect->setVector3("vEyePosition", scene->_mirroredCameraPosition ?
-                                       *scene->_mirroredCameraPosition.get() :
-                                       scene->activeCamera->globalPosition());
+  effect->setVector3(vEyePosition, scene->_mirroredCameraPosition ?
+                                     *scene->_mirroredCameraPosition.get() :
+                                     scene->activeCamera->globalPosition());
 }
 
 void MaterialHelper::PrepareDefinesForMergedUV(const BaseTexturePtr& texture,
@@ -240,7 +241,7 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
 
       auto lightIndexStr = std::to_string(lightIndex);
 
-      if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+      if (!defines.boolDef.contains("LIGHT" + lightIndexStr)) {
         needRebuild = true;
       }
 
@@ -325,7 +326,7 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
   for (unsigned int index = lightIndex; index < maxSimultaneousLights;
        ++index) {
     auto indexStr = std::to_string(index);
-    if (stl_util::contains(defines.boolDef, "LIGHT" + indexStr)) {
+    if (defines.boolDef.contains("LIGHT" + indexStr)) {
       defines.boolDef["LIGHT" + indexStr]           = false;
       defines.boolDef["HEMILIGHT" + lightIndexStr]  = false;
       defines.boolDef["POINTLIGHT" + lightIndexStr] = false;
@@ -337,7 +338,7 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
 
   auto caps = scene->getEngine()->getCaps();
 
-  if (!stl_util::contains(defines.boolDef, "SHADOWFLOAT")) {
+  if (!defines.boolDef.contains("SHADOWFLOAT")) {
     needRebuild = true;
   }
 
@@ -366,7 +367,7 @@ void MaterialHelper::PrepareUniformsAndSamplersList(
        ++lightIndex) {
     const std::string lightIndexStr = std::to_string(lightIndex);
 
-    if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+    if (!defines.boolDef.contains("LIGHT" + lightIndexStr)) {
       break;
     }
 
@@ -390,15 +391,14 @@ void MaterialHelper::PrepareUniformsAndSamplersList(
     samplersList.emplace_back("shadowSampler" + lightIndexStr);
     samplersList.emplace_back("depthSampler" + lightIndexStr);
 
-    if (stl_util::contains(defines.boolDef,
-                           "PROJECTEDLIGHTTEXTURE" + lightIndexStr)
+    if (defines.boolDef.contains("PROJECTEDLIGHTTEXTURE" + lightIndexStr)
         && defines["PROJECTEDLIGHTTEXTURE" + lightIndexStr]) {
       samplersList.emplace_back("projectionLightSampler" + lightIndexStr);
       uniformsList.emplace_back("textureProjectionMatrix" + lightIndexStr);
     }
   }
 
-  if (stl_util::contains(defines.intDef, "NUM_MORPH_INFLUENCERS")
+  if (defines.intDef.contains("NUM_MORPH_INFLUENCERS")
       && defines.intDef["NUM_MORPH_INFLUENCERS"]) {
     uniformsList.emplace_back("morphTargetInfluences");
   }
@@ -447,7 +447,7 @@ void MaterialHelper::PrepareUniformsAndSamplersList(
     }
   }
 
-  if (stl_util::contains(defines.intDef, "NUM_MORPH_INFLUENCERS")
+  if (defines.intDef.contains("NUM_MORPH_INFLUENCERS")
       && defines.intDef["NUM_MORPH_INFLUENCERS"]) {
     uniformsList.emplace_back("morphTargetInfluences");
   }
@@ -462,7 +462,7 @@ unsigned int MaterialHelper::HandleFallbacksForShadows(
        ++lightIndex) {
     const std::string lightIndexStr = std::to_string(lightIndex);
 
-    if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+    if (!defines.boolDef.contains("LIGHT" + lightIndexStr)) {
       break;
     }
 
@@ -500,7 +500,7 @@ void MaterialHelper::PrepareAttributesForMorphTargets(
   std::vector<std::string>& attribs, AbstractMesh* mesh,
   MaterialDefines& defines)
 {
-  auto influencers = defines.intDef["NUM_MORPH_INFLUENCERS"];
+  const unsigned int influencers = defines.intDef["NUM_MORPH_INFLUENCERS"];
 
   auto engine = Engine::LastCreatedEngine();
   auto _mesh  = static_cast<Mesh*>(mesh);
@@ -620,9 +620,11 @@ void MaterialHelper::BindFogParameters(Scene* scene, AbstractMesh* mesh,
 {
   if (scene->fogEnabled() && mesh->applyFog()
       && scene->fogMode() != Scene::FOGMODE_NONE) {
-    effect->setFloat4("vFogInfos", static_cast<float>(scene->fogMode()),
+    static const UniformName vFogInfos{"vFogInfos"};
+    static const UniformName vFogColor{"vFogColor"};
+    effect->setFloat4(vFogInfos, static_cast<float>(scene->fogMode()),
                       scene->fogStart, scene->fogEnd, scene->fogDensity);
-    effect->setColor3("vFogColor", scene->fogColor);
+    effect->setColor3(vFogColor, scene->fogColor);
   }
 }
 
@@ -641,7 +643,8 @@ void MaterialHelper::BindBonesParameters(AbstractMesh* mesh, Effect* effect)
     const auto& matrices = mesh->skeleton()->getTransformMatrices(mesh);
 
     if (!matrices.empty()) {
-      effect->setMatrices("mBones", matrices);
+      static const UniformName mBones{"mBones"};
+      effect->setMatrices(mBones, matrices);
     }
   }
 }
@@ -656,7 +659,8 @@ void MaterialHelper::BindMorphTargetParameters(AbstractMesh* abstractMesh,
       return;
     }
 
-    effect->setFloatArray("morphTargetInfluences", manager->influences());
+    static const UniformName morphTargetInfluences{"morphTargetInfluences"};
+    effect->setFloatArray(morphTargetInfluences, manager->influences());
   }
 }
 
@@ -664,32 +668,38 @@ void MaterialHelper::BindLogDepth(MaterialDefines& defines, Effect* effect,
                                   Scene* scene)
 {
   if (defines["LOGARITHMICDEPTH"]) {
+    static const UniformName logarithmicDepthConstant{
+      "logarithmicDepthConstant"};
     effect->setFloat(
-      "logarithmicDepthConstant",
+      logarithmicDepthConstant,
       2.f / (std::log(scene->activeCamera->maxZ + 1.f) / Math::LN2));
   }
 }
 
 void MaterialHelper::BindClipPlane(Effect* effect, Scene* scene)
 {
+  static const UniformName vClipPlane{"vClipPlane"};
+  static const UniformName vClipPlane2{"vClipPlane2"};
+  static const UniformName vClipPlane3{"vClipPlane3"};
+  static const UniformName vClipPlane4{"vClipPlane4"};
   if (scene->clipPlane) {
     const auto& clipPlane = *scene->clipPlane;
-    effect->setFloat4("vClipPlane", clipPlane.normal.x, clipPlane.normal.y,
+    effect->setFloat4(vClipPlane, clipPlane.normal.x, clipPlane.normal.y,
                       clipPlane.normal.z, clipPlane.d);
   }
   if (scene->clipPlane2) {
     const auto& clipPlane = *scene->clipPlane2;
-    effect->setFloat4("vClipPlane2", clipPlane.normal.x, clipPlane.normal.y,
+    effect->setFloat4(vClipPlane2, clipPlane.normal.x, clipPlane.normal.y,
                       clipPlane.normal.z, clipPlane.d);
   }
   if (scene->clipPlane3) {
     const auto& clipPlane = *scene->clipPlane3;
-    effect->setFloat4("vClipPlane3", clipPlane.normal.x, clipPlane.normal.y,
+    effect->setFloat4(vClipPlane3, clipPlane.normal.x, clipPlane.normal.y,
                       clipPlane.normal.z, clipPlane.d);
   }
   if (scene->clipPlane4) {
     const auto& clipPlane = *scene->clipPlane4;
-    effect->setFloat4("vClipPlane4", clipPlane.normal.x, clipPlane.normal.y,
+    effect->setFloat4(vClipPlane4, clipPlane.normal.x, clipPlane.normal.y,
                       clipPlane.normal.z, clipPlane.d);
   }
 }
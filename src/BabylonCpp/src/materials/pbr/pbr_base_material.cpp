@@ -1016,7 +1016,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
   if (!definesTmp) {
     return;
   }
-  auto defines = *definesTmp;
+  auto& defines = *definesTmp;
 
   auto effect = subMesh->effect();
   if (!effect) {
@@ -1052,8 +1052,9 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
       // Texture uniforms
       if (scene->texturesEnabled()) {
         if (_albedoTexture && StandardMaterial::DiffuseTextureEnabled()) {
+          static const UniformName vAlbedoInfos{"vAlbedoInfos"};
           _uniformBuffer->updateFloat2(
-            "vAlbedoInfos",
+            vAlbedoInfos,
             static_cast<float>(_albedoTexture->coordinatesIndex),
             static_cast<float>(_albedoTexture->level), "");
           MaterialHelper::BindTextureMatrix(*_albedoTexture, *_uniformBuffer,
@@ -1061,8 +1062,9 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
         }
 
         if (_ambientTexture && StandardMaterial::AmbientTextureEnabled()) {
+          static const UniformName vAmbientInfos{"vAmbientInfos"};
           _uniformBuffer->updateFloat4(
-            "vAmbientInfos",
+            vAmbientInfos,
             static_cast<float>(_ambientTexture->coordinatesIndex),
             static_cast<float>(_ambientTexture->level), _ambientTextureStrength,
             static_cast<float>(_ambientTextureImpactOnAnalyticalLights), "");
@@ -1071,8 +1073,9 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
         }
 
         if (_opacityTexture && StandardMaterial::OpacityTextureEnabled()) {
+          static const UniformName vOpacityInfos{"vOpacityInfos"};
           _uniformBuffer->updateFloat2(
-            "vOpacityInfos",
+            vOpacityInfos,
             static_cast<float>(_opacityTexture->coordinatesIndex),
             static_cast<float>(_opacityTexture->level), "");
           MaterialHelper::BindTextureMatrix(*_opacityTexture, *_uniformBuffer,
@@ -1080,18 +1083,23 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
         }
 
         if (reflectionTexture && StandardMaterial::ReflectionTextureEnabled()) {
+          static const UniformName reflectionMatrix{"reflectionMatrix"};
+          static const UniformName vReflectionInfos{"vReflectionInfos"};
           _uniformBuffer->updateMatrix(
-            "reflectionMatrix",
+            reflectionMatrix,
             *reflectionTexture->getReflectionTextureMatrix());
-          _uniformBuffer->updateFloat2("vReflectionInfos",
+          _uniformBuffer->updateFloat2(vReflectionInfos,
                                        reflectionTexture->level, 0, "");
 
           if (reflectionTexture->boundingBoxSize()) {
             if (auto cubeTexture
                 = std::static_pointer_cast<CubeTexture>(reflectionTexture)) {
-              _uniformBuffer->updateVector3("vReflectionPosition",
+              static const UniformName vReflectionPosition{
+                "vReflectionPosition"};
+              static const UniformName vReflectionSize{"vReflectionSize"};
+              _uniformBuffer->updateVector3(vReflectionPosition,
                                             cubeTexture->boundingBoxPosition);
-              _uniformBuffer->updateVector3("vReflectionSize",
+              _uniformBuffer->updateVector3(vReflectionSize,
                                             *cubeTexture->boundingBoxSize());
             }
           }
@@ -1099,40 +1107,52 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
           auto _polynomials = reflectionTexture->sphericalPolynomial();
           if (defines["USESPHERICALFROMREFLECTIONMAP"] && _polynomials) {
             auto polynomials = *_polynomials;
-            _activeEffect->setFloat3("vSphericalX", polynomials.x.x,
+            static const UniformName vSphericalX{"vSphericalX"};
+            static const UniformName vSphericalY{"vSphericalY"};
+            static const UniformName vSphericalZ{"vSphericalZ"};
+            static const UniformName vSphericalXX_ZZ{"vSphericalXX_ZZ"};
+            static const UniformName vSphericalYY_ZZ{"vSphericalYY_ZZ"};
+            static const UniformName vSphericalZZ{"vSphericalZZ"};
+            static const UniformName vSphericalXY{"vSphericalXY"};
+            static const UniformName vSphericalYZ{"vSphericalYZ"};
+            static const UniformName vSphericalZX{"vSphericalZX"};
+            _activeEffect->setFloat3(vSphericalX, polynomials.x.x,
                                      polynomials.x.y, polynomials.x.z);
-            _activeEffect->setFloat3("vSphericalY", polynomials.y.x,
+            _activeEffect->setFloat3(vSphericalY, polynomials.y.x,
                                      polynomials.y.y, polynomials.y.z);
-            _activeEffect->setFloat3("vSphericalZ", polynomials.z.x,
+            _activeEffect->setFloat3(vSphericalZ, polynomials.z.x,
                                      polynomials.z.y, polynomials.z.z);
-            _activeEffect->setFloat3("vSphericalXX_ZZ",
+            _activeEffect->setFloat3(vSphericalXX_ZZ,
                                      polynomials.xx.x - polynomials.zz.x,
                                      polynomials.xx.y - polynomials.zz.y,
                                      polynomials.xx.z - polynomials.zz.z);
-            _activeEffect->setFloat3("vSphericalYY_ZZ",
+            _activeEffect->setFloat3(vSphericalYY_ZZ,
                                      polynomials.yy.x - polynomials.zz.x,
                                      polynomials.yy.y - polynomials.zz.y,
                                      polynomials.yy.z - polynomials.zz.z);
-            _activeEffect->setFloat3("vSphericalZZ", polynomials.zz.x,
+            _activeEffect->setFloat3(vSphericalZZ, polynomials.zz.x,
                                      polynomials.zz.y, polynomials.zz.z);
-            _activeEffect->setFloat3("vSphericalXY", polynomials.xy.x,
+            _activeEffect->setFloat3(vSphericalXY, polynomials.xy.x,
                                      polynomials.xy.y, polynomials.xy.z);
-            _activeEffect->setFloat3("vSphericalYZ", polynomials.yz.x,
+            _activeEffect->setFloat3(vSphericalYZ, polynomials.yz.x,
                                      polynomials.yz.y, polynomials.yz.z);
-            _activeEffect->setFloat3("vSphericalZX", polynomials.zx.x,
+            _activeEffect->setFloat3(vSphericalZX, polynomials.zx.x,
                                      polynomials.zx.y, polynomials.zx.z);
           }
 
+          static const UniformName vReflectionMicrosurfaceInfos{
+            "vReflectionMicrosurfaceInfos"};
           _uniformBuffer->updateFloat3(
-            "vReflectionMicrosurfaceInfos",
+            vReflectionMicrosurfaceInfos,
             static_cast<float>(reflectionTexture->getSize().width),
             reflectionTexture->lodGenerationScale,
             reflectionTexture->lodGenerationOffset, "");
         }
 
         if (_emissiveTexture && StandardMaterial::EmissiveTextureEnabled()) {
+          static const UniformName vEmissiveInfos{"vEmissiveInfos"};
           _uniformBuffer->updateFloat2(
-            "vEmissiveInfos",
+            vEmissiveInfos,
             static_cast<float>(_emissiveTexture->coordinatesIndex),
             static_cast<float>(_emissiveTexture->level), "");
           MaterialHelper::BindTextureMatrix(*_emissiveTexture, *_uniformBuffer,
@@ -1140,8 +1160,9 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
         }
 
         if (_lightmapTexture && StandardMaterial::LightmapTextureEnabled()) {
+          static const UniformName vLightmapInfos{"vLightmapInfos"};
           _uniformBuffer->updateFloat2(
-            "vLightmapInfos",
+            vLightmapInfos,
             static_cast<float>(_lightmapTexture->coordinatesIndex),
             static_cast<float>(_lightmapTexture->level), "");
           MaterialHelper::BindTextureMatrix(*_lightmapTexture, *_uniformBuffer,
@@ -1150,8 +1171,9 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
 
         if (StandardMaterial::SpecularTextureEnabled()) {
           if (_metallicTexture) {
+            static const UniformName vReflectivityInfos{"vReflectivityInfos"};
             _uniformBuffer->updateFloat3(
-              "vReflectivityInfos",
+              vReflectivityInfos,
               static_cast<float>(_metallicTexture->coordinatesIndex),
               static_cast<float>(_metallicTexture->level),
               _ambientTextureStrength, "");
@@ -1159,8 +1181,9 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
                                               *_uniformBuffer, "reflectivity");
           }
           else if (_reflectivityTexture) {
+            static const UniformName vReflectivityInfos{"vReflectivityInfos"};
             _uniformBuffer->updateFloat3(
-              "vReflectivityInfos",
+              vReflectivityInfos,
               static_cast<float>(_reflectivityTexture->coordinatesIndex),
               static_cast<float>(_reflectivityTexture->level), 1.f, "");
             MaterialHelper::BindTextureMatrix(*_reflectivityTexture,
@@ -1168,8 +1191,10 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
           }
 
           if (_microSurfaceTexture) {
+            static const UniformName vMicroSurfaceSamplerInfos{
+              "vMicroSurfaceSamplerInfos"};
             _uniformBuffer->updateFloat2(
-              "vMicroSurfaceSamplerInfos",
+              vMicroSurfaceSamplerInfos,
               static_cast<float>(_microSurfaceTexture->coordinatesIndex),
               static_cast<float>(_microSurfaceTexture->level), "");
             MaterialHelper::BindTextureMatrix(
@@ -1179,26 +1204,30 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
 
         if (_bumpTexture && scene->getEngine()->getCaps().standardDerivatives
             && StandardMaterial::BumpTextureEnabled() && !_disableBumpMap) {
+          static const UniformName vBumpInfos{"vBumpInfos"};
           _uniformBuffer->updateFloat3(
-            "vBumpInfos", static_cast<float>(_bumpTexture->coordinatesIndex),
+            vBumpInfos, static_cast<float>(_bumpTexture->coordinatesIndex),
             static_cast<float>(_bumpTexture->level), _parallaxScaleBias, "");
           MaterialHelper::BindTextureMatrix(*_bumpTexture, *_uniformBuffer,
                                             "bump");
           if (scene->_mirroredCameraPosition) {
-            _uniformBuffer->updateFloat2("vTangentSpaceParams",
+            static const UniformName vTangentSpaceParams{"vTangentSpaceParams"};
+            _uniformBuffer->updateFloat2(vTangentSpaceParams,
                                          _invertNormalMapX ? 1.f : -1.f,
                                          _invertNormalMapY ? 1.f : -1.f, "");
           }
           else {
-            _uniformBuffer->updateFloat2("vTangentSpaceParams",
+            static const UniformName vTangentSpaceParams{"vTangentSpaceParams"};
+            _uniformBuffer->updateFloat2(vTangentSpaceParams,
                                          _invertNormalMapX ? -1.f : 1.f,
                                          _invertNormalMapY ? -1.f : 1.f, "");
           }
         }
 
         if (refractionTexture && StandardMaterial::RefractionTextureEnabled()) {
+          static const UniformName refractionMatrix{"refractionMatrix"};
           _uniformBuffer->updateMatrix(
-            "refractionMatrix",
+            refractionMatrix,
             *refractionTexture->getReflectionTextureMatrix());
 
           float depth = 1.f;
@@ -1209,11 +1238,14 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
               depth = refractionTextureTmp->depth;
             }
           }
+          static const UniformName vRefractionInfos{"vRefractionInfos"};
+          static const UniformName vRefractionMicrosurfaceInfos{
+            "vRefractionMicrosurfaceInfos"};
           _uniformBuffer->updateFloat4(
-            "vRefractionInfos", refractionTexture->level, _indexOfRefraction,
+            vRefractionInfos, refractionTexture->level, _indexOfRefraction,
             depth, _invertRefractionY ? -1.f : 1.f, "");
           _uniformBuffer->updateFloat3(
-            "vRefractionMicrosurfaceInfos",
+            vRefractionMicrosurfaceInfos,
             static_cast<float>(refractionTexture->getSize().width),
             refractionTexture->lodGenerationScale,
             refractionTexture->lodGenerationOffset, "");
@@ -1222,7 +1254,8 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
 
       // Point size
       if (pointsCloud()) {
-        _uniformBuffer->updateFloat("pointSize", pointSize);
+        static const UniformName pointSizeName{"pointSize"};
+        _uniformBuffer->updateFloat(pointSizeName, pointSize);
       }
 
       // Colors
@@ -1231,17 +1264,22 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
           = (!_metallic.has_value()) ? 1 : *_metallic;
         PBRMaterial::_scaledReflectivity.g
           = (!_roughness.has_value()) ? 1 : *_roughness;
-        _uniformBuffer->updateColor4("vReflectivityColor",
+        static const UniformName vReflectivityColor{"vReflectivityColor"};
+        _uniformBuffer->updateColor4(vReflectivityColor,
                                      PBRMaterial::_scaledReflectivity, 0, "");
       }
       else {
-        _uniformBuffer->updateColor4("vReflectivityColor", _reflectivityColor,
+        static const UniformName vReflectivityColor{"vReflectivityColor"};
+        _uniformBuffer->updateColor4(vReflectivityColor, _reflectivityColor,
                                      _microSurface, "");
       }
 
-      _uniformBuffer->updateColor3("vEmissiveColor", _emissiveColor, "");
-      _uniformBuffer->updateColor3("vReflectionColor", _reflectionColor, "");
-      _uniformBuffer->updateColor4("vAlbedoColor", _albedoColor,
+      static const UniformName vEmissiveColor{"vEmissiveColor"};
+      static const UniformName vReflectionColor{"vReflectionColor"};
+      static const UniformName vAlbedoColor{"vAlbedoColor"};
+      _uniformBuffer->updateColor3(vEmissiveColor, _emissiveColor, "");
+      _uniformBuffer->updateColor3(vReflectionColor, _reflectionColor, "");
+      _uniformBuffer->updateColor4(vAlbedoColor, _albedoColor,
                                    alpha() * mesh->visibility(), "");
 
       // Misc
@@ -1250,7 +1288,8 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
       _lightingInfos.z = _environmentIntensity;
       _lightingInfos.w = _specularIntensity;
 
-      _uniformBuffer->updateVector4("vLightingIntensity", _lightingInfos);
+      static const UniformName vLightingIntensity{"vLightingIntensity"};
+      _uniformBuffer->updateVector4(vLightingIntensity, _lightingInfos);
     }
 
     // Textures
@@ -1354,9 +1393,11 @@ void PBRBaseMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
                             scene->activeCamera->globalPosition());
     auto invertNormal = (scene->useRightHandedSystem()
                          == (scene->_mirroredCameraPosition != nullptr));
-    effect->setFloat4("vEyePosition", eyePosition.x, eyePosition.y,
+    static const UniformName vEyePosition{"vEyePosition"};
+    static const UniformName vAmbientColor{"vAmbientColor"};
+    effect->setFloat4(vEyePosition, eyePosition.x, eyePosition.y,
                       eyePosition.z, invertNormal ? -1.f : 1.f);
-    effect->setColor3("vAmbientColor", _globalAmbientColor);
+    effect->setColor3(vAmbientColor, _globalAmbientColor);
   }
 
   if (mustRebind || !isFrozen()) {
@@ -2,9 +2,22 @@
 
 namespace BABYLON {
 
-PBRMaterialDefines::PBRMaterialDefines() : MaterialDefines{}
+PBRMaterialDefines::PBRMaterialDefines() : MaterialDefines{_Layout()}
 {
-  boolDef = {
+}
+
+const MaterialDefinesLayout& PBRMaterialDefines::_Layout()
+{
+  // The defines are registered once
+  static const auto layout = _CreateLayout();
+  return layout;
+}
+
+MaterialDefinesLayout PBRMaterialDefines::_CreateLayout()
+{
+  MaterialDefinesLayout layout;
+
+  layout.boolDef = {
     {"PBR", true}, //
 
     {"MAINUV1", false}, //
@@ -133,7 +146,7 @@ PBRMaterialDefines::PBRMaterialDefines() : MaterialDefines{}
     {"UNLIT", false}, //
   };
 
-  intDef = {
+  layout.intDef = {
     {"AMBIENTDIRECTUV", 0},         //
     {"ALBEDODIRECTUV", 0},          //
     {"OPACITYDIRECTUV", 0},         //
@@ -147,11 +160,12 @@ PBRMaterialDefines::PBRMaterialDefines() : MaterialDefines{}
     {"NUM_MORPH_INFLUENCERS", 0},   //
   };
 
-  floatDef = {
+  layout.floatDef = {
     {"ALPHATESTVALUE", 0.5f}, //
   };
 
-} // namespace BABYLON
+  return layout;
+}
 
 PBRMaterialDefines::~PBRMaterialDefines()
 {
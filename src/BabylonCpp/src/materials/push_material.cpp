@@ -47,12 +47,14 @@ bool PushMaterial::isReady(AbstractMesh* mesh, bool useInstances)
 
 void PushMaterial::bindOnlyWorldMatrix(Matrix& world)
 {
-  _activeEffect->setMatrix("world", world);
+  static const UniformName worldName{"world"};
+  _activeEffect->setMatrix(worldName, world);
 }
 
 void PushMaterial::bindOnlyNormalMatrix(Matrix& normalMatrix)
 {
-  _activeEffect->setMatrix("normalMatrix", normalMatrix);
+  static const UniformName normalMatrixName{"normalMatrix"};
+  _activeEffect->setMatrix(normalMatrixName, normalMatrix);
 }
 
 void PushMaterial::bind(Matrix* world, Mesh* mesh)
@@ -0,0 +1,512 @@
+#include <babylon/materials/shader_processor.h>
+
+#include <algorithm>
+#include <cctype>
+#include <mutex>
+#include <vector>
+
+#include <babylon/core/string.h>
+#include <babylon/materials/effect.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Processed shaders and expanded includes.
+ */
+struct ShaderProcessorCache {
+  std::mutex mutex;
+  std::unordered_map<std::string, std::string> includes;
+  std::unordered_map<std::string, std::string> sources;
+
+  static ShaderProcessorCache& Instance()
+  {
+    static ShaderProcessorCache cache;
+    return cache;
+  }
+}; // end of struct ShaderProcessorCache
+
+std::string ShaderProcessor::Process(std::string_view sourceCode,
+                                     const ShaderProcessingOptions& options)
+{
+  // The key holds the options, with the index parameters sorted, followed by
+  // the source code
+  std::vector<std::pair<std::string, unsigned int>> indexParameters(
+    options.indexParameters.begin(), options.indexParameters.end());
+  std::sort(indexParameters.begin(), indexParameters.end());
+  std::string key{options.isFragment ? 'f' : 'v',
+                  options.supportsUniformBuffers ? 'u' : '-',
+                  options.highPrecisionShaderSupported ? 'h' : 'm',
+                  options.convertToGLSL300 ? '3' : '1'};
+  for (const auto& parameter : indexParameters) {
+    key += parameter.first + "=" + std::to_string(parameter.second) + ";";
+  }
+  key += '\0';
+  key += sourceCode;
+
+  auto& cache = ShaderProcessorCache::Instance();
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    const auto it = cache.sources.find(key);
+    if (it != cache.sources.end()) {
+      return it->second;
+    }
+  }
+
+  auto processedCode = ProcessPrecision(ProcessIncludes(sourceCode, options),
+                                        options.highPrecisionShaderSupported);
+  if (options.convertToGLSL300) {
+    processedCode = ConvertToGLSL300(processedCode, options.isFragment);
+  }
+
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.sources.emplace(std::move(key), processedCode);
+  return processedCode;
+}
+
+std::string
+ShaderProcessor::ProcessIncludes(std::string_view sourceCode,
+                                 const ShaderProcessingOptions& options)
+{
+  static const std::string includeToken{"#include<"};
+
+  std::string result;
+  result.reserve(sourceCode.size() + 1);
+
+  size_t lineStart = 0;
+  while (true) {
+    const auto newLine = sourceCode.find('\n', lineStart);
+    const auto lineEnd
+      = (newLine == std::string::npos) ? sourceCode.size() : newLine;
+
+    // The include name ends with the last '>' of the line, the substitutions
+    // and the index with the last ')' and ']', a '\r' ends the directive
+    auto begin   = sourceCode.find(includeToken, lineStart);
+    auto nameEnd = std::string::npos;
+    auto limit   = lineEnd;
+    while (begin < lineEnd) {
+      limit   = std::min(sourceCode.find('\r', begin), lineEnd);
+      nameEnd = sourceCode.rfind('>', limit - 1);
+      if (nameEnd != std::string::npos
+          && nameEnd > begin + includeToken.size()) {
+        break;
+      }
+      begin = sourceCode.find(includeToken, begin + 1);
+    }
+
+    if (begin >= lineEnd) {
+      result.append(sourceCode, lineStart, lineEnd - lineStart);
+      result += '\n';
+    }
+    else {
+      const auto nameBegin = begin + includeToken.size();
+      std::string includeFile{
+        sourceCode.substr(nameBegin, nameEnd - nameBegin)};
+      auto end = nameEnd + 1;
+
+      std::string substitutions;
+      if (end < limit && sourceCode[end] == '(') {
+        const auto close = sourceCode.rfind(')', limit - 1);
+        if (close != std::string::npos && close > end) {
+          substitutions = sourceCode.substr(end + 1, close - end - 1);
+          end           = close + 1;
+        }
+      }
+
+      bool hasIndex = false;
+      std::string index;
+      if (end < limit && sourceCode[end] == '[') {
+        const auto close = sourceCode.rfind(']', limit - 1);
+        if (close != std::string::npos && close > end) {
+          hasIndex = true;
+          index    = sourceCode.substr(end + 1, close - end - 1);
+          end      = close + 1;
+        }
+      }
+
+      // Uniform declaration
+      if (String::contains(includeFile, "__decl__")) {
+        String::replaceInPlace(includeFile, "__decl__", "");
+        if (options.supportsUniformBuffers) {
+          String::replaceInPlace(includeFile, "Vertex", "Ubo");
+          String::replaceInPlace(includeFile, "Fragment", "Ubo");
+        }
+        includeFile += "Declaration";
+      }
+
+      if (!Effect::GetIncludeShader(includeFile).empty()) {
+        // The index parameters are resolved here, the expanded includes do
+        // not depend on them
+        if (String::contains(index, "..")) {
+          auto range = index;
+          String::replaceInPlace(range, "..", ".");
+          const auto bounds = String::split(range, '.');
+          if (bounds.size() == 2 && !_IsInteger(bounds[1])) {
+            const auto it = options.indexParameters.find(bounds[1]);
+            if (it != options.indexParameters.end()) {
+              index = bounds[0] + ".." + std::to_string(it->second);
+            }
+          }
+        }
+
+        // Replace
+        std::string line{sourceCode.substr(lineStart, lineEnd - lineStart)};
+        String::replaceInPlace(
+          line, std::string{sourceCode.substr(begin, end - begin)},
+          _ExpandInclude(includeFile, substitutions, hasIndex, index,
+                         options.supportsUniformBuffers));
+        result += line;
+        result += '\n';
+      }
+    }
+
+    if (newLine == std::string::npos) {
+      break;
+    }
+    lineStart = newLine + 1;
+  }
+
+  return result;
+}
+
+std::string ShaderProcessor::ProcessPrecision(std::string sourceCode,
+                                              bool highPrecisionShaderSupported)
+{
+  if (!String::contains(sourceCode, "precision highp float")
+      && !String::contains(sourceCode, "precision mediump float")) {
+    if (!highPrecisionShaderSupported) {
+      sourceCode = "precision mediump float;\n" + sourceCode;
+    }
+    else {
+      sourceCode = "precision highp float;\n" + sourceCode;
+    }
+  }
+  else {
+    if (!highPrecisionShaderSupported) {
+      // Moving highp to mediump
+      String::replaceInPlace(sourceCode, "precision highp float",
+                             "precision mediump float");
+    }
+  }
+
+  // Add GL_ES define
+  // -- precision mediump float
+  const std::string mediump{"#ifdef GL_ES\nprecision mediump float;\n#endif\n"};
+  if (String::contains(sourceCode, "precision mediump float;")
+      && !String::contains(sourceCode, mediump)) {
+    String::replaceInPlace(sourceCode, "precision mediump float;", mediump);
+  }
+
+  // -- precision highp float
+  const std::string highp{"#ifdef GL_ES\nprecision highp float;\n#endif\n"};
+  if (String::contains(sourceCode, "precision highp float;")
+      && !String::contains(sourceCode, highp)) {
+    String::replaceInPlace(sourceCode, "precision highp float;", highp);
+  }
+
+  return sourceCode;
+}
+
+std::string ShaderProcessor::ConvertToGLSL300(const std::string& sourceCode,
+                                              bool isFragment)
+{
+  // Already converted
+  if (String::contains(sourceCode, "#version 3")) {
+    auto result = sourceCode;
+    String::replaceInPlace(result, "#version 300 es", "");
+    return result;
+  }
+
+  const auto hasDrawBuffersExtension
+    = String::contains(sourceCode, "#extension.+GL_EXT_draw_buffers.+require");
+
+  // Remove extensions
+  auto result = _RemoveExtensions(sourceCode);
+
+  // Migrate to GLSL v300
+  result = _ReplaceAll(
+    result, "varying",
+    [](const std::string& code, size_t pos) {
+      return (pos < code.size()
+              && (code[pos] == ' ' || code[pos] == '\t' || code[pos] == '\v'
+                  || code[pos] == '\f')) ?
+               pos + 1 :
+               std::string::npos;
+    },
+    isFragment ? "in " : "out ");
+  result = _ReplaceAll(result, "attribute",
+                       [](const std::string& code, size_t pos) {
+                         return (pos < code.size()
+                                 && (code[pos] == ' ' || code[pos] == '\t')) ?
+                                  pos + 1 :
+                                  std::string::npos;
+                       },
+                       "in ");
+  String::replaceInPlace(result, " attribute", " in");
+  String::replaceInPlace(result, "\tattribute", " in");
+
+  if (isFragment) {
+    // Function name followed by the opening parenthesis
+    const auto call = [](const std::string& code, size_t pos) {
+      pos = _SkipWhitespaces(code, pos);
+      return (pos < code.size() && code[pos] == '(') ? pos + 1 :
+                                                       std::string::npos;
+    };
+    result = _ReplaceAll(result, "texture2DLodEXT", call, "textureLod(");
+    result = _ReplaceAll(result, "textureCubeLodEXT", call, "textureLod(");
+    result = _ReplaceAll(result, "texture2D", call, "texture(");
+    result = _ReplaceAll(result, "textureCube", call, "texture(");
+    String::replaceInPlace(result, "gl_FragDepthEXT", "gl_FragDepth");
+    String::replaceInPlace(result, "gl_FragColor", "glFragColor");
+    String::replaceInPlace(result, "gl_FragData", "glFragData");
+    result = _ReplaceAll(
+      result, "void",
+      [&call](const std::string& code, size_t pos) {
+        const auto next = _SkipWhitespaces(code, pos);
+        if (next == pos || code.compare(next, 4, "main") != 0) {
+          return std::string::npos;
+        }
+        return call(code, next + 4);
+      },
+      String::concat((hasDrawBuffersExtension ? "" : "out vec4 glFragColor;\n"),
+                     "void main("));
+  }
+
+  return result;
+}
+
+size_t ShaderProcessor::CacheSize()
+{
+  auto& cache = ShaderProcessorCache::Instance();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  return cache.sources.size();
+}
+
+void ShaderProcessor::ClearCache()
+{
+  auto& cache = ShaderProcessorCache::Instance();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.includes.clear();
+  cache.sources.clear();
+}
+
+std::string ShaderProcessor::_ExpandInclude(const std::string& includeName,
+                                            const std::string& substitutions,
+                                            bool hasIndex,
+                                            const std::string& index,
+                                            bool supportsUniformBuffers)
+{
+  std::string key{includeName};
+  key += '\0';
+  key += substitutions;
+  key += hasIndex ? '[' : '\0';
+  key += index;
+  key += supportsUniformBuffers ? 'u' : '-';
+
+  auto& cache = ShaderProcessorCache::Instance();
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    const auto it = cache.includes.find(key);
+    if (it != cache.includes.end()) {
+      return it->second;
+    }
+  }
+
+  std::string includeContent{Effect::GetIncludeShader(includeName)};
+
+  // Substitution
+  if (!substitutions.empty()) {
+    const auto splits = String::split(substitutions, ',');
+    for (size_t i = 0; i + 1 < splits.size(); i += 2) {
+      if (!splits[i].empty()) {
+        String::replaceInPlace(includeContent, splits[i], splits[i + 1]);
+      }
+    }
+  }
+
+  if (hasIndex) {
+    if (String::contains(index, "..")) {
+      auto range = index;
+      String::replaceInPlace(range, "..", ".");
+      const auto bounds = String::split(range, '.');
+      if (bounds.size() == 2) {
+        auto sourceIncludeContent = includeContent;
+        includeContent            = "";
+        if (_IsInteger(bounds[0]) && _IsInteger(bounds[1])) {
+          const size_t minIndex = std::stoul(bounds[0], nullptr, 0);
+          const size_t maxIndex = std::stoul(bounds[1], nullptr, 0);
+          for (size_t i = minIndex; i < maxIndex; ++i) {
+            if (!supportsUniformBuffers) {
+              sourceIncludeContent
+                = _ReplaceLightUniforms(sourceIncludeContent);
+            }
+            auto content = sourceIncludeContent;
+            String::replaceInPlace(content, "{X}", std::to_string(i));
+            includeContent += content + "\n";
+          }
+        }
+      }
+    }
+    else {
+      if (!supportsUniformBuffers) {
+        includeContent = _ReplaceLightUniforms(includeContent);
+      }
+      String::replaceInPlace(includeContent, "{X}", index);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.includes.emplace(std::move(key), includeContent);
+  return includeContent;
+}
+
+std::string ShaderProcessor::_ReplaceLightUniforms(const std::string& content)
+{
+  // Ubo replacement: "light{X}.member" => "member{X}"
+  static const std::string token{"light{X}"};
+
+  std::string result;
+  size_t last = 0;
+  auto pos    = content.find(token);
+  while (pos != std::string::npos) {
+    auto end = pos + token.size();
+    if (end < content.size() && content[end] != '\n' && content[end] != '\r') {
+      const auto memberBegin = ++end;
+      while (end < content.size()
+             && (std::isalnum(static_cast<unsigned char>(content[end]))
+                 || content[end] == '_')) {
+        ++end;
+      }
+      result.append(content, last, pos - last);
+      result.append(content, memberBegin, end - memberBegin);
+      result += "{X}";
+      last = end;
+      pos  = content.find(token, end);
+    }
+    else {
+      pos = content.find(token, pos + 1);
+    }
+  }
+  result.append(content, last, std::string::npos);
+
+  return result;
+}
+
+std::string ShaderProcessor::_RemoveExtensions(const std::string& sourceCode)
+{
+  // #extension GL_OES_standard_derivatives : enable
+  // #extension GL_EXT_shader_texture_lod : enable
+  // #extension GL_EXT_frag_depth : enable
+  // #extension GL_EXT_draw_buffers : require
+  static const std::string token{"#extension"};
+  static const std::vector<std::string> extensions{
+    "GL_OES_standard_derivatives", "GL_EXT_shader_texture_lod",
+    "GL_EXT_frag_depth", "GL_EXT_draw_buffers"};
+  static const std::vector<std::string> behaviors{"enable", "require"};
+
+  std::string result;
+  size_t last = 0;
+  auto pos    = sourceCode.find(token);
+  while (pos != std::string::npos) {
+    // The directive ends with the last behavior of the line
+    const auto lineEnd
+      = std::min(sourceCode.find_first_of("\n\r", pos), sourceCode.size());
+    auto behaviorBegin = std::string::npos;
+    auto behaviorEnd   = std::string::npos;
+    for (const auto& behavior : behaviors) {
+      if (lineEnd < pos + behavior.size()) {
+        continue;
+      }
+      const auto found = sourceCode.rfind(behavior, lineEnd - behavior.size());
+      if (found != std::string::npos
+          && (behaviorBegin == std::string::npos || found > behaviorBegin)) {
+        behaviorBegin = found;
+        behaviorEnd   = found + behavior.size();
+      }
+    }
+
+    // A supported extension is followed by at least one character
+    bool supported = false;
+    if (behaviorBegin != std::string::npos) {
+      for (const auto& extension : extensions) {
+        const auto found = sourceCode.find(extension, pos + token.size() + 1);
+        if (found != std::string::npos
+            && found + extension.size() < behaviorBegin) {
+          supported = true;
+          break;
+        }
+      }
+    }
+
+    if (supported) {
+      result.append(sourceCode, last, pos - last);
+      last = behaviorEnd;
+      pos  = sourceCode.find(token, behaviorEnd);
+    }
+    else {
+      pos = sourceCode.find(token, pos + 1);
+    }
+  }
+  result.append(sourceCode, last, std::string::npos);
+
+  return result;
+}
+
+std::string ShaderProcessor::_ReplaceAll(
+  const std::string& sourceCode, const std::string& prefix,
+  const std::function<size_t(const std::string&, size_t)>& match,
+  const std::string& replacement)
+{
+  std::string result;
+  size_t last = 0;
+  auto pos    = sourceCode.find(prefix);
+  while (pos != std::string::npos) {
+    const auto end = match(sourceCode, pos + prefix.size());
+    if (end != std::string::npos) {
+      result.append(sourceCode, last, pos - last);
+      result += replacement;
+      last = end;
+      pos  = sourceCode.find(prefix, end);
+    }
+    else {
+      pos = sourceCode.find(prefix, pos + 1);
+    }
+  }
+  result.append(sourceCode, last, std::string::npos);
+
+  return result;
+}
+
+size_t ShaderProcessor::_SkipWhitespaces(const std::string& sourceCode,
+                                         size_t pos)
+{
+  while (pos < sourceCode.size()
+         && std::isspace(static_cast<unsigned char>(sourceCode[pos]))) {
+    ++pos;
+  }
+  return pos;
+}
+
+bool ShaderProcessor::_IsInteger(const std::string& value)
+{
+  // First word of the value, optionally signed
+  auto pos = _SkipWhitespaces(value, 0);
+  auto end = pos;
+  while (end < value.size()
+         && !std::isspace(static_cast<unsigned char>(value[end]))) {
+    ++end;
+  }
+  if (pos < end && value[pos] == '-') {
+    ++pos;
+  }
+  if (pos == end) {
+    return false;
+  }
+  for (; pos < end; ++pos) {
+    if (!std::isdigit(static_cast<unsigned char>(value[pos]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // end of namespace BABYLON
@@ -1037,7 +1037,7 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
   if (!definesTmp) {
     return;
   }
-  auto defines = *definesTmp;
+  auto& defines = *definesTmp;
 
   auto effect = subMesh->effect();
   if (!effect) {
@@ -1068,18 +1068,21 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
         // Fresnel
         if (_diffuseFresnelParameters
             && _diffuseFresnelParameters->isEnabled()) {
-          _uniformBuffer->updateColor4("diffuseLeftColor",
+          static const UniformName diffuseLeftColor{"diffuseLeftColor"};
+          static const UniformName diffuseRightColor{"diffuseRightColor"};
+          _uniformBuffer->updateColor4(diffuseLeftColor,
                                        _diffuseFresnelParameters->leftColor,
                                        _diffuseFresnelParameters->power, "");
-          _uniformBuffer->updateColor4("diffuseRightColor",
+          _uniformBuffer->updateColor4(diffuseRightColor,
                                        _diffuseFresnelParameters->rightColor,
                                        _diffuseFresnelParameters->bias, "");
         }
 
         if (_opacityFresnelParameters
             && _opacityFresnelParameters->isEnabled()) {
+          static const UniformName opacityParts{"opacityParts"};
           _uniformBuffer->updateColor4(
-            "opacityParts",
+            opacityParts,
             Color3(_opacityFresnelParameters->leftColor.toLuminance(),
                    _opacityFresnelParameters->rightColor.toLuminance(),
                    _opacityFresnelParameters->bias),
@@ -1088,30 +1091,36 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
 
         if (_reflectionFresnelParameters
             && _reflectionFresnelParameters->isEnabled()) {
-          _uniformBuffer->updateColor4("reflectionLeftColor",
+          static const UniformName reflectionLeftColor{"reflectionLeftColor"};
+          static const UniformName reflectionRightColor{"reflectionRightColor"};
+          _uniformBuffer->updateColor4(reflectionLeftColor,
                                        _reflectionFresnelParameters->leftColor,
                                        _reflectionFresnelParameters->power, "");
-          _uniformBuffer->updateColor4("reflectionRightColor",
+          _uniformBuffer->updateColor4(reflectionRightColor,
                                        _reflectionFresnelParameters->rightColor,
                                        _reflectionFresnelParameters->bias, "");
         }
 
         if (_refractionFresnelParameters
             && _refractionFresnelParameters->isEnabled()) {
-          _uniformBuffer->updateColor4("refractionLeftColor",
+          static const UniformName refractionLeftColor{"refractionLeftColor"};
+          static const UniformName refractionRightColor{"refractionRightColor"};
+          _uniformBuffer->updateColor4(refractionLeftColor,
                                        _refractionFresnelParameters->leftColor,
                                        _refractionFresnelParameters->power, "");
-          _uniformBuffer->updateColor4("refractionRightColor",
+          _uniformBuffer->updateColor4(refractionRightColor,
                                        _refractionFresnelParameters->rightColor,
                                        _refractionFresnelParameters->bias, "");
         }
 
         if (_emissiveFresnelParameters
             && _emissiveFresnelParameters->isEnabled()) {
-          _uniformBuffer->updateColor4("emissiveLeftColor",
+          static const UniformName emissiveLeftColor{"emissiveLeftColor"};
+          static const UniformName emissiveRightColor{"emissiveRightColor"};
+          _uniformBuffer->updateColor4(emissiveLeftColor,
                                        _emissiveFresnelParameters->leftColor,
                                        _emissiveFresnelParameters->power, "");
-          _uniformBuffer->updateColor4("emissiveRightColor",
+          _uniformBuffer->updateColor4(emissiveRightColor,
                                        _emissiveFresnelParameters->rightColor,
                                        _emissiveFresnelParameters->bias, "");
         }
@@ -1120,21 +1129,24 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
       // Textures
       if (scene->texturesEnabled()) {
         if (_diffuseTexture && StandardMaterial::DiffuseTextureEnabled()) {
+          static const UniformName vDiffuseInfos{"vDiffuseInfos"};
           _uniformBuffer->updateFloat2(
-            "vDiffuseInfos",
+            vDiffuseInfos,
             static_cast<float>(_diffuseTexture->coordinatesIndex),
             static_cast<float>(_diffuseTexture->level), "");
           MaterialHelper::BindTextureMatrix(*_diffuseTexture, *_uniformBuffer,
                                             "diffuse");
 
           if (_diffuseTexture->hasAlpha()) {
-            effect->setFloat("alphaCutOff", alphaCutOff);
+            static const UniformName alphaCutOffName{"alphaCutOff"};
+            effect->setFloat(alphaCutOffName, alphaCutOff);
           }
         }
 
         if (_ambientTexture && StandardMaterial::AmbientTextureEnabled()) {
+          static const UniformName vAmbientInfos{"vAmbientInfos"};
           _uniformBuffer->updateFloat2(
-            "vAmbientInfos",
+            vAmbientInfos,
             static_cast<float>(_ambientTexture->coordinatesIndex),
             static_cast<float>(_ambientTexture->level), "");
           MaterialHelper::BindTextureMatrix(*_ambientTexture, *_uniformBuffer,
@@ -1142,8 +1154,9 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
         }
 
         if (_opacityTexture && StandardMaterial::OpacityTextureEnabled()) {
+          static const UniformName vOpacityInfos{"vOpacityInfos"};
           _uniformBuffer->updateFloat2(
-            "vOpacityInfos",
+            vOpacityInfos,
             static_cast<float>(_opacityTexture->coordinatesIndex),
             static_cast<float>(_opacityTexture->level), "");
           MaterialHelper::BindTextureMatrix(*_opacityTexture, *_uniformBuffer,
@@ -1152,26 +1165,32 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
 
         if (_reflectionTexture
             && StandardMaterial::ReflectionTextureEnabled()) {
+          static const UniformName vReflectionInfos{"vReflectionInfos"};
+          static const UniformName reflectionMatrix{"reflectionMatrix"};
           _uniformBuffer->updateFloat2(
-            "vReflectionInfos", _reflectionTexture->level, _roughness, "");
+            vReflectionInfos, _reflectionTexture->level, _roughness, "");
           _uniformBuffer->updateMatrix(
-            "reflectionMatrix",
+            reflectionMatrix,
             *_reflectionTexture->getReflectionTextureMatrix());
 
           if (_reflectionTexture->boundingBoxSize()) {
             if (auto cubeTexture
                 = std::static_pointer_cast<CubeTexture>(_reflectionTexture)) {
-              _uniformBuffer->updateVector3("vReflectionPosition",
+              static const UniformName vReflectionPosition{
+                "vReflectionPosition"};
+              static const UniformName vReflectionSize{"vReflectionSize"};
+              _uniformBuffer->updateVector3(vReflectionPosition,
                                             cubeTexture->boundingBoxPosition);
-              _uniformBuffer->updateVector3("vReflectionSize",
+              _uniformBuffer->updateVector3(vReflectionSize,
                                             *cubeTexture->boundingBoxSize());
             }
           }
         }
 
         if (_emissiveTexture && StandardMaterial::EmissiveTextureEnabled()) {
+          static const UniformName vEmissiveInfos{"vEmissiveInfos"};
           _uniformBuffer->updateFloat2(
-            "vEmissiveInfos",
+            vEmissiveInfos,
             static_cast<float>(_emissiveTexture->coordinatesIndex),
             static_cast<float>(_emissiveTexture->level), "");
           MaterialHelper::BindTextureMatrix(*_emissiveTexture, *_uniformBuffer,
@@ -1179,8 +1198,9 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
         }
 
         if (_lightmapTexture && StandardMaterial::LightmapTextureEnabled()) {
+          static const UniformName vLightmapInfos{"vLightmapInfos"};
           _uniformBuffer->updateFloat2(
-            "vLightmapInfos",
+            vLightmapInfos,
             static_cast<float>(_lightmapTexture->coordinatesIndex),
             static_cast<float>(_lightmapTexture->level), "");
           MaterialHelper::BindTextureMatrix(*_lightmapTexture, *_uniformBuffer,
@@ -1188,8 +1208,9 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
         }
 
         if (_specularTexture && StandardMaterial::SpecularTextureEnabled()) {
+          static const UniformName vSpecularInfos{"vSpecularInfos"};
           _uniformBuffer->updateFloat2(
-            "vSpecularInfos",
+            vSpecularInfos,
             static_cast<float>(_specularTexture->coordinatesIndex),
             static_cast<float>(_specularTexture->level), "");
           MaterialHelper::BindTextureMatrix(*_specularTexture, *_uniformBuffer,
@@ -1198,18 +1219,21 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
 
         if (_bumpTexture && scene->getEngine()->getCaps().standardDerivatives
             && StandardMaterial::BumpTextureEnabled()) {
+          static const UniformName vBumpInfos{"vBumpInfos"};
           _uniformBuffer->updateFloat3(
-            "vBumpInfos", static_cast<float>(_bumpTexture->coordinatesIndex),
+            vBumpInfos, static_cast<float>(_bumpTexture->coordinatesIndex),
             1.f / _bumpTexture->level, parallaxScaleBias, "");
           MaterialHelper::BindTextureMatrix(*_bumpTexture, *_uniformBuffer,
                                             "bump");
           if (scene->_mirroredCameraPosition) {
-            _uniformBuffer->updateFloat2("vTangentSpaceParams",
+            static const UniformName vTangentSpaceParams{"vTangentSpaceParams"};
+            _uniformBuffer->updateFloat2(vTangentSpaceParams,
                                          _invertNormalMapX ? 1.f : -1.f,
                                          _invertNormalMapY ? 1.f : -1.f, "");
           }
           else {
-            _uniformBuffer->updateFloat2("vTangentSpaceParams",
+            static const UniformName vTangentSpaceParams{"vTangentSpaceParams"};
+            _uniformBuffer->updateFloat2(vTangentSpaceParams,
                                          _invertNormalMapX ? -1.f : 1.f,
                                          _invertNormalMapY ? -1.f : 1.f, "");
           }
@@ -1219,8 +1243,9 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
             && StandardMaterial::RefractionTextureEnabled()) {
           float depth = 1.f;
           if (!_refractionTexture->isCube) {
+            static const UniformName refractionMatrix{"refractionMatrix"};
             _uniformBuffer->updateMatrix(
-              "refractionMatrix",
+              refractionMatrix,
               *_refractionTexture->getReflectionTextureMatrix());
             auto refractionTextureTmp
               = std::static_pointer_cast<RefractionTexture>(_refractionTexture);
@@ -1228,24 +1253,29 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
               depth = refractionTextureTmp->depth;
             }
           }
+          static const UniformName vRefractionInfos{"vRefractionInfos"};
           _uniformBuffer->updateFloat4(
-            "vRefractionInfos", _refractionTexture->level, indexOfRefraction,
+            vRefractionInfos, _refractionTexture->level, indexOfRefraction,
             depth, invertRefractionY ? -1.f : 1.f, "");
         }
       }
 
       // Point size
       if (pointsCloud()) {
-        _uniformBuffer->updateFloat("pointSize", pointSize);
+        static const UniformName pointSizeName{"pointSize"};
+        _uniformBuffer->updateFloat(pointSizeName, pointSize);
       }
 
       if (defines["SPECULARTERM"]) {
-        _uniformBuffer->updateColor4("vSpecularColor", specularColor,
+        static const UniformName vSpecularColor{"vSpecularColor"};
+        _uniformBuffer->updateColor4(vSpecularColor, specularColor,
                                      specularPower, "");
       }
-      _uniformBuffer->updateColor3("vEmissiveColor", emissiveColor, "");
+      static const UniformName vEmissiveColor{"vEmissiveColor"};
+      _uniformBuffer->updateColor3(vEmissiveColor, emissiveColor, "");
       // Diffuse
-      _uniformBuffer->updateColor4("vDiffuseColor", diffuseColor,
+      static const UniformName vDiffuseColor{"vDiffuseColor"};
+      _uniformBuffer->updateColor4(vDiffuseColor, diffuseColor,
                                    alpha() * mesh->visibility(), "");
     }
 
@@ -1306,7 +1336,8 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
     scene->ambientColor.multiplyToRef(ambientColor, _globalAmbientColor);
 
     MaterialHelper::BindEyePosition(effect, scene);
-    effect->setColor3("vAmbientColor", _globalAmbientColor);
+    static const UniformName vAmbientColor{"vAmbientColor"};
+    effect->setColor3(vAmbientColor, _globalAmbientColor);
   }
 
   if (mustRebind || !isFrozen()) {
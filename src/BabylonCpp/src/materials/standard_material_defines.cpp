@@ -4,9 +4,22 @@
 
 namespace BABYLON {
 
-StandardMaterialDefines::StandardMaterialDefines() : MaterialDefines{}
+StandardMaterialDefines::StandardMaterialDefines() : MaterialDefines{_Layout()}
 {
-  boolDef = {
+}
+
+const MaterialDefinesLayout& StandardMaterialDefines::_Layout()
+{
+  // The defines are registered once
+  static const auto layout = _CreateLayout();
+  return layout;
+}
+
+MaterialDefinesLayout StandardMaterialDefines::_CreateLayout()
+{
+  MaterialDefinesLayout layout;
+
+  layout.boolDef = {
     {"MAINUV1", false},                                     //
     {"MAINUV2", false},                                     //
     {"DIFFUSE", false},                                     //
@@ -101,7 +114,7 @@ StandardMaterialDefines::StandardMaterialDefines() : MaterialDefines{}
     {"EXPOSURE", false},             //
   };
 
-  intDef = {
+  layout.intDef = {
     {"DIFFUSEDIRECTUV", 0},       //
     {"AMBIENTDIRECTUV", 0},       //
     {"OPACITYDIRECTUV", 0},       //
@@ -113,6 +126,8 @@ StandardMaterialDefines::StandardMaterialDefines() : MaterialDefines{}
     {"LIGHTMAPDIRECTUV", 0},      //
     {"NUM_MORPH_INFLUENCERS", 0}, //
   };
+
+  return layout;
 }
 
 StandardMaterialDefines::~StandardMaterialDefines()
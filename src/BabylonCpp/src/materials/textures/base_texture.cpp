@@ -372,8 +372,10 @@ SphericalPolynomial* BaseTexture::sphericalPolynomial()
   }
 
   if (!_texture->_sphericalPolynomial) {
+    auto scene      = getScene();
+    auto threadPool = scene ? scene->getEngine()->threadPool() : nullptr;
     _texture->_sphericalPolynomial = CubeMapToSphericalPolynomialTools::
-      ConvertCubeMapTextureToSphericalPolynomial(this);
+      ConvertCubeMapTextureToSphericalPolynomial(this, threadPool);
   }
 
   return _texture->_sphericalPolynomial.get();
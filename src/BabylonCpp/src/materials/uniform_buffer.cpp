@@ -22,41 +22,41 @@ UniformBuffer::UniformBuffer(Engine* engine, const Float32Array& data,
     , _noUBO{!engine->supportsUniformBuffers()}
 {
   if (_noUBO) {
-    updateMatrix3x3 = [this](const std::string& name, const Float32Array& matrix) {
+    updateMatrix3x3 = [this](const UniformName& name, const Float32Array& matrix) {
       _updateMatrix3x3ForEffect(name, matrix);
     };
-    updateMatrix2x2 = [this](const std::string& name, const Float32Array& matrix) {
+    updateMatrix2x2 = [this](const UniformName& name, const Float32Array& matrix) {
       _updateMatrix2x2ForEffect(name, matrix);
     };
-    updateFloat = [this](const std::string& name, float x) {
+    updateFloat = [this](const UniformName& name, float x) {
       _updateFloatForEffect(name, x);
     };
     updateFloat2
-      = [this](const std::string& name, float x, float y, const std::string& suffix) {
+      = [this](const UniformName& name, float x, float y, const std::string& suffix) {
           _updateFloat2ForEffect(name, x, y, suffix);
         };
-    updateFloat3 = [this](const std::string& name, float x, float y, float z,
+    updateFloat3 = [this](const UniformName& name, float x, float y, float z,
                           const std::string& suffix = "") {
       _updateFloat3ForEffect(name, x, y, z, suffix);
     };
-    updateFloat4 = [this](const std::string& name, float x, float y, float z,
+    updateFloat4 = [this](const UniformName& name, float x, float y, float z,
                           float w, const std::string& suffix = "") {
       _updateFloat4ForEffect(name, x, y, z, w, suffix);
     };
-    updateMatrix = [this](const std::string& name, const Matrix& mat) {
+    updateMatrix = [this](const UniformName& name, const Matrix& mat) {
       _updateMatrixForEffect(name, mat);
     };
-    updateVector3 = [this](const std::string& name, const Vector3& vector) {
+    updateVector3 = [this](const UniformName& name, const Vector3& vector) {
       _updateVector3ForEffect(name, vector);
     };
-    updateVector4 = [this](const std::string& name, const Vector4& vector) {
+    updateVector4 = [this](const UniformName& name, const Vector4& vector) {
       _updateVector4ForEffect(name, vector);
     };
-    updateColor3 = [this](const std::string& name, const Color3& color,
+    updateColor3 = [this](const UniformName& name, const Color3& color,
                           const std::string& suffix = "") {
       _updateColor3ForEffect(name, color, suffix);
     };
-    updateColor4 = [this](const std::string& name, const Color3& color,
+    updateColor4 = [this](const UniformName& name, const Color3& color,
                           float alpha, const std::string& suffix = "") {
       _updateColor4ForEffect(name, color, alpha, suffix);
     };
@@ -64,41 +64,41 @@ UniformBuffer::UniformBuffer(Engine* engine, const Float32Array& data,
   else {
     _engine->_uniformBuffers.emplace_back(this);
 
-    updateMatrix3x3 = [this](const std::string& name, const Float32Array& matrix) {
+    updateMatrix3x3 = [this](const UniformName& name, const Float32Array& matrix) {
       _updateMatrix3x3ForUniform(name, matrix);
     };
-    updateMatrix2x2 = [this](const std::string& name, const Float32Array& matrix) {
+    updateMatrix2x2 = [this](const UniformName& name, const Float32Array& matrix) {
       _updateMatrix2x2ForUniform(name, matrix);
     };
-    updateFloat = [this](const std::string& name, float x) {
+    updateFloat = [this](const UniformName& name, float x) {
       _updateFloatForUniform(name, x);
     };
-    updateFloat2 = [this](const std::string& name, float x, float y,
+    updateFloat2 = [this](const UniformName& name, float x, float y,
                           const std::string& suffix = "") {
       _updateFloat2ForUniform(name, x, y, suffix);
     };
-    updateFloat3 = [this](const std::string& name, float x, float y, float z,
+    updateFloat3 = [this](const UniformName& name, float x, float y, float z,
                           const std::string& suffix = "") {
       _updateFloat3ForUniform(name, x, y, z, suffix);
     };
-    updateFloat4 = [this](const std::string& name, float x, float y, float z,
+    updateFloat4 = [this](const UniformName& name, float x, float y, float z,
                           float w, const std::string& suffix = "") {
       _updateFloat4ForUniform(name, x, y, z, w, suffix);
     };
-    updateMatrix = [this](const std::string& name, const Matrix& mat) {
+    updateMatrix = [this](const UniformName& name, const Matrix& mat) {
       _updateMatrixForUniform(name, mat);
     };
-    updateVector3 = [this](const std::string& name, const Vector3& vector) {
+    updateVector3 = [this](const UniformName& name, const Vector3& vector) {
       _updateVector3ForUniform(name, vector);
     };
-    updateVector4 = [this](const std::string& name, const Vector4& vector) {
+    updateVector4 = [this](const UniformName& name, const Vector4& vector) {
       _updateVector4ForUniform(name, vector);
     };
-    updateColor3 = [this](const std::string& name, const Color3& color,
+    updateColor3 = [this](const UniformName& name, const Color3& color,
                           const std::string& suffix = "") {
       _updateColor3ForUniform(name, color, suffix);
     };
-    updateColor4 = [this](const std::string& name, const Color3& color,
+    updateColor4 = [this](const UniformName& name, const Color3& color,
                           float alpha, const std::string& suffix = "") {
       _updateColor4ForUniform(name, color, alpha, suffix);
     };
@@ -159,13 +159,32 @@ void UniformBuffer::_fillAlignment(size_t size)
   }
 }
 
-void UniformBuffer::addUniform(const std::string& name, size_t size)
+size_t UniformBuffer::_getUniformLocation(const UniformName& name) const
+{
+  const auto id = name.id();
+  return id < _uniformLocations.size() ? _uniformLocations[id] :
+                                         UniformName::npos;
+}
+
+void UniformBuffer::_addUniformLocation(const UniformName& name, size_t size)
+{
+  const auto id = name.id();
+  if (id >= _uniformLocations.size()) {
+    _uniformLocations.resize(id + 1, UniformName::npos);
+    _uniformSizes.resize(id + 1, 0);
+  }
+  _uniformSizes[id]     = size;
+  _uniformLocations[id] = _uniformLocationPointer;
+  _uniformLocationPointer += size;
+}
+
+void UniformBuffer::addUniform(const UniformName& name, size_t size)
 {
   if (_noUBO) {
     return;
   }
 
-  if (stl_util::contains(_uniformLocations, name)) {
+  if (_getUniformLocation(name) != UniformName::npos) {
     // Already existing uniform
     return;
   }
@@ -175,9 +194,7 @@ void UniformBuffer::addUniform(const std::string& name, size_t size)
   auto data = Float32Array(size, 0);
 
   _fillAlignment(size);
-  _uniformSizes[name]     = size;
-  _uniformLocations[name] = _uniformLocationPointer;
-  _uniformLocationPointer += size;
+  _addUniformLocation(name, size);
 
   for (size_t i = 0; i < size; ++i) {
     _data.emplace_back(data[i]);
@@ -186,13 +203,13 @@ void UniformBuffer::addUniform(const std::string& name, size_t size)
   _needSync = true;
 }
 
-void UniformBuffer::addUniform(const std::string& name, const Float32Array& size)
+void UniformBuffer::addUniform(const UniformName& name, const Float32Array& size)
 {
   if (_noUBO) {
     return;
   }
 
-  if (stl_util::contains(_uniformLocations, name)) {
+  if (_getUniformLocation(name) != UniformName::npos) {
     // Already existing uniform
     return;
   }
@@ -203,9 +220,7 @@ void UniformBuffer::addUniform(const std::string& name, const Float32Array& size
   size_t _size = data.size();
 
   _fillAlignment(_size);
-  _uniformSizes[name]     = _size;
-  _uniformLocations[name] = _uniformLocationPointer;
-  _uniformLocationPointer += _size;
+  _addUniformLocation(name, _size);
 
   for (size_t i = 0; i < _size; ++i) {
     _data.emplace_back(data[i]);
@@ -214,29 +229,29 @@ void UniformBuffer::addUniform(const std::string& name, const Float32Array& size
   _needSync = true;
 }
 
-void UniformBuffer::addMatrix(const std::string& name, const Matrix& mat)
+void UniformBuffer::addMatrix(const UniformName& name, const Matrix& mat)
 {
   addUniform(name, mat.toArray());
 }
 
-void UniformBuffer::addFloat2(const std::string& name, float x, float y)
+void UniformBuffer::addFloat2(const UniformName& name, float x, float y)
 {
   addUniform(name, {x, y});
 }
 
-void UniformBuffer::addFloat3(const std::string& name, float x, float y, float z)
+void UniformBuffer::addFloat3(const UniformName& name, float x, float y, float z)
 {
   addUniform(name, {x, y, z});
 }
 
-void UniformBuffer::addColor3(const std::string& name, const Color3& color)
+void UniformBuffer::addColor3(const UniformName& name, const Color3& color)
 {
   Float32Array temp;
   color.toArray(temp);
   addUniform(name, temp);
 }
 
-void UniformBuffer::addColor4(const std::string& name, const Color3& color,
+void UniformBuffer::addColor4(const UniformName& name, const Color3& color,
                               float alpha)
 {
   Float32Array temp;
@@ -245,19 +260,19 @@ void UniformBuffer::addColor4(const std::string& name, const Color3& color,
   addUniform(name, temp);
 }
 
-void UniformBuffer::addVector3(const std::string& name, const Vector3& vector)
+void UniformBuffer::addVector3(const UniformName& name, const Vector3& vector)
 {
   Float32Array temp;
   vector.toArray(temp);
   addUniform(name, temp);
 }
 
-void UniformBuffer::addMatrix3x3(const std::string& name)
+void UniformBuffer::addMatrix3x3(const UniformName& name)
 {
   addUniform(name, 12);
 }
 
-void UniformBuffer::addMatrix2x2(const std::string& name)
+void UniformBuffer::addMatrix2x2(const UniformName& name)
 {
   addUniform(name, 8);
 }
@@ -312,11 +327,11 @@ void UniformBuffer::update()
   _needSync = false;
 }
 
-void UniformBuffer::updateUniform(const std::string& uniformName,
+void UniformBuffer::updateUniform(const UniformName& uniformName,
                                   const Float32Array& data, size_t size)
 {
-  size_t location = _uniformLocations[uniformName];
-  if (!stl_util::contains(_uniformLocations, uniformName)) {
+  auto location = _getUniformLocation(uniformName);
+  if (location == UniformName::npos) {
     if (_buffer) {
       // Cannot add an uniform if the buffer is already created
       BABYLON_LOG_ERROR("UniformBuffer",
@@ -324,7 +339,7 @@ void UniformBuffer::updateUniform(const std::string& uniformName,
       return;
     }
     addUniform(uniformName, size);
-    location = _uniformLocations[uniformName];
+    location = _getUniformLocation(uniformName);
   }
 
   if (!_buffer) {
@@ -351,7 +366,7 @@ void UniformBuffer::updateUniform(const std::string& uniformName,
   }
 }
 
-void UniformBuffer::_updateMatrix3x3ForUniform(const std::string& name,
+void UniformBuffer::_updateMatrix3x3ForUniform(const UniformName& name,
                                                const Float32Array& matrix)
 {
   // To match std140, matrix must be realigned
@@ -365,19 +380,19 @@ void UniformBuffer::_updateMatrix3x3ForUniform(const std::string& name,
   updateUniform(name, UniformBuffer::_tempBuffer, 12);
 }
 
-void UniformBuffer::_updateMatrix3x3ForEffect(const std::string& name,
+void UniformBuffer::_updateMatrix3x3ForEffect(const UniformName& name,
                                               const Float32Array& matrix)
 {
   _currentEffect->setMatrix3x3(name, matrix);
 }
 
-void UniformBuffer::_updateMatrix2x2ForEffect(const std::string& name,
+void UniformBuffer::_updateMatrix2x2ForEffect(const UniformName& name,
                                               const Float32Array& matrix)
 {
   _currentEffect->setMatrix2x2(name, matrix);
 }
 
-void UniformBuffer::_updateMatrix2x2ForUniform(const std::string& name,
+void UniformBuffer::_updateMatrix2x2ForUniform(const UniformName& name,
                                                const Float32Array& matrix)
 {
   // To match std140, matrix must be realigned
@@ -391,24 +406,29 @@ void UniformBuffer::_updateMatrix2x2ForUniform(const std::string& name,
   updateUniform(name, UniformBuffer::_tempBuffer, 8);
 }
 
-void UniformBuffer::_updateFloatForEffect(const std::string& name, float x)
+void UniformBuffer::_updateFloatForEffect(const UniformName& name, float x)
 {
   _currentEffect->setFloat(name, x);
 }
 
-void UniformBuffer::_updateFloatForUniform(const std::string& name, float x)
+void UniformBuffer::_updateFloatForUniform(const UniformName& name, float x)
 {
   UniformBuffer::_tempBuffer[0] = x;
   updateUniform(name, UniformBuffer::_tempBuffer, 1);
 }
 
-void UniformBuffer::_updateFloat2ForEffect(const std::string& name, float x,
+void UniformBuffer::_updateFloat2ForEffect(const UniformName& name, float x,
                                            float y, const std::string& suffix)
 {
-  _currentEffect->setFloat2(name + suffix, x, y);
+  if (suffix.empty()) {
+    _currentEffect->setFloat2(name, x, y);
+  }
+  else {
+    _currentEffect->setFloat2(name.str() + suffix, x, y);
+  }
 }
 
-void UniformBuffer::_updateFloat2ForUniform(const std::string& name, float x,
+void UniformBuffer::_updateFloat2ForUniform(const UniformName& name, float x,
                                             float y, const std::string& /*suffix*/)
 {
   UniformBuffer::_tempBuffer[0] = x;
@@ -416,14 +436,19 @@ void UniformBuffer::_updateFloat2ForUniform(const std::string& name, float x,
   updateUniform(name, UniformBuffer::_tempBuffer, 2);
 }
 
-void UniformBuffer::_updateFloat3ForEffect(const std::string& name, float x,
+void UniformBuffer::_updateFloat3ForEffect(const UniformName& name, float x,
                                            float y, float z,
                                            const std::string& suffix)
 {
-  _currentEffect->setFloat3(name + suffix, x, y, z);
+  if (suffix.empty()) {
+    _currentEffect->setFloat3(name, x, y, z);
+  }
+  else {
+    _currentEffect->setFloat3(name.str() + suffix, x, y, z);
+  }
 }
 
-void UniformBuffer::_updateFloat3ForUniform(const std::string& name, float x,
+void UniformBuffer::_updateFloat3ForUniform(const UniformName& name, float x,
                                             float y, float z,
                                             const std::string& /*suffix*/)
 {
@@ -433,14 +458,19 @@ void UniformBuffer::_updateFloat3ForUniform(const std::string& name, float x,
   updateUniform(name, UniformBuffer::_tempBuffer, 3);
 }
 
-void UniformBuffer::_updateFloat4ForEffect(const std::string& name, float x,
+void UniformBuffer::_updateFloat4ForEffect(const UniformName& name, float x,
                                            float y, float z, float w,
                                            const std::string& suffix)
 {
-  _currentEffect->setFloat4(name + suffix, x, y, z, w);
+  if (suffix.empty()) {
+    _currentEffect->setFloat4(name, x, y, z, w);
+  }
+  else {
+    _currentEffect->setFloat4(name.str() + suffix, x, y, z, w);
+  }
 }
 
-void UniformBuffer::_updateFloat4ForUniform(const std::string& name, float x,
+void UniformBuffer::_updateFloat4ForUniform(const UniformName& name, float x,
                                             float y, float z, float w,
                                             const std::string& /*suffix*/)
 {
@@ -451,52 +481,57 @@ void UniformBuffer::_updateFloat4ForUniform(const std::string& name, float x,
   updateUniform(name, UniformBuffer::_tempBuffer, 4);
 }
 
-void UniformBuffer::_updateMatrixForEffect(const std::string& name,
+void UniformBuffer::_updateMatrixForEffect(const UniformName& name,
                                            const Matrix& mat)
 {
   _currentEffect->setMatrix(name, mat);
 }
 
-void UniformBuffer::_updateMatrixForUniform(const std::string& name,
+void UniformBuffer::_updateMatrixForUniform(const UniformName& name,
                                             const Matrix& mat)
 {
   updateUniform(name, mat.toArray(), 16);
 }
 
-void UniformBuffer::_updateVector3ForEffect(const std::string& name,
+void UniformBuffer::_updateVector3ForEffect(const UniformName& name,
                                             const Vector3& vector)
 {
   _currentEffect->setVector3(name, vector);
 }
 
-void UniformBuffer::_updateVector3ForUniform(const std::string& name,
+void UniformBuffer::_updateVector3ForUniform(const UniformName& name,
                                              const Vector3& vector)
 {
   vector.toArray(UniformBuffer::_tempBuffer);
   updateUniform(name, UniformBuffer::_tempBuffer, 3);
 }
 
-void UniformBuffer::_updateVector4ForEffect(const std::string& name,
+void UniformBuffer::_updateVector4ForEffect(const UniformName& name,
                                             const Vector4& vector)
 {
   _currentEffect->setVector4(name, vector);
 }
 
-void UniformBuffer::_updateVector4ForUniform(const std::string& name,
+void UniformBuffer::_updateVector4ForUniform(const UniformName& name,
                                              const Vector4& vector)
 {
   vector.toArray(UniformBuffer::_tempBuffer);
   updateUniform(name, UniformBuffer::_tempBuffer, 4);
 }
 
-void UniformBuffer::_updateColor3ForEffect(const std::string& name,
+void UniformBuffer::_updateColor3ForEffect(const UniformName& name,
                                            const Color3& color,
                                            const std::string& suffix)
 {
-  _currentEffect->setColor3(name + suffix, color);
+  if (suffix.empty()) {
+    _currentEffect->setColor3(name, color);
+  }
+  else {
+    _currentEffect->setColor3(name.str() + suffix, color);
+  }
 }
 
-void UniformBuffer::_updateColor3ForUniform(const std::string& name,
+void UniformBuffer::_updateColor3ForUniform(const UniformName& name,
                                             const Color3& color,
                                             const std::string& /*suffix*/)
 {
@@ -504,14 +539,19 @@ void UniformBuffer::_updateColor3ForUniform(const std::string& name,
   updateUniform(name, UniformBuffer::_tempBuffer, 3);
 }
 
-void UniformBuffer::_updateColor4ForEffect(const std::string& name,
+void UniformBuffer::_updateColor4ForEffect(const UniformName& name,
                                            const Color3& color, float alpha,
                                            const std::string& suffix)
 {
-  _currentEffect->setColor4(name + suffix, color, alpha);
+  if (suffix.empty()) {
+    _currentEffect->setColor4(name, color, alpha);
+  }
+  else {
+    _currentEffect->setColor4(name.str() + suffix, color, alpha);
+  }
 }
 
-void UniformBuffer::_updateColor4ForUniform(const std::string& name,
+void UniformBuffer::_updateColor4ForUniform(const UniformName& name,
                                             const Color3& color, float alpha,
                                             const std::string& /*suffix*/)
 {
@@ -526,7 +566,7 @@ void UniformBuffer::setTexture(const std::string& name,
   _currentEffect->setTexture(name, texture);
 }
 
-void UniformBuffer::updateUniformDirectly(const std::string& uniformName,
+void UniformBuffer::updateUniformDirectly(const UniformName& uniformName,
                                           const Float32Array& data)
 {
   updateUniform(uniformName, data, data.size());
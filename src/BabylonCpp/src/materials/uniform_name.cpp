@@ -0,0 +1,87 @@
+#include <babylon/materials/uniform_name.h>
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace BABYLON {
+
+/**
+ * @brief Table of the interned uniform names.
+ */
+struct UniformNameTable {
+  std::shared_mutex mutex;
+  std::unordered_map<std::string, size_t> ids;
+  // The names keep their address when the table grows
+  std::deque<std::string> names;
+
+  static UniformNameTable& Instance()
+  {
+    static UniformNameTable table;
+    return table;
+  }
+}; // end of struct UniformNameTable
+
+constexpr size_t UniformName::npos;
+
+UniformName::UniformName(const char* name) : _id{_Intern(name)}
+{
+}
+
+UniformName::UniformName(const std::string& name) : _id{_Intern(name)}
+{
+}
+
+UniformName::~UniformName()
+{
+}
+
+bool UniformName::operator==(const UniformName& other) const
+{
+  return _id == other._id;
+}
+
+bool UniformName::operator!=(const UniformName& other) const
+{
+  return _id != other._id;
+}
+
+size_t UniformName::id() const
+{
+  return _id;
+}
+
+const std::string& UniformName::str() const
+{
+  auto& table = UniformNameTable::Instance();
+  std::shared_lock<std::shared_mutex> lock(table.mutex);
+  return table.names[_id];
+}
+
+size_t UniformName::Count()
+{
+  auto& table = UniformNameTable::Instance();
+  std::shared_lock<std::shared_mutex> lock(table.mutex);
+  return table.names.size();
+}
+
+size_t UniformName::_Intern(const std::string& name)
+{
+  auto& table = UniformNameTable::Instance();
+  {
+    std::shared_lock<std::shared_mutex> lock(table.mutex);
+    const auto it = table.ids.find(name);
+    if (it != table.ids.end()) {
+      return it->second;
+    }
+  }
+  std::unique_lock<std::shared_mutex> lock(table.mutex);
+  const auto it = table.ids.emplace(name, table.names.size());
+  if (it.second) {
+    table.names.emplace_back(name);
+  }
+  return it.first->second;
+}
+
+} // end of namespace BABYLON
@@ -451,9 +451,9 @@ const Matrix& Matrix::multiplyToArray(const Matrix& other, Float32Array& result,
   }
 
   std::array<float, 16> array;
-  multiplyToArray(other, array, offset);
+  multiplyToArray(other, array, 0);
   for (unsigned int i = 0; i != 16; ++i) {
-    result[i] = array[i];
+    result[offset + i] = array[i];
   }
 
   return *this;
@@ -16,6 +16,7 @@ Buffer::Buffer(Engine* engine, const Float32Array& data, bool updatable,
     , _buffer{nullptr}
     , _updatable{updatable}
     , _instanced{instanced}
+    , _isRaw{false}
 {
   if (!stride.has_value()) {
     stride = 0ul;
@@ -36,6 +37,7 @@ Buffer::Buffer(Mesh* mesh, const Float32Array& data, bool updatable,
     , _buffer{nullptr}
     , _updatable{updatable}
     , _instanced{instanced}
+    , _isRaw{false}
 {
   if (!stride.has_value()) {
     stride = 0ul;
@@ -48,6 +50,22 @@ Buffer::Buffer(Mesh* mesh, const Float32Array& data, bool updatable,
   }
 }
 
+Buffer::Buffer(Engine* engine, const ArrayBuffer& data, bool updatable,
+               size_t iByteStride, bool postponeInternalCreation,
+               bool instanced)
+    : _rawData{data}
+    , byteStride{iByteStride}
+    , _engine{engine ? engine : Engine::LastCreatedEngine()}
+    , _buffer{nullptr}
+    , _updatable{updatable}
+    , _instanced{instanced}
+    , _isRaw{true}
+{
+  if (!postponeInternalCreation) { // by default
+    create();
+  }
+}
+
 Buffer::~Buffer()
 {
 }
@@ -55,7 +73,8 @@ Buffer::~Buffer()
 std::unique_ptr<VertexBuffer>
 Buffer::createVertexBuffer(unsigned int kind, size_t offset, int size,
                            std::optional<size_t> stride,
-                           std::optional<bool> instanced, bool useBytes)
+                           std::optional<bool> instanced, bool useBytes,
+                           std::optional<unsigned int> type, bool normalized)
 {
   const auto _byteOffset = useBytes ? offset : offset * sizeof(float);
   const auto _byteStride = stride.has_value() ?
@@ -65,8 +84,8 @@ Buffer::createVertexBuffer(unsigned int kind, size_t offset, int size,
   // a lot of these parameters are ignored as they are overriden by the buffer
   return std::make_unique<VertexBuffer>(
     _engine, ToVariant<Float32Array, Buffer*>(this), kind, _updatable, true,
-    _byteStride, !instanced.has_value() ? _instanced : _byteOffset, offset,
-    size, std::nullopt, false, true);
+    _byteStride, instanced.has_value() ? *instanced : _instanced,
+    static_cast<unsigned int>(_byteOffset), size, type, normalized, true);
 }
 
 // Properties
@@ -80,6 +99,16 @@ Float32Array& Buffer::getData()
   return _data;
 }
 
+ArrayBuffer& Buffer::getRawData()
+{
+  return _rawData;
+}
+
+bool Buffer::isRaw() const
+{
+  return _isRaw;
+}
+
 GL::IGLBuffer* Buffer::getBuffer()
 {
   return _buffer.get();
@@ -93,6 +122,14 @@ size_t Buffer::getStrideSize() const
 // Methods
 GL::IGLBuffer* Buffer::create(Float32Array data)
 {
+  if (_isRaw) {
+    if (!_buffer && !_rawData.empty()) {
+      _buffer = _updatable ? _engine->createDynamicVertexBuffer(_rawData) :
+                             _engine->createVertexBuffer(_rawData);
+    }
+    return _buffer ? _buffer.get() : nullptr;
+  }
+
   if (data.empty() && _buffer) {
     return nullptr; // nothing to do
   }
@@ -133,6 +170,41 @@ GL::IGLBuffer* Buffer::update(const Float32Array& data)
   return create(data);
 }
 
+GL::IGLBuffer* Buffer::update(const ArrayBuffer& data)
+{
+  if (!_isRaw) {
+    return nullptr;
+  }
+
+  if (!_buffer) {
+    _rawData = data;
+    return create();
+  }
+
+  if (_updatable) { // update buffer
+    _rawData = data;
+    _engine->updateDynamicVertexBuffer(_buffer, _rawData);
+  }
+
+  return _buffer.get();
+}
+
+GL::IGLBuffer* Buffer::update()
+{
+  if (!_buffer) {
+    return create();
+  }
+
+  if (_updatable && _isRaw && !_rawData.empty()) {
+    _engine->updateDynamicVertexBuffer(_buffer, _rawData);
+  }
+  else if (_updatable && !_data.empty()) {
+    _engine->updateDynamicVertexBuffer(_buffer, _data);
+  }
+
+  return _buffer.get();
+}
+
 GL::IGLBuffer* Buffer::updateDirectly(const Float32Array& data, size_t offset,
                                       const std::optional<size_t>& vertexCount,
                                       bool useBytes)
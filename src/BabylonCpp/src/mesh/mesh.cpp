@@ -31,8 +31,12 @@
 #include <babylon/mesh/instanced_mesh.h>
 #include <babylon/mesh/mesh_builder.h>
 #include <babylon/mesh/mesh_lod_level.h>
+#include <babylon/mesh/mesh_optimizer.h>
+#include <babylon/mesh/simplification/simplification_queue.h>
+#include <babylon/mesh/software_skinning.h>
 #include <babylon/mesh/vertex_buffer.h>
 #include <babylon/mesh/vertex_data.h>
+#include <babylon/mesh/vertex_data_view.h>
 #include <babylon/mesh/vertex_data_options.h>
 #include <babylon/morph/morph_target.h>
 #include <babylon/morph/morph_target_manager.h>
@@ -73,6 +77,7 @@ Mesh::Mesh(const std::string& iName, Scene* scene, Node* iParent, Mesh* source,
     , _effectiveMaterial{nullptr}
     , _preActivateId{-1}
     , _areNormalsFrozen{false}
+    , _softwareSkinning{nullptr}
     , _source{nullptr}
     , _tessellation{0}
     , _cap{Mesh::NO_CAP()}
@@ -240,12 +245,13 @@ std::string Mesh::toString(bool fullDetails)
 
   if (fullDetails) {
     if (_geometry) {
-      auto ib = getIndices();
-      auto vb = getVerticesData(VertexBuffer::PositionKind);
+      const auto totalIndices  = getTotalIndices();
+      const auto totalVertices = getTotalVertices();
 
-      if (!vb.empty() && !ib.empty()) {
+      if (isVerticesDataPresent(VertexBuffer::PositionKind) && totalVertices
+          && totalIndices) {
         oss << ", flat shading: "
-            << (vb.size() / 3 == ib.size() ? "YES" : "NO");
+            << (totalVertices == totalIndices ? "YES" : "NO");
       }
     }
     else {
@@ -414,6 +420,36 @@ Float32Array Mesh::getVerticesData(unsigned int kind, bool copyWhenShared,
   return _geometry->getVerticesData(kind, copyWhenShared, forceCopy);
 }
 
+VertexDataView Mesh::getVerticesDataView(unsigned int kind,
+                                         bool copyWhenShared)
+{
+  if (!_geometry) {
+    return VertexDataView();
+  }
+  if (copyWhenShared && _geometry->_meshes.size() > 1) {
+    makeGeometryUnique();
+  }
+  return _geometry->getVerticesDataView(kind);
+}
+
+VertexDataView Mesh::_getVerticesDataView(unsigned int kind,
+                                          Float32Array& copy)
+{
+  auto view = getVerticesDataView(kind);
+  if (!view.empty()) {
+    return view;
+  }
+
+  // The data is unpacked to floats
+  const auto totalVertices = getTotalVertices();
+  copy                     = getVerticesData(kind);
+  if (totalVertices == 0 || copy.size() < totalVertices) {
+    return VertexDataView();
+  }
+  const auto size = copy.size() / totalVertices;
+  return VertexDataView(copy.data(), totalVertices, size, size);
+}
+
 VertexBuffer* Mesh::getVertexBuffer(unsigned int kind) const
 {
   if (!_geometry) {
@@ -632,11 +668,23 @@ Mesh& Mesh::_refreshBoundingInfo(bool applySkeleton)
     return *this;
   }
 
-  auto data = _getPositionData(applySkeleton);
-  if (!data.empty()) {
-    auto extend   = Tools::ExtractMinAndMax(data, 0, getTotalVertices());
+  // The positions are read in place when they are not skinned
+  const auto positions = (applySkeleton && skeleton()) ?
+                           VertexDataView() :
+                           getVerticesDataView(VertexBuffer::PositionKind);
+  if (!positions.empty()) {
+    auto extend = Tools::ExtractMinAndMax(positions.data(), 0,
+                                          positions.vertexCount(),
+                                          std::nullopt, positions.stride());
     _boundingInfo = std::make_unique<BoundingInfo>(extend.min, extend.max);
   }
+  else {
+    auto data = _getPositionData(applySkeleton);
+    if (!data.empty()) {
+      auto extend   = Tools::ExtractMinAndMax(data, 0, getTotalVertices());
+      _boundingInfo = std::make_unique<BoundingInfo>(extend.min, extend.max);
+    }
+  }
 
   if (!subMeshes.empty()) {
     for (auto& subMesh : subMeshes) {
@@ -654,18 +702,30 @@ Float32Array Mesh::_getPositionData(bool applySkeleton)
   auto data = getVerticesData(VertexBuffer::PositionKind);
 
   if (!data.empty() && applySkeleton && skeleton()) {
-    auto matricesIndicesData
-      = getVerticesData(VertexBuffer::MatricesIndicesKind);
-    auto matricesWeightsData
-      = getVerticesData(VertexBuffer::MatricesWeightsKind);
-    if (!matricesWeightsData.empty() && !matricesIndicesData.empty()) {
+    // The influences are read in place when possible
+    Float32Array copies[4];
+    const auto matricesIndicesData
+      = _getVerticesDataView(VertexBuffer::MatricesIndicesKind, copies[0]);
+    const auto matricesWeightsData
+      = _getVerticesDataView(VertexBuffer::MatricesWeightsKind, copies[1]);
+    const auto vertexCount = data.size() / 3;
+    if (matricesWeightsData.vertexCount() >= vertexCount
+        && matricesIndicesData.vertexCount() >= vertexCount
+        && matricesWeightsData.size() >= 4 && matricesIndicesData.size() >= 4) {
       auto needExtras = numBoneInfluencers() > 4;
-      auto matricesIndicesExtraData
-        = needExtras ? getVerticesData(VertexBuffer::MatricesIndicesExtraKind) :
-                       Float32Array();
-      auto matricesWeightsExtraData
-        = needExtras ? getVerticesData(VertexBuffer::MatricesWeightsExtraKind) :
-                       Float32Array();
+      const auto matricesIndicesExtraData
+        = needExtras ? _getVerticesDataView(
+                         VertexBuffer::MatricesIndicesExtraKind, copies[2]) :
+                       VertexDataView();
+      const auto matricesWeightsExtraData
+        = needExtras ? _getVerticesDataView(
+                         VertexBuffer::MatricesWeightsExtraKind, copies[3]) :
+                       VertexDataView();
+      needExtras = needExtras
+                   && matricesIndicesExtraData.vertexCount() >= vertexCount
+                   && matricesWeightsExtraData.vertexCount() >= vertexCount
+                   && matricesIndicesExtraData.size() >= 4
+                   && matricesWeightsExtraData.size() >= 4;
 
       auto skeletonMatrices = skeleton()->getTransformMatrices(this);
 
@@ -673,32 +733,31 @@ Float32Array Mesh::_getPositionData(bool applySkeleton)
       auto& finalMatrix = Tmp::MatrixArray[0];
       auto& tempMatrix  = Tmp::MatrixArray[1];
 
-      unsigned int matWeightIdx = 0;
-      for (unsigned int index = 0; index < data.size();
-           index += 3, matWeightIdx += 4) {
+      for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+        const auto index = static_cast<unsigned int>(vertex * 3);
         finalMatrix.reset();
 
         unsigned int inf = 0;
         float weight     = 0.f;
         for (inf = 0; inf < 4; inf++) {
-          weight = matricesWeightsData[matWeightIdx + inf];
+          weight = matricesWeightsData[vertex][inf];
           if (weight > 0) {
             Matrix::FromFloat32ArrayToRefScaled(
               skeletonMatrices,
               static_cast<unsigned int>(
-                std::floor(matricesIndicesData[matWeightIdx + inf] * 16)),
+                std::floor(matricesIndicesData[vertex][inf] * 16)),
               weight, tempMatrix);
             finalMatrix.addToSelf(tempMatrix);
           }
         }
         if (needExtras) {
           for (inf = 0; inf < 4; inf++) {
-            weight = matricesWeightsExtraData[matWeightIdx + inf];
+            weight = matricesWeightsExtraData[vertex][inf];
             if (weight > 0) {
               Matrix::FromFloat32ArrayToRefScaled(
                 skeletonMatrices,
-                static_cast<unsigned int>(std::floor(
-                  matricesIndicesExtraData[matWeightIdx + inf] * 16)),
+                static_cast<unsigned int>(
+                  std::floor(matricesIndicesExtraData[vertex][inf] * 16)),
                 weight, tempMatrix);
               finalMatrix.addToSelf(tempMatrix);
             }
@@ -833,6 +892,27 @@ Mesh& Mesh::setVerticesBuffer(std::unique_ptr<VertexBuffer>&& buffer)
   return *this;
 }
 
+Mesh& Mesh::updateVerticesDataView(unsigned int kind, bool updateExtends)
+{
+  if (!_geometry) {
+    return *this;
+  }
+
+  _geometry->updateVerticesDataView(kind, updateExtends);
+  return *this;
+}
+
+Mesh& Mesh::quantizeVerticesData(unsigned int kind, unsigned int type,
+                                 bool normalized)
+{
+  if (!_geometry) {
+    return *this;
+  }
+
+  _geometry->quantizeVerticesData(kind, type, normalized);
+  return *this;
+}
+
 Mesh* Mesh::updateVerticesData(unsigned int kind, const Float32Array& data,
                                bool updateExtends, bool makeItUnique)
 {
@@ -2001,10 +2081,60 @@ Mesh& Mesh::synchronizeInstances()
   return *this;
 }
 
-void Mesh::optimizeIndices(
-  const std::function<void(Mesh* mesh)>& successCallback)
+Mesh& Mesh::simplify(const std::vector<ISimplificationSettings>& settings,
+                     bool parallelProcessing,
+                     SimplificationType simplificationType,
+                     const std::function<void()>& successCallback)
+{
+  getScene()->simplificationQueue()->addTask(
+    {settings, simplificationType, this, successCallback, parallelProcessing});
+
+  return *this;
+}
+
+Mesh& Mesh::optimizeIndices(
+  const std::function<void(Mesh* mesh)>& successCallback,
+  bool optimizeOverdraw)
 {
-  successCallback(nullptr);
+  MeshOptimizer::MeshData meshData;
+  meshData.indices     = getIndices();
+  meshData.vertexCount = getTotalVertices();
+  if (meshData.indices.empty() || meshData.vertexCount == 0) {
+    return *this;
+  }
+
+  const auto kinds = getVerticesDataKinds();
+  for (auto kind : kinds) {
+    auto data = getVerticesData(kind);
+    meshData.streams.emplace_back(MeshOptimizer::VertexStream{
+      kind, data, data.size() / meshData.vertexCount});
+  }
+  for (const auto& subMesh : subMeshes) {
+    meshData.subMeshes.emplace_back(MeshOptimizer::SubMeshRange{
+      subMesh->verticesStart, subMesh->verticesCount, subMesh->indexStart,
+      subMesh->indexCount});
+  }
+
+  const auto statistics = MeshOptimizer::Optimize(meshData, optimizeOverdraw);
+  BABYLON_LOGF_INFO("Mesh", "Optimized indices of mesh %s, ACMR %.3f -> %.3f",
+                    name.c_str(), static_cast<double>(statistics.acmrBefore),
+                    static_cast<double>(statistics.acmrAfter));
+
+  for (const auto& stream : meshData.streams) {
+    setVerticesData(stream.kind, stream.data,
+                    isVertexBufferUpdatable(stream.kind));
+  }
+
+  // Indices are now reordered
+  auto originalSubMeshes = subMeshes;
+  setIndices(meshData.indices, meshData.vertexCount);
+  subMeshes = originalSubMeshes;
+
+  if (successCallback) {
+    successCallback(this);
+  }
+
+  return *this;
 }
 
 void Mesh::_syncGeometryWithMorphTargetManager()
@@ -2769,86 +2899,70 @@ Mesh* Mesh::applySkeleton(const SkeletonPtr& skeleton)
     setNormalsForCPUSkinning();
   }
 
-  // positionsData checks for not being Float32Array will only pass at most once
-  auto positionsData = getVerticesData(VertexBuffer::PositionKind);
-
-  if (positionsData.empty()) {
+  const auto vertexCount = _sourcePositions.size() / 3;
+  if (vertexCount == 0 || _sourceNormals.size() < vertexCount * 3) {
     return this;
   }
 
-  // normalsData checks for not being Float32Array will only pass at most once
-  auto normalsData = getVerticesData(VertexBuffer::NormalKind);
-
-  if (normalsData.empty()) {
-    return this;
-  }
+  // The influences are read in place when they are stored as tightly packed
+  // floats, otherwise they are copied
+  Float32Array influencesData[4];
+  const auto getInfluences
+    = [this, vertexCount, &influencesData](unsigned int kind,
+                                           size_t slot) -> const float* {
+    const auto view = _getVerticesDataView(kind, influencesData[slot]);
+    if (view.vertexCount() < vertexCount || view.size() != 4) {
+      return nullptr;
+    }
+    if (!view.isTightlyPacked()) {
+      influencesData[slot] = view.toArray();
+      return influencesData[slot].data();
+    }
+    return view.data();
+  };
 
-  auto matricesIndicesData = getVerticesData(VertexBuffer::MatricesIndicesKind);
-  auto matricesWeightsData = getVerticesData(VertexBuffer::MatricesWeightsKind);
+  SoftwareSkinning::Vertices vertices;
+  vertices.vertexCount     = vertexCount;
+  vertices.sourcePositions = _sourcePositions.data();
+  vertices.sourceNormals   = _sourceNormals.data();
+  vertices.matricesIndices
+    = getInfluences(VertexBuffer::MatricesIndicesKind, 0);
+  vertices.matricesWeights
+    = getInfluences(VertexBuffer::MatricesWeightsKind, 1);
 
-  if (matricesWeightsData.empty() || matricesIndicesData.empty()) {
+  if (!vertices.matricesIndices || !vertices.matricesWeights) {
     return this;
   }
 
-  bool needExtras = numBoneInfluencers() > 4;
-  auto matricesIndicesExtraData
-    = needExtras ? getVerticesData(VertexBuffer::MatricesIndicesExtraKind) :
-                   Float32Array();
-  auto matricesWeightsExtraData
-    = needExtras ? getVerticesData(VertexBuffer::MatricesWeightsExtraKind) :
-                   Float32Array();
-
-  auto skeletonMatrices = skeleton->getTransformMatrices(this);
-
-  auto tempVector3 = Vector3::Zero();
-  Matrix finalMatrix;
-  Matrix tempMatrix;
-
-  unsigned int matWeightIdx = 0;
-  unsigned int inf;
-  float weight;
-  for (unsigned int index = 0; index < positionsData.size();
-       index += 3, matWeightIdx += 4) {
-    for (inf = 0; inf < 4; ++inf) {
-      weight = matricesWeightsData[matWeightIdx + inf];
-      if (weight > 0.f) {
-        Matrix::FromFloat32ArrayToRefScaled(
-          skeletonMatrices,
-          static_cast<unsigned int>(
-            std::floor(matricesIndicesData[matWeightIdx + inf] * 16)),
-          weight, tempMatrix);
-        finalMatrix.addToSelf(tempMatrix);
-      }
-    }
-    if (needExtras) {
-      for (inf = 0; inf < 4; ++inf) {
-        weight = matricesWeightsExtraData[matWeightIdx + inf];
-        if (weight > 0.f) {
-          Matrix::FromFloat32ArrayToRefScaled(
-            skeletonMatrices,
-            static_cast<unsigned int>(
-              std::floor(matricesIndicesExtraData[matWeightIdx + inf] * 16)),
-            weight, tempMatrix);
-          finalMatrix.addToSelf(tempMatrix);
-        }
-      }
-    }
+  if (numBoneInfluencers() > 4) {
+    vertices.matricesIndicesExtra
+      = getInfluences(VertexBuffer::MatricesIndicesExtraKind, 2);
+    vertices.matricesWeightsExtra
+      = getInfluences(VertexBuffer::MatricesWeightsExtraKind, 3);
+  }
 
-    Vector3::TransformCoordinatesFromFloatsToRef(
-      _sourcePositions[index], _sourcePositions[index + 1],
-      _sourcePositions[index + 2], finalMatrix, tempVector3);
-    tempVector3.toArray(positionsData, index);
+  if (!_softwareSkinning) {
+    _softwareSkinning = std::make_unique<SoftwareSkinning>();
+  }
 
-    Vector3::TransformNormalFromFloatsToRef(
-      _sourceNormals[index], _sourceNormals[index + 1],
-      _sourceNormals[index + 2], finalMatrix, tempVector3);
-    tempVector3.toArray(normalsData, index);
+  // The skinned vertices are kept between the updates, so that the vertices
+  // only influenced by bones which did not move are not skinned again
+  if (_skinnedPositions.size() != vertexCount * 3) {
+    _skinnedPositions.resize(vertexCount * 3);
+    _skinnedNormals.resize(vertexCount * 3);
+    _softwareSkinning->invalidate();
+  }
+  vertices.positions = _skinnedPositions.data();
+  vertices.normals   = _skinnedNormals.data();
 
-    finalMatrix.reset();
+  const auto& skeletonMatrices = skeleton->getTransformMatrices(this);
+  if (!_softwareSkinning->apply(skeletonMatrices, vertices,
+                                getScene()->_skinningThreadPool.get())) {
+    return this;
   }
 
-  updateVerticesData(VertexBuffer::PositionKind, positionsData);
-  updateVerticesData(VertexBuffer::NormalKind, normalsData);
+  updateVerticesData(VertexBuffer::PositionKind, _skinnedPositions);
+  updateVerticesData(VertexBuffer::NormalKind, _skinnedNormals);
 
   return this;
 }
@@ -0,0 +1,464 @@
+#include <babylon/mesh/mesh_optimizer.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <babylon/math/vector3.h>
+#include <babylon/mesh/vertex_buffer.h>
+
+namespace BABYLON {
+
+constexpr unsigned int MeshOptimizer::DefaultCacheSize;
+
+MeshOptimizer::Statistics MeshOptimizer::Optimize(MeshData& meshData,
+                                                  bool optimizeOverdraw,
+                                                  unsigned int cacheSize)
+{
+  const auto& indices = meshData.indices;
+  const auto computeACMR = [&]() {
+    float misses         = 0.f;
+    size_t triangleCount = 0;
+    for (const auto& subMesh : meshData.subMeshes) {
+      const auto count = subMesh.indexCount / 3;
+      misses += ComputeACMR(indices, subMesh.indexStart, subMesh.indexCount,
+                            cacheSize)
+                * static_cast<float>(count);
+      triangleCount += count;
+    }
+    return triangleCount ? misses / static_cast<float>(triangleCount) : 0.f;
+  };
+
+  Statistics statistics;
+  statistics.acmrBefore = computeACMR();
+
+  MergeDuplicatedVertices(meshData);
+
+  const Float32Array* positions = nullptr;
+  for (const auto& stream : meshData.streams) {
+    if (stream.kind == VertexBuffer::PositionKind && stream.stride == 3) {
+      positions = &stream.data;
+    }
+  }
+
+  for (const auto& subMesh : meshData.subMeshes) {
+    if (subMesh.indexStart + subMesh.indexCount > indices.size()) {
+      continue;
+    }
+    OptimizeVertexCache(meshData.indices, subMesh.indexStart,
+                        subMesh.indexCount, cacheSize);
+    if (optimizeOverdraw && positions) {
+      OptimizeOverdraw(meshData.indices, subMesh.indexStart, subMesh.indexCount,
+                       *positions, cacheSize);
+    }
+  }
+
+  OptimizeVertexFetch(meshData);
+
+  statistics.acmrAfter = computeACMR();
+  return statistics;
+}
+
+float MeshOptimizer::ComputeACMR(const IndicesArray& indices, size_t indexStart,
+                                 size_t indexCount, unsigned int cacheSize)
+{
+  const auto triangleCount = indexCount / 3;
+  if (triangleCount == 0 || indexStart + triangleCount * 3 > indices.size()) {
+    return 0.f;
+  }
+
+  const auto first = indices.begin() + static_cast<long>(indexStart);
+  const auto last  = first + static_cast<long>(triangleCount * 3);
+  const auto range = std::minmax_element(first, last);
+  const auto minIndex = *range.first;
+
+  // A vertex is in the cache if less than cacheSize vertices were loaded
+  // since its own loading
+  std::vector<size_t> cacheTime(*range.second - minIndex + 1, 0);
+  size_t timeStamp = cacheSize + 1;
+  size_t misses    = 0;
+  for (auto it = first; it != last; ++it) {
+    auto& vertexTime = cacheTime[*it - minIndex];
+    if (timeStamp - vertexTime > cacheSize) {
+      vertexTime = timeStamp++;
+      ++misses;
+    }
+  }
+
+  return static_cast<float>(misses) / static_cast<float>(triangleCount);
+}
+
+void MeshOptimizer::OptimizeVertexCache(IndicesArray& indices,
+                                        size_t indexStart, size_t indexCount,
+                                        unsigned int cacheSize)
+{
+  const auto triangleCount = indexCount / 3;
+  if (triangleCount < 2 || indexStart + triangleCount * 3 > indices.size()) {
+    return;
+  }
+
+  const auto first    = indices.begin() + static_cast<long>(indexStart);
+  const auto last     = first + static_cast<long>(triangleCount * 3);
+  const auto range    = std::minmax_element(first, last);
+  const auto minIndex = *range.first;
+  const size_t vertexCount = *range.second - minIndex + 1;
+  const auto vertexAt = [&](size_t i) -> size_t { return first[i] - minIndex; };
+
+  // Triangles adjacent to each vertex, the live count being the number of
+  // adjacent triangles not emitted yet
+  std::vector<size_t> liveCount(vertexCount, 0);
+  for (size_t i = 0; i < triangleCount * 3; ++i) {
+    ++liveCount[vertexAt(i)];
+  }
+  std::vector<size_t> adjacencyOffsets(vertexCount + 1, 0);
+  for (size_t v = 0; v < vertexCount; ++v) {
+    adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveCount[v];
+  }
+  std::vector<size_t> adjacency(triangleCount * 3);
+  {
+    auto cursors = adjacencyOffsets;
+    for (size_t i = 0; i < triangleCount * 3; ++i) {
+      adjacency[cursors[vertexAt(i)]++] = i / 3;
+    }
+  }
+
+  std::vector<size_t> cacheTime(vertexCount, 0);
+  std::vector<bool> emitted(triangleCount, false);
+  std::vector<size_t> deadEnd;
+  std::vector<size_t> candidates;
+  deadEnd.reserve(triangleCount * 3);
+  IndicesArray output;
+  output.reserve(triangleCount * 3);
+
+  const auto cacheAge = [&](size_t timeStamp, size_t v) {
+    return static_cast<int64_t>(timeStamp - cacheTime[v]);
+  };
+
+  size_t timeStamp = cacheSize + 1;
+  size_t cursor    = 0;
+  // The index range starts with a used vertex
+  int64_t fanningVertex = 0;
+  while (fanningVertex >= 0) {
+    const auto fanning = static_cast<size_t>(fanningVertex);
+
+    // Emits all the triangles around the fanning vertex
+    candidates.clear();
+    for (auto k = adjacencyOffsets[fanning]; k < adjacencyOffsets[fanning + 1];
+         ++k) {
+      const auto triangle = adjacency[k];
+      if (emitted[triangle]) {
+        continue;
+      }
+      for (size_t j = 0; j < 3; ++j) {
+        const auto v = vertexAt(triangle * 3 + j);
+        output.emplace_back(first[static_cast<long>(triangle * 3 + j)]);
+        deadEnd.emplace_back(v);
+        candidates.emplace_back(v);
+        --liveCount[v];
+        if (cacheAge(timeStamp, v) > static_cast<int64_t>(cacheSize)) {
+          cacheTime[v] = timeStamp++;
+        }
+      }
+      emitted[triangle] = true;
+    }
+
+    // Next fanning vertex, the oldest one still in the cache after its
+    // remaining triangles are emitted
+    fanningVertex        = -1;
+    int64_t bestPriority = -1;
+    for (auto v : candidates) {
+      if (liveCount[v] == 0) {
+        continue;
+      }
+      int64_t priority = 0;
+      if (cacheAge(timeStamp, v) + 2 * static_cast<int64_t>(liveCount[v])
+          <= static_cast<int64_t>(cacheSize)) {
+        priority = cacheAge(timeStamp, v);
+      }
+      if (priority > bestPriority) {
+        bestPriority  = priority;
+        fanningVertex = static_cast<int64_t>(v);
+      }
+    }
+
+    // Dead end, the most recently used vertex with live triangles is picked,
+    // else the next one in the input order
+    while (fanningVertex < 0 && !deadEnd.empty()) {
+      const auto v = deadEnd.back();
+      deadEnd.pop_back();
+      if (liveCount[v] > 0) {
+        fanningVertex = static_cast<int64_t>(v);
+      }
+    }
+    while (fanningVertex < 0 && cursor < vertexCount) {
+      if (liveCount[cursor] > 0) {
+        fanningVertex = static_cast<int64_t>(cursor);
+      }
+      ++cursor;
+    }
+  }
+
+  std::copy(output.begin(), output.end(), first);
+}
+
+void MeshOptimizer::OptimizeOverdraw(IndicesArray& indices, size_t indexStart,
+                                     size_t indexCount,
+                                     const Float32Array& positions,
+                                     unsigned int cacheSize)
+{
+  const auto triangleCount = indexCount / 3;
+  if (triangleCount < 2 || indexStart + triangleCount * 3 > indices.size()) {
+    return;
+  }
+
+  const auto first = indices.begin() + static_cast<long>(indexStart);
+  const auto last  = first + static_cast<long>(triangleCount * 3);
+  if ((static_cast<size_t>(*std::max_element(first, last)) + 1) * 3
+      > positions.size()) {
+    return;
+  }
+
+  // Splits the triangles in clusters starting where the cache is flushed
+  const auto minIndex = *std::min_element(first, last);
+  std::vector<size_t> cacheTime(
+    *std::max_element(first, last) - minIndex + 1, 0);
+  std::vector<size_t> clusterStarts;
+  size_t timeStamp = cacheSize + 1;
+  for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+    unsigned int misses = 0;
+    for (size_t j = 0; j < 3; ++j) {
+      auto& vertexTime = cacheTime[first[static_cast<long>(triangle * 3 + j)]
+                                   - minIndex];
+      if (timeStamp - vertexTime > cacheSize) {
+        vertexTime = timeStamp++;
+        ++misses;
+      }
+    }
+    if (triangle == 0 || misses == 3) {
+      clusterStarts.emplace_back(triangle);
+    }
+  }
+  clusterStarts.emplace_back(triangleCount);
+  const auto clusterCount = clusterStarts.size() - 1;
+  if (clusterCount < 2) {
+    return;
+  }
+
+  // Area weighted centroid and normal of each cluster
+  std::vector<Vector3> centroids(clusterCount, Vector3::Zero());
+  std::vector<Vector3> normals(clusterCount, Vector3::Zero());
+  std::vector<float> areas(clusterCount, 0.f);
+  auto meshCentroid = Vector3::Zero();
+  float meshArea    = 0.f;
+  for (size_t cluster = 0; cluster < clusterCount; ++cluster) {
+    for (auto triangle = clusterStarts[cluster];
+         triangle < clusterStarts[cluster + 1]; ++triangle) {
+      const auto offset = static_cast<long>(triangle * 3);
+      const auto p0 = Vector3::FromArray(positions, first[offset] * 3);
+      const auto p1 = Vector3::FromArray(positions, first[offset + 1] * 3);
+      const auto p2 = Vector3::FromArray(positions, first[offset + 2] * 3);
+      const auto normal = Vector3::Cross(p1.subtract(p0), p2.subtract(p0));
+      const auto area   = normal.length();
+      centroids[cluster].addInPlace(
+        p0.add(p1).addInPlace(p2).scaleInPlace(area / 3.f));
+      normals[cluster].addInPlace(normal);
+      areas[cluster] += area;
+    }
+    meshCentroid.addInPlace(centroids[cluster]);
+    meshArea += areas[cluster];
+  }
+  if (meshArea > 0.f) {
+    meshCentroid.scaleInPlace(1.f / meshArea);
+  }
+
+  // The clusters facing away from the center of the mesh are likely to
+  // occlude the others and are drawn first
+  std::vector<float> sortKeys(clusterCount, 0.f);
+  for (size_t cluster = 0; cluster < clusterCount; ++cluster) {
+    if (areas[cluster] > 0.f) {
+      const auto centroid = centroids[cluster].scale(1.f / areas[cluster]);
+      normals[cluster].normalize();
+      sortKeys[cluster]
+        = Vector3::Dot(centroid.subtract(meshCentroid), normals[cluster]);
+    }
+  }
+  std::vector<size_t> order(clusterCount);
+  for (size_t cluster = 0; cluster < clusterCount; ++cluster) {
+    order[cluster] = cluster;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return sortKeys[a] > sortKeys[b];
+  });
+
+  IndicesArray output;
+  output.reserve(triangleCount * 3);
+  for (auto cluster : order) {
+    output.insert(output.end(),
+                  first + static_cast<long>(clusterStarts[cluster] * 3),
+                  first + static_cast<long>(clusterStarts[cluster + 1] * 3));
+  }
+  std::copy(output.begin(), output.end(), first);
+}
+
+bool MeshOptimizer::OptimizeVertexFetch(MeshData& meshData)
+{
+  const auto groups = _GroupSubMeshes(meshData);
+  if (groups.empty()) {
+    return false;
+  }
+
+  // New location of each vertex, the vertices outside of the submeshes stay
+  // in place
+  const auto vertexCount = meshData.vertexCount;
+  Uint32Array remap(vertexCount);
+  for (size_t v = 0; v < vertexCount; ++v) {
+    remap[v] = static_cast<uint32_t>(v);
+  }
+  for (const auto& group : groups) {
+    const auto& range = meshData.subMeshes[group.front()];
+    std::vector<bool> assigned(range.verticesCount, false);
+    auto next = range.verticesStart;
+    for (auto subMeshIndex : group) {
+      const auto& subMesh = meshData.subMeshes[subMeshIndex];
+      for (size_t i = 0; i < subMesh.indexCount; ++i) {
+        const auto index = meshData.indices[subMesh.indexStart + i];
+        if (!assigned[index - range.verticesStart]) {
+          assigned[index - range.verticesStart] = true;
+          remap[index] = static_cast<uint32_t>(next++);
+        }
+      }
+    }
+    // Unused vertices
+    for (size_t v = 0; v < range.verticesCount; ++v) {
+      if (!assigned[v]) {
+        remap[range.verticesStart + v] = static_cast<uint32_t>(next++);
+      }
+    }
+  }
+
+  for (auto& stream : meshData.streams) {
+    Float32Array data(stream.data.size());
+    for (size_t v = 0; v < vertexCount; ++v) {
+      std::copy_n(stream.data.begin() + static_cast<long>(v * stream.stride),
+                  stream.stride,
+                  data.begin() + static_cast<long>(remap[v] * stream.stride));
+    }
+    stream.data = std::move(data);
+  }
+  for (auto& index : meshData.indices) {
+    if (index < vertexCount) {
+      index = remap[index];
+    }
+  }
+
+  return true;
+}
+
+size_t MeshOptimizer::MergeDuplicatedVertices(MeshData& meshData)
+{
+  const auto groups = _GroupSubMeshes(meshData);
+
+  const auto& streams  = meshData.streams;
+  const auto compare = [&streams](size_t a, size_t b) {
+    for (const auto& stream : streams) {
+      const auto result
+        = std::memcmp(stream.data.data() + a * stream.stride,
+                      stream.data.data() + b * stream.stride,
+                      stream.stride * sizeof(float));
+      if (result != 0) {
+        return result;
+      }
+    }
+    return 0;
+  };
+
+  size_t mergedCount = 0;
+  for (const auto& group : groups) {
+    const auto& range = meshData.subMeshes[group.front()];
+
+    // Sorting the vertices puts the duplicates next to each other
+    std::vector<size_t> sorted(range.verticesCount);
+    for (size_t v = 0; v < range.verticesCount; ++v) {
+      sorted[v] = range.verticesStart + v;
+    }
+    std::stable_sort(sorted.begin(), sorted.end(), [&](size_t a, size_t b) {
+      return compare(a, b) < 0;
+    });
+
+    std::vector<uint32_t> remap(range.verticesCount);
+    for (size_t i = 0; i < sorted.size();) {
+      // The first occurrence comes first thanks to the stable sort
+      const auto original = sorted[i];
+      size_t j            = i;
+      for (; j < sorted.size() && compare(original, sorted[j]) == 0; ++j) {
+        remap[sorted[j] - range.verticesStart]
+          = static_cast<uint32_t>(original);
+      }
+      mergedCount += j - i - 1;
+      i = j;
+    }
+
+    for (auto subMeshIndex : group) {
+      const auto& subMesh = meshData.subMeshes[subMeshIndex];
+      for (size_t i = 0; i < subMesh.indexCount; ++i) {
+        auto& index = meshData.indices[subMesh.indexStart + i];
+        index       = remap[index - range.verticesStart];
+      }
+    }
+  }
+
+  return mergedCount;
+}
+
+std::vector<std::vector<size_t>>
+MeshOptimizer::_GroupSubMeshes(const MeshData& meshData)
+{
+  const auto vertexCount = meshData.vertexCount;
+  if (vertexCount == 0) {
+    return {};
+  }
+  for (const auto& stream : meshData.streams) {
+    if (stream.stride == 0 || stream.data.size() != vertexCount * stream.stride) {
+      return {};
+    }
+  }
+
+  // The submeshes sharing exactly the same vertex range are grouped, the
+  // vertices cannot be moved if the ranges partially overlap
+  std::vector<std::vector<size_t>> groups;
+  for (size_t i = 0; i < meshData.subMeshes.size(); ++i) {
+    const auto& subMesh = meshData.subMeshes[i];
+    const auto rangeEnd = subMesh.verticesStart + subMesh.verticesCount;
+    if (rangeEnd > vertexCount
+        || subMesh.indexStart + subMesh.indexCount > meshData.indices.size()) {
+      return {};
+    }
+    for (size_t k = 0; k < subMesh.indexCount; ++k) {
+      const auto index = meshData.indices[subMesh.indexStart + k];
+      if (index < subMesh.verticesStart || index >= rangeEnd) {
+        return {};
+      }
+    }
+
+    bool grouped = false;
+    for (auto& group : groups) {
+      const auto& range = meshData.subMeshes[group.front()];
+      if (range.verticesStart == subMesh.verticesStart
+          && range.verticesCount == subMesh.verticesCount) {
+        group.emplace_back(i);
+        grouped = true;
+        break;
+      }
+      if (subMesh.verticesStart < range.verticesStart + range.verticesCount
+          && range.verticesStart < rangeEnd) {
+        return {};
+      }
+    }
+    if (!grouped) {
+      groups.push_back({i});
+    }
+  }
+
+  return groups;
+}
+
+} // end of namespace BABYLON
@@ -33,8 +33,15 @@ void SimplicationQueueSceneComponent::dispose()
 
 void SimplicationQueueSceneComponent::_beforeCameraUpdate()
 {
-  if (scene->simplificationQueue() && !scene->simplificationQueue()->running) {
-    scene->simplificationQueue()->executeNext();
+  auto& queue = scene->simplificationQueue();
+  if (!queue) {
+    return;
+  }
+  if (queue->running) {
+    queue->update();
+  }
+  else {
+    queue->executeNext();
   }
 }
 
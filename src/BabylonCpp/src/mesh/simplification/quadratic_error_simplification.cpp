@@ -0,0 +1,630 @@
+#include <babylon/mesh/simplification/quadratic_error_simplification.h>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include <babylon/engine/scene.h>
+#include <babylon/materials/material.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/simplification/isimplification_settings.h>
+#include <babylon/mesh/sub_mesh.h>
+#include <babylon/mesh/vertex_buffer.h>
+#include <babylon/mesh/vertex_data.h>
+
+namespace BABYLON {
+
+QuadraticErrorSimplification::QuadraticErrorSimplification(Mesh* mesh)
+    : aggressiveness{7.f}
+    , decimationIterations{100}
+    , _name{mesh->name}
+    , _scene{mesh->getScene()}
+    , _parent{mesh->parent()}
+    , _material{mesh->material()}
+    , _renderingGroupId{mesh->renderingGroupId}
+{
+  _source.positions = mesh->getVerticesData(VertexBuffer::PositionKind);
+  _source.normals   = mesh->getVerticesData(VertexBuffer::NormalKind);
+  _source.uvs       = mesh->getVerticesData(VertexBuffer::UVKind);
+  _source.colors    = mesh->getVerticesData(VertexBuffer::ColorKind);
+  _source.indices   = mesh->getIndices();
+  for (const auto& subMesh : mesh->subMeshes) {
+    _source.subMeshes.emplace_back(SubMeshData{
+      subMesh->materialIndex, subMesh->verticesStart, subMesh->verticesCount,
+      subMesh->indexStart, subMesh->indexCount});
+  }
+}
+
+QuadraticErrorSimplification::QuadraticErrorSimplification(
+  const MeshData& meshData)
+    : aggressiveness{7.f}
+    , decimationIterations{100}
+    , _source{meshData}
+    , _scene{nullptr}
+    , _parent{nullptr}
+    , _material{nullptr}
+    , _renderingGroupId{0}
+{
+}
+
+QuadraticErrorSimplification::~QuadraticErrorSimplification()
+{
+}
+
+void QuadraticErrorSimplification::simplify(
+  const ISimplificationSettings& settings,
+  const std::function<void(const MeshPtr& simplifiedMesh)>& successCallback)
+{
+  decimate(settings);
+  auto simplifiedMesh = createSimplifiedMesh();
+  if (successCallback) {
+    successCallback(simplifiedMesh);
+  }
+}
+
+void QuadraticErrorSimplification::decimate(
+  const ISimplificationSettings& settings)
+{
+  _simplified = MeshData();
+
+  // Iterating through the submeshes array, one after the other
+  for (size_t i = 0; i < _source.subMeshes.size(); ++i) {
+    initWithMesh(i, settings.optimizeMesh);
+    init();
+    runDecimation(settings, i);
+  }
+
+  _triangles.clear();
+  _vertices.clear();
+  _references.clear();
+}
+
+const QuadraticErrorSimplification::MeshData&
+QuadraticErrorSimplification::simplifiedData() const
+{
+  return _simplified;
+}
+
+MeshPtr QuadraticErrorSimplification::createSimplifiedMesh()
+{
+  if (!_scene) {
+    return nullptr;
+  }
+
+  auto mesh = Mesh::New(_name + "Decimated", _scene, _parent);
+  mesh->material         = _material;
+  mesh->isVisible        = false;
+  mesh->renderingGroupId = _renderingGroupId;
+
+  VertexData vertexData;
+  vertexData.positions = _simplified.positions;
+  vertexData.normals   = _simplified.normals;
+  vertexData.uvs       = _simplified.uvs;
+  vertexData.colors    = _simplified.colors;
+  vertexData.indices   = _simplified.indices;
+  vertexData.applyToMesh(*mesh);
+
+  if (_simplified.subMeshes.size() > 1) {
+    mesh->subMeshes.clear();
+    for (const auto& subMesh : _simplified.subMeshes) {
+      SubMesh::AddToMesh(subMesh.materialIndex,
+                         static_cast<unsigned int>(subMesh.verticesStart),
+                         subMesh.verticesCount,
+                         static_cast<unsigned int>(subMesh.indexStart),
+                         subMesh.indexCount, mesh);
+    }
+  }
+
+  return mesh;
+}
+
+void QuadraticErrorSimplification::runDecimation(
+  const ISimplificationSettings& settings, size_t submeshIndex)
+{
+  const auto triangleCount = _triangles.size();
+  const auto targetCount
+    = static_cast<size_t>(static_cast<float>(triangleCount) * settings.quality);
+  size_t deletedTriangles = 0;
+
+  const auto targetReached = [&]() {
+    return triangleCount - deletedTriangles <= targetCount;
+  };
+
+  std::vector<bool> deleted0, deleted1;
+  std::vector<DecimationTriangle*> delTr, uniqueArray;
+  for (unsigned int iteration = 0;
+       iteration < decimationIterations && !targetReached(); ++iteration) {
+    if (iteration % 5 == 0) {
+      updateMesh(iteration == 0);
+    }
+
+    for (auto& triangle : _triangles) {
+      triangle.isDirty = false;
+    }
+
+    const auto threshold = 0.000000001f
+                           * std::pow(static_cast<float>(iteration + 3),
+                                      aggressiveness);
+
+    const auto length = _triangles.size();
+    for (size_t i = 0; i < length && !targetReached(); ++i) {
+      auto& t = _triangles[(length / 2 + i) % length];
+      if (t.error[3] > threshold || t.deleted || t.isDirty) {
+        continue;
+      }
+      for (unsigned int j = 0; j < 3; ++j) {
+        if (t.error[j] >= threshold) {
+          continue;
+        }
+
+        auto& v0 = *t.vertices[j];
+        auto& v1 = *t.vertices[(j + 1) % 3];
+
+        if (v0.isBorder || v1.isBorder) {
+          continue;
+        }
+
+        Vector3 p;
+        calculateError(v0, v1, &p);
+
+        deleted0.assign(static_cast<size_t>(v0.triangleCount), false);
+        deleted1.assign(static_cast<size_t>(v1.triangleCount), false);
+        delTr.clear();
+
+        if (isFlipped(v0, v1, p, deleted0, delTr)) {
+          continue;
+        }
+        if (isFlipped(v1, v0, p, deleted1, delTr)) {
+          continue;
+        }
+
+        if (std::find(deleted0.begin(), deleted0.end(), true) == deleted0.end()
+            || std::find(deleted1.begin(), deleted1.end(), true)
+                 == deleted1.end()) {
+          continue;
+        }
+
+        uniqueArray.clear();
+        for (auto deletedT : delTr) {
+          if (std::find(uniqueArray.begin(), uniqueArray.end(), deletedT)
+              == uniqueArray.end()) {
+            deletedT->deletePending = true;
+            uniqueArray.emplace_back(deletedT);
+          }
+        }
+
+        if (uniqueArray.size() % 2 != 0) {
+          continue;
+        }
+
+        v0.q = v1.q.add(v0.q);
+
+        v0.updatePosition(p);
+
+        const auto tStart = _references.size();
+
+        deletedTriangles = updateTriangles(v0, v0, deleted0, deletedTriangles);
+        deletedTriangles = updateTriangles(v0, v1, deleted1, deletedTriangles);
+
+        const auto tCount = _references.size() - tStart;
+
+        if (tCount <= static_cast<size_t>(v0.triangleCount)) {
+          std::copy(_references.begin() + static_cast<long>(tStart),
+                    _references.end(),
+                    _references.begin() + v0.triangleStart);
+        }
+        else {
+          v0.triangleStart = static_cast<int>(tStart);
+        }
+
+        v0.triangleCount = static_cast<int>(tCount);
+        break;
+      }
+    }
+  }
+
+  // Reconstruct this part of the mesh
+  reconstructMesh(submeshIndex);
+}
+
+void QuadraticErrorSimplification::initWithMesh(size_t submeshIndex,
+                                                bool optimizeMesh)
+{
+  _vertices.clear();
+  _triangles.clear();
+  _references.clear();
+
+  const auto& positionData = _source.positions;
+  const auto& indices      = _source.indices;
+  const auto& submesh      = _source.subMeshes[submeshIndex];
+
+  const auto totalVertices = std::min(
+    submesh.verticesCount, positionData.size() / 3 - submesh.verticesStart);
+
+  // Positions closer than the epsilon are merged, the positions are bucketed
+  // in a grid whose cell size is the epsilon so that only the 27 neighboring
+  // cells have to be searched
+  const float epsilon = 0.0001f;
+  struct CellHash {
+    size_t operator()(const std::array<int64_t, 3>& cell) const
+    {
+      return std::hash<int64_t>()(cell[0] * 73856093 ^ cell[1] * 19349663
+                                  ^ cell[2] * 83492791);
+    }
+  };
+  std::unordered_map<std::array<int64_t, 3>, std::vector<int>, CellHash> grid;
+  const auto cellOf = [epsilon](const Vector3& position) {
+    return std::array<int64_t, 3>{
+      {static_cast<int64_t>(std::floor(position.x / epsilon)),
+       static_cast<int64_t>(std::floor(position.y / epsilon)),
+       static_cast<int64_t>(std::floor(position.z / epsilon))}};
+  };
+  const auto findInVertices = [&](const Vector3& positionToSearch) -> int {
+    const auto cell = cellOf(positionToSearch);
+    int found       = -1;
+    for (int64_t x = -1; x <= 1; ++x) {
+      for (int64_t y = -1; y <= 1; ++y) {
+        for (int64_t z = -1; z <= 1; ++z) {
+          auto it = grid.find({{cell[0] + x, cell[1] + y, cell[2] + z}});
+          if (it == grid.end()) {
+            continue;
+          }
+          for (auto id : it->second) {
+            if ((found < 0 || id < found)
+                && _vertices[static_cast<size_t>(id)]
+                     .position.equalsWithEpsilon(positionToSearch, epsilon)) {
+              found = id;
+            }
+          }
+        }
+      }
+    }
+    return found;
+  };
+
+  // The vertices are never reallocated once the triangles reference them
+  _vertices.reserve(totalVertices);
+  std::vector<int> vertexReferences(totalVertices);
+  for (size_t i = 0; i < totalVertices; ++i) {
+    const auto offset = i + submesh.verticesStart;
+    const auto position
+      = Vector3::FromArray(positionData, static_cast<unsigned int>(offset * 3));
+
+    auto id = optimizeMesh ? findInVertices(position) : -1;
+    if (id < 0) {
+      id = static_cast<int>(_vertices.size());
+      _vertices.emplace_back(DecimationVertex(position, id));
+      if (optimizeMesh) {
+        grid[cellOf(position)].emplace_back(id);
+      }
+    }
+    _vertices[static_cast<size_t>(id)].originalOffsets.emplace_back(
+      static_cast<uint32_t>(offset));
+    vertexReferences[i] = id;
+  }
+
+  _triangles.reserve(submesh.indexCount / 3);
+  for (size_t i = 0; i < submesh.indexCount / 3; ++i) {
+    const auto pos = submesh.indexStart + i * 3;
+    if (pos + 2 >= indices.size()) {
+      break;
+    }
+    std::array<DecimationVertex*, 3> triangleVertices;
+    bool isValid = true;
+    for (size_t k = 0; k < 3; ++k) {
+      const auto index = static_cast<size_t>(indices[pos + k]);
+      if (index < submesh.verticesStart
+          || index - submesh.verticesStart >= totalVertices) {
+        isValid = false;
+        break;
+      }
+      triangleVertices[k] = &_vertices[static_cast<size_t>(
+        vertexReferences[index - submesh.verticesStart])];
+    }
+    if (isValid) {
+      DecimationTriangle triangle(triangleVertices);
+      triangle.originalOffset = pos;
+      _triangles.emplace_back(triangle);
+    }
+  }
+}
+
+void QuadraticErrorSimplification::init()
+{
+  for (auto& t : _triangles) {
+    const auto& p0 = t.vertices[0]->position;
+    t.normal       = Vector3::Cross(t.vertices[1]->position.subtract(p0),
+                              t.vertices[2]->position.subtract(p0));
+    t.normal.normalize();
+    const auto data = QuadraticMatrix::DataFromNumbers(
+      t.normal.x, t.normal.y, t.normal.z, -(Vector3::Dot(t.normal, p0)));
+    for (unsigned int j = 0; j < 3; ++j) {
+      t.vertices[j]->q.addArrayInPlace(data);
+    }
+  }
+
+  for (auto& t : _triangles) {
+    for (unsigned int j = 0; j < 3; ++j) {
+      t.error[j] = calculateError(*t.vertices[j], *t.vertices[(j + 1) % 3]);
+    }
+    t.error[3] = std::min({t.error[0], t.error[1], t.error[2]});
+  }
+}
+
+void QuadraticErrorSimplification::reconstructMesh(size_t submeshIndex)
+{
+  for (auto& vertex : _vertices) {
+    vertex.triangleCount = 0;
+  }
+  std::vector<const DecimationTriangle*> newTriangles;
+  for (const auto& t : _triangles) {
+    if (!t.deleted) {
+      for (unsigned int j = 0; j < 3; ++j) {
+        t.vertices[j]->triangleCount = 1;
+      }
+      newTriangles.emplace_back(&t);
+    }
+  }
+
+  const auto& normalData = _source.normals;
+  const auto& uvs        = _source.uvs;
+  const auto& colorsData = _source.colors;
+  const auto totalVertices = _source.positions.size() / 3;
+  const auto hasNormals    = normalData.size() >= totalVertices * 3;
+  const auto hasUVs        = totalVertices && uvs.size() >= totalVertices * 2;
+  const auto colorSize     = totalVertices ? colorsData.size() / totalVertices : 0;
+  const auto hasColors     = colorSize == 3 || colorSize == 4;
+
+  auto& result              = _simplified;
+  const auto startingIndex  = result.indices.size();
+  const auto startingVertex = result.positions.size() / 3;
+
+  size_t vertexCount = 0;
+  for (auto& vertex : _vertices) {
+    vertex.id = static_cast<int>(vertexCount);
+    if (!vertex.triangleCount) {
+      continue;
+    }
+    for (auto originalOffset : vertex.originalOffsets) {
+      result.positions.emplace_back(vertex.position.x);
+      result.positions.emplace_back(vertex.position.y);
+      result.positions.emplace_back(vertex.position.z);
+      if (hasNormals) {
+        for (size_t c = 0; c < 3; ++c) {
+          result.normals.emplace_back(normalData[originalOffset * 3 + c]);
+        }
+      }
+      if (hasUVs) {
+        for (size_t c = 0; c < 2; ++c) {
+          result.uvs.emplace_back(uvs[originalOffset * 2 + c]);
+        }
+      }
+      if (hasColors) {
+        for (size_t c = 0; c < colorSize; ++c) {
+          result.colors.emplace_back(colorsData[originalOffset * colorSize + c]);
+        }
+      }
+      ++vertexCount;
+    }
+  }
+
+  // Now get the new referencing point for each vertex
+  const auto& originalIndices = _source.indices;
+  for (const auto t : newTriangles) {
+    for (unsigned int idx = 0; idx < 3; ++idx) {
+      const auto id      = originalIndices[t->originalOffset + idx];
+      const auto& vertex = *t->vertices[idx];
+      auto it = std::find(vertex.originalOffsets.begin(),
+                          vertex.originalOffsets.end(), id);
+      const auto offset = (it == vertex.originalOffsets.end()) ?
+                            0 :
+                            it - vertex.originalOffsets.begin();
+      result.indices.emplace_back(static_cast<uint32_t>(
+        static_cast<size_t>(vertex.id + offset) + startingVertex));
+    }
+  }
+
+  // Create submesh
+  result.subMeshes.emplace_back(
+    SubMeshData{_source.subMeshes[submeshIndex].materialIndex, startingVertex,
+                vertexCount, startingIndex, newTriangles.size() * 3});
+}
+
+bool QuadraticErrorSimplification::isFlipped(
+  DecimationVertex& vertex1, DecimationVertex& vertex2, const Vector3& point,
+  std::vector<bool>& deletedArray, std::vector<DecimationTriangle*>& delTr)
+{
+  for (int i = 0; i < vertex1.triangleCount; ++i) {
+    const auto& ref = _references[static_cast<size_t>(vertex1.triangleStart + i)];
+    auto& t         = _triangles[static_cast<size_t>(ref.triangleId)];
+    if (t.deleted) {
+      continue;
+    }
+
+    const auto s = ref.vertexId;
+
+    const auto v1 = t.vertices[static_cast<size_t>((s + 1) % 3)];
+    const auto v2 = t.vertices[static_cast<size_t>((s + 2) % 3)];
+
+    if (v1 == &vertex2 || v2 == &vertex2) {
+      deletedArray[static_cast<size_t>(i)] = true;
+      delTr.emplace_back(&t);
+      continue;
+    }
+
+    auto d1 = v1->position.subtract(point);
+    d1.normalize();
+    auto d2 = v2->position.subtract(point);
+    d2.normalize();
+    if (std::abs(Vector3::Dot(d1, d2)) > 0.999f) {
+      return true;
+    }
+    auto normal = Vector3::Cross(d1, d2);
+    normal.normalize();
+    deletedArray[static_cast<size_t>(i)] = false;
+    if (Vector3::Dot(normal, t.normal) < 0.2f) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+size_t QuadraticErrorSimplification::updateTriangles(
+  DecimationVertex& origVertex, DecimationVertex& vertex,
+  const std::vector<bool>& deletedArray, size_t deletedTriangles)
+{
+  auto newDeleted = deletedTriangles;
+  for (int i = 0; i < vertex.triangleCount; ++i) {
+    // Copied, the references can be reallocated below
+    const auto ref = _references[static_cast<size_t>(vertex.triangleStart + i)];
+    auto& t        = _triangles[static_cast<size_t>(ref.triangleId)];
+    if (t.deleted) {
+      continue;
+    }
+    if (deletedArray[static_cast<size_t>(i)] && t.deletePending) {
+      t.deleted = true;
+      ++newDeleted;
+      continue;
+    }
+    t.vertices[static_cast<size_t>(ref.vertexId)] = &origVertex;
+    t.isDirty  = true;
+    t.error[0] = calculateError(*t.vertices[0], *t.vertices[1])
+                 + (t.borderFactor / 2.f);
+    t.error[1] = calculateError(*t.vertices[1], *t.vertices[2])
+                 + (t.borderFactor / 2.f);
+    t.error[2] = calculateError(*t.vertices[2], *t.vertices[0])
+                 + (t.borderFactor / 2.f);
+    t.error[3] = std::min({t.error[0], t.error[1], t.error[2]});
+    _references.emplace_back(ref);
+  }
+  return newDeleted;
+}
+
+void QuadraticErrorSimplification::identifyBorder()
+{
+  std::vector<int> vCount;
+  std::vector<int> vId;
+  for (auto& v : _vertices) {
+    vCount.clear();
+    vId.clear();
+    for (int j = 0; j < v.triangleCount; ++j) {
+      const auto& triangle = _triangles[static_cast<size_t>(
+        _references[static_cast<size_t>(v.triangleStart + j)].triangleId)];
+      for (unsigned int ii = 0; ii < 3; ++ii) {
+        const auto id = triangle.vertices[ii]->id;
+        auto it       = std::find(vId.begin(), vId.end(), id);
+        if (it == vId.end()) {
+          vCount.emplace_back(1);
+          vId.emplace_back(id);
+        }
+        else {
+          ++vCount[static_cast<size_t>(it - vId.begin())];
+        }
+      }
+    }
+
+    for (size_t j = 0; j < vCount.size(); ++j) {
+      _vertices[static_cast<size_t>(vId[j])].isBorder = (vCount[j] == 1);
+    }
+  }
+}
+
+void QuadraticErrorSimplification::updateMesh(bool identifyBorders)
+{
+  if (!identifyBorders) {
+    _triangles.erase(std::remove_if(_triangles.begin(), _triangles.end(),
+                                    [](const DecimationTriangle& triangle) {
+                                      return triangle.deleted;
+                                    }),
+                     _triangles.end());
+  }
+
+  for (auto& vertex : _vertices) {
+    vertex.triangleCount = 0;
+    vertex.triangleStart = 0;
+  }
+
+  for (auto& t : _triangles) {
+    for (unsigned int j = 0; j < 3; ++j) {
+      ++t.vertices[j]->triangleCount;
+    }
+  }
+
+  int tStart = 0;
+  for (auto& vertex : _vertices) {
+    vertex.triangleStart = tStart;
+    tStart += vertex.triangleCount;
+    vertex.triangleCount = 0;
+  }
+
+  _references.assign(_triangles.size() * 3, Reference(0, 0));
+  for (size_t i = 0; i < _triangles.size(); ++i) {
+    auto& t = _triangles[i];
+    for (unsigned int j = 0; j < 3; ++j) {
+      auto v = t.vertices[j];
+      _references[static_cast<size_t>(v->triangleStart + v->triangleCount)]
+        = Reference(static_cast<int>(j), static_cast<int>(i));
+      ++v->triangleCount;
+    }
+  }
+
+  if (identifyBorders) {
+    identifyBorder();
+  }
+}
+
+float QuadraticErrorSimplification::vertexError(const QuadraticMatrix& q,
+                                                const Vector3& point) const
+{
+  const auto x = point.x;
+  const auto y = point.y;
+  const auto z = point.z;
+  return q.data[0] * x * x + 2 * q.data[1] * x * y + 2 * q.data[2] * x * z
+         + 2 * q.data[3] * x + q.data[4] * y * y + 2 * q.data[5] * y * z
+         + 2 * q.data[6] * y + q.data[7] * z * z + 2 * q.data[8] * z
+         + q.data[9];
+}
+
+float QuadraticErrorSimplification::calculateError(
+  const DecimationVertex& vertex1, const DecimationVertex& vertex2,
+  Vector3* pointResult) const
+{
+  const auto q      = vertex1.q.add(vertex2.q);
+  const auto border = vertex1.isBorder && vertex2.isBorder;
+  float error       = 0.f;
+  const auto qDet   = q.det(0, 1, 2, 1, 4, 5, 2, 5, 7);
+
+  if (qDet != 0.f && !border) {
+    Vector3 point;
+    point.x = -1.f / qDet * (q.det(1, 2, 3, 4, 5, 6, 5, 7, 8));
+    point.y = 1.f / qDet * (q.det(0, 2, 3, 1, 5, 6, 2, 7, 8));
+    point.z = -1.f / qDet * (q.det(0, 1, 3, 1, 4, 6, 2, 5, 8));
+    error   = vertexError(q, point);
+    if (pointResult) {
+      pointResult->copyFrom(point);
+    }
+  }
+  else {
+    const auto p3 = vertex1.position.add(vertex2.position).scale(0.5f);
+    const auto error1 = vertexError(q, vertex1.position);
+    const auto error2 = vertexError(q, vertex2.position);
+    const auto error3 = vertexError(q, p3);
+    error             = std::min({error1, error2, error3});
+    if (pointResult) {
+      if (error == error1) {
+        pointResult->copyFrom(vertex1.position);
+      }
+      else if (error == error2) {
+        pointResult->copyFrom(vertex2.position);
+      }
+      else {
+        pointResult->copyFrom(p3);
+      }
+    }
+  }
+
+  return error;
+}
+
+} // end of namespace BABYLON
@@ -1,15 +1,20 @@
 #include <babylon/mesh/simplification/simplification_queue.h>
 
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/simplification/quadratic_error_simplification.h>
 #include <babylon/mesh/simplification/simplification_settings.h>
 
 namespace BABYLON {
 
-SimplificationQueue::SimplificationQueue() : running{false}
+SimplificationQueue::SimplificationQueue()
+    : running{false}, _runningTask{}
 {
 }
 
 SimplificationQueue::~SimplificationQueue()
 {
+  // The destructors of the futures wait for the running decimations
+  _simplifications.clear();
 }
 
 void SimplificationQueue::addTask(const ISimplificationTask& task)
@@ -20,8 +25,9 @@ void SimplificationQueue::addTask(const ISimplificationTask& task)
 void SimplificationQueue::executeNext()
 {
   if (!_simplificationQueue.empty()) {
-    running                         = true;
-    const ISimplificationTask& task = _simplificationQueue.front();
+    running = true;
+    // Copied, the reference is invalidated by pop()
+    const auto task = _simplificationQueue.front();
     _simplificationQueue.pop();
     runSimplification(task);
   }
@@ -30,19 +36,103 @@ void SimplificationQueue::executeNext()
   }
 }
 
-void SimplificationQueue::runSimplification(const ISimplificationTask& /*task*/)
+void SimplificationQueue::runSimplification(const ISimplificationTask& task)
 {
+  _runningTask = task;
+  _simplifications.clear();
+
+  if (!task.mesh) {
+    executeNext();
+    return;
+  }
+
+  // The vertex data of the mesh is copied on the render thread by each
+  // simplifier, the decimations then run on background threads
+  for (const auto& settings : task.settings) {
+    auto simplification        = std::make_unique<Simplification>();
+    simplification->settings   = settings;
+    simplification->simplifier = getSimplifier(task);
+    _simplifications.emplace_back(std::move(simplification));
+  }
+
+  if (task.parallelProcessing) {
+    for (auto& simplification : _simplifications) {
+      startSimplification(*simplification);
+    }
+  }
+  else if (!_simplifications.empty()) {
+    startSimplification(*_simplifications.front());
+  }
+
+  // Tasks without settings are completed immediately
+  update();
 }
 
-ISimplifier* SimplificationQueue::getSimplifier(const ISimplificationTask& task)
+void SimplificationQueue::update()
+{
+  if (!running || !_runningTask.mesh) {
+    return;
+  }
+
+  bool finished = true;
+  for (size_t i = 0; i < _simplifications.size(); ++i) {
+    auto& simplification = *_simplifications[i];
+    if (!simplification.simplifier) {
+      // Already added to the mesh
+      continue;
+    }
+    if (!simplification.future.valid()
+        || simplification.future.wait_for(std::chrono::seconds(0))
+             != std::future_status::ready) {
+      finished = false;
+      continue;
+    }
+
+    simplification.future.get();
+    auto simplifiedMesh = simplification.simplifier->createSimplifiedMesh();
+    if (simplifiedMesh) {
+      _runningTask.mesh->addLODLevel(simplification.settings.distance,
+                                     simplifiedMesh.get());
+      simplifiedMesh->isVisible = true;
+    }
+    simplification.simplifier.reset();
+
+    // Sequential processing, the next decimation is started
+    if (!_runningTask.parallelProcessing && i + 1 < _simplifications.size()) {
+      startSimplification(*_simplifications[i + 1]);
+      finished = false;
+      break;
+    }
+  }
+
+  if (finished) {
+    _simplifications.clear();
+    if (_runningTask.successCallback) {
+      _runningTask.successCallback();
+    }
+    _runningTask = ISimplificationTask();
+    running      = false;
+    executeNext();
+  }
+}
+
+std::unique_ptr<ISimplifier>
+SimplificationQueue::getSimplifier(const ISimplificationTask& task)
 {
   switch (task.simplificationType) {
     case SimplificationType::QUADRATIC:
     default:
-      // TODO FIXME
-      return nullptr;
-      // return new QuadraticErrorSimplification(task.mesh);
+      return std::make_unique<QuadraticErrorSimplification>(task.mesh);
   }
 }
 
+void SimplificationQueue::startSimplification(Simplification& simplification)
+{
+  auto simplifier = simplification.simplifier.get();
+  const auto settings = simplification.settings;
+  simplification.future
+    = std::async(std::launch::async,
+                 [simplifier, settings]() { simplifier->decimate(settings); });
+}
+
 } // end of namespace BABYLON
@@ -0,0 +1,208 @@
+#include <babylon/mesh/software_skinning.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <babylon/babylon_options.h>
+#include <babylon/core/thread_pool.h>
+
+// SIMD
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+#include <babylon/math/simd/float32x4.h>
+#endif
+
+namespace BABYLON {
+
+constexpr size_t SoftwareSkinning::VerticesPerTask;
+
+SoftwareSkinning::SoftwareSkinning() : _skinAllVertices{true}
+{
+}
+
+SoftwareSkinning::~SoftwareSkinning()
+{
+}
+
+void SoftwareSkinning::invalidate()
+{
+  _skinAllVertices = true;
+}
+
+bool SoftwareSkinning::apply(const Float32Array& boneMatrices,
+                             const Vertices& vertices, ThreadPool* threadPool)
+{
+  if (!_updateBones(boneMatrices) && !_skinAllVertices) {
+    return false;
+  }
+
+  const auto vertexCount = vertices.vertexCount;
+  if (threadPool && vertexCount >= 2 * VerticesPerTask) {
+    const auto taskCount = (vertexCount + VerticesPerTask - 1) / VerticesPerTask;
+    threadPool->parallelFor(taskCount, [&](size_t task) {
+      const auto start = task * VerticesPerTask;
+      _skin(vertices, start, std::min(start + VerticesPerTask, vertexCount));
+    });
+  }
+  else {
+    _skin(vertices, 0, vertexCount);
+  }
+
+  _skinAllVertices = false;
+
+  return true;
+}
+
+bool SoftwareSkinning::_updateBones(const Float32Array& boneMatrices)
+{
+  const auto boneCount = boneMatrices.size() / 16;
+  if (_boneMatrices.size() != boneMatrices.size()) {
+    _boneMatrices = boneMatrices;
+    _changedBones.assign(boneCount, 1);
+    _skinAllVertices = true;
+    return true;
+  }
+
+  bool changed = false;
+  for (size_t bone = 0; bone < boneCount; ++bone) {
+    const auto offset = bone * 16;
+    const auto size   = 16 * sizeof(float);
+    if (std::memcmp(&_boneMatrices[offset], &boneMatrices[offset], size) != 0) {
+      std::memcpy(&_boneMatrices[offset], &boneMatrices[offset], size);
+      _changedBones[bone] = 1;
+      changed             = true;
+    }
+    else {
+      _changedBones[bone] = 0;
+    }
+  }
+
+  return changed;
+}
+
+bool SoftwareSkinning::_isAffected(const float* matricesIndices,
+                                   const float* matricesWeights,
+                                   size_t offset) const
+{
+  for (size_t inf = 0; inf < 4; ++inf) {
+    if (matricesWeights[offset + inf] > 0.f) {
+      const auto bone = static_cast<size_t>(matricesIndices[offset + inf]);
+      if (bone < _changedBones.size() && _changedBones[bone]) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void SoftwareSkinning::_skin(const Vertices& vertices, size_t start,
+                             size_t end) const
+{
+  const auto boneCount = _changedBones.size();
+  const auto* matrices = _boneMatrices.data();
+  const auto hasExtras
+    = vertices.matricesIndicesExtra && vertices.matricesWeightsExtra;
+
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+  using SIMD::Float32x4;
+  const auto load
+    = [](const float* source) { return Float32x4(_mm_loadu_ps(source)); };
+
+  // Rows of the blended matrix, the vertex is transformed as
+  // x * rows[0] + y * rows[1] + z * rows[2] (+ rows[3] for positions)
+  Float32x4 rows[4];
+  const auto blend = [&](const float* matricesIndices,
+                         const float* matricesWeights, size_t offset) {
+    for (size_t inf = 0; inf < 4; ++inf) {
+      const auto weight = matricesWeights[offset + inf];
+      const auto bone   = static_cast<size_t>(matricesIndices[offset + inf]);
+      if (weight > 0.f && bone < boneCount) {
+        const auto* matrix = matrices + bone * 16;
+        const Float32x4 scale(weight);
+        rows[0] += load(matrix) * scale;
+        rows[1] += load(matrix + 4) * scale;
+        rows[2] += load(matrix + 8) * scale;
+        rows[3] += load(matrix + 12) * scale;
+      }
+    }
+  };
+#else
+  float rows[16];
+  const auto blend = [&](const float* matricesIndices,
+                         const float* matricesWeights, size_t offset) {
+    for (size_t inf = 0; inf < 4; ++inf) {
+      const auto weight = matricesWeights[offset + inf];
+      const auto bone   = static_cast<size_t>(matricesIndices[offset + inf]);
+      if (weight > 0.f && bone < boneCount) {
+        const auto* matrix = matrices + bone * 16;
+        for (size_t i = 0; i < 16; ++i) {
+          rows[i] += matrix[i] * weight;
+        }
+      }
+    }
+  };
+#endif
+
+  for (size_t vertex = start; vertex < end; ++vertex) {
+    const auto offset4 = vertex * 4;
+    if (!_skinAllVertices
+        && !_isAffected(vertices.matricesIndices, vertices.matricesWeights,
+                        offset4)
+        && !(hasExtras
+             && _isAffected(vertices.matricesIndicesExtra,
+                            vertices.matricesWeightsExtra, offset4))) {
+      continue;
+    }
+
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+    rows[0] = rows[1] = rows[2] = rows[3] = Float32x4();
+#else
+    std::fill(rows, rows + 16, 0.f);
+#endif
+    blend(vertices.matricesIndices, vertices.matricesWeights, offset4);
+    if (hasExtras) {
+      blend(vertices.matricesIndicesExtra, vertices.matricesWeightsExtra,
+            offset4);
+    }
+
+    const auto offset3    = vertex * 3;
+    const auto* position  = vertices.sourcePositions + offset3;
+    const auto* normal    = vertices.sourceNormals + offset3;
+    auto* skinnedPosition = vertices.positions + offset3;
+    auto* skinnedNormal   = vertices.normals + offset3;
+
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+    float result[4];
+    _mm_storeu_ps(result, (rows[0] * Float32x4(position[0])
+                           + rows[1] * Float32x4(position[1])
+                           + rows[2] * Float32x4(position[2]) + rows[3])
+                            .xmm);
+    skinnedPosition[0] = result[0] / result[3];
+    skinnedPosition[1] = result[1] / result[3];
+    skinnedPosition[2] = result[2] / result[3];
+
+    _mm_storeu_ps(result, (rows[0] * Float32x4(normal[0])
+                           + rows[1] * Float32x4(normal[1])
+                           + rows[2] * Float32x4(normal[2]))
+                            .xmm);
+    skinnedNormal[0] = result[0];
+    skinnedNormal[1] = result[1];
+    skinnedNormal[2] = result[2];
+#else
+    float result[4];
+    for (size_t i = 0; i < 4; ++i) {
+      result[i] = position[0] * rows[i] + position[1] * rows[4 + i]
+                  + position[2] * rows[8 + i] + rows[12 + i];
+    }
+    skinnedPosition[0] = result[0] / result[3];
+    skinnedPosition[1] = result[1] / result[3];
+    skinnedPosition[2] = result[2] / result[3];
+
+    for (size_t i = 0; i < 3; ++i) {
+      skinnedNormal[i] = normal[0] * rows[i] + normal[1] * rows[4 + i]
+                         + normal[2] * rows[8 + i];
+    }
+#endif
+  }
+}
+
+} // end of namespace BABYLON
@@ -1,8 +1,12 @@
 #include <babylon/mesh/vertex_buffer.h>
 
+#include <cmath>
+#include <cstring>
+
 #include <babylon/core/data_view.h>
 #include <babylon/engine/engine.h>
 #include <babylon/mesh/buffer.h>
+#include <babylon/mesh/vertex_data_view.h>
 
 namespace BABYLON {
 
@@ -73,6 +77,7 @@ constexpr const unsigned int VertexBuffer::UNSIGNED_SHORT;
 constexpr const unsigned int VertexBuffer::INT;
 constexpr const unsigned int VertexBuffer::UNSIGNED_INT;
 constexpr const unsigned int VertexBuffer::FLOAT;
+constexpr const unsigned int VertexBuffer::HALF_FLOAT;
 
 VertexBuffer::VertexBuffer(
   Engine* engine, const Variant<Float32Array, Buffer*> data, unsigned int kind,
@@ -140,6 +145,33 @@ VertexBuffer::~VertexBuffer()
 {
 }
 
+std::unique_ptr<VertexBuffer> VertexBuffer::CreateTyped(
+  Engine* engine, const Float32Array& data, unsigned int kind,
+  unsigned int type, bool normalized, bool updatable,
+  const std::optional<size_t>& size, bool postponeInternalCreation)
+{
+  const auto componentCount
+    = size.has_value() ? *size : VertexBuffer::DeduceStride(kind);
+  const auto byteStride
+    = VertexBuffer::GetAlignedByteStride(componentCount, type);
+
+  auto buffer = std::make_unique<Buffer>(
+    engine,
+    VertexBuffer::Encode(data, componentCount, type, normalized, byteStride),
+    updatable, byteStride, postponeInternalCreation);
+
+  auto vertexBuffer = std::make_unique<VertexBuffer>(
+    engine, ToVariant<Float32Array, Buffer*>(buffer.get()), kind, updatable,
+    true, byteStride, false, 0u, componentCount, type, normalized, true);
+
+  // The vertex buffer owns the buffer holding the encoded data
+  vertexBuffer->_ownedBuffer = std::move(buffer);
+  vertexBuffer->_buffer      = nullptr;
+  vertexBuffer->_ownsBuffer  = true;
+
+  return vertexBuffer;
+}
+
 unsigned int VertexBuffer::get_instanceDivisor() const
 {
   return _instanceDivisor;
@@ -224,11 +256,12 @@ std::string VertexBuffer::KindAsString(unsigned int kind)
 
 void VertexBuffer::_rebuild()
 {
-  if (!_buffer) {
+  auto buffer = _getBuffer();
+  if (!buffer) {
     return;
   }
 
-  _buffer->_rebuild();
+  buffer->_rebuild();
 }
 
 unsigned int VertexBuffer::getKind() const
@@ -256,6 +289,28 @@ Float32Array& VertexBuffer::getData()
   return _getBuffer()->getData();
 }
 
+ArrayBuffer& VertexBuffer::getRawData()
+{
+  return _getBuffer()->getRawData();
+}
+
+VertexDataView VertexBuffer::getDataView(size_t vertexCount)
+{
+  auto& data = _getBuffer()->getData();
+  if (type != VertexBuffer::FLOAT || byteStride % sizeof(float) != 0
+      || byteOffset % sizeof(float) != 0 || vertexCount == 0) {
+    return VertexDataView();
+  }
+
+  const auto offset = byteOffset / sizeof(float);
+  const auto stride = byteStride / sizeof(float);
+  if (data.size() < offset + (vertexCount - 1) * stride + _size) {
+    return VertexDataView();
+  }
+
+  return VertexDataView(data.data() + offset, vertexCount, _size, stride);
+}
+
 GL::IGLBuffer* VertexBuffer::getBuffer()
 {
   return _getBuffer()->getBuffer();
@@ -294,17 +349,41 @@ GL::IGLBuffer* VertexBuffer::create()
 
 GL::IGLBuffer* VertexBuffer::create(const Float32Array& data)
 {
+  if (_getBuffer()->isRaw()) {
+    return update(data);
+  }
+
   return _getBuffer()->create(data);
 }
 
 GL::IGLBuffer* VertexBuffer::update(const Float32Array& data)
 {
-  return _getBuffer()->update(data);
+  auto buffer = _getBuffer();
+  if (buffer->isRaw()) {
+    // Only the components of this vertex buffer are encoded again, the other
+    // components of an interleaved buffer are left unchanged
+    auto rawData = buffer->getRawData();
+    VertexBuffer::_Encode(data, _size, type, normalized, byteOffset,
+                          byteStride, rawData);
+    return buffer->update(rawData);
+  }
+
+  return buffer->update(data);
+}
+
+GL::IGLBuffer* VertexBuffer::update()
+{
+  return _getBuffer()->update();
 }
 
 GL::IGLBuffer* VertexBuffer::updateDirectly(const Float32Array& data,
                                             size_t offset, bool useBytes)
 {
+  // Typed data is encoded as a whole, see update()
+  if (_getBuffer()->isRaw()) {
+    return nullptr;
+  }
+
   return _getBuffer()->updateDirectly(data, offset, std::nullopt, useBytes);
 }
 
@@ -320,8 +399,16 @@ void VertexBuffer::forEach(
   size_t count,
   const std::function<void(float value, size_t index)>& callback)
 {
-  VertexBuffer::ForEach(_buffer->getData(), byteOffset, byteStride, _size, type,
-                        count, normalized, callback);
+  auto buffer = _getBuffer();
+  if (buffer->isRaw()) {
+    VertexBuffer::ForEach(
+      ToVariant<ArrayBuffer, DataView>(buffer->getRawData()), byteOffset,
+      byteStride, _size, type, count, normalized, callback);
+  }
+  else {
+    VertexBuffer::ForEach(buffer->getData(), byteOffset, byteStride, _size,
+                          type, count, normalized, callback);
+  }
 }
 
 size_t VertexBuffer::DeduceStride(unsigned int kind)
@@ -359,8 +446,10 @@ unsigned int VertexBuffer::GetTypeByteLength(unsigned int type)
       return 1;
     case VertexBuffer::SHORT:
     case VertexBuffer::UNSIGNED_SHORT:
+    case VertexBuffer::HALF_FLOAT:
       return 2;
     case VertexBuffer::INT:
+    case VertexBuffer::UNSIGNED_INT:
     case VertexBuffer::FLOAT:
       return 4;
     default:
@@ -368,6 +457,63 @@ unsigned int VertexBuffer::GetTypeByteLength(unsigned int type)
   }
 }
 
+size_t VertexBuffer::GetAlignedByteStride(size_t componentCount,
+                                          unsigned int type)
+{
+  const auto byteLength
+    = componentCount * VertexBuffer::GetTypeByteLength(type);
+  return (byteLength + 3) & ~static_cast<size_t>(3);
+}
+
+ArrayBuffer VertexBuffer::Encode(const Float32Array& data,
+                                 size_t componentCount, unsigned int type,
+                                 bool normalized, size_t byteStride)
+{
+  if (componentCount == 0) {
+    return ArrayBuffer();
+  }
+
+  if (byteStride == 0) {
+    byteStride = VertexBuffer::GetAlignedByteStride(componentCount, type);
+  }
+
+  // The padding bytes of the last vertex are kept
+  const auto vertexCount = data.size() / componentCount;
+
+  ArrayBuffer result(vertexCount * byteStride, 0);
+  VertexBuffer::_Encode(data, componentCount, type, normalized, 0, byteStride,
+                        result);
+  return result;
+}
+
+void VertexBuffer::_Encode(const Float32Array& data, size_t componentCount,
+                           unsigned int type, bool normalized,
+                           size_t byteOffset, size_t byteStride,
+                           ArrayBuffer& target)
+{
+  const auto componentByteLength = VertexBuffer::GetTypeByteLength(type);
+  const auto vertexCount         = data.size() / componentCount;
+  if (vertexCount == 0) {
+    return;
+  }
+
+  const auto byteLength = byteOffset + (vertexCount - 1) * byteStride
+                          + componentCount * componentByteLength;
+  if (target.size() < byteLength) {
+    target.resize(byteLength, 0);
+  }
+
+  for (size_t index = 0; index < vertexCount; ++index) {
+    for (size_t componentIndex = 0; componentIndex < componentCount;
+         ++componentIndex) {
+      VertexBuffer::_SetFloatValue(
+        target, type,
+        byteOffset + index * byteStride + componentIndex * componentByteLength,
+        data[index * componentCount + componentIndex], normalized);
+    }
+  }
+}
+
 void VertexBuffer::ForEach(
   const Float32Array& data, size_t byteOffset, size_t byteStride,
   size_t componentCount, unsigned int /*componentType*/, size_t count,
@@ -429,7 +575,7 @@ float VertexBuffer::_GetFloatValue(const DataView& dataView, unsigned int type,
     case VertexBuffer::SHORT: {
       auto value = static_cast<float>(dataView.getInt16(byteOffset, true));
       if (normalized) {
-        value = std::max(value / 16383.f, -1.f);
+        value = std::max(value / 32767.f, -1.f);
       }
       return value;
     }
@@ -440,6 +586,9 @@ float VertexBuffer::_GetFloatValue(const DataView& dataView, unsigned int type,
       }
       return value;
     }
+    case VertexBuffer::HALF_FLOAT: {
+      return VertexBuffer::_HalfToFloat(dataView.getUint16(byteOffset, true));
+    }
     case VertexBuffer::FLOAT: {
       return dataView.getFloat32(byteOffset, true);
     }
@@ -450,4 +599,117 @@ float VertexBuffer::_GetFloatValue(const DataView& dataView, unsigned int type,
   }
 }
 
+void VertexBuffer::_SetFloatValue(ArrayBuffer& data, unsigned int type,
+                                  size_t byteOffset, float value,
+                                  bool normalized)
+{
+  // Components are stored in little endian order
+  const auto setUint16 = [&data, byteOffset](uint16_t bits) {
+    data[byteOffset]     = static_cast<uint8_t>(bits & 0xff);
+    data[byteOffset + 1] = static_cast<uint8_t>(bits >> 8);
+  };
+
+  switch (type) {
+    case VertexBuffer::BYTE: {
+      const auto v = normalized ? std::clamp(value, -1.f, 1.f) * 127.f :
+                                  std::clamp(value, -128.f, 127.f);
+      data[byteOffset]
+        = static_cast<uint8_t>(static_cast<int8_t>(std::lround(v)));
+    } break;
+    case VertexBuffer::UNSIGNED_BYTE: {
+      const auto v = normalized ? std::clamp(value, 0.f, 1.f) * 255.f :
+                                  std::clamp(value, 0.f, 255.f);
+      data[byteOffset] = static_cast<uint8_t>(std::lround(v));
+    } break;
+    case VertexBuffer::SHORT: {
+      const auto v = normalized ? std::clamp(value, -1.f, 1.f) * 32767.f :
+                                  std::clamp(value, -32768.f, 32767.f);
+      setUint16(static_cast<uint16_t>(static_cast<int16_t>(std::lround(v))));
+    } break;
+    case VertexBuffer::UNSIGNED_SHORT: {
+      const auto v = normalized ? std::clamp(value, 0.f, 1.f) * 65535.f :
+                                  std::clamp(value, 0.f, 65535.f);
+      setUint16(static_cast<uint16_t>(std::lround(v)));
+    } break;
+    case VertexBuffer::HALF_FLOAT: {
+      setUint16(VertexBuffer::_FloatToHalf(value));
+    } break;
+    case VertexBuffer::FLOAT: {
+      uint32_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      for (size_t i = 0; i < 4; ++i) {
+        data[byteOffset + i] = static_cast<uint8_t>((bits >> (8 * i)) & 0xff);
+      }
+    } break;
+    default: {
+      throw std::runtime_error("Invalid component type "
+                                 + std::to_string(type));
+    }
+  }
+}
+
+float VertexBuffer::_HalfToFloat(uint16_t value)
+{
+  const uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+  uint32_t exponent   = (value >> 10) & 0x1f;
+  uint32_t mantissa   = value & 0x03ff;
+
+  uint32_t bits = sign;
+  if (exponent == 0x1f) { // Inf or NaN
+    bits |= 0x7f800000 | (mantissa << 13);
+  }
+  else if (exponent != 0) { // Normalized value
+    bits |= ((exponent + 127 - 15) << 23) | (mantissa << 13);
+  }
+  else if (mantissa != 0) { // Denormalized value, renormalized as a float
+    exponent = 127 - 15 + 1;
+    while (!(mantissa & 0x0400)) {
+      mantissa <<= 1;
+      --exponent;
+    }
+    bits |= (exponent << 23) | ((mantissa & 0x03ff) << 13);
+  }
+
+  float result;
+  std::memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+uint16_t VertexBuffer::_FloatToHalf(float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  const auto sign     = static_cast<uint16_t>((bits >> 16) & 0x8000);
+  const auto exponent = static_cast<int>((bits >> 23) & 0xff) - 127 + 15;
+  auto mantissa       = bits & 0x007fffff;
+
+  if (((bits >> 23) & 0xff) == 0xff) { // Inf or NaN
+    return static_cast<uint16_t>(sign | 0x7c00 | (mantissa ? 0x0200 : 0));
+  }
+  if (exponent >= 0x1f) { // Overflow, clamped to Inf
+    return static_cast<uint16_t>(sign | 0x7c00);
+  }
+  if (exponent <= 0) { // Denormalized half or signed zero
+    if (exponent < -10) {
+      return sign;
+    }
+    mantissa |= 0x00800000;
+    const auto shift = static_cast<uint32_t>(14 - exponent);
+    auto half        = mantissa >> shift;
+    // Round to nearest
+    if ((mantissa >> (shift - 1)) & 1) {
+      ++half;
+    }
+    return static_cast<uint16_t>(sign | half);
+  }
+
+  // Round to nearest, a carry correctly bumps the exponent
+  auto half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+  if (mantissa & 0x00001000) {
+    ++half;
+  }
+  return static_cast<uint16_t>(sign | half);
+}
+
 } // end of namespace BABYLON
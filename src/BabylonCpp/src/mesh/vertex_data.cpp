@@ -1,7 +1,9 @@
 #include <babylon/mesh/vertex_data.h>
 
+#include <babylon/babylon_options.h>
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/json.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engine/engine.h>
 #include <babylon/math/axis.h>
 #include <babylon/math/vector2.h>
@@ -12,8 +14,15 @@
 #include <babylon/mesh/vertex_data_options.h>
 #include <babylon/tools/tools.h>
 
+// SIMD
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+#include <babylon/math/simd/float32x4.h>
+#endif
+
 namespace BABYLON {
 
+constexpr size_t VertexData::FacetsPerTask;
+
 VertexData::VertexData()
 {
 }
@@ -2654,245 +2663,353 @@ void VertexData::ComputeNormals(const Float32Array& positions,
                                 Float32Array& normals,
                                 std::optional<FacetParameters> options)
 {
-  if (normals.size() < positions.size()) {
-    normals.resize(positions.size());
-  }
-
-  // temporary scalar variables
-  unsigned int index         = 0;   // facet index
-  float p1p2x                = 0.f; // p1p2 vector x coordinate
-  float p1p2y                = 0.f; // p1p2 vector y coordinate
-  float p1p2z                = 0.f; // p1p2 vector z coordinate
-  float p3p2x                = 0.f; // p3p2 vector x coordinate
-  float p3p2y                = 0.f; // p3p2 vector y coordinate
-  float p3p2z                = 0.f; // p3p2 vector z coordinate
-  float faceNormalx          = 0.f; // facet normal x coordinate
-  float faceNormaly          = 0.f; // facet normal y coordinate
-  float faceNormalz          = 0.f; // facet normal z coordinate
-  float length               = 0.f; // facet normal length before normalization
-  unsigned int v1x           = 0;   // vector1 x index in the positions array
-  unsigned int v1y           = 0;   // vector1 y index in the positions array
-  unsigned int v1z           = 0;   // vector1 z index in the positions array
-  unsigned int v2x           = 0;   // vector2 x index in the positions array
-  unsigned int v2y           = 0;   // vector2 y index in the positions array
-  unsigned int v2z           = 0;   // vector2 z index in the positions array
-  unsigned int v3x           = 0;   // vector3 x index in the positions array
-  unsigned int v3y           = 0;   // vector3 y index in the positions array
-  unsigned int v3z           = 0;   // vector3 z index in the positions array
-  bool computeFacetNormals   = false;
-  bool computeFacetPositions = false;
-  bool computeFacetPartitioning  = false;
-  bool computeDepthSort          = false;
-  float faceNormalSign           = 1.f;
-  float ratio                    = 0.f;
-  std::optional<Vector3> distanceTo = std::nullopt;
-  std::vector<DepthSortedFacet> depthSortedFacets;
+  VertexData::_ComputeNormals(positions, indices, normals,
+                              options ? &(*options) : nullptr, nullptr);
+}
+
+void VertexData::ComputeNormals(const Float32Array& positions,
+                                const Uint32Array& indices,
+                                Float32Array& normals, FacetParameters& options,
+                                ThreadPool* threadPool)
+{
+  VertexData::_ComputeNormals(positions, indices, normals, &options,
+                              threadPool);
+}
+
+void VertexData::ComputeNormals(const Float32Array& positions,
+                                const Uint32Array& indices,
+                                Float32Array& normals, ThreadPool* threadPool)
+{
+  VertexData::_ComputeNormals(positions, indices, normals, nullptr,
+                              threadPool);
+}
+
+void VertexData::_ComputeNormals(const Float32Array& positions,
+                                 const Uint32Array& indices,
+                                 Float32Array& normals,
+                                 FacetParameters* options,
+                                 ThreadPool* threadPool)
+{
+  bool computeFacetNormals      = false;
+  bool computeFacetPositions    = false;
+  bool computeFacetPartitioning = false;
+  bool computeDepthSort         = false;
+  float faceNormalSign          = 1.f;
+  Vector3 distanceTo;
   if (options) {
-    computeFacetNormals   = (!options->facetNormals.empty()) ? true : false;
-    computeFacetPositions = (!options->facetPositions.empty()) ? true : false;
+    computeFacetNormals      = !options->facetNormals.empty();
+    computeFacetPositions    = !options->facetPositions.empty();
+    // the partitioning is requested with its bounding box size
     computeFacetPartitioning
-      = (!options->facetPartitioning.empty()) ? true : false;
-    faceNormalSign   = (options->useRightHandedSystem == true) ? -1.f : 1.f;
-    ratio            = options->ratio ? *options->ratio : 0.f;
-    computeDepthSort = (options->depthSort) ? true : false;
-    distanceTo       = options->distanceTo;
-    if (computeDepthSort) {
-      if (!distanceTo.has_value()) {
-        distanceTo = Vector3::Zero();
-      }
-      depthSortedFacets = options->depthSortedFacets;
-    }
+      = (!options->facetPartitioning.empty() || options->bbSize.has_value())
+        && computeFacetPositions;
+    faceNormalSign   = options->useRightHandedSystem ? -1.f : 1.f;
+    computeDepthSort = options->depthSort && computeFacetPositions;
+    distanceTo       = options->distanceTo.value_or(Vector3::Zero());
   }
 
-  // facetPartitioning reinit if needed
-  float xSubRatio    = 0.f;
-  float ySubRatio    = 0.f;
-  float zSubRatio    = 0.f;
-  unsigned int subSq = 0;
-
-  unsigned int ox           = 0; // X partitioning index for facet position
-  unsigned int oy           = 0; // Y partinioning index for facet position
-  unsigned int oz           = 0; // Z partinioning index for facet position
-  unsigned int b1x          = 0; // X partitioning index for facet v1 vertex
-  unsigned int b1y          = 0; // Y partitioning index for facet v1 vertex
-  unsigned int b1z          = 0; // z partitioning index for facet v1 vertex
-  unsigned int b2x          = 0; // X partitioning index for facet v2 vertex
-  unsigned int b2y          = 0; // Y partitioning index for facet v2 vertex
-  unsigned int b2z          = 0; // Z partitioning index for facet v2 vertex
-  unsigned int b3x          = 0; // X partitioning index for facet v3 vertex
-  unsigned int b3y          = 0; // Y partitioning index for facet v3 vertex
-  unsigned int b3z          = 0; // Z partitioning index for facet v3 vertex
-  unsigned int block_idx_o  = 0; // facet barycenter block index
-  unsigned int block_idx_v1 = 0; // v1 vertex block index
-  unsigned int block_idx_v2 = 0; // v2 vertex block index
-  unsigned int block_idx_v3 = 0; // v3 vertex block index
-
-  if (computeFacetPartitioning && options && (*options).bbSize) {
-    const auto& bbSize = *options->bbSize;
-    float bbSizeMax    = (bbSize.x > bbSize.y) ? bbSize.x : bbSize.y;
-    bbSizeMax          = (bbSizeMax > bbSize.z) ? bbSizeMax : bbSize.z;
-    xSubRatio          = options->subDiv.X * ratio / bbSize.x;
-    ySubRatio          = options->subDiv.Y * ratio / bbSize.y;
-    zSubRatio          = options->subDiv.Z * ratio / bbSize.z;
-    subSq              = options->subDiv.max * options->subDiv.max;
-    options->facetPartitioning.clear();
+  const size_t nbFaces     = indices.size() / 3;
+  const size_t vertexCount = positions.size() / 3;
+  if (computeDepthSort && options->depthSortedFacets.size() < nbFaces) {
+    options->depthSortedFacets.resize(nbFaces);
   }
 
   // reset the normals
-  normals.resize(positions.size());
-  std::fill(normals.begin(), normals.end(), 0.f);
+  normals.assign(positions.size(), 0.f);
+
+  // normalized facet normals, accumulated per vertex afterwards
+  Float32Array faceNormals(nbFaces * 3);
 
   // Loop : 1 indice triplet = 1 facet
-  size_t nbFaces = indices.size() / 3;
-  for (index = 0; index < nbFaces; index++) {
-
-    // get the indexes of the coordinates of each vertex of the facet
-    v1x = indices[index * 3] * 3;
-    v1y = v1x + 1;
-    v1z = v1x + 2;
-    v2x = indices[index * 3 + 1] * 3;
-    v2y = v2x + 1;
-    v2z = v2x + 2;
-    v3x = indices[index * 3 + 2] * 3;
-    v3y = v3x + 1;
-    v3z = v3x + 2;
-
-    // compute two vectors per facet : p1p2 and p3p2
-    p1p2x = positions[v1x] - positions[v2x];
-    p1p2y = positions[v1y] - positions[v2y];
-    p1p2z = positions[v1z] - positions[v2z];
-
-    p3p2x = positions[v3x] - positions[v2x];
-    p3p2y = positions[v3y] - positions[v2y];
-    p3p2z = positions[v3z] - positions[v2z];
-
-    // compute the face normal with the cross product
-    faceNormalx = faceNormalSign * (p1p2y * p3p2z - p1p2z * p3p2y);
-    faceNormaly = faceNormalSign * (p1p2z * p3p2x - p1p2x * p3p2z);
-    faceNormalz = faceNormalSign * (p1p2x * p3p2y - p1p2y * p3p2x);
-
-    // normalize this normal and store it in the array facetData
-    length = std::sqrt(faceNormalx * faceNormalx + faceNormaly * faceNormaly
-                         + faceNormalz * faceNormalz);
-    length = stl_util::almost_equal(length, 0.f) ? 1.f : length;
-    faceNormalx /= length;
-    faceNormaly /= length;
-    faceNormalz /= length;
-
-    if (computeFacetNormals && options) {
-      options->facetNormals[index].x = faceNormalx;
-      options->facetNormals[index].y = faceNormaly;
-      options->facetNormals[index].z = faceNormalz;
-    }
+  const auto computeFacets = [&](size_t start, size_t end) {
+    for (size_t index = start; index < end; ++index) {
+      // get the indexes of the coordinates of each vertex of the facet
+      const size_t v1x = indices[index * 3] * 3;
+      const size_t v2x = indices[index * 3 + 1] * 3;
+      const size_t v3x = indices[index * 3 + 2] * 3;
+
+      // compute two vectors per facet : p1p2 and p3p2
+      const auto p1p2x = positions[v1x] - positions[v2x];
+      const auto p1p2y = positions[v1x + 1] - positions[v2x + 1];
+      const auto p1p2z = positions[v1x + 2] - positions[v2x + 2];
+
+      const auto p3p2x = positions[v3x] - positions[v2x];
+      const auto p3p2y = positions[v3x + 1] - positions[v2x + 1];
+      const auto p3p2z = positions[v3x + 2] - positions[v2x + 2];
+
+      // compute the face normal with the cross product
+      auto faceNormalx = faceNormalSign * (p1p2y * p3p2z - p1p2z * p3p2y);
+      auto faceNormaly = faceNormalSign * (p1p2z * p3p2x - p1p2x * p3p2z);
+      auto faceNormalz = faceNormalSign * (p1p2x * p3p2y - p1p2y * p3p2x);
+
+      // normalize this normal and store it in the array facetData
+      auto length = std::sqrt(faceNormalx * faceNormalx
+                              + faceNormaly * faceNormaly
+                              + faceNormalz * faceNormalz);
+      length = stl_util::almost_equal(length, 0.f) ? 1.f : length;
+      faceNormalx /= length;
+      faceNormaly /= length;
+      faceNormalz /= length;
+
+      faceNormals[index * 3]     = faceNormalx;
+      faceNormals[index * 3 + 1] = faceNormaly;
+      faceNormals[index * 3 + 2] = faceNormalz;
+
+      if (computeFacetNormals) {
+        options->facetNormals[index].x = faceNormalx;
+        options->facetNormals[index].y = faceNormaly;
+        options->facetNormals[index].z = faceNormalz;
+      }
 
-    if (computeFacetPositions && options) {
-      // compute and the facet barycenter coordinates in the array
-      // facetPositions
-      options->facetPositions[index].x
-        = (positions[v1x] + positions[v2x] + positions[v3x]) / 3.f;
-      options->facetPositions[index].y
-        = (positions[v1y] + positions[v2y] + positions[v3y]) / 3.f;
-      options->facetPositions[index].z
-        = (positions[v1z] + positions[v2z] + positions[v3z]) / 3.f;
+      if (computeFacetPositions) {
+        // compute and the facet barycenter coordinates in the array
+        // facetPositions
+        options->facetPositions[index].x
+          = (positions[v1x] + positions[v2x] + positions[v3x]) / 3.f;
+        options->facetPositions[index].y
+          = (positions[v1x + 1] + positions[v2x + 1] + positions[v3x + 1])
+            / 3.f;
+        options->facetPositions[index].z
+          = (positions[v1x + 2] + positions[v2x + 2] + positions[v3x + 2])
+            / 3.f;
+      }
+
+      if (computeDepthSort) {
+        auto& dsf      = options->depthSortedFacets[index];
+        dsf.ind        = static_cast<unsigned int>(index * 3);
+        dsf.sqDistance = Vector3::DistanceSquared(
+          options->facetPositions[index], distanceTo);
+      }
     }
+  };
 
-    if (computeFacetPartitioning && options) {
-      // store the facet indexes in arrays in the main facetPartitioning array :
-      // compute each facet vertex (+ facet barycenter) index in the partiniong
-      // array
-      ox  = static_cast<unsigned>(std::floor(
-        (options->facetPositions[index].x - options->bInfo.minimum.x * ratio)
-        * xSubRatio));
-      oy  = static_cast<unsigned>(std::floor(
-        (options->facetPositions[index].y - options->bInfo.minimum.y * ratio)
-        * ySubRatio));
-      oz  = static_cast<unsigned>(std::floor(
-        (options->facetPositions[index].z - options->bInfo.minimum.z * ratio)
-        * zSubRatio));
-      b1x = static_cast<unsigned>(std::floor(
-        (positions[v1x] - options->bInfo.minimum.x * ratio) * xSubRatio));
-      b1y = static_cast<unsigned>(std::floor(
-        (positions[v1y] - options->bInfo.minimum.y * ratio) * ySubRatio));
-      b1z = static_cast<unsigned>(std::floor(
-        (positions[v1z] - options->bInfo.minimum.z * ratio) * zSubRatio));
-      b2x = static_cast<unsigned>(std::floor(
-        (positions[v2x] - options->bInfo.minimum.x * ratio) * xSubRatio));
-      b2y = static_cast<unsigned>(std::floor(
-        (positions[v2y] - options->bInfo.minimum.y * ratio) * ySubRatio));
-      b2z = static_cast<unsigned>(std::floor(
-        (positions[v2z] - options->bInfo.minimum.z * ratio) * zSubRatio));
-      b3x = static_cast<unsigned>(std::floor(
-        (positions[v3x] - options->bInfo.minimum.x * ratio) * xSubRatio));
-      b3y = static_cast<unsigned>(std::floor(
-        (positions[v3y] - options->bInfo.minimum.y * ratio) * ySubRatio));
-      b3z = static_cast<unsigned>(std::floor(
-        (positions[v3z] - options->bInfo.minimum.z * ratio) * zSubRatio));
-
-      block_idx_v1 = b1x + options->subDiv.max * b1y + subSq * b1z;
-      block_idx_v2 = b2x + options->subDiv.max * b2y + subSq * b2z;
-      block_idx_v3 = b3x + options->subDiv.max * b3y + subSq * b3z;
-      block_idx_o  = ox + options->subDiv.max * oy + subSq * oz;
-
-      const std::array<unsigned int, 4> block_idxs{
-        {block_idx_o, block_idx_v1, block_idx_v2, block_idx_v3}};
-      for (auto& block_idx : block_idxs) {
-        // Check if facetPartitioning needs to be resized
-        if (options->facetPartitioning.size() <= block_idx) {
-          options->facetPartitioning.resize(block_idx + 1);
+  // accumulate the facet normals of a range of facets per vertex, in a target
+  // array starting at the given vertex
+  const auto accumulate
+    = [&](float* target, size_t firstVertex, size_t start, size_t end) {
+        for (size_t index = start; index < end; ++index) {
+          const auto* faceNormal = faceNormals.data() + index * 3;
+          for (size_t corner = 0; corner < 3; ++corner) {
+            auto* normal
+              = target + (indices[index * 3 + corner] - firstVertex) * 3;
+            normal[0] += faceNormal[0];
+            normal[1] += faceNormal[1];
+            normal[2] += faceNormal[2];
+          }
         }
-      }
+      };
 
-      // push each facet index in each block containing the vertex
-      options->facetPartitioning[block_idx_v1].emplace_back(index);
-      if (block_idx_v2 != block_idx_v1) {
-        options->facetPartitioning[block_idx_v2].emplace_back(index);
-      }
-      if (!(block_idx_v3 == block_idx_v2 || block_idx_v3 == block_idx_v1)) {
-        options->facetPartitioning[block_idx_v3].emplace_back(index);
+  const auto taskCount = (nbFaces + FacetsPerTask - 1) / FacetsPerTask;
+  if (!threadPool || taskCount < 2) {
+    computeFacets(0, nbFaces);
+    if (computeFacetPartitioning) {
+      VertexData::_PartitionFacets(positions, indices, *options);
+    }
+    accumulate(normals.data(), 0, 0, nbFaces);
+    // last normalization of each normal
+    VertexData::_NormalizeNormals(normals.data(), 0, vertexCount);
+    return;
+  }
+
+  // range of the vertices referenced by the facets of each task
+  std::vector<std::pair<size_t, size_t>> vertexRanges(taskCount);
+  threadPool->parallelFor(taskCount, [&](size_t task) {
+    const auto start = task * FacetsPerTask;
+    const auto end   = std::min(start + FacetsPerTask, nbFaces);
+    computeFacets(start, end);
+    const auto range = std::minmax_element(indices.begin() + start * 3,
+                                           indices.begin() + end * 3);
+    vertexRanges[task] = {*range.first, *range.second + 1};
+  });
+
+  // the partitioning appends the facets to shared arrays, in facet order
+  if (computeFacetPartitioning) {
+    VertexData::_PartitionFacets(positions, indices, *options);
+  }
+
+  const auto vertexTaskCount
+    = (vertexCount + FacetsPerTask - 1) / FacetsPerTask;
+  const auto normalize = [&](size_t vertexTask) {
+    const auto start = vertexTask * FacetsPerTask;
+    const auto end   = std::min(start + FacetsPerTask, vertexCount);
+    VertexData::_NormalizeNormals(normals.data(), start, end);
+  };
+
+  // each task accumulates its facet normals in its own bucket, holding the
+  // range of vertices referenced by its facets
+  std::vector<size_t> bucketOffsets(taskCount + 1, 0);
+  for (size_t task = 0; task < taskCount; ++task) {
+    const auto& range = vertexRanges[task];
+    bucketOffsets[task + 1]
+      = bucketOffsets[task] + (range.second - range.first) * 3;
+  }
+
+  if (bucketOffsets.back() > 4 * normals.size()) {
+    // the facets are scattered over the vertices, the buckets would take more
+    // memory than they save time
+    accumulate(normals.data(), 0, 0, nbFaces);
+    threadPool->parallelFor(vertexTaskCount, normalize);
+    return;
+  }
+
+  Float32Array buckets(bucketOffsets.back());
+  threadPool->parallelFor(taskCount, [&](size_t task) {
+    const auto start = task * FacetsPerTask;
+    accumulate(buckets.data() + bucketOffsets[task], vertexRanges[task].first,
+               start, std::min(start + FacetsPerTask, nbFaces));
+  });
+
+  // sum the buckets per vertex in task order, the result does not depend on
+  // the scheduling of the tasks
+  threadPool->parallelFor(vertexTaskCount, [&](size_t vertexTask) {
+    const auto start = vertexTask * FacetsPerTask;
+    const auto end   = std::min(start + FacetsPerTask, vertexCount);
+    for (size_t task = 0; task < taskCount; ++task) {
+      const auto& range = vertexRanges[task];
+      const auto first  = std::max(start, range.first);
+      const auto last   = std::min(end, range.second);
+      if (first >= last) {
+        continue;
       }
-      if (!(block_idx_o == block_idx_v1 || block_idx_o == block_idx_v2
-            || block_idx_o == block_idx_v3)) {
-        options->facetPartitioning[block_idx_o].emplace_back(index);
+      const auto* bucket
+        = buckets.data() + bucketOffsets[task] + (first - range.first) * 3;
+      auto* normal = normals.data() + first * 3;
+      for (size_t i = 0; i < (last - first) * 3; ++i) {
+        normal[i] += bucket[i];
       }
     }
+    normalize(vertexTask);
+  });
+}
+
+void VertexData::_PartitionFacets(const Float32Array& positions,
+                                  const Uint32Array& indices,
+                                  FacetParameters& options)
+{
+  const auto ratio = options.ratio ? *options.ratio : 0.f;
 
-    if (computeDepthSort && options && !options->facetPositions.empty()) {
-      if (nbFaces >= depthSortedFacets.size()) {
-        depthSortedFacets.resize(nbFaces);
+  // facetPartitioning reinit if needed
+  float xSubRatio    = 0.f;
+  float ySubRatio    = 0.f;
+  float zSubRatio    = 0.f;
+  unsigned int subSq = 0;
+
+  if (options.bbSize) {
+    const auto& bbSize = *options.bbSize;
+    xSubRatio          = options.subDiv.X * ratio / bbSize.x;
+    ySubRatio          = options.subDiv.Y * ratio / bbSize.y;
+    zSubRatio          = options.subDiv.Z * ratio / bbSize.z;
+    subSq              = options.subDiv.max * options.subDiv.max;
+    options.facetPartitioning.clear();
+  }
+
+  const auto& minimum = options.bInfo.minimum;
+  // partitioning index of a coordinate
+  const auto block = [&](float value, float min, float subRatio) {
+    return static_cast<unsigned>(std::floor((value - min * ratio) * subRatio));
+  };
+  // partitioning array index of a position
+  const auto blockIndex = [&](float x, float y, float z) {
+    return block(x, minimum.x, xSubRatio)
+           + options.subDiv.max * block(y, minimum.y, ySubRatio)
+           + subSq * block(z, minimum.z, zSubRatio);
+  };
+
+  const size_t nbFaces = indices.size() / 3;
+  for (size_t index = 0; index < nbFaces; ++index) {
+    const size_t v1x = indices[index * 3] * 3;
+    const size_t v2x = indices[index * 3 + 1] * 3;
+    const size_t v3x = indices[index * 3 + 2] * 3;
+
+    // compute each facet vertex (+ facet barycenter) index in the
+    // partitioning array
+    const auto& facetPosition = options.facetPositions[index];
+    const auto block_idx_o
+      = blockIndex(facetPosition.x, facetPosition.y, facetPosition.z);
+    const auto block_idx_v1
+      = blockIndex(positions[v1x], positions[v1x + 1], positions[v1x + 2]);
+    const auto block_idx_v2
+      = blockIndex(positions[v2x], positions[v2x + 1], positions[v2x + 2]);
+    const auto block_idx_v3
+      = blockIndex(positions[v3x], positions[v3x + 1], positions[v3x + 2]);
+
+    const std::array<unsigned int, 4> block_idxs{
+      {block_idx_o, block_idx_v1, block_idx_v2, block_idx_v3}};
+    for (auto& block_idx : block_idxs) {
+      // Check if facetPartitioning needs to be resized
+      if (options.facetPartitioning.size() <= block_idx) {
+        options.facetPartitioning.resize(block_idx + 1);
       }
-      auto& dsf = depthSortedFacets[index];
-      dsf.ind   = index * 3;
-      dsf.sqDistance
-        = Vector3::DistanceSquared(options->facetPositions[index], *distanceTo);
     }
 
-    // compute the normals anyway
-    normals[v1x] += faceNormalx; // accumulate all the normals per face
-    normals[v1y] += faceNormaly;
-    normals[v1z] += faceNormalz;
-    normals[v2x] += faceNormalx;
-    normals[v2y] += faceNormaly;
-    normals[v2z] += faceNormalz;
-    normals[v3x] += faceNormalx;
-    normals[v3y] += faceNormaly;
-    normals[v3z] += faceNormalz;
-  }
-  // last normalization of each normal
-  for (index = 0; index < normals.size() / 3; ++index) {
-    faceNormalx = normals[index * 3];
-    faceNormaly = normals[index * 3 + 1];
-    faceNormalz = normals[index * 3 + 2];
-
-    length = std::sqrt(faceNormalx * faceNormalx + faceNormaly * faceNormaly
-                         + faceNormalz * faceNormalz);
-    length = stl_util::almost_equal(length, 0.f) ? 1.f : length;
-    faceNormalx /= length;
-    faceNormaly /= length;
-    faceNormalz /= length;
-
-    normals[index * 3]     = faceNormalx;
-    normals[index * 3 + 1] = faceNormaly;
-    normals[index * 3 + 2] = faceNormalz;
+    // push each facet index in each block containing the vertex
+    const auto facetIndex = static_cast<unsigned int>(index);
+    options.facetPartitioning[block_idx_v1].emplace_back(facetIndex);
+    if (block_idx_v2 != block_idx_v1) {
+      options.facetPartitioning[block_idx_v2].emplace_back(facetIndex);
+    }
+    if (!(block_idx_v3 == block_idx_v2 || block_idx_v3 == block_idx_v1)) {
+      options.facetPartitioning[block_idx_v3].emplace_back(facetIndex);
+    }
+    if (!(block_idx_o == block_idx_v1 || block_idx_o == block_idx_v2
+          || block_idx_o == block_idx_v3)) {
+      options.facetPartitioning[block_idx_o].emplace_back(facetIndex);
+    }
+  }
+}
+
+void VertexData::_NormalizeNormals(float* normals, size_t start, size_t end)
+{
+  // a null normal is left unchanged, see stl_util::almost_equal()
+  const auto minLength = std::numeric_limits<float>::min();
+
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+  using SIMD::Float32x4;
+  const auto one        = _mm_set1_ps(1.f);
+  const auto minLength4 = _mm_set1_ps(minLength);
+  // 4 normals, i.e. 3 vectors of 4 floats, per iteration
+  for (; start + 4 <= end; start += 4) {
+    auto* data = normals + start * 3;
+    const Float32x4 a(_mm_loadu_ps(data));     // x0 y0 z0 x1
+    const Float32x4 b(_mm_loadu_ps(data + 4)); // y1 z1 x2 y2
+    const Float32x4 c(_mm_loadu_ps(data + 8)); // z2 x3 y3 z3
+    const auto aa = (a * a).xmm;
+    const auto bb = (b * b).xmm;
+    const auto cc = (c * c).xmm;
+
+    // squared coordinates grouped per axis: x0 x1 x2 x3, y0 y1 y2 y3, ...
+    const auto xa = _mm_shuffle_ps(aa, bb, _MM_SHUFFLE(2, 2, 3, 0));
+    const auto xb = _mm_shuffle_ps(bb, cc, _MM_SHUFFLE(1, 1, 2, 2));
+    const auto ya = _mm_shuffle_ps(aa, bb, _MM_SHUFFLE(0, 0, 1, 1));
+    const auto yb = _mm_shuffle_ps(bb, cc, _MM_SHUFFLE(2, 2, 3, 3));
+    const auto za = _mm_shuffle_ps(aa, bb, _MM_SHUFFLE(1, 1, 2, 2));
+    const auto zb = _mm_shuffle_ps(cc, cc, _MM_SHUFFLE(3, 3, 0, 0));
+    const Float32x4 xx(_mm_shuffle_ps(xa, xb, _MM_SHUFFLE(2, 0, 1, 0)));
+    const Float32x4 yy(_mm_shuffle_ps(ya, yb, _MM_SHUFFLE(2, 0, 2, 0)));
+    const Float32x4 zz(_mm_shuffle_ps(za, zb, _MM_SHUFFLE(2, 0, 2, 0)));
+
+    auto length       = (xx + yy + zz).sqrt().xmm;
+    const auto isNull = _mm_cmplt_ps(length, minLength4);
+    length = _mm_or_ps(_mm_and_ps(isNull, one), _mm_andnot_ps(isNull, length));
+
+    // lengths spread back over the coordinates
+    const auto la = _mm_shuffle_ps(length, length, _MM_SHUFFLE(1, 0, 0, 0));
+    const auto lb = _mm_shuffle_ps(length, length, _MM_SHUFFLE(2, 2, 1, 1));
+    const auto lc = _mm_shuffle_ps(length, length, _MM_SHUFFLE(3, 3, 3, 2));
+    _mm_storeu_ps(data, _mm_div_ps(a.xmm, la));
+    _mm_storeu_ps(data + 4, _mm_div_ps(b.xmm, lb));
+    _mm_storeu_ps(data + 8, _mm_div_ps(c.xmm, lc));
+  }
+#endif
+
+  for (size_t index = start; index < end; ++index) {
+    auto* normal = normals + index * 3;
+    auto length  = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1]
+                            + normal[2] * normal[2]);
+    length       = (length < minLength) ? 1.f : length;
+    normal[0] /= length;
+    normal[1] /= length;
+    normal[2] /= length;
   }
 }
 
@@ -4,6 +4,7 @@
 #include <babylon/materials/effect.h>
 #include <babylon/math/scalar.h>
 #include <babylon/math/vector3.h>
+#include <babylon/particles/particle.h>
 #include <babylon/particles/particle_system.h>
 
 namespace BABYLON {
@@ -22,11 +23,13 @@ BoxParticleEmitter::~BoxParticleEmitter()
 
 void BoxParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
                                                 Vector3& directionToUpdate,
-                                                Particle* /*particle*/)
+                                                Particle* particle)
 {
-  const auto randX = Scalar::RandomRange(direction1.x, direction2.x);
-  const auto randY = Scalar::RandomRange(direction1.y, direction2.y);
-  const auto randZ = Scalar::RandomRange(direction1.z, direction2.z);
+  auto& random = particle->particleSystem->randomStream();
+
+  const auto randX = random.randomRange(direction1.x, direction2.x);
+  const auto randY = random.randomRange(direction1.y, direction2.y);
+  const auto randZ = random.randomRange(direction1.z, direction2.z);
 
   Vector3::TransformNormalFromFloatsToRef(randX, randY, randZ, worldMatrix,
                                           directionToUpdate);
@@ -34,11 +37,13 @@ void BoxParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
 
 void BoxParticleEmitter::startPositionFunction(const Matrix& worldMatrix,
                                                Vector3& positionToUpdate,
-                                               Particle* /*particle*/)
+                                               Particle* particle)
 {
-  const auto randX = Scalar::RandomRange(minEmitBox.x, maxEmitBox.x);
-  const auto randY = Scalar::RandomRange(minEmitBox.y, maxEmitBox.y);
-  const auto randZ = Scalar::RandomRange(minEmitBox.z, maxEmitBox.z);
+  auto& random = particle->particleSystem->randomStream();
+
+  const auto randX = random.randomRange(minEmitBox.x, maxEmitBox.x);
+  const auto randY = random.randomRange(minEmitBox.y, maxEmitBox.y);
+  const auto randZ = random.randomRange(minEmitBox.z, maxEmitBox.z);
 
   Vector3::TransformCoordinatesFromFloatsToRef(randX, randY, randZ, worldMatrix,
                                                positionToUpdate);
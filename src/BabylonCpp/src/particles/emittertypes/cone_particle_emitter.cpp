@@ -6,6 +6,7 @@
 #include <babylon/math/scalar.h>
 #include <babylon/math/vector3.h>
 #include <babylon/particles/particle.h>
+#include <babylon/particles/particle_system.h>
 
 namespace BABYLON {
 
@@ -64,6 +65,8 @@ void ConeParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
                                                  Vector3& directionToUpdate,
                                                  Particle* particle)
 {
+  auto& random = particle->particleSystem->randomStream();
+
   if (std::abs(std::cos(_angle)) == 1.f) {
     Vector3::TransformNormalFromFloatsToRef(0, 1.0, 0, worldMatrix,
                                             directionToUpdate);
@@ -72,9 +75,9 @@ void ConeParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
     // measure the direction Vector from the emitter to the particle.
     auto direction
       = particle->position.subtract(worldMatrix.getTranslation()).normalize();
-    const auto randX = Scalar::RandomRange(0.f, directionRandomizer);
-    const auto randY = Scalar::RandomRange(0.f, directionRandomizer);
-    const auto randZ = Scalar::RandomRange(0.f, directionRandomizer);
+    const auto randX = random.randomRange(0.f, directionRandomizer);
+    const auto randY = random.randomRange(0.f, directionRandomizer);
+    const auto randZ = random.randomRange(0.f, directionRandomizer);
     direction.x += randX;
     direction.y += randY;
     direction.z += randZ;
@@ -87,20 +90,22 @@ void ConeParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
 
 void ConeParticleEmitter::startPositionFunction(const Matrix& worldMatrix,
                                                 Vector3& positionToUpdate,
-                                                Particle* /*particle*/)
+                                                Particle* particle)
 {
-  const auto s = Scalar::RandomRange(0.f, Math::PI2);
+  auto& random = particle->particleSystem->randomStream();
+
+  const auto s = random.randomRange(0.f, Math::PI2);
   float h      = 0.f;
 
   if (!emitFromSpawnPointOnly) {
-    h = Scalar::RandomRange(0.f, heightRange);
+    h = random.randomRange(0.f, heightRange);
     // Better distribution in a cone at normal angles.
     h = 1.f - h * h;
   }
   else {
     h = 0.0001f;
   }
-  auto radius = _radius - Scalar::RandomRange(0.f, _radius * radiusRange);
+  auto radius = _radius - random.randomRange(0.f, _radius * radiusRange);
   radius      = radius * h;
 
   const auto randX = radius * std::sin(s);
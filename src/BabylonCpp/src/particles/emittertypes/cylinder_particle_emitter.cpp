@@ -5,6 +5,7 @@
 #include <babylon/math/matrix.h>
 #include <babylon/math/scalar.h>
 #include <babylon/particles/particle.h>
+#include <babylon/particles/particle_system.h>
 
 namespace BABYLON {
 
@@ -26,13 +27,15 @@ void CylinderParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
                                                      Vector3& directionToUpdate,
                                                      Particle* particle)
 {
+  auto& random = particle->particleSystem->randomStream();
+
   auto direction
     = particle->position.subtract(worldMatrix.getTranslation()).normalize();
-  auto randY = Scalar::RandomRange(-directionRandomizer / 2.f,
-                                   directionRandomizer / 2.f);
+  auto randY = random.randomRange(-directionRandomizer / 2.f,
+                                  directionRandomizer / 2.f);
 
   auto angle = std::atan2(direction.x, direction.z);
-  angle += Scalar::RandomRange(-Math::PI_2, Math::PI_2) * directionRandomizer;
+  angle += random.randomRange(-Math::PI_2, Math::PI_2) * directionRandomizer;
 
   direction.y
     = randY; // set direction y to rand y to mirror normal of cylinder surface
@@ -46,15 +49,17 @@ void CylinderParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
 
 void CylinderParticleEmitter::startPositionFunction(const Matrix& worldMatrix,
                                                     Vector3& positionToUpdate,
-                                                    Particle* /*particle*/)
+                                                    Particle* particle)
 {
-  auto yPos  = Scalar::RandomRange(-height / 2.f, height / 2.f);
-  auto angle = Scalar::RandomRange(0.f, Math::PI2);
+  auto& random = particle->particleSystem->randomStream();
+
+  auto yPos  = random.randomRange(-height / 2.f, height / 2.f);
+  auto angle = random.randomRange(0.f, Math::PI2);
 
   // Pick a properly distributed point within the circle
   // https://programming.guide/random-point-within-circle.html
   auto radiusDistribution
-    = Scalar::RandomRange((1.f - radiusRange) * (1.f - radiusRange), 1.f);
+    = random.randomRange((1.f - radiusRange) * (1.f - radiusRange), 1.f);
   auto positionRadius = std::sqrt(radiusDistribution) * radius;
   auto xPos           = positionRadius * std::cos(angle);
   auto zPos           = positionRadius * std::sin(angle);
@@ -6,6 +6,7 @@
 #include <babylon/math/scalar.h>
 #include <babylon/math/vector3.h>
 #include <babylon/particles/particle.h>
+#include <babylon/particles/particle_system.h>
 
 namespace BABYLON {
 
@@ -24,11 +25,13 @@ HemisphericParticleEmitter::~HemisphericParticleEmitter()
 void HemisphericParticleEmitter::startDirectionFunction(
   const Matrix& worldMatrix, Vector3& directionToUpdate, Particle* particle)
 {
+  auto& random = particle->particleSystem->randomStream();
+
   auto direction
     = particle->position.subtract(worldMatrix.getTranslation()).normalize();
-  auto randX = Scalar::RandomRange(0.f, directionRandomizer);
-  auto randY = Scalar::RandomRange(0.f, directionRandomizer);
-  auto randZ = Scalar::RandomRange(0.f, directionRandomizer);
+  auto randX = random.randomRange(0.f, directionRandomizer);
+  auto randY = random.randomRange(0.f, directionRandomizer);
+  auto randZ = random.randomRange(0.f, directionRandomizer);
   direction.x += randX;
   direction.y += randY;
   direction.z += randZ;
@@ -39,11 +42,13 @@ void HemisphericParticleEmitter::startDirectionFunction(
 }
 
 void HemisphericParticleEmitter::startPositionFunction(
-  const Matrix& worldMatrix, Vector3& positionToUpdate, Particle* /*particle*/)
+  const Matrix& worldMatrix, Vector3& positionToUpdate, Particle* particle)
 {
-  auto randRadius = radius - Scalar::RandomRange(0.f, radius * radiusRange);
-  auto v          = Scalar::RandomRange(0.f, 1.f);
-  auto phi        = Scalar::RandomRange(0.f, Math::PI2);
+  auto& random = particle->particleSystem->randomStream();
+
+  auto randRadius = radius - random.randomRange(0.f, radius * radiusRange);
+  auto v          = random.randomRange(0.f, 1.f);
+  auto phi        = random.randomRange(0.f, Math::PI2);
   auto theta      = std::acos(2.f * v - 1.f);
   auto randX      = randRadius * std::cos(phi) * std::sin(theta);
   auto randY      = randRadius * std::cos(theta);
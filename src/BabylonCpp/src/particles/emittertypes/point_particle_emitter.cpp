@@ -3,6 +3,8 @@
 #include <babylon/core/json.h>
 #include <babylon/materials/effect.h>
 #include <babylon/math/scalar.h>
+#include <babylon/particles/particle.h>
+#include <babylon/particles/particle_system.h>
 
 namespace BABYLON {
 
@@ -17,11 +19,13 @@ PointParticleEmitter::~PointParticleEmitter()
 
 void PointParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
                                                   Vector3& directionToUpdate,
-                                                  Particle* /*particle*/)
+                                                  Particle* particle)
 {
-  auto randX = Scalar::RandomRange(direction1.x, direction2.x);
-  auto randY = Scalar::RandomRange(direction1.y, direction2.y);
-  auto randZ = Scalar::RandomRange(direction1.z, direction2.z);
+  auto& random = particle->particleSystem->randomStream();
+
+  auto randX = random.randomRange(direction1.x, direction2.x);
+  auto randY = random.randomRange(direction1.y, direction2.y);
+  auto randZ = random.randomRange(direction1.z, direction2.z);
 
   Vector3::TransformNormalFromFloatsToRef(randX, randY, randZ, worldMatrix,
                                           directionToUpdate);
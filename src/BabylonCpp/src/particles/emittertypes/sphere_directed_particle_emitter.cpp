@@ -3,6 +3,8 @@
 #include <babylon/core/json.h>
 #include <babylon/materials/effect.h>
 #include <babylon/math/scalar.h>
+#include <babylon/particles/particle.h>
+#include <babylon/particles/particle_system.h>
 
 namespace BABYLON {
 
@@ -19,11 +21,13 @@ SphereDirectedParticleEmitter::~SphereDirectedParticleEmitter()
 }
 
 void SphereDirectedParticleEmitter::startDirectionFunction(
-  const Matrix& worldMatrix, Vector3& directionToUpdate, Particle* /*particle*/)
+  const Matrix& worldMatrix, Vector3& directionToUpdate, Particle* particle)
 {
-  const auto randX = Scalar::RandomRange(direction1.x, direction2.x);
-  const auto randY = Scalar::RandomRange(direction1.y, direction2.y);
-  const auto randZ = Scalar::RandomRange(direction1.z, direction2.z);
+  auto& random = particle->particleSystem->randomStream();
+
+  const auto randX = random.randomRange(direction1.x, direction2.x);
+  const auto randY = random.randomRange(direction1.y, direction2.y);
+  const auto randZ = random.randomRange(direction1.z, direction2.z);
   Vector3::TransformNormalFromFloatsToRef(randX, randY, randZ, worldMatrix,
                                           directionToUpdate);
 }
@@ -6,6 +6,7 @@
 #include <babylon/math/scalar.h>
 #include <babylon/math/vector3.h>
 #include <babylon/particles/particle.h>
+#include <babylon/particles/particle_system.h>
 
 namespace BABYLON {
 
@@ -25,11 +26,13 @@ void SphereParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
                                                    Vector3& directionToUpdate,
                                                    Particle* particle)
 {
+  auto& random = particle->particleSystem->randomStream();
+
   auto direction
     = particle->position.subtract(worldMatrix.getTranslation()).normalize();
-  const auto randX = Scalar::RandomRange(0, directionRandomizer);
-  const auto randY = Scalar::RandomRange(0, directionRandomizer);
-  const auto randZ = Scalar::RandomRange(0, directionRandomizer);
+  const auto randX = random.randomRange(0, directionRandomizer);
+  const auto randY = random.randomRange(0, directionRandomizer);
+  const auto randZ = random.randomRange(0, directionRandomizer);
   direction.x += randX;
   direction.y += randY;
   direction.z += randZ;
@@ -41,11 +44,13 @@ void SphereParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
 
 void SphereParticleEmitter::startPositionFunction(const Matrix& worldMatrix,
                                                   Vector3& positionToUpdate,
-                                                  Particle* /*particle*/)
+                                                  Particle* particle)
 {
-  const auto randRadius = radius - Scalar::RandomRange(0, radius * radiusRange);
-  const auto v          = Scalar::RandomRange(0.f, 1.f);
-  const auto phi        = Scalar::RandomRange(0.f, Math::PI2);
+  auto& random = particle->particleSystem->randomStream();
+
+  const auto randRadius = radius - random.randomRange(0, radius * radiusRange);
+  const auto v          = random.randomRange(0.f, 1.f);
+  const auto phi        = random.randomRange(0.f, Math::PI2);
   const auto theta      = std::acos(2.f * v - 1.f);
 
   const auto randX = randRadius * std::cos(phi) * std::sin(theta);
@@ -19,4 +19,18 @@ bool IParticleSystem::hasEmitter() const
   return emitter.is<AbstractMeshPtr>() || emitter.is<Vector3>();
 }
 
+bool IParticleSystem::_beginAnimate()
+{
+  animate();
+  return false;
+}
+
+void IParticleSystem::_simulate()
+{
+}
+
+void IParticleSystem::_endAnimate()
+{
+}
+
 } // end of namespace BABYLON
@@ -36,6 +36,10 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity,
                                bool isAnimationSheetEnabled, float epsilon)
     : BaseParticleSystem{iName}
     , onDispose{this, &ParticleSystem::set_onDispose}
+    , useStructureOfArrays{this, &ParticleSystem::get_useStructureOfArrays,
+                           &ParticleSystem::set_useStructureOfArrays}
+    , randomSeed{this, &ParticleSystem::get_randomSeed,
+                 &ParticleSystem::set_randomSeed}
     , _vertexBufferSize{11}
     , _newPartsExcess{0}
     , _scaledColorStep{Color4(0.f, 0.f, 0.f, 0.f)}
@@ -47,8 +51,12 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity,
     , _started{false}
     , _stopped{false}
     , _actualFrame{0}
+    , _newParticles{0}
     , _appendParticleVertexes{nullptr}
     , _zeroVector3{Vector3::Zero()}
+    , _useStructureOfArrays{false}
+    , _poolUpdateParameters{nullptr}
+    , _poolSpawnParticle{nullptr}
 {
   _capacity = capacity;
 
@@ -57,6 +65,9 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity,
 
   _scene = scene ? scene : Engine::LastCreatedScene();
 
+  // Deterministic for a given scene creation order
+  set_randomSeed(_scene->getUniqueId());
+
   // Setup the default processing configuration to the scene.
   _attachImageProcessingConfiguration(nullptr);
 
@@ -104,7 +115,7 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity,
               if (currentGradient != *particle->_currentColorGradient) {
                 particle->_currentColor1.copyFrom(particle->_currentColor2);
                 static_cast<ColorGradient&>(nextGradient)
-                  .getColorToRef(particle->_currentColor2);
+                  .getColorToRef(particle->_currentColor2, _random);
                 particle->_currentColorGradient
                   = static_cast<ColorGradient&>(currentGradient);
               }
@@ -131,7 +142,8 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity,
               if (currentGradient != particle->_currentAngularSpeedGradient) {
                 particle->_currentAngularSpeed1
                   = particle->_currentAngularSpeed2;
-                particle->_currentAngularSpeed2 = nextGradient.getFactor();
+                particle->_currentAngularSpeed2
+                  = nextGradient.getFactor(_random);
                 particle->_currentAngularSpeedGradient = currentGradient;
               }
               particle->angularSpeed
@@ -152,7 +164,7 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity,
                 float scale) {
               if (currentGradient != particle->_currentVelocityGradient) {
                 particle->_currentVelocity1 = particle->_currentVelocity2;
-                particle->_currentVelocity2 = nextGradient.getFactor();
+                particle->_currentVelocity2 = nextGradient.getFactor(_random);
                 particle->_currentVelocityGradient = currentGradient;
               }
               directionScale
@@ -171,7 +183,8 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity,
               if (currentGradient != particle->_currentLimitVelocityGradient) {
                 particle->_currentLimitVelocity1
                   = particle->_currentLimitVelocity2;
-                particle->_currentLimitVelocity2 = nextGradient.getFactor();
+                particle->_currentLimitVelocity2
+                  = nextGradient.getFactor(_random);
                 particle->_currentLimitVelocityGradient = currentGradient;
               }
 
@@ -194,7 +207,8 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity,
                 float scale) {
               if (currentGradient != particle->_currentDragGradient) {
                 particle->_currentDrag1        = particle->_currentDrag2;
-                particle->_currentDrag2        = nextGradient.getFactor();
+                particle->_currentDrag2
+                  = nextGradient.getFactor(_random);
                 particle->_currentDragGradient = currentGradient;
               }
 
@@ -250,7 +264,8 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity,
                 float scale) {
               if (currentGradient != particle->_currentSizeGradient) {
                 particle->_currentSize1        = particle->_currentSize2;
-                particle->_currentSize2        = nextGradient.getFactor();
+                particle->_currentSize2
+                  = nextGradient.getFactor(_random);
                 particle->_currentSizeGradient = currentGradient;
               }
               particle->size = Scalar::Lerp(particle->_currentSize1,
@@ -290,6 +305,51 @@ std::vector<Particle*>& ParticleSystem::particles()
   return _particles;
 }
 
+SoAParticlePool& ParticleSystem::particlePool()
+{
+  return _particlePool;
+}
+
+Math::RandomStream& ParticleSystem::randomStream()
+{
+  return _random;
+}
+
+std::uint64_t ParticleSystem::get_randomSeed() const
+{
+  return _randomSeed;
+}
+
+void ParticleSystem::set_randomSeed(std::uint64_t value)
+{
+  _randomSeed = value;
+  _random.seed(_randomSeed);
+}
+
+bool ParticleSystem::get_useStructureOfArrays() const
+{
+  return _useStructureOfArrays;
+}
+
+void ParticleSystem::set_useStructureOfArrays(bool value)
+{
+  if (_useStructureOfArrays == value) {
+    return;
+  }
+
+  reset();
+  _useStructureOfArrays = value;
+
+  if (_useStructureOfArrays) {
+    _particlePool.reserve(_capacity);
+    if (!_poolUpdateParameters) {
+      _poolUpdateParameters
+        = std::make_unique<SoAParticlePool::UpdateParameters>();
+      _poolSpawnParticle = std::make_unique<Particle>(this);
+    }
+  }
+}
+
 void ParticleSystem::set_onDispose(
   const std::function<void(ParticleSystem*, EventState&)>& callback)
 {
@@ -654,6 +714,7 @@ void ParticleSystem::reset()
 {
   _stockParticles.clear();
   _particles.clear();
+  _particlePool.clear();
 }
 
 void ParticleSystem::_appendParticleVertex(unsigned int index,
@@ -774,7 +835,7 @@ void ParticleSystem::_emitFromParticle(Particle* /*particle*/)
   }
 #if 0
   auto templateIndex
-    = static_cast<size_t>(std::floor(Math::random() * subEmitters.size()));
+    = static_cast<size_t>(std::floor(_random.random() * subEmitters.size()));
 
   auto subSystem
     = subEmitters[templateIndex]->clone(name + "_sub", particle->position);
@@ -787,16 +848,12 @@ void ParticleSystem::_emitFromParticle(Particle* /*particle*/)
 void ParticleSystem::_update(int newParticles)
 {
   // Update current
-  _alive = !_particles.empty();
+  _alive = _particleCount() > 0;
 
-  if (emitter.is<AbstractMeshPtr>()) {
-    auto emitterMesh    = emitter.get<AbstractMeshPtr>();
-    _emitterWorldMatrix = *emitterMesh->getWorldMatrix();
-  }
-  else {
-    auto emitterPosition = emitter.get<Vector3>();
-    _emitterWorldMatrix  = Matrix::Translation(
-      emitterPosition.x, emitterPosition.y, emitterPosition.z);
+  if (_useStructureOfArrays) {
+    _updateSoAParticles();
+    _createSoAParticles(newParticles);
+    return;
   }
 
   updateFunction(_particles);
@@ -813,7 +870,7 @@ void ParticleSystem::_update(int newParticles)
     _particles.emplace_back(particle);
 
     // Emitter
-    auto emitPower = Scalar::RandomRange(minEmitPower, maxEmitPower);
+    auto emitPower = _random.randomRange(minEmitPower, maxEmitPower);
 
     if (startPositionFunction) {
       startPositionFunction(_emitterWorldMatrix, particle->position, particle);
@@ -855,8 +912,8 @@ void ParticleSystem::_update(int newParticles)
             float /*scale*/) {
           auto& factorGradient1 = currentGradient;
           auto& factorGradient2 = nextGradient;
-          auto lifeTime1        = factorGradient1.getFactor();
-          auto lifeTime2        = factorGradient2.getFactor();
+          auto lifeTime1        = factorGradient1.getFactor(_random);
+          auto lifeTime2        = factorGradient2.getFactor(_random);
           auto gradient
             = (ratio - factorGradient1.gradient)
               / (factorGradient2.gradient - factorGradient1.gradient);
@@ -864,58 +921,60 @@ void ParticleSystem::_update(int newParticles)
         });
     }
     else {
-      particle->lifeTime = Scalar::RandomRange(minLifeTime, maxLifeTime);
+      particle->lifeTime = _random.randomRange(minLifeTime, maxLifeTime);
     }
 
     // Size
     if (!_sizeGradients.empty()) {
-      particle->size = Scalar::RandomRange(minSize, maxSize);
+      particle->size = _random.randomRange(minSize, maxSize);
     }
     else {
       particle->_currentSizeGradient = _sizeGradients[0];
-      particle->_currentSize1 = (*particle->_currentSizeGradient).getFactor();
+      particle->_currentSize1
+        = (*particle->_currentSizeGradient).getFactor(_random);
       particle->size          = particle->_currentSize1;
 
       if (_sizeGradients.size() > 1) {
-        particle->_currentSize2 = _sizeGradients[1].getFactor();
+        particle->_currentSize2 = _sizeGradients[1].getFactor(_random);
       }
       else {
         particle->_currentSize2 = particle->_currentSize1;
       }
     }
     // Size and scale
-    particle->scale.copyFromFloats(Scalar::RandomRange(minScaleX, maxScaleX),
-                                   Scalar::RandomRange(minScaleY, maxScaleY));
+    particle->scale.copyFromFloats(_random.randomRange(minScaleX, maxScaleX),
+                                   _random.randomRange(minScaleY, maxScaleY));
 
     // Angle
     if (!_angularSpeedGradients.empty()) {
       particle->angularSpeed
-        = Scalar::RandomRange(minAngularSpeed, maxAngularSpeed);
+        = _random.randomRange(minAngularSpeed, maxAngularSpeed);
     }
     else {
       particle->_currentAngularSpeedGradient = _angularSpeedGradients[0];
       particle->angularSpeed
-        = (*particle->_currentAngularSpeedGradient).getFactor();
+        = (*particle->_currentAngularSpeedGradient).getFactor(_random);
       particle->_currentAngularSpeed1 = particle->angularSpeed;
 
       if (_angularSpeedGradients.size() > 1) {
-        particle->_currentAngularSpeed2 = _angularSpeedGradients[1].getFactor();
+        particle->_currentAngularSpeed2
+          = _angularSpeedGradients[1].getFactor(_random);
       }
       else {
         particle->_currentAngularSpeed2 = particle->_currentAngularSpeed1;
       }
     }
     particle->angle
-      = Scalar::RandomRange(minInitialRotation, maxInitialRotation);
+      = _random.randomRange(minInitialRotation, maxInitialRotation);
 
     // Velocity
     if (!_velocityGradients.empty()) {
       particle->_currentVelocityGradient = _velocityGradients[0];
       particle->_currentVelocity1
-        = (*particle->_currentVelocityGradient).getFactor();
+        = (*particle->_currentVelocityGradient).getFactor(_random);
 
       if (_velocityGradients.size() > 1) {
-        particle->_currentVelocity2 = _velocityGradients[1].getFactor();
+        particle->_currentVelocity2 = _velocityGradients[1].getFactor(_random);
       }
       else {
         particle->_currentVelocity2 = particle->_currentVelocity1;
@@ -926,11 +985,11 @@ void ParticleSystem::_update(int newParticles)
     if (!_limitVelocityGradients.empty()) {
       particle->_currentLimitVelocityGradient = _limitVelocityGradients[0];
       particle->_currentLimitVelocity1
-        = particle->_currentLimitVelocityGradient->getFactor();
+        = particle->_currentLimitVelocityGradient->getFactor(_random);
 
       if (_limitVelocityGradients.size() > 1) {
         particle->_currentLimitVelocity2
-          = _limitVelocityGradients[1].getFactor();
+          = _limitVelocityGradients[1].getFactor(_random);
       }
       else {
         particle->_currentLimitVelocity2 = particle->_currentLimitVelocity1;
@@ -940,10 +999,11 @@ void ParticleSystem::_update(int newParticles)
     // Drag
     if (_dragGradients.empty()) {
       particle->_currentDragGradient = _dragGradients[0];
-      particle->_currentDrag1 = particle->_currentDragGradient->getFactor();
+      particle->_currentDrag1
+        = particle->_currentDragGradient->getFactor(_random);
 
       if (_dragGradients.size() > 1) {
-        particle->_currentDrag2 = _dragGradients[1].getFactor();
+        particle->_currentDrag2 = _dragGradients[1].getFactor(_random);
       }
       else {
         particle->_currentDrag2 = particle->_currentDrag1;
@@ -952,7 +1012,7 @@ void ParticleSystem::_update(int newParticles)
 
     // Color
     if (_colorGradients.empty()) {
-      auto step = Scalar::RandomRange(0.f, 1.f);
+      auto step = _random.randomRange(0.f, 1.f);
 
       Color4::LerpToRef(color1, color2, step, particle->color);
 
@@ -961,12 +1021,12 @@ void ParticleSystem::_update(int newParticles)
     }
     else {
       auto currentColorGradient = _colorGradients[0];
-      currentColorGradient.getColorToRef(particle->color);
+      currentColorGradient.getColorToRef(particle->color, _random);
       particle->_currentColorGradient = currentColorGradient;
       particle->_currentColor1.copyFrom(particle->color);
 
       if (_colorGradients.size() > 1) {
-        _colorGradients[1].getColorToRef(particle->_currentColor2);
+        _colorGradients[1].getColorToRef(particle->_currentColor2, _random);
       }
       else {
         particle->_currentColor2.copyFrom(particle->color);
@@ -981,6 +1041,230 @@ void ParticleSystem::_update(int newParticles)
   }
 }
 
+size_t ParticleSystem::_particleCount() const
+{
+  return _useStructureOfArrays ? _particlePool.size() : _particles.size();
+}
+
+void ParticleSystem::_updateSoAParticles()
+{
+  auto& parameters = *_poolUpdateParameters;
+
+  // Gradients are sampled once per step instead of being searched per particle
+  SoAParticlePool::BuildColorGradientTables(_colorGradients,
+                                            parameters.colorGradient);
+  SoAParticlePool::BuildGradientTable(_sizeGradients, parameters.sizeGradient);
+  SoAParticlePool::BuildGradientTable(_angularSpeedGradients,
+                                      parameters.angularSpeedGradient);
+  SoAParticlePool::BuildGradientTable(_velocityGradients,
+                                      parameters.velocityGradient);
+  SoAParticlePool::BuildGradientTable(_limitVelocityGradients,
+                                      parameters.limitVelocityGradient);
+  SoAParticlePool::BuildGradientTable(_dragGradients, parameters.dragGradient);
+
+  parameters.deltaTime             = static_cast<float>(_scaledUpdateSpeed);
+  parameters.gravity               = gravity;
+  parameters.limitVelocityDamping  = limitVelocityDamping;
+  parameters.updateCellIndex       = _isAnimationSheetEnabled;
+  parameters.spriteCellChangeSpeed = spriteCellChangeSpeed;
+
+  _particlePool.update(parameters);
+}
+
+void ParticleSystem::_createSoAParticles(int newParticles)
+{
+  const auto& parameters = *_poolUpdateParameters;
+  auto& pool             = _particlePool;
+  auto& spawnParticle    = *_poolSpawnParticle;
+
+  for (int index = 0; index < newParticles; ++index) {
+    if (pool.size() == _capacity) {
+      break;
+    }
+
+    const auto i = pool.add();
+
+    // Emitter
+    auto emitPower = _random.randomRange(minEmitPower, maxEmitPower);
+
+    if (startPositionFunction) {
+      startPositionFunction(_emitterWorldMatrix, spawnParticle.position,
+                            &spawnParticle);
+    }
+    else {
+      particleEmitterType->startPositionFunction(
+        _emitterWorldMatrix, spawnParticle.position, &spawnParticle);
+    }
+
+    if (startDirectionFunction) {
+      startDirectionFunction(_emitterWorldMatrix, spawnParticle.direction,
+                             &spawnParticle);
+    }
+    else {
+      particleEmitterType->startDirectionFunction(
+        _emitterWorldMatrix, spawnParticle.direction, &spawnParticle);
+    }
+
+    const auto& position  = spawnParticle.position;
+    const auto& direction = spawnParticle.direction;
+    pool.positionX[i]     = position.x;
+    pool.positionY[i]     = position.y;
+    pool.positionZ[i]     = position.z;
+
+    if (emitPower == 0.f) {
+      pool.initialDirectionX[i]   = direction.x;
+      pool.initialDirectionY[i]   = direction.y;
+      pool.initialDirectionZ[i]   = direction.z;
+      pool.hasInitialDirection[i] = 1.f;
+    }
+
+    pool.directionX[i] = direction.x * emitPower;
+    pool.directionY[i] = direction.y * emitPower;
+    pool.directionZ[i] = direction.z * emitPower;
+
+    // Life time
+    float lifeTime = 0.f;
+    if (targetStopDuration && !_lifeTimeGradients.empty()) {
+      auto ratio = Scalar::Clamp(_actualFrame / targetStopDuration);
+      Tools::GetCurrentGradient<FactorGradient>(
+        ratio, _lifeTimeGradients,
+        [&](FactorGradient& currentGradient, FactorGradient& nextGradient,
+            float /*scale*/) {
+          auto lifeTime1 = currentGradient.getFactor(_random);
+          auto lifeTime2 = nextGradient.getFactor(_random);
+          auto gradient
+            = (ratio - currentGradient.gradient)
+              / (nextGradient.gradient - currentGradient.gradient);
+          lifeTime = Scalar::Lerp(lifeTime1, lifeTime2, gradient);
+        });
+    }
+    else {
+      lifeTime = _random.randomRange(minLifeTime, maxLifeTime);
+    }
+    pool.lifeTime[i] = lifeTime;
+
+    // Gradients variation
+    const auto seed      = _random.random();
+    pool.gradientSeed[i] = seed;
+
+    // Size and scale
+    pool.particleSize[i]
+      = _sizeGradients.empty() ?
+          _random.randomRange(minSize, maxSize) :
+          SoAParticlePool::SampleGradientTable(parameters.sizeGradient, 0.f,
+                                               seed);
+    pool.scaleX[i] = _random.randomRange(minScaleX, maxScaleX);
+    pool.scaleY[i] = _random.randomRange(minScaleY, maxScaleY);
+
+    // Angle
+    pool.angularSpeed[i]
+      = _angularSpeedGradients.empty() ?
+          _random.randomRange(minAngularSpeed, maxAngularSpeed) :
+          SoAParticlePool::SampleGradientTable(parameters.angularSpeedGradient,
+                                               0.f, seed);
+    pool.angle[i]
+      = _random.randomRange(minInitialRotation, maxInitialRotation);
+
+    // Color
+    if (_colorGradients.empty()) {
+      auto& color = Tmp::Color4Array[0];
+      Color4::LerpToRef(color1, color2, _random.randomRange(0.f, 1.f), color);
+      pool.colorR[i] = color.r;
+      pool.colorG[i] = color.g;
+      pool.colorB[i] = color.b;
+      pool.colorA[i] = color.a;
+
+      colorDead.subtractToRef(color, _colorDiff);
+      const auto inverseLifeTime = 1.f / lifeTime;
+      pool.colorStepR[i]         = _colorDiff.r * inverseLifeTime;
+      pool.colorStepG[i]         = _colorDiff.g * inverseLifeTime;
+      pool.colorStepB[i]         = _colorDiff.b * inverseLifeTime;
+      pool.colorStepA[i]         = _colorDiff.a * inverseLifeTime;
+    }
+    else {
+      const auto& colorGradient = parameters.colorGradient;
+      pool.colorR[i]
+        = SoAParticlePool::SampleGradientTable(colorGradient[0], 0.f, seed);
+      pool.colorG[i]
+        = SoAParticlePool::SampleGradientTable(colorGradient[1], 0.f, seed);
+      pool.colorB[i]
+        = SoAParticlePool::SampleGradientTable(colorGradient[2], 0.f, seed);
+      pool.colorA[i]
+        = SoAParticlePool::SampleGradientTable(colorGradient[3], 0.f, seed);
+    }
+
+    // Sheet
+    if (_isAnimationSheetEnabled) {
+      pool.startCellIndex[i] = static_cast<float>(startSpriteCellID);
+      pool.endCellIndex[i]   = static_cast<float>(endSpriteCellID);
+      pool.cellIndex[i]      = static_cast<float>(startSpriteCellID);
+    }
+  }
+}
+
+void ParticleSystem::_appendSoAParticleVertices()
+{
+  const auto& pool          = _particlePool;
+  const size_t count        = pool.size();
+  const size_t quadSize     = _useInstancing ? 1 : 4;
+  const size_t stride       = _vertexBufferSize;
+  const bool writeCell      = _isAnimationSheetEnabled;
+  const bool writeDirection = !_isBillboardBased;
+
+  // Corner offsets of the quad, pulled inside the cell for sprite sheets
+  std::array<std::array<float, 2>, 4> cornerOffsets{
+    {{{0.f, 0.f}}, {{1.f, 0.f}}, {{1.f, 1.f}}, {{0.f, 1.f}}}};
+  if (_isAnimationSheetEnabled) {
+    for (auto& cornerOffset : cornerOffsets) {
+      for (auto& value : cornerOffset) {
+        value = (value == 0.f) ? _epsilon : 1.f - _epsilon;
+      }
+    }
+  }
+
+  // Written straight from the pool arrays into the vertex data
+  float* vertexData = _vertexData.data();
+  for (size_t i = 0; i < count; ++i) {
+    const bool useInitialDirection = pool.hasInitialDirection[i] != 0.f;
+    const float directionX
+      = useInitialDirection ? pool.initialDirectionX[i] : pool.directionX[i];
+    const float directionY
+      = useInitialDirection ? pool.initialDirectionY[i] : pool.directionY[i];
+    const float directionZ
+      = useInitialDirection ? pool.initialDirectionZ[i] : pool.directionZ[i];
+
+    for (size_t corner = 0; corner < quadSize; ++corner) {
+      float* vertex = vertexData + (i * quadSize + corner) * stride;
+
+      *vertex++ = pool.positionX[i];
+      *vertex++ = pool.positionY[i];
+      *vertex++ = pool.positionZ[i];
+      *vertex++ = pool.colorR[i];
+      *vertex++ = pool.colorG[i];
+      *vertex++ = pool.colorB[i];
+      *vertex++ = pool.colorA[i];
+      *vertex++ = pool.angle[i];
+      *vertex++ = pool.scaleX[i] * pool.particleSize[i];
+      *vertex++ = pool.scaleY[i] * pool.particleSize[i];
+
+      if (writeCell) {
+        *vertex++ = pool.cellIndex[i];
+      }
+
+      if (writeDirection) {
+        *vertex++ = directionX;
+        *vertex++ = directionY;
+        *vertex++ = directionZ;
+      }
+
+      if (!_useInstancing) {
+        *vertex++ = cornerOffsets[corner][0];
+        *vertex++ = cornerOffsets[corner][1];
+      }
+    }
+  }
+}
+
 std::vector<std::string>
 ParticleSystem::_GetAttributeNamesOrOptions(bool isAnimationSheetEnabled,
                                             bool isBillboardBased)
@@ -1097,10 +1381,41 @@ Effect* ParticleSystem::_getEffect()
 
 void ParticleSystem::animate(bool preWarmOnly)
 {
-  if (!_started) {
+  if (!_prepareStep(preWarmOnly)) {
     return;
   }
 
+  _simulateStep(preWarmOnly);
+  _completeStep(preWarmOnly);
+}
+
+bool ParticleSystem::_beginAnimate()
+{
+  // Reading the noise texture back goes through the engine
+  if (noiseTexture) {
+    animate();
+    return false;
+  }
+
+  return _prepareStep(false);
+}
+
+void ParticleSystem::_simulate()
+{
+  _simulateStep(false);
+}
+
+void ParticleSystem::_endAnimate()
+{
+  _completeStep(false);
+}
+
+bool ParticleSystem::_prepareStep(bool preWarmOnly)
+{
+  if (!_started) {
+    return false;
+  }
+
   if (!preWarmOnly) {
     auto effect = _getEffect();
 
@@ -1108,10 +1423,10 @@ void ParticleSystem::animate(bool preWarmOnly)
     if (!hasEmitter() || !_imageProcessingConfiguration->isReady()
         || !effect->isReady() || !particleTexture
         || !particleTexture->isReady())
-      return;
+      return false;
 
     if (_currentRenderId == _scene->getRenderId()) {
-      return;
+      return false;
     }
     _currentRenderId = _scene->getRenderId();
   }
@@ -1138,8 +1453,6 @@ void ParticleSystem::animate(bool preWarmOnly)
     _newPartsExcess -= _newPartsExcess >> 0;
   }
 
-  _alive = false;
-
   if (!_stopped) {
     _actualFrame += _scaledUpdateSpeed;
 
@@ -1149,8 +1462,46 @@ void ParticleSystem::animate(bool preWarmOnly)
   else {
     newParticles = 0;
   }
-  _update(newParticles);
+  _newParticles = newParticles;
+
+  // The world matrix of the emitter mesh can be computed on demand, resolve it
+  // before the simulation which may run on a worker thread
+  if (emitter.is<AbstractMeshPtr>()) {
+    auto emitterMesh    = emitter.get<AbstractMeshPtr>();
+    _emitterWorldMatrix = *emitterMesh->getWorldMatrix();
+  }
+  else {
+    auto emitterPosition = emitter.get<Vector3>();
+    _emitterWorldMatrix  = Matrix::Translation(
+      emitterPosition.x, emitterPosition.y, emitterPosition.z);
+  }
+
+  return true;
+}
+
+void ParticleSystem::_simulateStep(bool preWarmOnly)
+{
+  _alive = false;
+
+  _update(_newParticles);
+
+  if (!preWarmOnly) {
+    // Update the vertex data, uploaded by _completeStep
+    if (_useStructureOfArrays) {
+      _appendSoAParticleVertices();
+    }
+    else {
+      unsigned int offset = 0;
+      for (auto& particle : _particles) {
+        _appendParticleVertices(offset, particle);
+        offset += _useInstancing ? 1 : 4;
+      }
+    }
+  }
+}
 
+void ParticleSystem::_completeStep(bool preWarmOnly)
+{
   // Stopped?
   if (_stopped) {
     if (!_alive) {
@@ -1166,12 +1517,6 @@ void ParticleSystem::animate(bool preWarmOnly)
 
   if (!preWarmOnly) {
     // Update VBO
-    unsigned int offset = 0;
-    for (auto& particle : _particles) {
-      _appendParticleVertices(offset, particle);
-      offset += _useInstancing ? 1 : 4;
-    }
-
     if (_vertexBuffer) {
       _vertexBuffer->update(_vertexData);
     }
@@ -1219,7 +1564,7 @@ size_t ParticleSystem::render(bool /*preWarm*/)
   auto effect = _getEffect();
 
   // Check
-  if (!isReady() || _particles.empty()) {
+  if (!isReady() || _particleCount() == 0) {
     return 0;
   }
 
@@ -1290,16 +1635,16 @@ size_t ParticleSystem::render(bool /*preWarm*/)
 
   if (_useInstancing) {
     engine->drawArraysType(Material::TriangleFanDrawMode(), 0, 4,
-                           static_cast<int>(_particles.size()));
+                           static_cast<int>(_particleCount()));
     engine->unbindInstanceAttributes();
   }
   else {
     engine->drawElementsType(Material::TriangleFillMode(), 0,
-                             static_cast<int>(_particles.size() * 6));
+                             static_cast<int>(_particleCount() * 6));
   }
   engine->setAlphaMode(EngineConstants::ALPHA_DISABLE);
 
-  return _particles.size();
+  return _particleCount();
 }
 
 void ParticleSystem::dispose(bool disposeTexture,
@@ -0,0 +1,477 @@
+#include <babylon/particles/soa_particle_pool.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <babylon/babylon_options.h>
+#include <babylon/math/scalar.h>
+#include <babylon/tools/color_gradient.h>
+#include <babylon/tools/factor_gradient.h>
+
+// SIMD
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+#include <babylon/math/simd/float32x4.h>
+#endif
+
+namespace BABYLON {
+
+constexpr size_t SoAParticlePool::GradientTableSize;
+
+SoAParticlePool::SoAParticlePool() : _size{0}
+{
+}
+
+SoAParticlePool::~SoAParticlePool()
+{
+}
+
+template <typename F>
+void SoAParticlePool::_forEachArray(F&& f)
+{
+  f(positionX);
+  f(positionY);
+  f(positionZ);
+  f(directionX);
+  f(directionY);
+  f(directionZ);
+  f(initialDirectionX);
+  f(initialDirectionY);
+  f(initialDirectionZ);
+  f(hasInitialDirection);
+  f(colorR);
+  f(colorG);
+  f(colorB);
+  f(colorA);
+  f(colorStepR);
+  f(colorStepG);
+  f(colorStepB);
+  f(colorStepA);
+  f(age);
+  f(lifeTime);
+  f(particleSize);
+  f(scaleX);
+  f(scaleY);
+  f(angle);
+  f(angularSpeed);
+  f(cellIndex);
+  f(startCellIndex);
+  f(endCellIndex);
+  f(gradientSeed);
+}
+
+void SoAParticlePool::reserve(size_t capacity)
+{
+  if (capacity <= positionX.size()) {
+    return;
+  }
+
+  _forEachArray([capacity](std::vector<float>& array) {
+    array.resize(capacity, 0.f);
+  });
+}
+
+size_t SoAParticlePool::size() const
+{
+  return _size;
+}
+
+bool SoAParticlePool::empty() const
+{
+  return _size == 0;
+}
+
+void SoAParticlePool::clear()
+{
+  _size = 0;
+}
+
+size_t SoAParticlePool::add()
+{
+  if (_size == positionX.size()) {
+    reserve(std::max<size_t>(16, 2 * _size));
+  }
+
+  const size_t index = _size++;
+  _forEachArray([index](std::vector<float>& array) { array[index] = 0.f; });
+  lifeTime[index]     = 1.f;
+  particleSize[index] = 1.f;
+  scaleX[index]       = 1.f;
+  scaleY[index]       = 1.f;
+
+  return index;
+}
+
+void SoAParticlePool::swapRemove(size_t index)
+{
+  const size_t last = _size - 1;
+  if (index != last) {
+    _forEachArray(
+      [index, last](std::vector<float>& array) { array[index] = array[last]; });
+  }
+  --_size;
+}
+
+size_t SoAParticlePool::update(const UpdateParameters& parameters)
+{
+  if (_size == 0) {
+    return 0;
+  }
+
+  // Age
+  const float deltaTime = parameters.deltaTime;
+  float* ages           = age.data();
+  for (size_t i = 0; i < _size; ++i) {
+    ages[i] += deltaTime;
+  }
+
+  _evaluateGradients(parameters);
+  _integrate(parameters, _integrateSIMD(parameters));
+
+  if (parameters.updateCellIndex) {
+    _updateCellIndices(parameters);
+  }
+
+  return _recycleDeadParticles();
+}
+
+void SoAParticlePool::_evaluateGradients(const UpdateParameters& parameters)
+{
+  const bool hasMotionGradient = parameters.velocityGradient.enabled
+                                 || parameters.limitVelocityGradient.enabled
+                                 || parameters.dragGradient.enabled;
+  if (!parameters.colorGradient[0].enabled && !parameters.sizeGradient.enabled
+      && !parameters.angularSpeedGradient.enabled && !hasMotionGradient) {
+    return;
+  }
+
+  // Life time ratios
+  _ratio.resize(_size);
+  for (size_t i = 0; i < _size; ++i) {
+    _ratio[i] = std::min(age[i] / lifeTime[i], 1.f);
+  }
+
+  // One pass per gradient, the table lookups are gathers and are kept out of
+  // the integration kernel
+  const auto evaluate = [this](const GradientTable& table,
+                               std::vector<float>& values, float neutral) {
+    if (!table.enabled) {
+      std::fill(values.begin(), values.begin() + static_cast<long>(_size),
+                neutral);
+      return;
+    }
+    for (size_t i = 0; i < _size; ++i) {
+      values[i] = SampleGradientTable(table, _ratio[i], gradientSeed[i]);
+    }
+  };
+
+  if (parameters.colorGradient[0].enabled) {
+    evaluate(parameters.colorGradient[0], colorR, 0.f);
+    evaluate(parameters.colorGradient[1], colorG, 0.f);
+    evaluate(parameters.colorGradient[2], colorB, 0.f);
+    evaluate(parameters.colorGradient[3], colorA, 0.f);
+  }
+  if (parameters.sizeGradient.enabled) {
+    evaluate(parameters.sizeGradient, particleSize, 1.f);
+  }
+  if (parameters.angularSpeedGradient.enabled) {
+    evaluate(parameters.angularSpeedGradient, angularSpeed, 0.f);
+  }
+
+  // The motion factors are used together, the missing ones are neutral
+  if (hasMotionGradient) {
+    _velocity.resize(_size);
+    _limitVelocity.resize(_size);
+    _drag.resize(_size);
+    evaluate(parameters.velocityGradient, _velocity, 1.f);
+    evaluate(parameters.limitVelocityGradient, _limitVelocity,
+             std::numeric_limits<float>::max());
+    evaluate(parameters.dragGradient, _drag, 1.f);
+  }
+}
+
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+size_t SoAParticlePool::_integrateSIMD(const UpdateParameters& parameters)
+{
+  using SIMD::Float32x4;
+
+  const auto load
+    = [](const float* source) { return Float32x4(_mm_loadu_ps(source)); };
+  const auto store = [](float* destination, const Float32x4& value) {
+    _mm_storeu_ps(destination, value.xmm);
+  };
+
+  const bool hasColorGradient  = parameters.colorGradient[0].enabled;
+  const bool hasMotionGradient = parameters.velocityGradient.enabled
+                                 || parameters.limitVelocityGradient.enabled
+                                 || parameters.dragGradient.enabled;
+
+  const Float32x4 zero;
+  const Float32x4 one(1.f);
+  const Float32x4 deltaTime(parameters.deltaTime);
+  const Float32x4 limitDamping(parameters.limitVelocityDamping);
+  const Float32x4 gravityX(parameters.gravity.x * parameters.deltaTime);
+  const Float32x4 gravityY(parameters.gravity.y * parameters.deltaTime);
+  const Float32x4 gravityZ(parameters.gravity.z * parameters.deltaTime);
+
+  const size_t end = _size - (_size % 4);
+  for (size_t i = 0; i < end; i += 4) {
+    // Color
+    if (!hasColorGradient) {
+      store(&colorR[i], load(&colorR[i]) + load(&colorStepR[i]) * deltaTime);
+      store(&colorG[i], load(&colorG[i]) + load(&colorStepG[i]) * deltaTime);
+      store(&colorB[i], load(&colorB[i]) + load(&colorStepB[i]) * deltaTime);
+      store(&colorA[i],
+            (load(&colorA[i]) + load(&colorStepA[i]) * deltaTime).max(zero));
+    }
+
+    // Angle
+    store(&angle[i], load(&angle[i]) + load(&angularSpeed[i]) * deltaTime);
+
+    // Direction and velocity
+    auto dirX = load(&directionX[i]);
+    auto dirY = load(&directionY[i]);
+    auto dirZ = load(&directionZ[i]);
+
+    auto scaledX = dirX * deltaTime;
+    auto scaledY = dirY * deltaTime;
+    auto scaledZ = dirZ * deltaTime;
+
+    if (hasMotionGradient) {
+      // Velocity and drag
+      const auto factor = load(&_velocity[i]) * load(&_drag[i]);
+      scaledX *= factor;
+      scaledY *= factor;
+      scaledZ *= factor;
+
+      // Limit velocity
+      const auto currentVelocity
+        = (dirX * dirX + dirY * dirY + dirZ * dirZ).sqrt();
+      const auto mask
+        = _mm_cmpgt_ps(currentVelocity.xmm, load(&_limitVelocity[i]).xmm);
+      const Float32x4 damping(_mm_or_ps(_mm_and_ps(mask, limitDamping.xmm),
+                                        _mm_andnot_ps(mask, one.xmm)));
+      dirX *= damping;
+      dirY *= damping;
+      dirZ *= damping;
+    }
+
+    // Position
+    store(&positionX[i], load(&positionX[i]) + scaledX);
+    store(&positionY[i], load(&positionY[i]) + scaledY);
+    store(&positionZ[i], load(&positionZ[i]) + scaledZ);
+
+    // Gravity
+    store(&directionX[i], dirX + gravityX);
+    store(&directionY[i], dirY + gravityY);
+    store(&directionZ[i], dirZ + gravityZ);
+  }
+
+  return end;
+}
+#else
+size_t SoAParticlePool::_integrateSIMD(const UpdateParameters& /*parameters*/)
+{
+  return 0;
+}
+#endif
+
+void SoAParticlePool::_integrate(const UpdateParameters& parameters,
+                                 size_t start)
+{
+  const float deltaTime = parameters.deltaTime;
+
+  // Short loops over raw arrays without branches, vectorized by the compiler
+
+  // Color
+  if (!parameters.colorGradient[0].enabled) {
+    float* r        = colorR.data();
+    float* g        = colorG.data();
+    float* b        = colorB.data();
+    float* a        = colorA.data();
+    const float* sr = colorStepR.data();
+    const float* sg = colorStepG.data();
+    const float* sb = colorStepB.data();
+    const float* sa = colorStepA.data();
+    for (size_t i = start; i < _size; ++i) {
+      r[i] += sr[i] * deltaTime;
+      g[i] += sg[i] * deltaTime;
+      b[i] += sb[i] * deltaTime;
+      a[i] = std::max(a[i] + sa[i] * deltaTime, 0.f);
+    }
+  }
+
+  // Angle
+  {
+    float* angles              = angle.data();
+    const float* angularSpeeds = angularSpeed.data();
+    for (size_t i = start; i < _size; ++i) {
+      angles[i] += angularSpeeds[i] * deltaTime;
+    }
+  }
+
+  // Position and direction
+  float* px            = positionX.data();
+  float* py            = positionY.data();
+  float* pz            = positionZ.data();
+  float* dx            = directionX.data();
+  float* dy            = directionY.data();
+  float* dz            = directionZ.data();
+  const float gravityX = parameters.gravity.x * deltaTime;
+  const float gravityY = parameters.gravity.y * deltaTime;
+  const float gravityZ = parameters.gravity.z * deltaTime;
+
+  const bool hasMotionGradient = parameters.velocityGradient.enabled
+                                 || parameters.limitVelocityGradient.enabled
+                                 || parameters.dragGradient.enabled;
+
+  if (!hasMotionGradient) {
+    for (size_t i = start; i < _size; ++i) {
+      px[i] += dx[i] * deltaTime;
+      py[i] += dy[i] * deltaTime;
+      pz[i] += dz[i] * deltaTime;
+      dx[i] += gravityX;
+      dy[i] += gravityY;
+      dz[i] += gravityZ;
+    }
+    return;
+  }
+
+  const float* velocity      = _velocity.data();
+  const float* limitVelocity = _limitVelocity.data();
+  const float* drag          = _drag.data();
+  const float limitDamping   = parameters.limitVelocityDamping;
+  for (size_t i = start; i < _size; ++i) {
+    // Velocity and drag
+    const float factor = velocity[i] * drag[i] * deltaTime;
+    px[i] += dx[i] * factor;
+    py[i] += dy[i] * factor;
+    pz[i] += dz[i] * factor;
+
+    // Limit velocity, applied to the direction of the next step
+    const float currentVelocity
+      = std::sqrt(dx[i] * dx[i] + dy[i] * dy[i] + dz[i] * dz[i]);
+    const float damping
+      = (currentVelocity > limitVelocity[i]) ? limitDamping : 1.f;
+
+    // Gravity
+    dx[i] = dx[i] * damping + gravityX;
+    dy[i] = dy[i] * damping + gravityY;
+    dz[i] = dz[i] * damping + gravityZ;
+  }
+}
+
+void SoAParticlePool::_updateCellIndices(const UpdateParameters& parameters)
+{
+  for (size_t i = 0; i < _size; ++i) {
+    const float dist  = endCellIndex[i] - startCellIndex[i];
+    const float ratio = Scalar::Clamp(
+      std::fmod(age[i] * parameters.spriteCellChangeSpeed, lifeTime[i])
+      / lifeTime[i]);
+    cellIndex[i] = std::floor(startCellIndex[i] + ratio * dist);
+  }
+}
+
+size_t SoAParticlePool::_recycleDeadParticles()
+{
+  size_t recycled = 0;
+  for (size_t i = 0; i < _size;) {
+    if (age[i] >= lifeTime[i]) {
+      swapRemove(i);
+      ++recycled;
+    }
+    else {
+      ++i;
+    }
+  }
+
+  return recycled;
+}
+
+void SoAParticlePool::BuildGradientTable(
+  const std::vector<FactorGradient>& gradients, GradientTable& table)
+{
+  table.enabled = !gradients.empty();
+  if (!table.enabled) {
+    return;
+  }
+
+  const auto& first = gradients.front();
+  const auto& last  = gradients.back();
+  for (size_t k = 0; k < GradientTableSize; ++k) {
+    const float ratio
+      = static_cast<float>(k) / static_cast<float>(GradientTableSize - 1);
+
+    // Values are held constant before the first and after the last gradient
+    if (ratio <= first.gradient) {
+      table.values1[k] = first.factor1;
+      table.values2[k] = first.factor2.value_or(first.factor1);
+      continue;
+    }
+    if (ratio >= last.gradient) {
+      table.values1[k] = last.factor1;
+      table.values2[k] = last.factor2.value_or(last.factor1);
+      continue;
+    }
+
+    for (size_t index = 0; index + 1 < gradients.size(); ++index) {
+      const auto& currentGradient = gradients[index];
+      const auto& nextGradient    = gradients[index + 1];
+      if (ratio >= currentGradient.gradient
+          && ratio <= nextGradient.gradient) {
+        const float scale
+          = (ratio - currentGradient.gradient)
+            / (nextGradient.gradient - currentGradient.gradient);
+        table.values1[k]
+          = Scalar::Lerp(currentGradient.factor1, nextGradient.factor1, scale);
+        table.values2[k] = Scalar::Lerp(
+          currentGradient.factor2.value_or(currentGradient.factor1),
+          nextGradient.factor2.value_or(nextGradient.factor1), scale);
+        break;
+      }
+    }
+  }
+}
+
+void SoAParticlePool::BuildColorGradientTables(
+  const std::vector<ColorGradient>& gradients,
+  std::array<GradientTable, 4>& tables)
+{
+  // One factor gradient per channel
+  std::array<std::vector<FactorGradient>, 4> channels;
+  for (const auto& colorGradient : gradients) {
+    const auto color1 = colorGradient.color1.asArray();
+    const auto color2 = colorGradient.color2.value_or(colorGradient.color1)
+                          .asArray();
+    for (size_t channel = 0; channel < 4; ++channel) {
+      FactorGradient factorGradient;
+      factorGradient.gradient = colorGradient.gradient;
+      factorGradient.factor1  = color1[channel];
+      factorGradient.factor2  = color2[channel];
+      channels[channel].emplace_back(factorGradient);
+    }
+  }
+
+  for (size_t channel = 0; channel < 4; ++channel) {
+    BuildGradientTable(channels[channel], tables[channel]);
+  }
+}
+
+float SoAParticlePool::SampleGradientTable(const GradientTable& table,
+                                           float ratio, float seed)
+{
+  const float position
+    = Scalar::Clamp(ratio) * static_cast<float>(GradientTableSize - 1);
+  const size_t index
+    = std::min(static_cast<size_t>(position), GradientTableSize - 2);
+  const float amount = position - static_cast<float>(index);
+
+  const float value1
+    = Scalar::Lerp(table.values1[index], table.values1[index + 1], amount);
+  const float value2
+    = Scalar::Lerp(table.values2[index], table.values2[index + 1], amount);
+
+  return Scalar::Lerp(value1, value2, seed);
+}
+
+} // end of namespace BABYLON
@@ -23,6 +23,16 @@ void ColorGradient::getColorToRef(Color4& result)
   Color4::LerpToRef(color1, *color2, Math::random(), result);
 }
 
+void ColorGradient::getColorToRef(Color4& result, Math::RandomStream& random)
+{
+  if (!color2) {
+    result.copyFrom(color1);
+    return;
+  }
+
+  Color4::LerpToRef(color1, *color2, random.random(), result);
+}
+
 bool operator==(const ColorGradient& lhs, const ColorGradient& rhs)
 {
   return stl_util::almost_equal(lhs.gradient, rhs.gradient)
@@ -530,19 +530,19 @@ void DDSTools::UploadDDSLevels(Engine* engine,
   if (hasSphericalPolynomialFaces && sphericalPolynomialFaces.size() >= 6) {
     CubeMapInfo cubeInfo;
     cubeInfo.size       = static_cast<size_t>(header[off_width]);
-    cubeInfo.right      = sphericalPolynomialFaces[0];
-    cubeInfo.left       = sphericalPolynomialFaces[1];
-    cubeInfo.up         = sphericalPolynomialFaces[2];
-    cubeInfo.down       = sphericalPolynomialFaces[3];
-    cubeInfo.front      = sphericalPolynomialFaces[4];
-    cubeInfo.back       = sphericalPolynomialFaces[5];
+    cubeInfo.right      = std::move(sphericalPolynomialFaces[0]);
+    cubeInfo.left       = std::move(sphericalPolynomialFaces[1]);
+    cubeInfo.up         = std::move(sphericalPolynomialFaces[2]);
+    cubeInfo.down       = std::move(sphericalPolynomialFaces[3]);
+    cubeInfo.front      = std::move(sphericalPolynomialFaces[4]);
+    cubeInfo.back       = std::move(sphericalPolynomialFaces[5]);
     cubeInfo.format     = EngineConstants::TEXTUREFORMAT_RGBA;
     cubeInfo.type       = EngineConstants::TEXTURETYPE_FLOAT;
     cubeInfo.gammaSpace = false;
 
     info.sphericalPolynomial
       = CubeMapToSphericalPolynomialTools::ConvertCubeMapToSphericalPolynomial(
-        cubeInfo);
+        cubeInfo, engine->threadPool());
   }
   else {
     info.sphericalPolynomial = nullptr;
@@ -23,6 +23,15 @@ float FactorGradient::getFactor() const
   return Scalar::Lerp(factor1, *factor2, Math::random());
 }
 
+float FactorGradient::getFactor(Math::RandomStream& random) const
+{
+  if (!factor2.has_value()) {
+    return factor1;
+  }
+
+  return Scalar::Lerp(factor1, *factor2, random.random());
+}
+
 bool operator==(const FactorGradient& lhs, const FactorGradient& rhs)
 {
   return stl_util::almost_equal(lhs.gradient, rhs.gradient)
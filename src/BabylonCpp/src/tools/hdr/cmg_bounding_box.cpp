@@ -3,7 +3,7 @@
 namespace BABYLON {
 
 float CMGBoundinBox::MAX = std::numeric_limits<float>::max();
-float CMGBoundinBox::MIN = std::numeric_limits<float>::max();
+float CMGBoundinBox::MIN = std::numeric_limits<float>::lowest();
 
 CMGBoundinBox::CMGBoundinBox()
     : min{Vector3(0.f, 0.f, 0.f)}, max{Vector3(0.f, 0.f, 0.f)}
@@ -52,7 +52,7 @@ void CMGBoundinBox::clampMax(float x, float y, float z)
 
 bool CMGBoundinBox::empty() const
 {
-  if ((min.x > max.y) || (min.y > max.y) || (min.z > max.y)) {
+  if ((min.x > max.x) || (min.y > max.y) || (min.z > max.z)) {
     return true;
   }
   else {
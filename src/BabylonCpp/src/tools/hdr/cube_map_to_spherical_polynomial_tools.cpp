@@ -1,5 +1,8 @@
 #include <babylon/tools/hdr/cube_map_to_spherical_polynomial_tools.h>
 
+#include <cmath>
+
+#include <babylon/core/thread_pool.h>
 #include <babylon/engine/engine_constants.h>
 #include <babylon/materials/textures/base_texture.h>
 #include <babylon/math/color3.h>
@@ -8,6 +11,11 @@
 #include <babylon/math/spherical_polynomial.h>
 #include <babylon/math/vector3.h>
 
+// SIMD
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+#include <babylon/math/simd/float32x4.h>
+#endif
+
 namespace BABYLON {
 
 std::array<FileFaceOrientation, 6> CubeMapToSphericalPolynomialTools::FileFaces
@@ -26,9 +34,16 @@ std::array<FileFaceOrientation, 6> CubeMapToSphericalPolynomialTools::FileFaces
                         Vector3(0, -1, 0)) // -Z bottom
   }};
 
+std::unordered_map<std::size_t,
+                   std::shared_ptr<const CubeMapToSphericalPolynomialTools::
+                                     CubeTexelWeights>>
+  CubeMapToSphericalPolynomialTools::_TexelWeights;
+
+std::mutex CubeMapToSphericalPolynomialTools::_TexelWeightsMutex;
+
 std::unique_ptr<SphericalPolynomial>
 CubeMapToSphericalPolynomialTools::ConvertCubeMapTextureToSphericalPolynomial(
-  BaseTexture* texture)
+  BaseTexture* texture, ThreadPool* threadPool)
 {
   if (!texture->isCube) {
     // Only supports cube Textures currently.
@@ -62,122 +77,270 @@ CubeMapToSphericalPolynomialTools::ConvertCubeMapTextureToSphericalPolynomial(
   }
 
   CubeMapInfo cubeInfo{
-    front,      //
-    back,       //
-    left,       //
-    right,      //
-    up,         //
-    down,       //
-    size,       //
-    format,     //
-    type,       //
-    gammaSpace, //
+    std::move(front), //
+    std::move(back),  //
+    std::move(left),  //
+    std::move(right), //
+    std::move(up),    //
+    std::move(down),  //
+    size,             //
+    format,           //
+    type,             //
+    gammaSpace,       //
   };
 
-  return ConvertCubeMapToSphericalPolynomial(cubeInfo);
+  return ConvertCubeMapToSphericalPolynomial(cubeInfo, threadPool);
 }
 
-std::unique_ptr<SphericalPolynomial>
-CubeMapToSphericalPolynomialTools::ConvertCubeMapToSphericalPolynomial(
-  const CubeMapInfo& cubeInfo)
+std::shared_ptr<const CubeMapToSphericalPolynomialTools::CubeTexelWeights>
+CubeMapToSphericalPolynomialTools::_GetTexelWeights(std::size_t size)
 {
-  SphericalHarmonics sphericalHarmonics;
-  float totalSolidAngle = 0.f;
+  std::lock_guard<std::mutex> lock(_TexelWeightsMutex);
+  auto& cached = _TexelWeights[size];
+  if (cached) {
+    return cached;
+  }
+
+  auto weights             = std::make_shared<CubeTexelWeights>();
+  weights->totalSolidAngle = 0.0;
 
   // The (u,v) range is [-1,+1], so the distance between each texel is 2/Size.
-  float du = 2.f / static_cast<float>(cubeInfo.size);
-  float dv = du;
+  const float du = 2.f / static_cast<float>(size);
 
   // The (u,v) of the first texel is half a texel from the corner (-1,-1).
-  float minUV = du * 0.5f - 1.f;
+  const float minUV = du * 0.5f - 1.f;
 
   for (unsigned int faceIndex = 0; faceIndex < 6; ++faceIndex) {
     const auto& fileFace = FileFaces[faceIndex];
-    Float32Array dataArray;
-    if (fileFace.name == "right") {
-      dataArray = cubeInfo.right.float32Array;
-    }
-    else if (fileFace.name == "left") {
-      dataArray = cubeInfo.left.float32Array;
-    }
-    else if (fileFace.name == "up") {
-      dataArray = cubeInfo.up.float32Array;
+    auto& face           = weights->faces[faceIndex];
+    face.directionX.resize(size * size);
+    face.directionY.resize(size * size);
+    face.directionZ.resize(size * size);
+    face.solidAngle.resize(size * size);
+
+    for (size_t y = 0; y < size; ++y) {
+      const float v = minUV + static_cast<float>(y) * du;
+      for (size_t x = 0; x < size; ++x) {
+        const float u = minUV + static_cast<float>(x) * du;
+
+        // World direction (not normalised)
+        const auto& axisX  = fileFace.worldAxisForFileX;
+        const auto& axisY  = fileFace.worldAxisForFileY;
+        const auto& normal = fileFace.worldAxisForNormal;
+        const float dx     = axisX.x * u + axisY.x * v + normal.x;
+        const float dy     = axisX.y * u + axisY.y * v + normal.y;
+        const float dz     = axisX.z * u + axisY.z * v + normal.z;
+        const float length = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+        // (1 + u^2 + v^2)^(-3/2)
+        const float t               = 1.f + u * u + v * v;
+        const float deltaSolidAngle = 1.f / (t * std::sqrt(t));
+
+        const auto index       = y * size + x;
+        face.directionX[index] = dx / length;
+        face.directionY[index] = dy / length;
+        face.directionZ[index] = dz / length;
+        face.solidAngle[index] = deltaSolidAngle;
+
+        weights->totalSolidAngle += deltaSolidAngle;
+      }
     }
-    else if (fileFace.name == "down") {
-      dataArray = cubeInfo.down.float32Array;
+  }
+
+  cached = weights;
+  return cached;
+}
+
+void CubeMapToSphericalPolynomialTools::_AccumulateRow(
+  const FaceTexelWeights& weights, size_t offset, const float* r,
+  const float* g, const float* b, size_t count, ColorMoments& moments)
+{
+  const float* directionX = weights.directionX.data() + offset;
+  const float* directionY = weights.directionY.data() + offset;
+  const float* directionZ = weights.directionZ.data() + offset;
+  const float* solidAngle = weights.solidAngle.data() + offset;
+
+  size_t i = 0;
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+  // Four texels at a time, with one partial sum per lane
+  std::array<__m128, 27> sums;
+  sums.fill(_mm_setzero_ps());
+  const auto one = _mm_set1_ps(1.f);
+  for (; i + 4 <= count; i += 4) {
+    const auto x = _mm_loadu_ps(directionX + i);
+    const auto y = _mm_loadu_ps(directionY + i);
+    const auto z = _mm_loadu_ps(directionZ + i);
+    const auto w = _mm_loadu_ps(solidAngle + i);
+
+    const std::array<__m128, 9> monomials{{
+      one,                                             //
+      y,                                               //
+      z,                                               //
+      x,                                               //
+      _mm_mul_ps(x, y),                                //
+      _mm_mul_ps(y, z),                                //
+      _mm_mul_ps(x, z),                                //
+      _mm_mul_ps(z, z),                                //
+      _mm_sub_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), //
+    }};
+    const std::array<__m128, 3> color{{
+      _mm_mul_ps(_mm_loadu_ps(r + i), w), //
+      _mm_mul_ps(_mm_loadu_ps(g + i), w), //
+      _mm_mul_ps(_mm_loadu_ps(b + i), w), //
+    }};
+
+    for (size_t m = 0; m < 9; ++m) {
+      for (size_t c = 0; c < 3; ++c) {
+        sums[m * 3 + c]
+          = _mm_add_ps(sums[m * 3 + c], _mm_mul_ps(monomials[m], color[c]));
+      }
     }
-    else if (fileFace.name == "front") {
-      dataArray = cubeInfo.front.float32Array;
+  }
+  alignas(16) std::array<float, 4> lanes;
+  for (size_t k = 0; k < 27; ++k) {
+    _mm_store_ps(lanes.data(), sums[k]);
+    moments[k] += static_cast<double>(lanes[0]) + lanes[1] + lanes[2]
+                  + lanes[3];
+  }
+#endif
+
+  for (; i < count; ++i) {
+    const float x = directionX[i];
+    const float y = directionY[i];
+    const float z = directionZ[i];
+    const float w = solidAngle[i];
+
+    const std::array<float, 9> monomials{
+      {1.f, y, z, x, x * y, y * z, x * z, z * z, x * x - y * y}};
+    const std::array<float, 3> color{{r[i] * w, g[i] * w, b[i] * w}};
+
+    for (size_t m = 0; m < 9; ++m) {
+      for (size_t c = 0; c < 3; ++c) {
+        moments[m * 3 + c] += monomials[m] * color[c];
+      }
     }
-    else if (fileFace.name == "back") {
-      dataArray = cubeInfo.back.float32Array;
+  }
+}
+
+std::unique_ptr<SphericalPolynomial>
+CubeMapToSphericalPolynomialTools::ConvertCubeMapToSphericalPolynomial(
+  const CubeMapInfo& cubeInfo, ThreadPool* threadPool)
+{
+  const auto size = cubeInfo.size;
+  if (size == 0) {
+    return nullptr;
+  }
+
+  // Faces in the order of FileFaces, read in place
+  const std::array<const ArrayBufferView*, 6> faces{{
+    &cubeInfo.right, //
+    &cubeInfo.left,  //
+    &cubeInfo.up,    //
+    &cubeInfo.down,  //
+    &cubeInfo.front, //
+    &cubeInfo.back,  //
+  }};
+
+  const size_t stride
+    = cubeInfo.format == EngineConstants::TEXTUREFORMAT_RGBA ? 4 : 3;
+  for (const auto& face : faces) {
+    const auto length = face->float32Array.empty() ? face->uint8Array.size() :
+                                                     face->float32Array.size();
+    if (length < size * size * stride) {
+      return nullptr;
     }
-    float v = minUV;
-
-    // TODO: we could perform the summation directly into a SphericalPolynomial
-    // (SP), which is more efficient than SphericalHarmonic (SH).
-    // This is possible because during the summation we do not need the
-    // SH-specific properties, e.g. orthogonality.
-    // Because SP is still linear, so summation is fine in that basis.
-    const unsigned int stride
-      = cubeInfo.format == EngineConstants::TEXTUREFORMAT_RGBA ? 4 : 3;
-    for (size_t y = 0; y < cubeInfo.size; ++y) {
-      float u = minUV;
-
-      for (size_t x = 0; x < cubeInfo.size; ++x) {
-        // World direction (not normalised)
-        auto worldDirection = fileFace.worldAxisForFileX.scale(u)
-                                .add(fileFace.worldAxisForFileY.scale(v))
-                                .add(fileFace.worldAxisForNormal);
-        worldDirection.normalize();
-
-        float deltaSolidAngle = std::pow(1.f + u * u + v * v, -3.f / 2.f);
-
-        float r = dataArray[(y * cubeInfo.size * stride) + (x * stride) + 0];
-        float g = dataArray[(y * cubeInfo.size * stride) + (x * stride) + 1];
-        float b = dataArray[(y * cubeInfo.size * stride) + (x * stride) + 2];
-
-        // Handle Integer types.
-        if (cubeInfo.type == EngineConstants::TEXTURETYPE_UNSIGNED_INT) {
-          r /= 255.f;
-          g /= 255.f;
-          b /= 255.f;
-        }
+  }
+
+  const auto weights = _GetTexelWeights(size);
+
+  // The moments of each row are summed in a fixed order afterwards
+  std::vector<ColorMoments> rowMoments(6 * size);
+  const auto projectRow = [&](size_t rowIndex) {
+    const auto faceIndex = rowIndex / size;
+    const auto y         = rowIndex % size;
+    const auto& face     = *faces[faceIndex];
+
+    // Handle Integer types.
+    const bool fromBytes = face.float32Array.empty();
+    const float scale
+      = (fromBytes
+         || cubeInfo.type == EngineConstants::TEXTURETYPE_UNSIGNED_INT) ?
+          1.f / 255.f :
+          1.f;
+
+    // Linear colors of the row
+    std::vector<float> colors(3 * size);
+    float* r = colors.data();
+    float* g = r + size;
+    float* b = g + size;
+    for (size_t x = 0; x < size; ++x) {
+      const auto index = (y * size + x) * stride;
+      for (size_t c = 0; c < 3; ++c) {
+        float value = fromBytes ? face.uint8Array[index + c] :
+                                  face.float32Array[index + c];
+        value *= scale;
 
         // Handle Gamma space textures.
         if (cubeInfo.gammaSpace) {
-          r = std::pow(Scalar::Clamp(r), Math::ToLinearSpace);
-          g = std::pow(Scalar::Clamp(g), Math::ToLinearSpace);
-          b = std::pow(Scalar::Clamp(b), Math::ToLinearSpace);
+          value = std::pow(Scalar::Clamp(value), Math::ToLinearSpace);
         }
 
-        Color3 color(r, g, b);
-
-        sphericalHarmonics.addLight(worldDirection, color, deltaSolidAngle);
+        colors[c * size + x] = value;
+      }
+    }
 
-        totalSolidAngle += deltaSolidAngle;
+    auto& moments = rowMoments[rowIndex];
+    moments.fill(0.0);
+    _AccumulateRow(weights->faces[faceIndex], y * size, r, g, b, size,
+                   moments);
+  };
 
-        u += du;
-      }
+  if (threadPool) {
+    threadPool->parallelFor(rowMoments.size(), projectRow);
+  }
+  else {
+    for (size_t rowIndex = 0; rowIndex < rowMoments.size(); ++rowIndex) {
+      projectRow(rowIndex);
+    }
+  }
 
-      v += dv;
+  ColorMoments moments;
+  moments.fill(0.0);
+  for (const auto& row : rowMoments) {
+    for (size_t k = 0; k < moments.size(); ++k) {
+      moments[k] += row[k];
     }
   }
 
   // Solid angle for entire sphere is 4*pi
-  float sphereSolidAngle = 4.f * Math::PI;
-
-  // Adjust the solid angle to allow for how many faces we processed.
-  float facesProcessed     = 6.f;
-  float expectedSolidAngle = sphereSolidAngle * facesProcessed / 6.f;
+  const double sphereSolidAngle = 4.0 * Math::PI;
 
   // Adjust the harmonics so that the accumulated solid angle matches the
   // expected solid angle. This is needed because the numerical integration over
   // the cube uses a small angle approximation of solid angle for each texel
   // (see deltaSolidAngle), and also to compensate for accumulative error due to
   // float precision in the summation.
-  float correctionFactor = expectedSolidAngle / totalSolidAngle;
-  sphericalHarmonics.scale(correctionFactor);
+  const double correctionFactor = sphereSolidAngle / weights->totalSolidAngle;
+
+  const auto moment = [&moments, correctionFactor](size_t index, double scale) {
+    scale *= correctionFactor;
+    return Vector3(static_cast<float>(moments[index * 3 + 0] * scale),
+                   static_cast<float>(moments[index * 3 + 1] * scale),
+                   static_cast<float>(moments[index * 3 + 2] * scale));
+  };
+
+  // Same basis as SphericalHarmonics::addLight, applied once to the sums
+  SphericalHarmonics sphericalHarmonics;
+  sphericalHarmonics.l00  = moment(0, 0.282095);
+  sphericalHarmonics.l1_1 = moment(1, 0.488603);
+  sphericalHarmonics.l10  = moment(2, 0.488603);
+  sphericalHarmonics.l11  = moment(3, 0.488603);
+  sphericalHarmonics.l2_2 = moment(4, 1.092548);
+  sphericalHarmonics.l2_1 = moment(5, 1.092548);
+  sphericalHarmonics.l21  = moment(6, 1.092548);
+  sphericalHarmonics.l20
+    = moment(7, 3.0 * 0.315392).subtract(moment(0, 0.315392));
+  sphericalHarmonics.lL22 = moment(8, 0.546274);
 
   sphericalHarmonics.convertIncidentRadianceToIrradiance();
   sphericalHarmonics.convertIrradianceToLambertianRadiance();
@@ -1,6 +1,14 @@
 #include <babylon/tools/hdr/pmrem_generator.h>
 
 #include <cmath>
+#include <mutex>
+
+#include <babylon/core/thread_pool.h>
+
+// SIMD
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+#include <babylon/math/simd/float32x4.h>
+#endif
 
 namespace BABYLON {
 
@@ -122,6 +130,7 @@ PMREMGenerator<ArrayBufferView>::PMREMGenerator(
     , cosinePowerDropPerMip{_cosinePowerDropPerMip}
     , excludeBase{_excludeBase}
     , fixup{_fixup}
+    , _numMipLevels{0}
 {
 }
 
@@ -132,13 +141,14 @@ PMREMGenerator<ArrayBufferView>::~PMREMGenerator()
 
 template <typename ArrayBufferView>
 std::vector<std::vector<ArrayBufferView>>&
-PMREMGenerator<ArrayBufferView>::filterCubeMap()
+PMREMGenerator<ArrayBufferView>::filterCubeMap(
+  ThreadPool* threadPool, const ProgressCallback& onProgress)
 {
   // Init cubemap processor
   init();
 
   // Filters the cubemap
-  filterCubeMapMipChain();
+  filterCubeMapMipChain(threadPool, onProgress);
 
   // Returns the filtered mips.
   return _outputSurface;
@@ -155,7 +165,8 @@ void PMREMGenerator<ArrayBufferView>::init()
   }
 
   // first miplevel size
-  mipLevelSize = outputSize;
+  mipLevelSize  = outputSize;
+  _numMipLevels = 0;
 
   // Iterate over mip chain, and init ArrayBufferView for mip-chain
   _outputSurface.resize(maxNumMipLevels);
@@ -175,13 +186,16 @@ void PMREMGenerator<ArrayBufferView>::init()
     // terminate if mip chain becomes too small
     if (mipLevelSize == 0) {
       maxNumMipLevels = j;
-      return;
+      break;
     }
   }
+
+  _outputSurface.resize(_numMipLevels);
 }
 
 template <typename ArrayBufferView>
-void PMREMGenerator<ArrayBufferView>::filterCubeMapMipChain()
+void PMREMGenerator<ArrayBufferView>::filterCubeMapMipChain(
+  ThreadPool* threadPool, const ProgressCallback& onProgress)
 {
   // First, take count of the lighting model to modify SpecularPower
   // var refSpecularPower = (a_MCO.LightingModel == CP_LIGHTINGMODEL_BLINN ||
@@ -197,6 +211,23 @@ void PMREMGenerator<ArrayBufferView>::filterCubeMapMipChain()
   // Build filter lookup tables based on the source miplevel size
   precomputeFilterLookupTables(inputSize);
 
+  // The progress is the number of filtered rows over the rows of all the levels
+  std::function<void()> onRowFiltered;
+  std::mutex progressMutex;
+  size_t rowCount         = 0;
+  size_t filteredRowCount = 0;
+  if (onProgress) {
+    for (int levelIndex = 0; levelIndex < _numMipLevels; ++levelIndex) {
+      rowCount += 6 * static_cast<size_t>(outputSize >> levelIndex);
+    }
+    onRowFiltered = [&]() {
+      std::lock_guard<std::mutex> lock(progressMutex);
+      ++filteredRowCount;
+      onProgress(static_cast<float>(filteredRowCount)
+                 / static_cast<float>(rowCount));
+    };
+  }
+
   // Note that we need to filter the first level before generating mipmap
   // So LevelIndex == 0 is base filtering hen LevelIndex > 0 is mipmap
   // generation
@@ -213,8 +244,7 @@ void PMREMGenerator<ArrayBufferView>::filterCubeMapMipChain()
     // Special case for cosine power mipmap chain. For quality requirement, we
     // always process the current mipmap from the top mipmap
     std::vector<ArrayBufferView>& srcCubeImage = input;
-    std::vector<std::vector<ArrayBufferView>>& dstCubeImage
-      = _outputSurface[levelIndex];
+    std::vector<ArrayBufferView>& dstCubeImage = _outputSurface[levelIndex];
     size_t dstSize = outputSize >> levelIndex;
 
     // Compute required angle.
@@ -222,7 +252,7 @@ void PMREMGenerator<ArrayBufferView>::filterCubeMapMipChain()
 
     // filter cube surfaces
     filterCubeSurfaces(srcCubeImage, inputSize, dstCubeImage, dstSize, angle,
-                       currentSpecularPower);
+                       currentSpecularPower, threadPool, onRowFiltered);
 
     // fix seams
     if (fixup) {
@@ -263,8 +293,6 @@ template <typename ArrayBufferView>
 void PMREMGenerator<ArrayBufferView>::precomputeFilterLookupTables(
   size_t srcCubeMapWidth)
 {
-  // clear pre-existing normalizer cube map
-  _normCubeMap.clear();
 
   // Normalized vectors per cubeface and per-texel solid angle
   buildNormalizerSolidAngleCubemap(srcCubeMapWidth);
@@ -276,21 +304,23 @@ void PMREMGenerator<ArrayBufferView>::buildNormalizerSolidAngleCubemap(
 {
   // iterate over cube faces
   for (unsigned int iCubeFace = 0; iCubeFace < 6; ++iCubeFace) {
-    // First three channels for norm cube, and last channel for solid angle
-    _normCubeMap.emplace_back(Float32Array(size * size * 4));
+    // Three tables for the norm cube, and one table for the solid angle
+    auto& normalizerFace = _normCubeMap[iCubeFace];
+    normalizerFace.directionX.resize(size * size);
+    normalizerFace.directionY.resize(size * size);
+    normalizerFace.directionZ.resize(size * size);
+    normalizerFace.solidAngle.resize(size * size);
 
     // fast texture walk, build normalizer cube map
-    // ArrayBufferView& facesData = input[iCubeFace];
-
     for (size_t v = 0; v < size; v++) {
       for (size_t u = 0; u < size; u++) {
-        Vector3 vect = texelCoordToVect(iCubeFace, u, v, size, fixup);
-        _normCubeMap[iCubeFace][(v * size + u) * 4 + 0] = vect.x;
-        _normCubeMap[iCubeFace][(v * size + u) * 4 + 1] = vect.y;
-        _normCubeMap[iCubeFace][(v * size + u) * 4 + 2] = vect.z;
-
-        float solidAngle = texelCoordSolidAngle(iCubeFace, u, v, size);
-        _normCubeMap[iCubeFace][(v * size + u) * 4 + 4] = solidAngle;
+        const auto index = v * size + u;
+        const auto vect  = texelCoordToVect(iCubeFace, u, v, size, fixup);
+        normalizerFace.directionX[index] = vect.x;
+        normalizerFace.directionY[index] = vect.y;
+        normalizerFace.directionZ[index] = vect.z;
+        normalizerFace.solidAngle[index]
+          = texelCoordSolidAngle(iCubeFace, u, v, size);
       }
     }
   }
@@ -458,11 +488,9 @@ template <typename ArrayBufferView>
 void PMREMGenerator<ArrayBufferView>::filterCubeSurfaces(
   const std::vector<ArrayBufferView>& srcCubeMap, float srcSize,
   std::vector<ArrayBufferView>& dstCubeMap, size_t dstSize,
-  float filterConeAngle, float _specularPower)
+  float filterConeAngle, float _specularPower, ThreadPool* threadPool,
+  const std::function<void()>& onRowFiltered)
 {
-  // bounding box per face to specify region to process
-  std::array<CMGBoundinBox, 6> filterExtents;
-
   // min angle a src texel can cover (in degrees)
   float srcTexelAngle = (180.f / (Math::PI)*std::atan2(1.f, srcSize));
 
@@ -494,38 +522,60 @@ void PMREMGenerator<ArrayBufferView>::filterCubeSurfaces(
   //  reside within the cone angle
   float dotProdThresh = std::cos((Math::PI / 180.f) * filterAngle);
 
-  // process required faces
-  for (unsigned int iCubeFace = 0; iCubeFace < 6; ++iCubeFace) {
+  // process a row of a required face, the rows only share read-only data
+  const auto filterRow = [&](size_t row) {
+    // bounding box per face to specify region to process
+    std::array<CMGBoundinBox, 6> filterExtents;
+
+    const auto iCubeFace = static_cast<unsigned int>(row / dstSize);
+    const auto v         = static_cast<unsigned int>(row % dstSize);
+    auto& dstFace        = dstCubeMap[iCubeFace];
+
     // iterate over dst cube map face texel
-    for (unsigned int v = 0; v < dstSize; ++v) {
-      for (unsigned int u = 0; u < dstSize; ++u) {
-        // get center tap direction
-        Vector4 centerTapDir
-          = texelCoordToVect(iCubeFace, u, v, dstSize, fixup).clone();
-
-        // clear old per-face filter extents
-        clearFilterExtents(filterExtents);
-
-        // define per-face filter extents
-        determineFilterExtents(centerTapDir, srcSize, filterSize,
-                               filterExtents);
-
-        // perform filtering of src faces using filter extents
-        Vector3 vect
-          = processFilterExtents(centerTapDir, dotProdThresh, filterExtents,
-                                 srcCubeMap, srcSize, _specularPower);
-
-        dstCubeMap[iCubeFace][(v * dstSize + u) * numChannels + 0] = vect.x;
-        dstCubeMap[iCubeFace][(v * dstSize + u) * numChannels + 1] = vect.y;
-        dstCubeMap[iCubeFace][(v * dstSize + u) * numChannels + 2] = vect.z;
+    for (unsigned int u = 0; u < dstSize; ++u) {
+      // get center tap direction
+      const auto centerTapDir
+        = texelCoordToVect(iCubeFace, u, v, dstSize, fixup);
+
+      // clear old per-face filter extents
+      clearFilterExtents(filterExtents);
+
+      // define per-face filter extents
+      determineFilterExtents(centerTapDir, srcSize, filterSize, filterExtents);
+
+      // perform filtering of src faces using filter extents
+      const auto vect
+        = processFilterExtents(centerTapDir, dotProdThresh, filterExtents,
+                               srcCubeMap, srcSize, _specularPower);
+
+      const auto index = (v * dstSize + u) * numChannels;
+      dstFace[index + 0] = vect.x;
+      dstFace[index + 1] = vect.y;
+      dstFace[index + 2] = vect.z;
+      if (numChannels > 3) {
+        dstFace[index + 3] = vect.w;
       }
     }
+
+    if (onRowFiltered) {
+      onRowFiltered();
+    }
+  };
+
+  const auto rowCount = 6 * dstSize;
+  if (threadPool) {
+    threadPool->parallelFor(rowCount, filterRow);
+  }
+  else {
+    for (size_t row = 0; row < rowCount; ++row) {
+      filterRow(row);
+    }
   }
 }
 
 template <typename ArrayBufferView>
 void PMREMGenerator<ArrayBufferView>::clearFilterExtents(
-  std::array<CMGBoundinBox, 6>& filterExtents)
+  std::array<CMGBoundinBox, 6>& filterExtents) const
 {
   for (auto& filterExtent : filterExtents) {
     filterExtent.clear();
@@ -548,7 +598,7 @@ void PMREMGenerator<ArrayBufferView>::determineFilterExtents(
   unsigned int oppositeFaceIdx = 0;
 
   // get face idx, and u, v info from center tap dir
-  Vector3 result
+  const auto result
     = vectToTexelCoord(centerTapDir.x, centerTapDir.y, centerTapDir.z, srcSize);
   unsigned int faceIdx = static_cast<unsigned>(result.x);
   float u              = result.y;
@@ -689,134 +739,145 @@ Vector4 PMREMGenerator<ArrayBufferView>::processFilterExtents(
   const Vector4& centerTapDir, float dotProdThresh,
   const std::array<CMGBoundinBox, 6>& filterExtents,
   const std::vector<ArrayBufferView>& srcCubeMap, size_t srcSize,
-  size_t _specularPower) const
+  float _specularPower) const
 {
   Vector4 _vectorTemp{0.f, 0.f, 0.f, 0.f};
 
   // accumulators are 64-bit floats in order to have the precision needed
   // over a summation of a large number of pixels
-  std::array<float, 4> dstAccum{{0, 0, 0, 0}};
-  float weightAccum   = 0.f;
-  size_t nSrcChannels = numChannels;
+  std::array<double, 4> dstAccum{{0, 0, 0, 0}};
+  double weightAccum = 0.0;
 
   // norm cube map and srcCubeMap have same face width
   size_t faceWidth = srcSize;
 
-  // amount to add to pointer to move to next scanline in images
-  size_t normCubePitch = faceWidth * 4; // 4 channels in normCubeMap.
-  size_t srcCubePitch
-    = faceWidth
-      * numChannels; // numChannels correponds to the cubemap number of channel
-
   unsigned int IsPhongBRDF = 1; // Only works in Phong BRDF yet.
   //(a_LightingModel == CP_LIGHTINGMODEL_PHONG_BRDF || a_LightingModel ==
   // CP_LIGHTINGMODEL_BLINN_BRDF) ? 1 : 0; // This value will be added to the
   // specular power
 
+  // Here we decide if we use a Phong/Blinn or a Phong/Blinn BRDF.
+  // Phong/Blinn BRDF is just the Phong/Blinn model multiply by the cosine of
+  // the lambert law so just adding one to specularpower do the trick.
+  const float power = _specularPower + IsPhongBRDF;
+
   // iterate over cubefaces
   for (unsigned int iFaceIdx = 0; iFaceIdx < 6; iFaceIdx++) {
 
     // if bbox is non empty
     if (!filterExtents[iFaceIdx].empty()) {
-      float uStart = filterExtents[iFaceIdx].min.x;
-      float vStart = filterExtents[iFaceIdx].min.y;
-      float uEnd   = filterExtents[iFaceIdx].max.x;
-      float vEnd   = filterExtents[iFaceIdx].max.y;
-
-      size_t startIndexNormCubeMap
-        = static_cast<size_t>(4.f * ((vStart * faceWidth) + uStart));
-      size_t startIndexSrcCubeMap
-        = static_cast<size_t>(numChannels * ((vStart * faceWidth) + uStart));
+      const auto uStart = static_cast<size_t>(filterExtents[iFaceIdx].min.x);
+      const auto vStart = static_cast<size_t>(filterExtents[iFaceIdx].min.y);
+      const auto uEnd   = static_cast<size_t>(filterExtents[iFaceIdx].max.x);
+      const auto vEnd   = static_cast<size_t>(filterExtents[iFaceIdx].max.y);
 
       // note that <= is used to ensure filter extents always encompass at least
       // one pixel if bbox is non empty
-      for (float v = vStart; v <= vEnd; v++) {
-        float normCubeRowWalk = 0;
-        float srcCubeRowWalk  = 0;
-
-        for (float u = uStart; u <= uEnd; u++) {
-          // pointer to direction in cube map associated with texel
-          float texelVectX = _normCubeMap[iFaceIdx][startIndexNormCubeMap
-                                                    + normCubeRowWalk + 0];
-          float texelVectY = _normCubeMap[iFaceIdx][startIndexNormCubeMap
-                                                    + normCubeRowWalk + 1];
-          float texelVectZ = _normCubeMap[iFaceIdx][startIndexNormCubeMap
-                                                    + normCubeRowWalk + 2];
-
-          // check dot product to see if texel is within cone
-          float tapDotProd = texelVectX * centerTapDir.x
-                             + texelVectY * centerTapDir.y
-                             + texelVectZ * centerTapDir.z;
-
-          if (tapDotProd >= dotProdThresh && tapDotProd > 0.f) {
-            // solid angle stored in 4th channel of normalizer/solid angle cube
-            // map
-            float weight = _normCubeMap[iFaceIdx][startIndexNormCubeMap
-                                                  + normCubeRowWalk + 3];
-
-            // Here we decide if we use a Phong/Blinn or a Phong/Blinn BRDF.
-            // Phong/Blinn BRDF is just the Phong/Blinn model multiply by the
-            // cosine of the lambert law
-            // so just adding one to specularpower do the trick.
-            weight *= std::pow(tapDotProd, (_specularPower + IsPhongBRDF));
-
-            // iterate over channels
-            for (size_t k = 0; k < nSrcChannels;
-                 k++) //(aSrcCubeMap[iFaceIdx].m_NumChannels) //up to 4 channels
-            {
-              dstAccum[k] += weight
-                             * srcCubeMap[iFaceIdx][startIndexSrcCubeMap
-                                                    + srcCubeRowWalk];
-              srcCubeRowWalk++;
-            }
-
-            weightAccum += weight; // accumulate weight
-          }
-          else {
-            // step across source pixel
-            srcCubeRowWalk += nSrcChannels;
-          }
-
-          normCubeRowWalk += 4; // 4 channels per norm cube map.
-        }
-
-        startIndexNormCubeMap += normCubePitch;
-        startIndexSrcCubeMap += srcCubePitch;
+      for (size_t v = vStart; v <= vEnd; v++) {
+        accumulateFilterRow(_normCubeMap[iFaceIdx], srcCubeMap[iFaceIdx],
+                            v * faceWidth, uStart, uEnd, centerTapDir,
+                            dotProdThresh, power, dstAccum, weightAccum);
       }
     }
   }
 
   // divide through by weights if weight is non zero
-  if (weightAccum != 0.f) {
-    _vectorTemp.x = (dstAccum[0] / weightAccum);
-    _vectorTemp.y = (dstAccum[1] / weightAccum);
-    _vectorTemp.z = (dstAccum[2] / weightAccum);
+  if (weightAccum != 0.0) {
+    _vectorTemp.x = static_cast<float>(dstAccum[0] / weightAccum);
+    _vectorTemp.y = static_cast<float>(dstAccum[1] / weightAccum);
+    _vectorTemp.z = static_cast<float>(dstAccum[2] / weightAccum);
     if (numChannels > 3) {
-      _vectorTemp.w = (dstAccum[3] / weightAccum);
+      _vectorTemp.w = static_cast<float>(dstAccum[3] / weightAccum);
     }
   }
   else {
     // otherwise sample nearest
     // get face idx and u, v texel coordinate in face
-    Vector3 coord = vectToTexelCoord(centerTapDir.x, centerTapDir.y,
-                                     centerTapDir.z, srcSize)
-                      .clone();
-
-    _vectorTemp.x
-      = srcCubeMap[coord.x][numChannels * (coord.z * srcSize + coord.y) + 0];
-    _vectorTemp.y
-      = srcCubeMap[coord.x][numChannels * (coord.z * srcSize + coord.y) + 1];
-    _vectorTemp.z
-      = srcCubeMap[coord.x][numChannels * (coord.z * srcSize + coord.y) + 2];
+    const auto coord = vectToTexelCoord(centerTapDir.x, centerTapDir.y,
+                                        centerTapDir.z, srcSize);
+    const auto& srcFace = srcCubeMap[static_cast<size_t>(coord.x)];
+    const auto index    = numChannels
+                       * static_cast<size_t>(coord.z * srcSize + coord.y);
+
+    _vectorTemp.x = srcFace[index + 0];
+    _vectorTemp.y = srcFace[index + 1];
+    _vectorTemp.z = srcFace[index + 2];
     if (numChannels > 3) {
-      _vectorTemp.z
-        = srcCubeMap[coord.x][numChannels * (coord.z * srcSize + coord.y) + 3];
+      _vectorTemp.w = srcFace[index + 3];
     }
   }
 
   return _vectorTemp;
 }
 
+template <typename ArrayBufferView>
+void PMREMGenerator<ArrayBufferView>::accumulateFilterRow(
+  const NormalizerFace& normalizerFace, const ArrayBufferView& srcFace,
+  size_t rowStart, size_t uStart, size_t uEnd, const Vector4& centerTapDir,
+  float dotProdThresh, float power, std::array<double, 4>& dstAccum,
+  double& weightAccum) const
+{
+  // directions and solid angles of the texels of the row
+  const auto* texelVectX = normalizerFace.directionX.data() + rowStart;
+  const auto* texelVectY = normalizerFace.directionY.data() + rowStart;
+  const auto* texelVectZ = normalizerFace.directionZ.data() + rowStart;
+  const auto* solidAngle = normalizerFace.solidAngle.data() + rowStart;
+  const auto* src        = srcFace.data() + rowStart * numChannels;
+
+  const auto accumulate = [&](size_t u, float tapDotProd) {
+    // solid angle stored in the 4th table of normalizer/solid angle cube map
+    const double weight = solidAngle[u] * std::pow(tapDotProd, power);
+
+    // iterate over channels
+    for (size_t k = 0; k < numChannels; ++k) {
+      dstAccum[k] += weight * src[u * numChannels + k];
+    }
+
+    weightAccum += weight; // accumulate weight
+  };
+
+  auto u = uStart;
+
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+  // 4 texels per iteration, the texels outside of the cone are rejected
+  // without leaving the registers
+  const auto centerX   = _mm_set1_ps(centerTapDir.x);
+  const auto centerY   = _mm_set1_ps(centerTapDir.y);
+  const auto centerZ   = _mm_set1_ps(centerTapDir.z);
+  const auto threshold = _mm_set1_ps(dotProdThresh);
+  const auto zero      = _mm_setzero_ps();
+  alignas(16) std::array<float, 4> tapDotProds;
+  for (; u + 4 <= uEnd + 1; u += 4) {
+    const auto tapDotProd = _mm_add_ps(
+      _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(texelVectX + u), centerX),
+                 _mm_mul_ps(_mm_loadu_ps(texelVectY + u), centerY)),
+      _mm_mul_ps(_mm_loadu_ps(texelVectZ + u), centerZ));
+    const auto inCone = _mm_movemask_ps(_mm_and_ps(
+      _mm_cmpge_ps(tapDotProd, threshold), _mm_cmpgt_ps(tapDotProd, zero)));
+    if (inCone == 0) {
+      continue;
+    }
+    _mm_store_ps(tapDotProds.data(), tapDotProd);
+    for (unsigned int lane = 0; lane < 4; ++lane) {
+      if (inCone & (1 << lane)) {
+        accumulate(u + lane, tapDotProds[lane]);
+      }
+    }
+  }
+#endif
+
+  for (; u <= uEnd; ++u) {
+    // check dot product to see if texel is within cone
+    const float tapDotProd = texelVectX[u] * centerTapDir.x
+                             + texelVectY[u] * centerTapDir.y
+                             + texelVectZ[u] * centerTapDir.z;
+
+    if (tapDotProd >= dotProdThresh && tapDotProd > 0.f) {
+      accumulate(u, tapDotProd);
+    }
+  }
+}
+
 template <typename ArrayBufferView>
 void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
   std::vector<ArrayBufferView>& cubeMap, size_t cubeMapSize)
@@ -840,7 +901,7 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
   if (cubeMapSize == 1) {
     // iterate over channels
     for (unsigned int k = 0; k < numChannels; ++k) {
-      size_t accum = 0.f;
+      float accum = 0.f;
 
       // iterate over faces to accumulate face colors
       for (unsigned int iFace = 0; iFace < 6; ++iFace) {
@@ -863,12 +924,15 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
   for (unsigned int iFace = 0; iFace < 6; ++iFace) {
     // the 4 corner pointers for this face
     faceCornerStartIndicies[0] = {iFace, 0};
-    faceCornerStartIndicies[1] = {iFace, ((cubeMapSize - 1) * numChannels)};
-    faceCornerStartIndicies[2]
-      = {iFace, ((cubeMapSize) * (cubeMapSize - 1) * numChannels)};
+    faceCornerStartIndicies[1]
+      = {iFace, static_cast<uint32_t>((cubeMapSize - 1) * numChannels)};
+    faceCornerStartIndicies[2] = {
+      iFace,
+      static_cast<uint32_t>((cubeMapSize) * (cubeMapSize - 1) * numChannels)};
     faceCornerStartIndicies[3]
-      = {iFace, ((((cubeMapSize) * (cubeMapSize - 1)) + (cubeMapSize - 1))
-                 * numChannels)};
+      = {iFace, static_cast<uint32_t>(
+                  (((cubeMapSize) * (cubeMapSize - 1)) + (cubeMapSize - 1))
+                  * numChannels)};
 
     // iterate over face corners to collect cube corner pointers
     for (unsigned int iCorner = 0; iCorner < 4; ++iCorner) {
@@ -1023,16 +1087,16 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
       // for each set of taps along edge, average them
       // and rewrite the results into the edges
       for (unsigned int k = 0; k < numChannels; k++) {
-        ArrayBufferView& edgeTap = cubeMap[face][edgeStartIndex + k];
-        ArrayBufferView& neighborEdgeTap
+        auto& edgeTap = cubeMap[face][edgeStartIndex + k];
+        auto& neighborEdgeTap
           = cubeMap[neighborFace][neighborEdgeStartIndex + k];
 
         // compute average of tap intensity values
         float avgTap = 0.5f * (edgeTap + neighborEdgeTap);
 
         // propagate average of taps to edge taps
-        cubeMap[face][edgeStartIndex + k]                 = avgTap;
-        cubeMap[neighborFace][neighborEdgeStartIndex + k] = avgTap;
+        edgeTap         = avgTap;
+        neighborEdgeTap = avgTap;
       }
 
       edgeStartIndex += edgeWalk;
@@ -1041,4 +1105,6 @@ void PMREMGenerator<ArrayBufferView>::fixupCubeEdges(
   }
 }
 
+template class PMREMGenerator<Float32Array>;
+
 } // end of namespace BABYLON
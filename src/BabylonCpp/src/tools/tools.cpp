@@ -22,8 +22,12 @@
 #define NOMINMAX
 #endif
 
+#include <limits>
+
 #include <babylon/core/filesystem.h>
+#include <babylon/core/filesystem/mapped_file.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/profiling/memory.h>
 #include <babylon/core/random.h>
 #include <babylon/core/string.h>
 #include <babylon/interfaces/igl_rendering_context.h>
@@ -52,6 +56,10 @@ std::function<std::string(std::string url)> Tools::PreprocessUrl
       return url;
     };
 
+size_t Tools::BinaryFileMemoryBudget
+  = Memory::GetMemorySize() > 0 ? Memory::GetMemorySize() / 2 :
+                                  std::numeric_limits<size_t>::max();
+
 void Tools::FetchToRef(int u, int v, int width, int height,
                        const Uint8Array& pixels, Color4& color)
 {
@@ -167,6 +175,16 @@ MinMax Tools::ExtractMinAndMaxIndexed(const Float32Array& positions,
                                       const Uint32Array& indices,
                                       size_t indexStart, size_t indexCount,
                                       const std::optional<Vector2>& bias)
+{
+  return ExtractMinAndMaxIndexed(positions.data(), indices, indexStart,
+                                 indexCount, bias);
+}
+
+MinMax Tools::ExtractMinAndMaxIndexed(const float* positions,
+                                      const Uint32Array& indices,
+                                      size_t indexStart, size_t indexCount,
+                                      const std::optional<Vector2>& bias,
+                                      size_t stride)
 {
   Vector3 minimum(std::numeric_limits<float>::max(),
                   std::numeric_limits<float>::max(),
@@ -176,9 +194,9 @@ MinMax Tools::ExtractMinAndMaxIndexed(const Float32Array& positions,
                   std::numeric_limits<float>::lowest());
 
   for (size_t index = indexStart; index < indexStart + indexCount; ++index) {
-    Vector3 current(positions[indices[index] * 3],
-                    positions[indices[index] * 3 + 1],
-                    positions[indices[index] * 3 + 2]);
+    const auto offset = indices[index] * stride;
+    Vector3 current(positions[offset], positions[offset + 1],
+                    positions[offset + 2]);
 
     minimum = Vector3::Minimize(current, minimum);
     maximum = Vector3::Maximize(current, maximum);
@@ -200,6 +218,14 @@ MinMax Tools::ExtractMinAndMaxIndexed(const Float32Array& positions,
 MinMax Tools::ExtractMinAndMax(const Float32Array& positions, size_t start,
                                size_t count, const std::optional<Vector2>& bias,
                                std::optional<unsigned int> stride)
+{
+  return ExtractMinAndMax(positions.data(), start, count, bias,
+                          stride ? *stride : 3u);
+}
+
+MinMax Tools::ExtractMinAndMax(const float* positions, size_t start,
+                               size_t count, const std::optional<Vector2>& bias,
+                               size_t stride)
 {
   Vector3 minimum(std::numeric_limits<float>::max(),
                   std::numeric_limits<float>::max(),
@@ -208,14 +234,9 @@ MinMax Tools::ExtractMinAndMax(const Float32Array& positions, size_t start,
                   std::numeric_limits<float>::lowest(),
                   std::numeric_limits<float>::lowest());
 
-  if (!stride) {
-    stride = 3;
-  }
-
-  auto _stride = *stride;
   for (size_t index = start; index < start + count; ++index) {
-    Vector3 current(positions[index * _stride], positions[index * _stride + 1],
-                    positions[index * _stride + 2]);
+    Vector3 current(positions[index * stride], positions[index * stride + 1],
+                    positions[index * stride + 2]);
 
     minimum = Vector3::Minimize(current, minimum);
     maximum = Vector3::Maximize(current, maximum);
@@ -428,10 +449,108 @@ void Tools::ReadFile(
     return;
   }
   else {
-    // Not implemented yet
+    // The callback takes the data as a string, the mapped file is copied once
+    ReadBinaryFile(
+      fileToLoad,
+      [&callback](const MappedFilePtr& data, const std::string& responseURL) {
+        if (callback) {
+          callback(std::string(reinterpret_cast<const char*>(data->data()),
+                               data->size()),
+                   responseURL);
+        }
+      },
+      onProgress, [&callback](const std::string& /*exception*/) {
+        if (callback) {
+          callback("", "");
+        }
+      });
   }
 }
 
+void Tools::LoadBinaryFile(
+  std::string url,
+  const std::function<void(const MappedFilePtr& data,
+                           const std::string& responseURL)>& callback,
+  const std::function<void(const ProgressEvent& event)>& onProgress,
+  const std::function<void(const std::string& exception)>& onError)
+{
+  url = Tools::CleanUrl(url);
+
+  url = Tools::PreprocessUrl(url);
+
+  // If file and file input are set
+  if (String::startsWith(url, "file:")) {
+    const auto fileName = url.substr(5);
+    if (!fileName.empty()) {
+      Tools::ReadBinaryFile(fileName, callback, onProgress, onError);
+      return;
+    }
+  }
+
+  // Report error
+  if (onError) {
+    onError("Unable to load file from location " + url);
+  }
+}
+
+void Tools::ReadBinaryFile(
+  std::string fileToLoad,
+  const std::function<void(const MappedFilePtr& data,
+                           const std::string& responseURL)>& callback,
+  const std::function<void(const ProgressEvent& event)>& onProgress,
+  const std::function<void(const std::string& exception)>& onError)
+{
+  const auto reportProgress = [&onProgress](size_t loaded, size_t total) {
+    if (onProgress) {
+      onProgress(ProgressEvent{"ReadFileEvent", true, loaded, total});
+    }
+  };
+
+  auto data = MappedFile::Map(fileToLoad);
+  if (data) {
+    reportProgress(data->size(), data->size());
+  }
+  else if (Filesystem::fileSize(fileToLoad) <= BinaryFileMemoryBudget) {
+    // Files which cannot be mapped, e.g. empty files
+    data = MappedFile::Read(fileToLoad, reportProgress);
+  }
+  else {
+    BABYLON_LOGF_ERROR("Tools", "File larger than the memory budget: %s",
+                       fileToLoad.c_str());
+    if (onError) {
+      onError("File larger than the memory budget, it must be streamed: "
+              + fileToLoad);
+    }
+    return;
+  }
+
+  if (!data) {
+    BABYLON_LOGF_ERROR("Tools", "Error while reading file: %s",
+                       fileToLoad.c_str());
+    if (onError) {
+      onError("Error while reading file: " + fileToLoad);
+    }
+    return;
+  }
+
+  if (callback) {
+    callback(data, "");
+  }
+}
+
+bool Tools::StreamFile(
+  const std::string& fileToLoad, size_t chunkSize,
+  const std::function<bool(const uint8_t* chunk, size_t length)>& onChunk,
+  const std::function<void(const ProgressEvent& event)>& onProgress)
+{
+  return MappedFile::Stream(
+    fileToLoad, chunkSize, onChunk, [&onProgress](size_t loaded, size_t total) {
+      if (onProgress) {
+        onProgress(ProgressEvent{"ReadFileEvent", true, loaded, total});
+      }
+    });
+}
+
 void Tools::CheckExtends(Vector3& v, Vector3& min, Vector3& max)
 {
   if (v.x < min.x) {
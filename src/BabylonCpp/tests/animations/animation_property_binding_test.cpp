@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_property_binding.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/lights/point_light.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/mesh/mesh.h>
+
+TEST(TestAnimationPropertyBinding, TransformNode)
+{
+  using namespace BABYLON;
+
+  // Engine without rendering context
+  auto engine = Engine::New(nullptr);
+  auto scene  = Scene::New(engine.get());
+  auto mesh   = Mesh::New("mesh", scene.get());
+
+  auto binding = AnimationPropertyBinding::Compile(
+    mesh.get(), {"position"}, Animation::ANIMATIONTYPE_VECTOR3());
+  ASSERT_TRUE(binding.isValid());
+  EXPECT_EQ(binding.target(), mesh.get());
+  binding.setValue(AnimationValue(Vector3(1.f, 2.f, 3.f)));
+  EXPECT_FLOAT_EQ(mesh->position().x, 1.f);
+  EXPECT_FLOAT_EQ(mesh->position().y, 2.f);
+  EXPECT_FLOAT_EQ(mesh->position().z, 3.f);
+
+  binding = AnimationPropertyBinding::Compile(
+    mesh.get(), {"rotationQuaternion"}, Animation::ANIMATIONTYPE_QUATERNION());
+  ASSERT_TRUE(binding.isValid());
+  binding.setValue(AnimationValue(Quaternion(0.f, 1.f, 0.f, 0.f)));
+  ASSERT_TRUE(mesh->rotationQuaternion());
+  EXPECT_FLOAT_EQ(mesh->rotationQuaternion()->y, 1.f);
+
+  // Unsupported data types and paths are left to the reflection
+  EXPECT_FALSE(AnimationPropertyBinding::Compile(
+                 mesh.get(), {"position"}, Animation::ANIMATIONTYPE_FLOAT())
+                 .isValid());
+  EXPECT_FALSE(AnimationPropertyBinding::Compile(
+                 mesh.get(), {"position", "x"},
+                 Animation::ANIMATIONTYPE_FLOAT())
+                 .isValid());
+  EXPECT_FALSE(AnimationPropertyBinding::Compile(
+                 nullptr, {"position"}, Animation::ANIMATIONTYPE_VECTOR3())
+                 .isValid());
+}
+
+TEST(TestAnimationPropertyBinding, BoneLightAndMaterial)
+{
+  using namespace BABYLON;
+
+  auto engine = Engine::New(nullptr);
+  auto scene  = Scene::New(engine.get());
+
+  // Bone local matrix, the scene owns the skeleton
+  auto skeleton = new Skeleton("skeleton", "skeleton", scene.get());
+  auto bone     = Bone::New("bone", skeleton);
+  auto binding  = AnimationPropertyBinding::Compile(
+    bone.get(), {"_matrix"}, Animation::ANIMATIONTYPE_MATRIX());
+  ASSERT_TRUE(binding.isValid());
+  binding.setValue(AnimationValue(Matrix::Translation(4.f, 5.f, 6.f)));
+  EXPECT_FLOAT_EQ(bone->getLocalMatrix().m[12], 4.f);
+  EXPECT_FLOAT_EQ(bone->getLocalMatrix().m[14], 6.f);
+
+  // Light intensity
+  auto light = PointLight::New("light", Vector3::Zero(), scene.get());
+  binding    = AnimationPropertyBinding::Compile(
+    light.get(), {"intensity"}, Animation::ANIMATIONTYPE_FLOAT());
+  ASSERT_TRUE(binding.isValid());
+  binding.setValue(AnimationValue(0.25f));
+  EXPECT_FLOAT_EQ(light->intensity, 0.25f);
+
+  // Material color
+  auto material = StandardMaterial::New("material", scene.get());
+  binding       = AnimationPropertyBinding::Compile(
+    material.get(), {"diffuseColor"}, Animation::ANIMATIONTYPE_COLOR3());
+  ASSERT_TRUE(binding.isValid());
+  binding.setValue(AnimationValue(Color3(0.1f, 0.2f, 0.3f)));
+  EXPECT_FLOAT_EQ(material->diffuseColor.g, 0.2f);
+}
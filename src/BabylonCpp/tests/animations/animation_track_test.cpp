@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_track.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/babylon_enums.h>
+#include <babylon/math/scalar.h>
+
+namespace {
+
+BABYLON::IAnimationKey CreateKey(float frame,
+                                 const BABYLON::AnimationValue& value)
+{
+  BABYLON::IAnimationKey key(frame, value);
+  // Linear interpolation, the previous interpolation path dereferences it
+  key.interpolation = BABYLON::AnimationValue();
+  return key;
+}
+
+} // namespace
+
+TEST(TestAnimationTrack, ComponentCount)
+{
+  using namespace BABYLON;
+
+  EXPECT_EQ(AnimationTrack::ComponentCount(Animation::ANIMATIONTYPE_FLOAT()),
+            1ull);
+  EXPECT_EQ(AnimationTrack::ComponentCount(Animation::ANIMATIONTYPE_SIZE()),
+            2ull);
+  EXPECT_EQ(AnimationTrack::ComponentCount(Animation::ANIMATIONTYPE_COLOR3()),
+            3ull);
+  EXPECT_EQ(
+    AnimationTrack::ComponentCount(Animation::ANIMATIONTYPE_QUATERNION()),
+    4ull);
+  EXPECT_EQ(AnimationTrack::ComponentCount(Animation::ANIMATIONTYPE_MATRIX()),
+            16ull);
+  EXPECT_EQ(AnimationTrack::ComponentCount(Animation::ANIMATIONTYPE_BOOL()),
+            0ull);
+
+  // Keys of another data type can not be stored
+  AnimationTrack track;
+  std::vector<IAnimationKey> keys{CreateKey(0.f, AnimationValue(1.f)),
+                                  CreateKey(10.f, AnimationValue(true))};
+  EXPECT_FALSE(track.build(Animation::ANIMATIONTYPE_FLOAT(), keys));
+  EXPECT_EQ(track.componentCount(), 0ull);
+}
+
+TEST(TestAnimationTrack, FindKey)
+{
+  using namespace BABYLON;
+
+  std::vector<IAnimationKey> keys;
+  for (unsigned int i = 0; i < 10; ++i) {
+    keys.emplace_back(CreateKey(i * 10.f, AnimationValue(float(i))));
+  }
+
+  AnimationTrack track;
+  ASSERT_TRUE(track.build(Animation::ANIMATIONTYPE_FLOAT(), keys));
+  EXPECT_EQ(track.keyCount(), 10ull);
+
+  // Forward playback
+  AnimationTrackCursor cursor;
+  EXPECT_EQ(track.findKey(0.f, cursor), 0ull);
+  EXPECT_EQ(track.findKey(10.f, cursor), 0ull);
+  EXPECT_EQ(track.findKey(10.5f, cursor), 1ull);
+  EXPECT_EQ(track.findKey(25.f, cursor), 2ull);
+  EXPECT_EQ(track.findKey(90.f, cursor), 8ull);
+
+  // Looping and seeking
+  EXPECT_EQ(track.findKey(1.f, cursor), 0ull);
+  EXPECT_EQ(cursor.key, 0ull);
+  EXPECT_EQ(track.findKey(55.f, cursor), 5ull);
+  EXPECT_EQ(track.findKey(-5.f, cursor), 0ull);
+}
+
+TEST(TestAnimationTrack, MatchesAnimationInterpolation)
+{
+  using namespace BABYLON;
+
+  auto animation = Animation::New("position", "position", 30,
+                                   Animation::ANIMATIONTYPE_VECTOR3());
+  std::vector<IAnimationKey> keys{
+    CreateKey(0.f, AnimationValue(Vector3(0.f, 1.f, 2.f))),
+    CreateKey(10.f, AnimationValue(Vector3(10.f, -1.f, 4.f))),
+    CreateKey(30.f, AnimationValue(Vector3(-5.f, 3.f, 0.f)))};
+  keys[1].outTangent = AnimationValue(Vector3(1.f, 0.f, -1.f));
+  keys[2].inTangent  = AnimationValue(Vector3(0.f, 2.f, 1.f));
+  animation->setKeys(keys);
+
+  AnimationTrackCursor cursor;
+  AnimationValue result;
+  std::optional<AnimationValue> workValue;
+  for (float frame = 0.f; frame <= 30.f; frame += 0.75f) {
+    const auto expected = animation->_interpolate(
+      frame, 0, workValue, Animation::ANIMATIONLOOPMODE_CYCLE());
+    ASSERT_TRUE(animation->_interpolateTrack(
+      frame, 0, Animation::ANIMATIONLOOPMODE_CYCLE(), AnimationValue(),
+      AnimationValue(), cursor, result));
+    EXPECT_EQ(result.dataType, Animation::ANIMATIONTYPE_VECTOR3());
+    EXPECT_NEAR(result.vector3Data.x, expected.vector3Data.x, 1e-4f);
+    EXPECT_NEAR(result.vector3Data.y, expected.vector3Data.y, 1e-4f);
+    EXPECT_NEAR(result.vector3Data.z, expected.vector3Data.z, 1e-4f);
+  }
+
+  // Relative loop mode offsets the interpolated value
+  const AnimationValue offset(Vector3(1.f, 2.f, 3.f));
+  ASSERT_TRUE(animation->_interpolateTrack(
+    5.f, 2, Animation::ANIMATIONLOOPMODE_RELATIVE(), offset, AnimationValue(),
+    cursor, result));
+  EXPECT_NEAR(result.vector3Data.x, 7.f, 1e-4f);
+  EXPECT_NEAR(result.vector3Data.y, 4.f, 1e-4f);
+  EXPECT_NEAR(result.vector3Data.z, 9.f, 1e-4f);
+
+  // The track follows the modified keys
+  animation->getKeys()[0].value = AnimationValue(Vector3(2.f, 2.f, 2.f));
+  ASSERT_TRUE(animation->_interpolateTrack(
+    0.f, 0, Animation::ANIMATIONLOOPMODE_CYCLE(), AnimationValue(),
+    AnimationValue(), cursor, result));
+  EXPECT_FLOAT_EQ(result.vector3Data.x, 2.f);
+}
+
+TEST(TestAnimationTrack, QuaternionAndStep)
+{
+  using namespace BABYLON;
+
+  auto animation = Animation::New("rotation", "rotationQuaternion", 30,
+                                   Animation::ANIMATIONTYPE_QUATERNION());
+  auto axis      = Vector3::Up();
+  std::vector<IAnimationKey> keys{
+    CreateKey(0.f, AnimationValue(Quaternion::Identity())),
+    CreateKey(10.f, AnimationValue(Quaternion::RotationAxis(axis, 1.f))),
+    CreateKey(20.f, AnimationValue(Quaternion::RotationAxis(axis, 2.f)))};
+  keys[1].interpolation->dataType
+    = static_cast<int>(AnimationKeyInterpolation::STEP);
+  animation->setKeys(keys);
+
+  AnimationTrackCursor cursor;
+  AnimationValue result;
+  std::optional<AnimationValue> workValue;
+  for (float frame = 0.f; frame <= 20.f; frame += 1.f) {
+    const auto expected = animation->_interpolate(
+      frame, 0, workValue, Animation::ANIMATIONLOOPMODE_CYCLE());
+    ASSERT_TRUE(animation->_interpolateTrack(
+      frame, 0, Animation::ANIMATIONLOOPMODE_CYCLE(), AnimationValue(),
+      AnimationValue(), cursor, result));
+    EXPECT_NEAR(result.quaternionData.x, expected.quaternionData.x, 1e-5f);
+    EXPECT_NEAR(result.quaternionData.y, expected.quaternionData.y, 1e-5f);
+    EXPECT_NEAR(result.quaternionData.z, expected.quaternionData.z, 1e-5f);
+    EXPECT_NEAR(result.quaternionData.w, expected.quaternionData.w, 1e-5f);
+  }
+}
+
+TEST(TestAnimationTrack, FloatTangents)
+{
+  using namespace BABYLON;
+
+  std::vector<IAnimationKey> keys{CreateKey(0.f, AnimationValue(0.f)),
+                                  CreateKey(4.f, AnimationValue(2.f))};
+  keys[0].outTangent = AnimationValue(0.5f);
+  keys[1].inTangent  = AnimationValue(-0.25f);
+
+  AnimationTrack track;
+  ASSERT_TRUE(track.build(Animation::ANIMATIONTYPE_FLOAT(), keys));
+
+  // The tangents are scaled by the frame delta of the segment
+  AnimationTrackCursor cursor;
+  AnimationTrack::Value value;
+  for (float frame = 0.f; frame <= 4.f; frame += 0.5f) {
+    EXPECT_TRUE(track.evaluate(frame, cursor, nullptr, value));
+    EXPECT_NEAR(value[0],
+                Scalar::Hermite(0.f, 0.5f * 4.f, 2.f, -0.25f * 4.f,
+                                frame / 4.f),
+                1e-5f);
+  }
+
+  // Past the last key
+  EXPECT_FALSE(track.evaluate(5.f, cursor, nullptr, value));
+  EXPECT_FLOAT_EQ(value[0], 2.f);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include <babylon/collisions/worker.h>
+#include <babylon/math/matrix.h>
+#include <babylon/math/vector3.h>
+#include <babylon/mesh/vertex_data.h>
+#include <babylon/mesh/vertex_data_options.h>
+
+TEST(TestWorker, Collide)
+{
+  using namespace BABYLON;
+
+  std::vector<WorkerReply> replies;
+  Worker worker;
+  worker.callbackHandler
+    = [&replies](const WorkerReply& reply) { replies.emplace_back(reply); };
+
+  BabylonMessage message;
+  message.taskType = WorkerTaskType::INIT;
+  worker.postMessage(message);
+
+  // Box of size 2 centered at the origin
+  BoxOptions options(2.f);
+  auto box = VertexData::CreateBox(options);
+
+  SerializedGeometry geometry;
+  geometry.id        = "box";
+  geometry.positions = box->positions;
+  geometry.normals   = box->normals;
+  geometry.indices   = box->indices;
+
+  SerializedSubMesh subMesh;
+  subMesh.position      = 0;
+  subMesh.verticesStart = 0;
+  subMesh.verticesCount = box->positions.size() / 3;
+  subMesh.indexStart    = 0;
+  subMesh.indexCount    = box->indices.size();
+  subMesh.hasMaterial   = false;
+  subMesh.sphereCenter  = {0.f, 0.f, 0.f};
+  subMesh.sphereRadius  = std::sqrt(3.f);
+  subMesh.boxMinimum    = {-1.f, -1.f, -1.f};
+  subMesh.boxMaximum    = {1.f, 1.f, 1.f};
+
+  SerializedMesh mesh;
+  mesh.uniqueId             = 7;
+  mesh.id                   = "box";
+  mesh.name                 = "box";
+  mesh.geometryId           = "box";
+  mesh.sphereCenter         = subMesh.sphereCenter;
+  mesh.sphereRadius         = subMesh.sphereRadius;
+  mesh.boxMinimum           = subMesh.boxMinimum;
+  mesh.boxMaximum           = subMesh.boxMaximum;
+  mesh.worldMatrixFromCache = Matrix::Identity().asArray();
+  mesh.subMeshes            = {subMesh};
+  mesh.checkCollisions      = true;
+
+  message.taskType                                   = WorkerTaskType::UPDATE;
+  message.updatePayload.updatedGeometries["box"]     = geometry;
+  message.updatePayload.updatedMeshes[mesh.uniqueId] = mesh;
+  worker.postMessage(std::move(message));
+
+  // Sphere of radius 0.5 falling on the top face of the box, the collider
+  // coordinates are divided by the radius
+  BabylonMessage collideMessage;
+  auto& collidePayload                = collideMessage.collidePayload;
+  collideMessage.taskType             = WorkerTaskType::COLLIDE;
+  collidePayload.collisionId          = 3;
+  collidePayload.maximumRetry         = 3;
+  collidePayload.excludedMeshUniqueId = -1;
+  collidePayload.collider.position    = {0.f, 10.f, 0.f};
+  collidePayload.collider.velocity    = {0.f, -20.f, 0.f};
+  collidePayload.collider.radius      = {0.5f, 0.5f, 0.5f};
+  worker.postMessage(std::move(collideMessage));
+
+  // The replies are only dispatched by processReplies, in order
+  const auto timeout
+    = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (replies.size() < 3 && std::chrono::steady_clock::now() < timeout) {
+    worker.processReplies();
+    std::this_thread::yield();
+  }
+  worker.terminate();
+
+  ASSERT_EQ(replies.size(), 3u);
+  EXPECT_EQ(replies[0].taskType, WorkerTaskType::INIT);
+  EXPECT_EQ(replies[1].taskType, WorkerTaskType::UPDATE);
+  ASSERT_EQ(replies[2].taskType, WorkerTaskType::COLLIDE);
+
+  const auto& payload = replies[2].collisionReplyPayload;
+  EXPECT_EQ(payload.collisionId, 3u);
+  EXPECT_EQ(payload.collidedMeshUniqueId, 7u);
+  const auto newPosition = Vector3::FromArray(payload.newPosition)
+                             .multiply(Vector3(0.5f, 0.5f, 0.5f));
+  EXPECT_NEAR(newPosition.x, 0.f, 1e-3f);
+  EXPECT_NEAR(newPosition.y, 1.5f, 0.05f);
+  EXPECT_NEAR(newPosition.z, 0.f, 1e-3f);
+
+  // Messages posted after termination are ignored
+  worker.postMessage(BabylonMessage());
+  EXPECT_EQ(worker.processReplies(), 0u);
+}
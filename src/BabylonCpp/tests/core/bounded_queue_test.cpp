@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <babylon/core/bounded_queue.h>
+
+TEST(TestBoundedQueue, PushAndPop)
+{
+  using namespace BABYLON;
+  BoundedQueue<int> testQueue(3);
+  EXPECT_EQ(testQueue.capacity(), 4ull);
+  EXPECT_TRUE(testQueue.empty());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(testQueue.tryPush(i));
+  }
+  // The queue is full
+  EXPECT_FALSE(testQueue.tryPush(4));
+  EXPECT_FALSE(testQueue.empty());
+  int poppedItem;
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(testQueue.tryAndPop(poppedItem));
+    EXPECT_EQ(poppedItem, i);
+  }
+  EXPECT_TRUE(testQueue.empty());
+  EXPECT_FALSE(testQueue.tryAndPop(poppedItem));
+  // The cells are reused
+  EXPECT_TRUE(testQueue.tryPush(5));
+  EXPECT_TRUE(testQueue.tryAndPop(poppedItem));
+  EXPECT_EQ(poppedItem, 5);
+}
+
+TEST(TestBoundedQueue, ProducerThreads)
+{
+  using namespace BABYLON;
+  const int producerCount = 4;
+  const int itemCount     = 10000;
+  BoundedQueue<int> testQueue(256);
+  std::vector<std::thread> producers;
+  for (int p = 0; p < producerCount; ++p) {
+    producers.emplace_back([&testQueue, p]() {
+      for (int i = 0; i < itemCount; ++i) {
+        while (!testQueue.tryPush(p * itemCount + i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  // The items of each producer are received in order
+  std::vector<int> expected(producerCount, 0);
+  int poppedItem;
+  for (int received = 0; received < producerCount * itemCount;) {
+    if (testQueue.tryAndPop(poppedItem)) {
+      const auto producer = poppedItem / itemCount;
+      ASSERT_EQ(poppedItem % itemCount, expected[producer]);
+      ++expected[producer];
+      ++received;
+    }
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  EXPECT_TRUE(testQueue.empty());
+}
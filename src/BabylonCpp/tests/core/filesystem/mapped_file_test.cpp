@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/core/filesystem/mapped_file.h>
+#include <babylon/loading/progress_event.h>
+#include <babylon/tools/tools.h>
+
+namespace {
+
+std::string writeTestFile(const std::string& name, size_t size)
+{
+  const auto filename = "mapped_file_test_" + name + ".bin";
+  std::ofstream out(filename, std::ios::out | std::ios::binary);
+  for (size_t i = 0; i < size; ++i) {
+    out.put(static_cast<char>(i % 251));
+  }
+  return filename;
+}
+
+} // end of anonymous namespace
+
+TEST(TestMappedFile, MapAndRead)
+{
+  using namespace BABYLON;
+
+  const size_t size   = 10000;
+  const auto filename = writeTestFile("map", size);
+
+  const auto mapped = MappedFile::Map(filename);
+  ASSERT_NE(mapped, nullptr);
+  EXPECT_TRUE(mapped->isMapped());
+  ASSERT_EQ(mapped->size(), size);
+
+  std::vector<size_t> progress;
+  const auto read = MappedFile::Read(
+    filename, [&progress, size](size_t loaded, size_t total) {
+      EXPECT_EQ(total, size);
+      progress.emplace_back(loaded);
+    });
+  ASSERT_NE(read, nullptr);
+  EXPECT_FALSE(read->isMapped());
+  ASSERT_EQ(read->size(), size);
+  ASSERT_FALSE(progress.empty());
+  EXPECT_EQ(progress.back(), size);
+
+  for (size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(mapped->data()[i], i % 251);
+    ASSERT_EQ(read->data()[i], i % 251);
+  }
+
+  // Empty files cannot be mapped, they are read
+  const auto empty = writeTestFile("empty", 0);
+  EXPECT_EQ(MappedFile::Map(empty), nullptr);
+  const auto opened = MappedFile::Open(empty);
+  ASSERT_NE(opened, nullptr);
+  EXPECT_EQ(opened->size(), 0ull);
+
+  EXPECT_EQ(MappedFile::Open("mapped_file_test_missing.bin"), nullptr);
+
+  Filesystem::removeFile(filename);
+  Filesystem::removeFile(empty);
+}
+
+TEST(TestMappedFile, Stream)
+{
+  using namespace BABYLON;
+
+  const size_t size   = 10000;
+  const auto filename = writeTestFile("stream", size);
+
+  size_t offset = 0;
+  size_t events = 0;
+  EXPECT_TRUE(Tools::StreamFile(
+    filename, 4096,
+    [&offset](const uint8_t* chunk, size_t length) {
+      EXPECT_LE(length, 4096ull);
+      for (size_t i = 0; i < length; ++i) {
+        EXPECT_EQ(chunk[i], (offset + i) % 251);
+      }
+      offset += length;
+      return true;
+    },
+    [&events, size](const ProgressEvent& event) {
+      EXPECT_EQ(event.total, size);
+      ++events;
+    }));
+  EXPECT_EQ(offset, size);
+  EXPECT_EQ(events, 3ull);
+
+  // Reading stops when the callback returns false
+  EXPECT_FALSE(Tools::StreamFile(
+    filename, 4096, [](const uint8_t*, size_t) { return false; }));
+
+  Filesystem::removeFile(filename);
+}
+
+TEST(TestMappedFile, ReadBinaryFile)
+{
+  using namespace BABYLON;
+
+  const size_t size   = 1000;
+  const auto filename = writeTestFile("tools", size);
+
+  MappedFilePtr data;
+  Tools::ReadBinaryFile(filename,
+                        [&data](const MappedFilePtr& file, const std::string&) {
+                          data = file;
+                        });
+  ASSERT_NE(data, nullptr);
+  EXPECT_EQ(data->size(), size);
+
+  // The string callback receives the same bytes
+  std::string contents;
+  Tools::ReadFile(
+    filename,
+    [&contents](const std::string& file, const std::string&) {
+      contents = file;
+    },
+    nullptr, true);
+  ASSERT_EQ(contents.size(), size);
+  EXPECT_EQ(static_cast<uint8_t>(contents[300]), 300 % 251);
+
+  Filesystem::removeFile(filename);
+}
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <babylon/core/lock_free_queue.h>
+
+TEST(TestLockFreeQueue, PushAndPop)
+{
+  using namespace BABYLON;
+  LockFreeQueue<int> testQueue;
+  EXPECT_TRUE(testQueue.empty());
+  testQueue.push(2);
+  testQueue.push(3);
+  EXPECT_FALSE(testQueue.empty());
+  int poppedItem;
+  bool result = testQueue.tryAndPop(poppedItem);
+  EXPECT_EQ(poppedItem, 2);
+  EXPECT_TRUE(result);
+  result = testQueue.tryAndPop(poppedItem);
+  EXPECT_EQ(poppedItem, 3);
+  EXPECT_TRUE(result);
+  EXPECT_TRUE(testQueue.empty());
+  result = testQueue.tryAndPop(poppedItem);
+  EXPECT_FALSE(result);
+}
+
+TEST(TestLockFreeQueue, ProducerAndConsumerThreads)
+{
+  using namespace BABYLON;
+  const int itemCount = 100000;
+  LockFreeQueue<int> testQueue;
+  std::thread producer([&testQueue]() {
+    for (int i = 0; i < itemCount; ++i) {
+      testQueue.push(i);
+    }
+  });
+  // The items are received in order
+  int expected = 0;
+  int poppedItem;
+  while (expected < itemCount) {
+    if (testQueue.tryAndPop(poppedItem)) {
+      ASSERT_EQ(poppedItem, expected);
+      ++expected;
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(testQueue.empty());
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Only the errors and the warnings are compiled in this test
+#define BABYLON_LOG_MAX_LEVEL 2
+#include <babylon/core/logging.h>
+
+namespace {
+
+std::vector<BABYLON::LogMessage> _logMessages;
+
+void onLogMessage(const BABYLON::LogMessage& logMessage)
+{
+  _logMessages.emplace_back(logMessage);
+}
+
+} // namespace
+
+TEST(TestLogger, LogMessages)
+{
+  using namespace BABYLON;
+  auto listener
+    = SA::delegate<void(const LogMessage&)>::create<&onLogMessage>();
+  auto& logger = Logger::Instance();
+  logger.registerLogMessageListener(LogLevels::LEVEL_ERROR, listener);
+  logger.registerLogMessageListener(LogLevels::LEVEL_INFO, listener);
+  EXPECT_TRUE(logger.isSubscribed(LogLevels::LEVEL_ERROR, listener));
+  EXPECT_FALSE(logger.isSubscribed(LogLevels::LEVEL_WARN, listener));
+
+  int evaluated = 0;
+  BABYLON_LOG_ERROR("TestLogger", "error", 1, 2.5f);
+  BABYLON_LOGF_ERROR("TestLogger", "errorf %d %s", 3, "x");
+  // Not listened
+  BABYLON_LOG_WARN("TestLogger", "warning");
+  // Removed at compile time, the arguments are not evaluated
+  BABYLON_LOG_INFO("TestLogger", "info", ++evaluated);
+  BABYLON_LOG_IF_INFO("TestLogger", true, "info %d", ++evaluated);
+  // Truncated to the size of the record
+  BABYLON_LOG_ERROR("TestLogger", std::string(1000, 'a'));
+  logger.flush();
+
+  logger.unregisterLogMessageListener(listener);
+  EXPECT_FALSE(logger.isSubscribed(LogLevels::LEVEL_ERROR, listener));
+
+  EXPECT_EQ(evaluated, 0);
+  ASSERT_EQ(_logMessages.size(), 3ull);
+  EXPECT_EQ(_logMessages[0].level(), LogLevels::LEVEL_ERROR);
+  EXPECT_EQ(_logMessages[0].context(), "TestLogger");
+  EXPECT_EQ(_logMessages[0].message(), "error 1 2.5");
+  EXPECT_EQ(_logMessages[0].function(), "TestBody");
+  EXPECT_EQ(_logMessages[1].message(), "errorf 3 x");
+  EXPECT_EQ(_logMessages[2].message(),
+            std::string(LogRecord::MessageSize - 1, 'a'));
+  _logMessages.clear();
+}
+
+TEST(TestLogger, ProducerThreads)
+{
+  using namespace BABYLON;
+  std::atomic<size_t> received{0};
+  // The delegate references the lambda
+  auto onLogMessage = [&received](const LogMessage&) { ++received; };
+  SA::delegate<void(const LogMessage&)> listener{onLogMessage};
+  auto& logger = Logger::Instance();
+  logger.registerLogMessageListener(LogLevels::LEVEL_ERROR, listener);
+
+  // Every record is either received or dropped
+  const size_t producerCount = 4;
+  const size_t messageCount  = 10000;
+  const auto droppedBefore   = logger.droppedCount();
+  for (auto policy : {LogOverflowPolicy::DROP, LogOverflowPolicy::OVERWRITE}) {
+    logger.setOverflowPolicy(policy);
+    received = 0;
+    std::vector<std::thread> producers;
+    const auto dropped = logger.droppedCount();
+    for (size_t p = 0; p < producerCount; ++p) {
+      producers.emplace_back([messageCount]() {
+        for (size_t i = 0; i < messageCount; ++i) {
+          BABYLON_LOG_ERROR("TestLogger", i);
+        }
+      });
+    }
+    for (auto& producer : producers) {
+      producer.join();
+    }
+    logger.flush();
+    EXPECT_EQ(received + logger.droppedCount() - dropped,
+              producerCount * messageCount);
+  }
+
+  logger.unregisterLogMessageListener(listener);
+  logger.setOverflowPolicy(LogOverflowPolicy::DROP);
+  EXPECT_GE(logger.droppedCount(), droppedBefore);
+}
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/random.h>
+
+TEST(TestRandomStream, Deterministic)
+{
+  using namespace BABYLON;
+
+  Math::RandomStream stream1(42);
+  Math::RandomStream stream2(42);
+  Math::RandomStream stream3(43);
+  bool differs = false;
+  for (size_t i = 0; i < 1000; ++i) {
+    const auto value = stream1.random();
+    EXPECT_EQ(value, stream2.random());
+    differs = differs || (value != stream3.random());
+    EXPECT_GE(value, 0.f);
+    EXPECT_LT(value, 1.f);
+  }
+  EXPECT_TRUE(differs);
+
+  // Seeding restarts the stream
+  stream1.seed(42);
+  stream2.seed(42);
+  EXPECT_EQ(stream1.nextUInt32(), stream2.nextUInt32());
+}
+
+TEST(TestRandomStream, RandomRange)
+{
+  using namespace BABYLON;
+
+  Math::RandomStream stream(7);
+  EXPECT_FLOAT_EQ(stream.randomRange(2.f, 2.f), 2.f);
+
+  float sum = 0.f;
+  for (size_t i = 0; i < 10000; ++i) {
+    const auto value = stream.randomRange(-1.f, 3.f);
+    EXPECT_GE(value, -1.f);
+    EXPECT_LT(value, 3.f);
+    sum += value;
+  }
+  // Uniformly distributed
+  EXPECT_NEAR(sum / 10000.f, 1.f, 0.05f);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include <babylon/core/thread_pool.h>
+
+TEST(TestThreadPool, ParallelFor)
+{
+  using namespace BABYLON;
+
+  for (size_t workerCount : {0, 1, 3}) {
+    ThreadPool pool(workerCount);
+    EXPECT_EQ(pool.workerCount(), workerCount);
+
+    // Every index is visited exactly once, several loops in a row
+    for (size_t loop = 0; loop < 20; ++loop) {
+      const size_t count = 1 + loop * 37;
+      std::vector<std::atomic<int>> visits(count);
+      for (auto& visit : visits) {
+        visit = 0;
+      }
+      pool.parallelFor(count, [&](size_t index) { ++visits[index]; });
+      for (auto& visit : visits) {
+        EXPECT_EQ(visit, 1);
+      }
+    }
+
+    // Nothing to do
+    pool.parallelFor(0, [](size_t /*index*/) { FAIL(); });
+  }
+}
+
+TEST(TestThreadPool, NestedParallelFor)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(3);
+  std::vector<std::atomic<int>> visits(64 * 64);
+  for (auto& visit : visits) {
+    visit = 0;
+  }
+  pool.parallelFor(0, 64, 5, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      pool.parallelFor(64, [&](size_t j) { ++visits[i * 64 + j]; });
+    }
+  });
+  for (auto& visit : visits) {
+    EXPECT_EQ(visit, 1);
+  }
+}
+
+TEST(TestThreadPool, TaskGraph)
+{
+  using namespace BABYLON;
+
+  for (size_t workerCount : {0, 1, 3}) {
+    ThreadPool pool(workerCount);
+
+    // a -> (b, c) -> d -> e
+    std::atomic<int> a{0}, b{0}, c{0}, d{0}, e{0};
+    auto taskA = pool.submit([&]() { a = 1; });
+    auto taskB = pool.submit([&]() { b = a + 1; }, {taskA});
+    auto taskC = pool.submit([&]() { c = a + 2; }, {taskA});
+    auto taskD = pool.submit([&]() { d = b + c; }, {taskB, taskC});
+    auto taskE = pool.then(taskD, [&]() { e = d * 10; });
+    pool.wait(taskE);
+    EXPECT_TRUE(taskD->isCompleted());
+    EXPECT_EQ(e, 50);
+
+    // Dependency already completed
+    auto taskF = pool.then(taskA, [&]() { ++a; });
+    pool.waitAll();
+    EXPECT_TRUE(taskF->isCompleted());
+    EXPECT_EQ(a, 2);
+
+    // Tasks submitted from tasks
+    std::atomic<int> count{0};
+    for (int i = 0; i < 10; ++i) {
+      pool.submit([&]() {
+        for (int j = 0; j < 10; ++j) {
+          pool.submit([&]() { ++count; });
+        }
+      });
+    }
+    pool.waitAll();
+    EXPECT_EQ(count, 100);
+  }
+}
+
+TEST(TestThreadPool, Deterministic)
+{
+  using namespace BABYLON;
+
+  // Without worker, the tasks run on the waiting thread in submission order
+  ThreadPool pool(0);
+  std::vector<int> order;
+  auto first = pool.submit([&]() { order.emplace_back(0); });
+  pool.then(first, [&]() { order.emplace_back(2); });
+  pool.submit([&]() { order.emplace_back(1); });
+  EXPECT_TRUE(order.empty());
+  pool.waitAll();
+  EXPECT_EQ(order, std::vector<int>({0, 1, 2}));
+}
@@ -0,0 +1,122 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/culling/dynamic_aabb_tree.h>
+#include <babylon/culling/ray.h>
+#include <babylon/mesh/abstract_mesh.h>
+
+namespace {
+
+using Tree = BABYLON::DynamicAABBTree<BABYLON::AbstractMesh*>;
+
+BABYLON::AbstractMesh* userData(size_t i)
+{
+  // The tree only stores the pointers, they are never dereferenced
+  return reinterpret_cast<BABYLON::AbstractMesh*>(i + 1);
+}
+
+BABYLON::Vector3 boxCenter(size_t i)
+{
+  const float f = static_cast<float>(i);
+  return BABYLON::Vector3(std::fmod(f * 7.3f, 40.f) - 20.f,
+                          std::fmod(f * 3.1f, 10.f) - 5.f,
+                          std::fmod(f * 5.7f, 40.f) - 20.f);
+}
+
+} // end of anonymous namespace
+
+TEST(TestDynamicAABBTree, CreateMoveDestroy)
+{
+  using namespace BABYLON;
+
+  Tree tree(0.5f);
+  EXPECT_EQ(tree.proxyCount(), 0ull);
+  EXPECT_EQ(tree.height(), 0);
+
+  std::vector<int> proxies;
+  for (size_t i = 0; i < 256; ++i) {
+    const auto center = boxCenter(i);
+    proxies.emplace_back(tree.createProxy(center.subtract(Vector3::One()),
+                                          center.add(Vector3::One()),
+                                          userData(i)));
+  }
+  EXPECT_EQ(tree.proxyCount(), 256ull);
+  // Balanced tree, far from the 255 levels of a degenerate one
+  EXPECT_LT(tree.height(), 24);
+  EXPECT_EQ(tree.getUserData(proxies[42]), userData(42));
+
+  // Small moves stay inside the fattened box
+  const auto center = boxCenter(42);
+  EXPECT_FALSE(tree.moveProxy(proxies[42],
+                              center.subtract(Vector3::One()).add(
+                                Vector3(0.25f, 0.f, 0.f)),
+                              center.add(Vector3::One())));
+  EXPECT_TRUE(tree.moveProxy(proxies[42], Vector3(100.f, 0.f, 0.f),
+                             Vector3(102.f, 2.f, 2.f)));
+  EXPECT_FLOAT_EQ(tree.getFatMinimum(proxies[42]).x, 99.5f);
+  EXPECT_FLOAT_EQ(tree.getFatMaximum(proxies[42]).x, 102.5f);
+
+  for (size_t i = 0; i < 128; ++i) {
+    tree.destroyProxy(proxies[i]);
+  }
+  EXPECT_EQ(tree.proxyCount(), 128ull);
+
+  tree.clear();
+  EXPECT_EQ(tree.proxyCount(), 0ull);
+  EXPECT_EQ(tree.height(), 0);
+}
+
+TEST(TestDynamicAABBTree, RaycastFrontToBack)
+{
+  using namespace BABYLON;
+
+  Tree tree(0.f);
+  for (size_t i = 0; i < 10; ++i) {
+    const Vector3 center(static_cast<float>(i) * 4.f, 0.f, 0.f);
+    tree.createProxy(center.subtract(Vector3::One()),
+                     center.add(Vector3::One()), userData(i));
+  }
+  // Off axis box, never hit
+  tree.createProxy(Vector3(0.f, 10.f, 0.f), Vector3(1.f, 11.f, 1.f),
+                   userData(10));
+
+  // All boxes on the axis are visited in order of distance
+  Ray ray(Vector3(-10.f, 0.f, 0.f), Vector3(1.f, 0.f, 0.f));
+  std::vector<AbstractMesh*> visited;
+  std::vector<float> distances;
+  tree.raycast(ray, [&](AbstractMesh* const& data, float distance) {
+    visited.emplace_back(data);
+    distances.emplace_back(distance);
+    return std::numeric_limits<float>::max();
+  });
+  ASSERT_EQ(visited.size(), 10ull);
+  for (size_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(visited[i], userData(i));
+    EXPECT_NEAR(distances[i], 9.f + static_cast<float>(i) * 4.f, 1e-4f);
+  }
+
+  // Returning a distance prunes the boxes entered beyond it
+  visited.clear();
+  tree.raycast(ray, [&](AbstractMesh* const& data, float distance) {
+    visited.emplace_back(data);
+    return distance + 5.f;
+  });
+  EXPECT_EQ(visited.size(), 2ull);
+
+  // Returning a negative value terminates the query
+  visited.clear();
+  tree.raycast(ray, [&](AbstractMesh* const& data, float /*distance*/) {
+    visited.emplace_back(data);
+    return -1.f;
+  });
+  EXPECT_EQ(visited.size(), 1ull);
+
+  // The ray length limits the query
+  visited.clear();
+  Ray shortRay(Vector3(-10.f, 0.f, 0.f), Vector3(1.f, 0.f, 0.f), 15.f);
+  tree.raycast(shortRay, [&](AbstractMesh* const& data, float /*distance*/) {
+    visited.emplace_back(data);
+    return std::numeric_limits<float>::max();
+  });
+  EXPECT_EQ(visited.size(), 2ull);
+}
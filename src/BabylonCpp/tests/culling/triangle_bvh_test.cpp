@@ -0,0 +1,97 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/culling/triangle_bvh.h>
+#include <babylon/mesh/vertex_data.h>
+#include <babylon/mesh/vertex_data_options.h>
+
+namespace {
+
+std::optional<BABYLON::IntersectionInfo>
+bruteForceIntersects(BABYLON::Ray& ray,
+                     const std::vector<BABYLON::Vector3>& positions,
+                     const BABYLON::IndicesArray& indices)
+{
+  std::optional<BABYLON::IntersectionInfo> intersectInfo = std::nullopt;
+  for (size_t index = 0; index < indices.size(); index += 3) {
+    auto currentIntersectInfo = ray.intersectsTriangle(
+      positions[indices[index]], positions[indices[index + 1]],
+      positions[indices[index + 2]]);
+    if (currentIntersectInfo && currentIntersectInfo->distance >= 0.f
+        && (!intersectInfo
+            || currentIntersectInfo->distance < intersectInfo->distance)) {
+      intersectInfo         = currentIntersectInfo;
+      intersectInfo->faceId = index / 3;
+    }
+  }
+  return intersectInfo;
+}
+
+} // end of anonymous namespace
+
+TEST(TestTriangleBVH, ClosestHitMatchesBruteForce)
+{
+  using namespace BABYLON;
+
+  SphereOptions options(2.f);
+  options.segments = 32;
+  auto sphere      = VertexData::CreateSphere(options);
+
+  std::vector<Vector3> positions;
+  for (size_t i = 0; i < sphere->positions.size(); i += 3) {
+    positions.emplace_back(Vector3::FromArray(sphere->positions, i));
+  }
+
+  TriangleBVH bvh(positions, sphere->indices, 0, sphere->indices.size());
+  EXPECT_EQ(bvh.triangleCount(), sphere->indices.size() / 3);
+  EXPECT_GT(bvh.nodeCount(), 1ull);
+
+  // Rays shot from outside the sphere towards points around its center
+  for (unsigned int i = 0; i < 64; ++i) {
+    const float angle = static_cast<float>(i) * 0.37f;
+    Vector3 origin(5.f * std::cos(angle), 0.5f * std::sin(3.f * angle),
+                   5.f * std::sin(angle));
+    Vector3 target(0.1f * std::sin(angle), 0.2f, 0.f);
+    Ray ray(origin, target.subtract(origin).normalize());
+
+    auto expected = bruteForceIntersects(ray, positions, sphere->indices);
+    auto actual   = bvh.intersects(ray, positions, false);
+
+    ASSERT_TRUE(expected.has_value());
+    ASSERT_TRUE(actual.has_value());
+    EXPECT_NEAR(actual->distance, expected->distance, 1e-5f);
+    EXPECT_EQ(actual->faceId, expected->faceId);
+  }
+}
+
+TEST(TestTriangleBVH, MissAndFastCheck)
+{
+  using namespace BABYLON;
+
+  SphereOptions options(2.f);
+  options.segments = 16;
+  auto sphere      = VertexData::CreateSphere(options);
+
+  std::vector<Vector3> positions;
+  for (size_t i = 0; i < sphere->positions.size(); i += 3) {
+    positions.emplace_back(Vector3::FromArray(sphere->positions, i));
+  }
+
+  TriangleBVH bvh(positions, sphere->indices, 0, sphere->indices.size());
+
+  // Ray pointing away from the sphere
+  Ray missingRay(Vector3(5.f, 0.f, 0.f), Vector3(1.f, 0.f, 0.f));
+  EXPECT_FALSE(bvh.intersects(missingRay, positions, false).has_value());
+
+  // Any hit is accepted by a fast check
+  Ray hittingRay(Vector3(5.f, 0.f, 0.f), Vector3(-1.f, 0.f, 0.f));
+  auto anyHit = bvh.intersects(hittingRay, positions, true);
+  ASSERT_TRUE(anyHit.has_value());
+  EXPECT_GE(anyHit->distance, 0.f);
+
+  // Hits beyond the ray length are ignored
+  Ray shortRay(Vector3(5.f, 0.f, 0.f), Vector3(-1.f, 0.f, 0.f), 1.f);
+  EXPECT_FALSE(bvh.intersects(shortRay, positions, false).has_value());
+}
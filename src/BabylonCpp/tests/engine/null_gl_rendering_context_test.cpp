@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <babylon/cameras/target_camera.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/null_canvas.h>
+#include <babylon/engine/null_gl_rendering_context.h>
+#include <babylon/engine/scene.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/mesh/mesh.h>
+
+TEST(TestNullGLRenderingContext, Objects)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::GL;
+
+  NullGLRenderingContext gl(320, 240);
+  EXPECT_TRUE(gl.initialize());
+  EXPECT_EQ(gl.drawingBufferWidth, 320);
+  EXPECT_EQ(gl.drawingBufferHeight, 240);
+
+  // Synthetic handles
+  auto buffer  = gl.createBuffer();
+  auto texture = gl.createTexture();
+  ASSERT_NE(buffer, nullptr);
+  ASSERT_NE(texture, nullptr);
+  EXPECT_NE(buffer->value, 0u);
+  EXPECT_NE(buffer->value, texture->value);
+
+  // Shaders always compile and link
+  auto program = gl.createProgram();
+  auto shader  = gl.createShader(GL::VERTEX_SHADER);
+  gl.shaderSource(shader, "void main() {}");
+  gl.compileShader(shader);
+  EXPECT_EQ(gl.getShaderParameter(shader, GL::COMPILE_STATUS), 1);
+  gl.attachShader(program, shader);
+  EXPECT_TRUE(gl.linkProgram(program));
+  ASSERT_EQ(gl.getAttachedShaders(program.get()).size(), 1ull);
+  EXPECT_EQ(gl.getShaderSource(shader.get()), "void main() {}");
+  EXPECT_EQ(gl.getAttribLocation(program.get(), "position"), 0);
+  EXPECT_EQ(gl.getAttribLocation(program.get(), "normal"), 1);
+  EXPECT_EQ(gl.getAttribLocation(program.get(), "position"), 0);
+  EXPECT_NE(gl.getUniformLocation(program.get(), "world"), nullptr);
+
+  // State queries
+  gl.enable(GL::SCISSOR_TEST);
+  EXPECT_TRUE(gl.isEnabled(GL::SCISSOR_TEST));
+  EXPECT_EQ(gl.getParameteri(GL::SCISSOR_TEST), 1);
+  gl.disable(GL::SCISSOR_TEST);
+  EXPECT_FALSE(gl.isEnabled(GL::SCISSOR_TEST));
+  gl.scissor(1, 2, 3, 4);
+  EXPECT_EQ(gl.getScissorBoxParameter(), (std::array<int, 4>{{1, 2, 3, 4}}));
+  gl.pixelStorei(GL::UNPACK_ALIGNMENT, 1);
+  EXPECT_EQ(gl.getParameteri(GL::UNPACK_ALIGNMENT), 1);
+  EXPECT_EQ(gl["TEXTURE3"], GL::TEXTURE0 + 3);
+  EXPECT_EQ(gl["COLOR_ATTACHMENT2"], GL::COLOR_ATTACHMENT0 + 2);
+}
+
+TEST(TestNullGLRenderingContext, Commands)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::GL;
+
+  NullGLRenderingContext gl;
+  auto buffer = gl.createBuffer();
+  gl.bindBuffer(GL::ARRAY_BUFFER, buffer.get());
+  gl.bufferData(GL::ARRAY_BUFFER, Float32Array(12), GL::STATIC_DRAW);
+  gl.drawArrays(GL::TRIANGLES, 0, 4);
+
+  const auto& commands = gl.commands();
+  ASSERT_EQ(commands.size(), 4ull);
+  EXPECT_EQ(commands[1].call, GLCall::BIND_BUFFER);
+  EXPECT_EQ(commands[1].arg0, static_cast<GLuint>(GL::ARRAY_BUFFER));
+  EXPECT_EQ(commands[1].arg1, buffer->value);
+  EXPECT_EQ(commands[2].call, GLCall::BUFFER_DATA);
+  EXPECT_EQ(commands[2].arg1, 48u);
+  EXPECT_EQ(commands[3].call, GLCall::DRAW_ARRAYS);
+  EXPECT_EQ(commands[3].arg1, 4u);
+  EXPECT_EQ(gl.totalCallCount(), 4ull);
+  EXPECT_EQ(gl.drawCallCount(), 1ull);
+  EXPECT_EQ(gl.countersToString(),
+            "bindBuffer 1\nbufferData 1\ncreateBuffer 1\ndrawArrays 1\n");
+
+  // Counting only
+  gl.reset();
+  gl.recordCommands = false;
+  gl.drawArrays(GL::TRIANGLES, 0, 4);
+  EXPECT_TRUE(gl.commands().empty());
+  EXPECT_EQ(gl.callCount(GLCall::DRAW_ARRAYS), 1ull);
+  EXPECT_STREQ(NullGLRenderingContext::CallName(GLCall::DRAW_ARRAYS),
+               "drawArrays");
+}
+
+TEST(TestNullGLRenderingContext, RenderScene)
+{
+  using namespace BABYLON;
+
+  NullCanvas canvas(640, 480);
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  auto camera
+    = TargetCamera::New("camera", Vector3(0.f, 5.f, -10.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+  HemisphericLight::New("light", Vector3(0.f, 1.f, 0.f), scene.get());
+  auto material = StandardMaterial::New("material", scene.get());
+  for (unsigned int i = 0; i < 3; ++i) {
+    auto box = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene.get());
+    box->position = Vector3(static_cast<float>(i) * 2.f - 2.f, 0.f, 0.f);
+    box->material = material;
+  }
+  EXPECT_EQ(engine->getRenderWidth(), 640);
+  EXPECT_EQ(engine->getRenderHeight(), 480);
+
+  // The first frame compiles the effect
+  auto gl = canvas.renderingContext();
+  scene->render();
+  EXPECT_EQ(gl->drawCallCount(), 3ull);
+  EXPECT_GT(gl->callCount(GL::GLCall::LINK_PROGRAM), 0ull);
+
+  // The next frames reuse the effect and the cached states
+  gl->reset();
+  scene->render();
+  EXPECT_EQ(gl->drawCallCount(), 3ull);
+  EXPECT_EQ(gl->callCount(GL::GLCall::LINK_PROGRAM), 0ull);
+  EXPECT_EQ(gl->callCount(GL::GLCall::USE_PROGRAM), 0ull);
+
+  // Identical frames issue identical calls
+  gl->reset();
+  scene->render();
+  const auto counters = gl->countersToString();
+  gl->reset();
+  scene->render();
+  EXPECT_EQ(gl->countersToString(), counters);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <babylon/cameras/target_camera.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/null_canvas.h>
+#include <babylon/engine/null_gl_rendering_context.h>
+#include <babylon/engine/scene.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/effect_includes_shaders_store.h>
+#include <babylon/materials/effect_shaders_store.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/materials/uniform_name.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/sub_mesh.h>
+
+TEST(TestEffect, ShadersStore)
+{
+  using namespace BABYLON;
+
+  // Every shader of the library is found with the perfect hash
+  EXPECT_EQ(EffectShadersStore::Names().size(), EffectShadersStore::Size);
+  for (const auto& name : EffectShadersStore::Names()) {
+    EXPECT_FALSE(EffectShadersStore::Find(name).empty()) << name;
+  }
+  for (const auto& name : EffectIncludesShadersStore::Names()) {
+    EXPECT_FALSE(EffectIncludesShadersStore::Find(name).empty()) << name;
+  }
+  EXPECT_TRUE(EffectShadersStore::Find("unknownVertexShader").empty());
+  EXPECT_TRUE(EffectIncludesShadersStore::Find("").empty());
+
+  // The shaders added at runtime take precedence
+  const auto defaultVertexShader = Effect::GetShader("defaultVertexShader");
+  EXPECT_EQ(defaultVertexShader,
+            EffectShadersStore::Find("defaultVertexShader"));
+  Effect::ShadersStore()["defaultVertexShader"] = "void main() {}";
+  EXPECT_EQ(Effect::GetShader("defaultVertexShader"), "void main() {}");
+  Effect::ShadersStore().erase("defaultVertexShader");
+  EXPECT_EQ(Effect::GetShader("defaultVertexShader"), defaultVertexShader);
+  EXPECT_TRUE(Effect::GetIncludeShader("unknownDeclaration").empty());
+}
+
+TEST(TestEffect, UniformName)
+{
+  using namespace BABYLON;
+
+  const UniformName world{"world"};
+  const UniformName view{std::string("view")};
+  EXPECT_EQ(world, UniformName("world"));
+  EXPECT_NE(world, view);
+  EXPECT_EQ(world.id(), UniformName(std::string("world")).id());
+  EXPECT_EQ(world.str(), "world");
+  EXPECT_EQ(view.str(), "view");
+
+  // The ids are dense
+  const auto count = UniformName::Count();
+  EXPECT_GT(count, std::max(world.id(), view.id()));
+  const UniformName newName{"TestEffect.UniformName"};
+  EXPECT_EQ(newName.id(), count);
+  EXPECT_EQ(UniformName::Count(), count + 1);
+}
+
+TEST(TestEffect, UniformCache)
+{
+  using namespace BABYLON;
+
+  NullCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  auto camera
+    = TargetCamera::New("camera", Vector3(0.f, 5.f, -10.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+  HemisphericLight::New("light", Vector3(0.f, 1.f, 0.f), scene.get());
+  auto box      = Mesh::CreateBox("box", 1.f, scene.get());
+  box->material = StandardMaterial::New("material", scene.get());
+  scene->render();
+
+  auto effect = box->subMeshes[0]->effect();
+  ASSERT_NE(effect, nullptr);
+  auto gl = canvas.renderingContext();
+
+  // Uniforms are resolved to slots when the effect is created
+  const auto slot = effect->getUniformIndex("pointSize");
+  EXPECT_GE(slot, 0);
+  EXPECT_EQ(effect->getUniform(slot), effect->getUniform("pointSize"));
+  EXPECT_NE(effect->getUniform(slot), nullptr);
+  EXPECT_EQ(effect->getUniformIndex("TestEffect.UniformCache"), -1);
+  EXPECT_EQ(effect->getUniform(-1), nullptr);
+
+  // Unchanged values are not sent again
+  gl->reset();
+  effect->setFloat("pointSize", 2.f);
+  effect->setFloat(slot, 2.f);
+  EXPECT_EQ(gl->callCount(GL::GLCall::UNIFORM1F), 1ull);
+  effect->setFloat(slot, 3.f);
+  EXPECT_EQ(gl->callCount(GL::GLCall::UNIFORM1F), 2ull);
+  effect->setFloat("TestEffect.UniformCache", 3.f);
+  EXPECT_EQ(gl->callCount(GL::GLCall::UNIFORM1F), 2ull);
+
+  // Array setters invalidate the cached value
+  effect->setFloatArray(slot, {3.f});
+  effect->setFloat(slot, 3.f);
+  EXPECT_EQ(gl->callCount(GL::GLCall::UNIFORM1F), 3ull);
+
+  // Vectors compare all their components
+  gl->reset();
+  effect->setFloat4("vFogInfos", 1.f, 2.f, 3.f, 4.f);
+  effect->setVector4("vFogInfos", Vector4(1.f, 2.f, 3.f, 4.f));
+  effect->setFloat4("vFogInfos", 1.f, 2.f, 3.f, 5.f);
+  EXPECT_EQ(gl->callCount(GL::GLCall::UNIFORM4F), 2ull);
+  effect->setFloat3("vFogInfos", 1.f, 2.f, 3.f);
+  EXPECT_EQ(gl->callCount(GL::GLCall::UNIFORM3F), 1ull);
+
+  // Matrices are cached with their update flag
+  gl->reset();
+  auto matrix = Matrix::Translation(1.f, 2.f, 3.f);
+  effect->setMatrix("world", matrix);
+  effect->setMatrix("world", matrix);
+  EXPECT_EQ(gl->callCount(GL::GLCall::UNIFORM_MATRIX4FV), 1ull);
+  matrix._markAsUpdated();
+  effect->setMatrix("world", matrix);
+  EXPECT_EQ(gl->callCount(GL::GLCall::UNIFORM_MATRIX4FV), 2ull);
+}
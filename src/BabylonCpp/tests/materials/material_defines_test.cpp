@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <babylon/materials/pbr/pbr_material_defines.h>
+#include <babylon/materials/standard_material_defines.h>
+
+TEST(TestMaterialDefines, Flags)
+{
+  using namespace BABYLON;
+
+  MaterialDefineFlags flags;
+  EXPECT_TRUE(flags.empty());
+  EXPECT_EQ(flags.hash(), 0ull);
+
+  // Reading a define registers it
+  EXPECT_FALSE(flags["A"]);
+  EXPECT_TRUE(flags.contains("A"));
+  EXPECT_FALSE(flags.contains("B"));
+  EXPECT_EQ(flags.size(), 1ull);
+  flags["B"] = true;
+  flags["C"] = flags["B"];
+  EXPECT_TRUE(flags["C"]);
+  EXPECT_EQ(flags.toString(), "#define B\n#define C\n");
+
+  // The hash only depends on the values
+  const auto hash = flags.hash();
+  flags["A"]      = true;
+  EXPECT_NE(flags.hash(), hash);
+  flags["A"] = false;
+  EXPECT_EQ(flags.hash(), hash);
+  EXPECT_EQ(flags.toString(), "#define B\n#define C\n");
+
+  // Copies share the names
+  auto other = flags;
+  EXPECT_EQ(other, flags);
+  other.set(flags.names()->find("B"), false);
+  EXPECT_NE(other, flags);
+  EXPECT_EQ(other.toString(), "#define C\n");
+
+  // Registered but not set defines
+  MaterialDefineFlags partial(flags.names());
+  partial["B"] = true;
+  partial["C"] = true;
+  EXPECT_NE(partial, flags);
+  partial["A"] = false;
+  EXPECT_EQ(partial, flags);
+  EXPECT_EQ(partial.hash(), flags.hash());
+
+  // Many defines
+  for (unsigned int i = 0; i < 200; ++i) {
+    flags["LIGHT" + std::to_string(i)] = (i % 3 == 0);
+  }
+  EXPECT_EQ(flags.size(), 203ull);
+  EXPECT_TRUE(flags["LIGHT198"]);
+  EXPECT_FALSE(flags["LIGHT199"]);
+  EXPECT_NE(partial, flags);
+}
+
+TEST(TestMaterialDefines, Values)
+{
+  using namespace BABYLON;
+
+  MaterialDefineValues<unsigned int> values;
+  values = {{"NUM_BONE_INFLUENCERS", 0}, {"BonesPerMesh", 0}};
+  EXPECT_EQ(values.size(), 2ull);
+  EXPECT_EQ(values.toString(),
+            "#define NUM_BONE_INFLUENCERS 0\n#define BonesPerMesh 0\n");
+
+  auto other = values;
+  values["NUM_BONE_INFLUENCERS"] = 4;
+  values["BonesPerMesh"]         = 32;
+  EXPECT_GT(values["NUM_BONE_INFLUENCERS"], 0u);
+  EXPECT_NE(values, other);
+  EXPECT_EQ(values.toString(),
+            "#define NUM_BONE_INFLUENCERS 4\n#define BonesPerMesh 32\n");
+
+  other["BonesPerMesh"]         = 32;
+  other["NUM_BONE_INFLUENCERS"] = 4;
+  EXPECT_EQ(values, other);
+  EXPECT_EQ(values.hash(), other.hash());
+
+  MaterialDefineValues<float> floats;
+  floats["ALPHATESTVALUE"] = 0.5f;
+  EXPECT_EQ(floats.toString(), "#define ALPHATESTVALUE 0.5\n");
+}
+
+TEST(TestMaterialDefines, MaterialDefines)
+{
+  using namespace BABYLON;
+
+  StandardMaterialDefines defines;
+  StandardMaterialDefines other;
+  EXPECT_TRUE(defines.isEqual(other));
+  EXPECT_EQ(defines.hash(), other.hash());
+  EXPECT_EQ(defines.toString(),
+            "#define DIFFUSEDIRECTUV 0\n"
+            "#define AMBIENTDIRECTUV 0\n"
+            "#define OPACITYDIRECTUV 0\n"
+            "#define EMISSIVEDIRECTUV 0\n"
+            "#define SPECULARDIRECTUV 0\n"
+            "#define BUMPDIRECTUV 0\n"
+            "#define NUM_BONE_INFLUENCERS 0\n"
+            "#define BonesPerMesh 0\n"
+            "#define LIGHTMAPDIRECTUV 0\n"
+            "#define NUM_MORPH_INFLUENCERS 0\n");
+
+  // The instances share the names registered by the class
+  EXPECT_EQ(defines.boolDef.names(), other.boolDef.names());
+  defines.boolDef["DIFFUSE"] = true;
+  EXPECT_TRUE(defines["DIFFUSE"]);
+  EXPECT_FALSE(other["DIFFUSE"]);
+  EXPECT_FALSE(defines["UNKNOWN"]);
+  EXPECT_FALSE(defines.isEqual(other));
+  EXPECT_NE(defines.hash(), other.hash());
+  EXPECT_EQ(defines.toString().find("#define DIFFUSE\n"), 0ull);
+
+  defines.cloneTo(other);
+  EXPECT_TRUE(defines.isEqual(other));
+  EXPECT_EQ(defines.toString(), other.toString());
+
+  // Dynamically added defines
+  defines.boolDef["LIGHT0"] = true;
+  EXPECT_TRUE(defines.boolDef.contains("LIGHT0"));
+  EXPECT_FALSE(other.boolDef.contains("LIGHT0"));
+  EXPECT_FALSE(defines.isEqual(other));
+
+  PBRMaterialDefines pbrDefines;
+  EXPECT_TRUE(pbrDefines["PBR"]);
+  EXPECT_TRUE(pbrDefines["NORMALXYSCALE"]);
+  EXPECT_NE(pbrDefines.toString().find("#define ALPHATESTVALUE 0.5\n"),
+            std::string::npos);
+}
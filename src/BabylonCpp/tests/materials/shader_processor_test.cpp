@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <babylon/materials/effect.h>
+#include <babylon/materials/shader_processor.h>
+
+TEST(TestShaderProcessor, ProcessIncludes)
+{
+  using namespace BABYLON;
+
+  auto& includes                   = Effect::IncludesShadersStore();
+  includes["testProcessorInclude"] = "color = vec4(light{X}.diffuse);";
+  includes["testProcessorVertexDeclaration"] = "uniform vec4 vertexColor;";
+  includes["testProcessorUboDeclaration"]    = "uniform Material {};";
+  ShaderProcessor::ClearCache();
+
+  ShaderProcessingOptions options;
+  options.indexParameters = {{"maxLights", 2}};
+
+  // Plain lines, missing includes are dropped
+  EXPECT_EQ(
+    ShaderProcessor::ProcessIncludes("a\n#include<missing>\nb", options),
+    "a\nb\n");
+
+  // Substitutions
+  EXPECT_EQ(ShaderProcessor::ProcessIncludes(
+              "  #include<testProcessorInclude>(color,result) // x", options),
+            "  result = vec4(light{X}.diffuse); // x\n");
+
+  // Index and range, the light uniforms are renamed without uniform buffers
+  EXPECT_EQ(
+    ShaderProcessor::ProcessIncludes("#include<testProcessorInclude>[3]",
+                                     options),
+    "color = vec4(diffuse3);\n");
+  EXPECT_EQ(ShaderProcessor::ProcessIncludes(
+              "#include<testProcessorInclude>[0..maxLights]", options),
+            "color = vec4(diffuse0);\ncolor = vec4(diffuse1);\n\n");
+  options.supportsUniformBuffers = true;
+  EXPECT_EQ(ShaderProcessor::ProcessIncludes(
+              "#include<testProcessorInclude>[1..2]", options),
+            "color = vec4(light1.diffuse);\n\n");
+
+  // Uniform declarations
+  EXPECT_EQ(ShaderProcessor::ProcessIncludes(
+              "#include<__decl__testProcessorVertex>", options),
+            "uniform Material {};\n");
+  options.supportsUniformBuffers = false;
+  EXPECT_EQ(ShaderProcessor::ProcessIncludes(
+              "#include<__decl__testProcessorVertex>", options),
+            "uniform vec4 vertexColor;\n");
+
+  includes.erase("testProcessorInclude");
+  includes.erase("testProcessorVertexDeclaration");
+  includes.erase("testProcessorUboDeclaration");
+  ShaderProcessor::ClearCache();
+}
+
+TEST(TestShaderProcessor, ProcessPrecision)
+{
+  using namespace BABYLON;
+
+  EXPECT_EQ(ShaderProcessor::ProcessPrecision("void main() {}", true),
+            "#ifdef GL_ES\nprecision highp float;\n#endif\n\nvoid main() {}");
+  EXPECT_EQ(
+    ShaderProcessor::ProcessPrecision("precision highp float;\n", false),
+    "#ifdef GL_ES\nprecision mediump float;\n#endif\n\n");
+}
+
+TEST(TestShaderProcessor, ConvertToGLSL300)
+{
+  using namespace BABYLON;
+
+  EXPECT_EQ(ShaderProcessor::ConvertToGLSL300(
+              "#extension GL_OES_standard_derivatives : enable\n"
+              "attribute vec3 position;\nvarying vec2 vUV;\n",
+              false),
+            "\nin vec3 position;\nout vec2 vUV;\n");
+  EXPECT_EQ(ShaderProcessor::ConvertToGLSL300(
+              "varying\tvec2 vUV;\nvoid main(void) {\n"
+              "  gl_FragColor = texture2D (s, vUV) + textureCube(c, n);\n}",
+              true),
+            "in vec2 vUV;\nout vec4 glFragColor;\nvoid main(void) {\n"
+            "  glFragColor = texture(s, vUV) + texture(c, n);\n}");
+  EXPECT_EQ(ShaderProcessor::ConvertToGLSL300(
+              "#version 300 es\nin vec3 position;", false),
+            "\nin vec3 position;");
+}
+
+TEST(TestShaderProcessor, Cache)
+{
+  using namespace BABYLON;
+
+  ShaderProcessor::ClearCache();
+  EXPECT_EQ(ShaderProcessor::CacheSize(), 0ull);
+
+  ShaderProcessingOptions options;
+  options.convertToGLSL300 = true;
+  const std::string sourceCode{"attribute float a;"};
+  const auto processed = ShaderProcessor::Process(sourceCode, options);
+  EXPECT_EQ(processed,
+            "#ifdef GL_ES\nprecision highp float;\n#endif\n\nin float a;\n");
+  EXPECT_EQ(ShaderProcessor::Process(sourceCode, options), processed);
+  EXPECT_EQ(ShaderProcessor::CacheSize(), 1ull);
+
+  // Other options are cached separately
+  options.convertToGLSL300 = false;
+  EXPECT_NE(ShaderProcessor::Process(sourceCode, options), processed);
+  EXPECT_EQ(ShaderProcessor::CacheSize(), 2ull);
+
+  ShaderProcessor::ClearCache();
+  EXPECT_EQ(ShaderProcessor::CacheSize(), 0ull);
+}
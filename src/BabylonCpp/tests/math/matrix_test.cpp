@@ -101,3 +101,21 @@ TEST(TestMatrix, Clone)
   a.m[0] = 2.f;
   EXPECT_FALSE(a.equals(b));
 }
+
+TEST(TestMatrix, MultiplyToArray)
+{
+  using namespace BABYLON;
+
+  Matrix a = Matrix::Translation(1.f, 2.f, 3.f);
+  Matrix b = Matrix::Scaling(2.f, 2.f, 2.f);
+  const Matrix c = a.multiply(b);
+
+  // The product is written at the given offset of the array
+  Float32Array array(48, -1.f);
+  a.multiplyToArray(b, array, 16);
+  for (unsigned int i = 0; i < 16; ++i) {
+    EXPECT_FLOAT_EQ(array[i], -1.f);
+    EXPECT_FLOAT_EQ(array[16 + i], c.m[i]);
+    EXPECT_FLOAT_EQ(array[32 + i], -1.f);
+  }
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+#include <babylon/mesh/mesh_optimizer.h>
+#include <babylon/mesh/vertex_buffer.h>
+#include <babylon/mesh/vertex_data.h>
+#include <babylon/mesh/vertex_data_options.h>
+
+namespace {
+
+/**
+ * Ground made of a grid of triangles, the triangles being shuffled like in a
+ * scanned mesh
+ */
+BABYLON::MeshOptimizer::MeshData CreateShuffledGround(unsigned int subdivisions)
+{
+  using namespace BABYLON;
+
+  GroundOptions options(subdivisions);
+  auto vertexData = VertexData::CreateGround(options);
+
+  MeshOptimizer::MeshData meshData;
+  meshData.vertexCount = vertexData->positions.size() / 3;
+  meshData.streams.emplace_back(MeshOptimizer::VertexStream{
+    VertexBuffer::PositionKind, vertexData->positions, 3});
+  meshData.streams.emplace_back(
+    MeshOptimizer::VertexStream{VertexBuffer::UVKind, vertexData->uvs, 2});
+
+  std::vector<std::array<uint32_t, 3>> triangles;
+  const auto& indices = vertexData->indices;
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    triangles.push_back({{indices[i], indices[i + 1], indices[i + 2]}});
+  }
+  std::mt19937 generator(42);
+  std::shuffle(triangles.begin(), triangles.end(), generator);
+  for (const auto& triangle : triangles) {
+    meshData.indices.insert(meshData.indices.end(), triangle.begin(),
+                            triangle.end());
+  }
+
+  meshData.subMeshes.emplace_back(MeshOptimizer::SubMeshRange{
+    0, meshData.vertexCount, 0, meshData.indices.size()});
+  return meshData;
+}
+
+/**
+ * Triangles of the mesh as sorted position triplets
+ */
+std::vector<std::array<float, 9>>
+GetTriangles(const BABYLON::MeshOptimizer::MeshData& meshData)
+{
+  const auto& positions = meshData.streams.front().data;
+  std::vector<std::array<float, 9>> triangles;
+  for (size_t i = 0; i + 2 < meshData.indices.size(); i += 3) {
+    std::array<std::array<float, 3>, 3> vertices;
+    for (size_t j = 0; j < 3; ++j) {
+      const auto index = meshData.indices[i + j];
+      vertices[j]      = {{positions[index * 3], positions[index * 3 + 1],
+                      positions[index * 3 + 2]}};
+    }
+    // Keeps the winding order, starting with the smallest vertex
+    std::rotate(vertices.begin(),
+                std::min_element(vertices.begin(), vertices.end()),
+                vertices.end());
+    std::array<float, 9> triangle;
+    for (size_t j = 0; j < 9; ++j) {
+      triangle[j] = vertices[j / 3][j % 3];
+    }
+    triangles.emplace_back(triangle);
+  }
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+} // namespace
+
+TEST(TestMeshOptimizer, ComputeACMR)
+{
+  using namespace BABYLON;
+
+  // Strip of triangles sharing an edge with the previous one
+  IndicesArray indices{0, 1, 2, 1, 3, 2, 2, 3, 4, 3, 5, 4};
+  EXPECT_FLOAT_EQ(MeshOptimizer::ComputeACMR(indices, 0, indices.size()),
+                  6.f / 4.f);
+  EXPECT_FLOAT_EQ(MeshOptimizer::ComputeACMR(indices, 3, 3), 3.f);
+
+  // Vertices evicted from a cache of 3 vertices
+  IndicesArray soup{0, 1, 2, 3, 4, 5, 0, 1, 2};
+  EXPECT_FLOAT_EQ(MeshOptimizer::ComputeACMR(soup, 0, soup.size(), 3), 3.f);
+  EXPECT_FLOAT_EQ(MeshOptimizer::ComputeACMR(soup, 0, soup.size(), 6), 2.f);
+}
+
+TEST(TestMeshOptimizer, Optimize)
+{
+  using namespace BABYLON;
+
+  auto meshData         = CreateShuffledGround(64);
+  const auto triangles  = GetTriangles(meshData);
+  const auto statistics = MeshOptimizer::Optimize(meshData, true);
+
+  EXPECT_GT(statistics.acmrBefore, 1.5f);
+  EXPECT_LT(statistics.acmrAfter, 0.8f);
+  EXPECT_FLOAT_EQ(statistics.acmrAfter,
+                  MeshOptimizer::ComputeACMR(meshData.indices, 0,
+                                             meshData.indices.size()));
+  EXPECT_EQ(GetTriangles(meshData), triangles);
+}
+
+TEST(TestMeshOptimizer, OptimizeVertexFetch)
+{
+  using namespace BABYLON;
+
+  auto meshData = CreateShuffledGround(8);
+  const auto triangles = GetTriangles(meshData);
+  ASSERT_TRUE(MeshOptimizer::OptimizeVertexFetch(meshData));
+
+  // The vertices are numbered in the order of their first use
+  uint32_t next = 0;
+  for (auto index : meshData.indices) {
+    EXPECT_LE(index, next);
+    if (index == next) {
+      ++next;
+    }
+  }
+  EXPECT_EQ(next, meshData.vertexCount);
+  EXPECT_EQ(GetTriangles(meshData), triangles);
+}
+
+TEST(TestMeshOptimizer, MergeDuplicatedVertices)
+{
+  using namespace BABYLON;
+
+  // Quad made of two triangles not sharing their vertices
+  MeshOptimizer::MeshData meshData;
+  meshData.vertexCount = 6;
+  meshData.streams.emplace_back(MeshOptimizer::VertexStream{
+    VertexBuffer::PositionKind,
+    {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0},
+    3});
+  meshData.indices = {0, 1, 2, 3, 4, 5};
+  meshData.subMeshes.emplace_back(MeshOptimizer::SubMeshRange{0, 6, 0, 6});
+
+  EXPECT_EQ(MeshOptimizer::MergeDuplicatedVertices(meshData), 2ull);
+  EXPECT_EQ(meshData.indices, IndicesArray({0, 1, 2, 0, 2, 5}));
+}
+
+TEST(TestMeshOptimizer, OverlappingSubMeshes)
+{
+  using namespace BABYLON;
+
+  auto meshData = CreateShuffledGround(4);
+  const auto indices = meshData.indices;
+  meshData.subMeshes.emplace_back(
+    MeshOptimizer::SubMeshRange{1, meshData.vertexCount - 1, 0, 0});
+
+  // The triangles are still reordered, the vertices are left in place
+  EXPECT_FALSE(MeshOptimizer::OptimizeVertexFetch(meshData));
+  EXPECT_EQ(MeshOptimizer::MergeDuplicatedVertices(meshData), 0ull);
+  EXPECT_EQ(meshData.indices, indices);
+}
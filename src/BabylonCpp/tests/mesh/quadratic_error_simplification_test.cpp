@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <babylon/mesh/simplification/isimplification_settings.h>
+#include <babylon/mesh/simplification/quadratic_error_simplification.h>
+#include <babylon/mesh/vertex_data.h>
+#include <babylon/mesh/vertex_data_options.h>
+
+namespace {
+
+BABYLON::QuadraticErrorSimplification::MeshData
+CreateSphereData(unsigned int segments, size_t subMeshCount = 1)
+{
+  using namespace BABYLON;
+
+  SphereOptions options(2.f);
+  options.segments = segments;
+  auto vertexData  = VertexData::CreateSphere(options);
+
+  QuadraticErrorSimplification::MeshData meshData;
+  meshData.positions = vertexData->positions;
+  meshData.normals   = vertexData->normals;
+  meshData.uvs       = vertexData->uvs;
+  meshData.indices   = vertexData->indices;
+
+  // Submeshes made of consecutive triangles, all using the whole vertex range
+  const auto vertexCount   = meshData.positions.size() / 3;
+  const auto triangleCount = meshData.indices.size() / 3;
+  for (size_t i = 0; i < subMeshCount; ++i) {
+    const auto start = i * triangleCount / subMeshCount;
+    const auto end   = (i + 1) * triangleCount / subMeshCount;
+    meshData.subMeshes.emplace_back(
+      QuadraticErrorSimplification::SubMeshData{
+        static_cast<unsigned int>(i), 0, vertexCount, start * 3,
+        (end - start) * 3});
+  }
+  return meshData;
+}
+
+void ExpectValid(const BABYLON::QuadraticErrorSimplification::MeshData& data)
+{
+  const auto vertexCount = data.positions.size() / 3;
+  EXPECT_EQ(data.normals.size(), vertexCount * 3);
+  EXPECT_EQ(data.uvs.size(), vertexCount * 2);
+  EXPECT_EQ(data.indices.size() % 3, 0ull);
+  for (const auto& subMesh : data.subMeshes) {
+    EXPECT_LE(subMesh.indexStart + subMesh.indexCount, data.indices.size());
+    EXPECT_LE(subMesh.verticesStart + subMesh.verticesCount, vertexCount);
+    for (size_t i = 0; i < subMesh.indexCount; ++i) {
+      const auto index = data.indices[subMesh.indexStart + i];
+      EXPECT_GE(index, subMesh.verticesStart);
+      EXPECT_LT(index, subMesh.verticesStart + subMesh.verticesCount);
+    }
+  }
+}
+
+} // namespace
+
+TEST(TestQuadraticErrorSimplification, decimate)
+{
+  using namespace BABYLON;
+
+  const auto meshData      = CreateSphereData(32);
+  const auto triangleCount = meshData.indices.size() / 3;
+
+  QuadraticErrorSimplification simplification(meshData);
+  ISimplificationSettings settings{0.5f, 10.f, true};
+  simplification.decimate(settings);
+
+  const auto& simplified = simplification.simplifiedData();
+  ASSERT_EQ(simplified.subMeshes.size(), 1ull);
+  ExpectValid(simplified);
+
+  const auto simplifiedCount = simplified.indices.size() / 3;
+  EXPECT_LE(simplifiedCount, triangleCount / 2 + 2);
+  EXPECT_GT(simplifiedCount, triangleCount / 4);
+  EXPECT_LT(simplified.positions.size(), meshData.positions.size());
+}
+
+TEST(TestQuadraticErrorSimplification, decimateSubMeshes)
+{
+  using namespace BABYLON;
+
+  const auto meshData      = CreateSphereData(24, 3);
+  const auto triangleCount = meshData.indices.size() / 3;
+
+  QuadraticErrorSimplification simplification(meshData);
+  ISimplificationSettings settings{0.6f, 10.f, true};
+  simplification.decimate(settings);
+
+  const auto& simplified = simplification.simplifiedData();
+  ASSERT_EQ(simplified.subMeshes.size(), 3ull);
+  ExpectValid(simplified);
+  for (size_t i = 0; i < simplified.subMeshes.size(); ++i) {
+    EXPECT_EQ(simplified.subMeshes[i].materialIndex, i);
+    EXPECT_GT(simplified.subMeshes[i].indexCount, 0ull);
+  }
+  EXPECT_LT(simplified.indices.size() / 3, triangleCount);
+}
+
+TEST(TestQuadraticErrorSimplification, fullQuality)
+{
+  using namespace BABYLON;
+
+  const auto meshData = CreateSphereData(16);
+
+  QuadraticErrorSimplification simplification(meshData);
+  ISimplificationSettings settings{1.f, 0.f, false};
+  simplification.decimate(settings);
+
+  const auto& simplified = simplification.simplifiedData();
+  ExpectValid(simplified);
+  EXPECT_EQ(simplified.indices.size(), meshData.indices.size());
+  EXPECT_EQ(simplified.positions.size(), meshData.positions.size());
+  EXPECT_EQ(simplification.createSimplifiedMesh(), nullptr);
+}
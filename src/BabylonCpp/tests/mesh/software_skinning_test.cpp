@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/math/matrix.h>
+#include <babylon/math/vector3.h>
+#include <babylon/mesh/software_skinning.h>
+
+namespace {
+
+struct SkinnedMesh {
+  size_t vertexCount;
+  BABYLON::Float32Array sourcePositions;
+  BABYLON::Float32Array sourceNormals;
+  BABYLON::Float32Array matricesIndices;
+  BABYLON::Float32Array matricesWeights;
+  BABYLON::Float32Array matricesIndicesExtra;
+  BABYLON::Float32Array matricesWeightsExtra;
+  BABYLON::Float32Array positions;
+  BABYLON::Float32Array normals;
+
+  SkinnedMesh(size_t count, size_t boneCount)
+      : vertexCount{count}
+      , sourcePositions(count * 3)
+      , sourceNormals(count * 3)
+      , matricesIndices(count * 4)
+      , matricesWeights(count * 4)
+      , matricesIndicesExtra(count * 4)
+      , matricesWeightsExtra(count * 4)
+      , positions(count * 3)
+      , normals(count * 3)
+  {
+    for (size_t i = 0; i < count; ++i) {
+      const auto f               = static_cast<float>(i);
+      sourcePositions[i * 3]     = f * 0.1f;
+      sourcePositions[i * 3 + 1] = 1.f - f * 0.05f;
+      sourcePositions[i * 3 + 2] = f * 0.01f;
+      sourceNormals[i * 3 + 1]   = 1.f;
+      for (size_t inf = 0; inf < 4; ++inf) {
+        matricesIndices[i * 4 + inf]
+          = static_cast<float>((i + inf) % boneCount);
+        matricesIndicesExtra[i * 4 + inf]
+          = static_cast<float>((i + inf + 4) % boneCount);
+      }
+      // Some vertices use a single bone, the others blend 8 bones
+      if (i % 3 == 0) {
+        matricesWeights[i * 4] = 1.f;
+      }
+      else {
+        for (size_t inf = 0; inf < 4; ++inf) {
+          matricesWeights[i * 4 + inf]      = 0.125f;
+          matricesWeightsExtra[i * 4 + inf] = 0.125f;
+        }
+      }
+    }
+  }
+
+  BABYLON::SoftwareSkinning::Vertices vertices(bool withExtras)
+  {
+    BABYLON::SoftwareSkinning::Vertices result;
+    result.sourcePositions = sourcePositions.data();
+    result.sourceNormals   = sourceNormals.data();
+    result.matricesIndices = matricesIndices.data();
+    result.matricesWeights = matricesWeights.data();
+    if (withExtras) {
+      result.matricesIndicesExtra = matricesIndicesExtra.data();
+      result.matricesWeightsExtra = matricesWeightsExtra.data();
+    }
+    result.positions   = positions.data();
+    result.normals     = normals.data();
+    result.vertexCount = vertexCount;
+    return result;
+  }
+};
+
+BABYLON::Float32Array BoneMatrices(size_t boneCount, float angle)
+{
+  using namespace BABYLON;
+  Float32Array result(boneCount * 16);
+  for (size_t bone = 0; bone < boneCount; ++bone) {
+    const auto f = static_cast<float>(bone);
+    auto matrix  = Matrix::RotationYawPitchRoll(angle * f, 0.1f * f, 0.f)
+                  .multiply(Matrix::Translation(f, 0.5f * f, -f));
+    matrix.copyToArray(result, static_cast<unsigned int>(bone * 16));
+  }
+  return result;
+}
+
+// Skinning of one vertex as previously done by Mesh::applySkeleton
+void ExpectSkinned(SkinnedMesh& mesh, const BABYLON::Float32Array& bones,
+                   size_t vertex, bool withExtras)
+{
+  using namespace BABYLON;
+  Matrix finalMatrix, tempMatrix;
+  finalMatrix.reset();
+  const auto addInfluences
+    = [&](const Float32Array& indices, const Float32Array& weights) {
+        for (size_t inf = 0; inf < 4; ++inf) {
+          const auto weight = weights[vertex * 4 + inf];
+          if (weight > 0.f) {
+            Matrix::FromFloat32ArrayToRefScaled(
+              bones,
+              static_cast<unsigned int>(indices[vertex * 4 + inf]) * 16,
+              weight, tempMatrix);
+            finalMatrix.addToSelf(tempMatrix);
+          }
+        }
+      };
+  addInfluences(mesh.matricesIndices, mesh.matricesWeights);
+  if (withExtras) {
+    addInfluences(mesh.matricesIndicesExtra, mesh.matricesWeightsExtra);
+  }
+
+  Vector3 expected;
+  const auto i = vertex * 3;
+  Vector3::TransformCoordinatesFromFloatsToRef(
+    mesh.sourcePositions[i], mesh.sourcePositions[i + 1],
+    mesh.sourcePositions[i + 2], finalMatrix, expected);
+  EXPECT_NEAR(mesh.positions[i], expected.x, 1e-4f);
+  EXPECT_NEAR(mesh.positions[i + 1], expected.y, 1e-4f);
+  EXPECT_NEAR(mesh.positions[i + 2], expected.z, 1e-4f);
+
+  Vector3::TransformNormalFromFloatsToRef(
+    mesh.sourceNormals[i], mesh.sourceNormals[i + 1], mesh.sourceNormals[i + 2],
+    finalMatrix, expected);
+  EXPECT_NEAR(mesh.normals[i], expected.x, 1e-4f);
+  EXPECT_NEAR(mesh.normals[i + 1], expected.y, 1e-4f);
+  EXPECT_NEAR(mesh.normals[i + 2], expected.z, 1e-4f);
+}
+
+} // namespace
+
+TEST(TestSoftwareSkinning, apply)
+{
+  using namespace BABYLON;
+
+  const size_t boneCount = 12;
+  SkinnedMesh mesh(100, boneCount);
+  const auto bones = BoneMatrices(boneCount, 0.3f);
+
+  for (const bool withExtras : {false, true}) {
+    SoftwareSkinning skinning;
+    EXPECT_TRUE(skinning.apply(bones, mesh.vertices(withExtras)));
+    for (size_t vertex = 0; vertex < mesh.vertexCount; ++vertex) {
+      ExpectSkinned(mesh, bones, vertex, withExtras);
+    }
+  }
+}
+
+TEST(TestSoftwareSkinning, SkipsUnchangedBones)
+{
+  using namespace BABYLON;
+
+  const size_t boneCount = 12;
+  SkinnedMesh mesh(100, boneCount);
+  auto bones = BoneMatrices(boneCount, 0.3f);
+
+  SoftwareSkinning skinning;
+  EXPECT_TRUE(skinning.apply(bones, mesh.vertices(true)));
+
+  // No bone moved
+  std::fill(mesh.positions.begin(), mesh.positions.end(), 0.f);
+  EXPECT_FALSE(skinning.apply(bones, mesh.vertices(true)));
+  EXPECT_FLOAT_EQ(mesh.positions[3], 0.f);
+
+  // Bone 0 moved, only the vertices it influences are skinned
+  bones[12] += 1.f;
+  EXPECT_TRUE(skinning.apply(bones, mesh.vertices(true)));
+  for (size_t vertex = 0; vertex < mesh.vertexCount; ++vertex) {
+    bool influenced = false;
+    for (size_t inf = 0; inf < 4; ++inf) {
+      influenced = influenced
+                   || (mesh.matricesWeights[vertex * 4 + inf] > 0.f
+                       && mesh.matricesIndices[vertex * 4 + inf] == 0.f)
+                   || (mesh.matricesWeightsExtra[vertex * 4 + inf] > 0.f
+                       && mesh.matricesIndicesExtra[vertex * 4 + inf] == 0.f);
+    }
+    if (influenced) {
+      ExpectSkinned(mesh, bones, vertex, true);
+    }
+    else {
+      EXPECT_FLOAT_EQ(mesh.positions[vertex * 3], 0.f);
+    }
+  }
+
+  // Invalidating skins all the vertices
+  skinning.invalidate();
+  EXPECT_TRUE(skinning.apply(bones, mesh.vertices(true)));
+  for (size_t vertex = 0; vertex < mesh.vertexCount; ++vertex) {
+    ExpectSkinned(mesh, bones, vertex, true);
+  }
+}
+
+TEST(TestSoftwareSkinning, ThreadPool)
+{
+  using namespace BABYLON;
+
+  const size_t boneCount   = 30;
+  const size_t vertexCount = SoftwareSkinning::VerticesPerTask * 3 + 17;
+  SkinnedMesh serialMesh(vertexCount, boneCount);
+  SkinnedMesh parallelMesh(vertexCount, boneCount);
+  const auto bones = BoneMatrices(boneCount, 0.7f);
+
+  SoftwareSkinning serialSkinning;
+  SoftwareSkinning parallelSkinning;
+  ThreadPool threadPool(3);
+  EXPECT_TRUE(serialSkinning.apply(bones, serialMesh.vertices(true)));
+  EXPECT_TRUE(
+    parallelSkinning.apply(bones, parallelMesh.vertices(true), &threadPool));
+  EXPECT_EQ(serialMesh.positions, parallelMesh.positions);
+  EXPECT_EQ(serialMesh.normals, parallelMesh.normals);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <babylon/mesh/buffer.h>
+#include <babylon/mesh/vertex_buffer.h>
+#include <babylon/mesh/vertex_data_view.h>
+
+namespace {
+
+BABYLON::Float32Array Decode(BABYLON::VertexBuffer& vertexBuffer, size_t count)
+{
+  BABYLON::Float32Array result(count);
+  vertexBuffer.forEach(
+    count, [&](float value, size_t index) { result[index] = value; });
+  return result;
+}
+
+} // namespace
+
+TEST(TestTypedVertexBuffer, HalfFloat)
+{
+  using namespace BABYLON;
+
+  const Float32Array uvs{0.f, 1.f, 0.5f, -2.25f, 65504.f, 1e-5f};
+  auto vertexBuffer
+    = VertexBuffer::CreateTyped(nullptr, uvs, VertexBuffer::UVKind,
+                                VertexBuffer::HALF_FLOAT, false, true,
+                                std::nullopt, true);
+
+  EXPECT_EQ(vertexBuffer->type, VertexBuffer::HALF_FLOAT);
+  EXPECT_EQ(vertexBuffer->byteStride, 4ull);
+  EXPECT_EQ(vertexBuffer->getRawData().size(), 12ull);
+  EXPECT_TRUE(vertexBuffer->getData().empty());
+  EXPECT_TRUE(vertexBuffer->getDataView(3).empty());
+
+  const auto decoded = Decode(*vertexBuffer, uvs.size());
+  for (size_t i = 0; i < 5; ++i) {
+    EXPECT_FLOAT_EQ(decoded[i], uvs[i]);
+  }
+  // Denormalized half
+  EXPECT_NEAR(decoded[5], uvs[5], 1e-7f);
+}
+
+TEST(TestTypedVertexBuffer, NormalizedBytes)
+{
+  using namespace BABYLON;
+
+  const Float32Array normals{0.f, -1.f, 0.5f, 0.267f, 0.534f, 0.802f};
+  auto vertexBuffer = VertexBuffer::CreateTyped(
+    nullptr, normals, VertexBuffer::NormalKind, VertexBuffer::BYTE, true,
+    false, std::nullopt, true);
+
+  // 3 bytes padded to 4
+  EXPECT_EQ(vertexBuffer->byteStride, 4ull);
+  EXPECT_EQ(vertexBuffer->getRawData().size(), 8ull);
+
+  const auto decoded = Decode(*vertexBuffer, normals.size());
+  for (size_t i = 0; i < normals.size(); ++i) {
+    EXPECT_NEAR(decoded[i], normals[i], 1.f / 127.f);
+  }
+}
+
+TEST(TestTypedVertexBuffer, InterleavedSkinning)
+{
+  using namespace BABYLON;
+
+  // Bone indices as unsigned bytes followed by normalized weights
+  const Float32Array indices{0.f, 3.f, 17.f, 255.f, 1.f, 2.f, 0.f, 0.f};
+  const Float32Array weights{0.5f, 0.25f, 0.25f, 0.f, 1.f, 0.f, 0.f, 0.f};
+
+  ArrayBuffer data;
+  data = VertexBuffer::Encode(indices, 4, VertexBuffer::UNSIGNED_BYTE, false,
+                              8);
+  const auto encodedWeights
+    = VertexBuffer::Encode(weights, 4, VertexBuffer::UNSIGNED_BYTE, true, 8);
+  for (size_t i = 0; i < data.size(); i += 8) {
+    std::copy_n(encodedWeights.begin() + i, 4, data.begin() + i + 4);
+  }
+
+  Buffer buffer(static_cast<Engine*>(nullptr), data, false, 8, true);
+  EXPECT_TRUE(buffer.isRaw());
+
+  auto matricesIndices = buffer.createVertexBuffer(
+    VertexBuffer::MatricesIndicesKind, 0, 4, std::nullopt, std::nullopt, true,
+    VertexBuffer::UNSIGNED_BYTE, false);
+  auto matricesWeights = buffer.createVertexBuffer(
+    VertexBuffer::MatricesWeightsKind, 4, 4, std::nullopt, std::nullopt, true,
+    VertexBuffer::UNSIGNED_BYTE, true);
+
+  EXPECT_EQ(matricesWeights->byteStride, 8ull);
+  EXPECT_EQ(matricesWeights->byteOffset, 4ull);
+  EXPECT_EQ(Decode(*matricesIndices, indices.size()), indices);
+
+  const auto decodedWeights = Decode(*matricesWeights, weights.size());
+  for (size_t i = 0; i < weights.size(); ++i) {
+    EXPECT_NEAR(decodedWeights[i], weights[i], 1.f / 255.f);
+  }
+}
@@ -1,10 +1,37 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/mesh/facet_parameters.h>
 #include <babylon/mesh/geometry.h>
 #include <babylon/mesh/vertex_data.h>
 #include <babylon/mesh/vertex_data_options.h>
 
+namespace {
+
+/**
+ * @brief Returns a wavy ground with enough facets to be processed in parallel.
+ */
+std::unique_ptr<BABYLON::VertexData> CreateWavyGround()
+{
+  using namespace BABYLON;
+  GroundOptions options(160);
+  options.width  = 10;
+  options.height = 10;
+  auto ground    = VertexData::CreateGround(options);
+  for (size_t i = 0; i < ground->positions.size(); i += 3) {
+    ground->positions[i + 1] = std::sin(ground->positions[i])
+                               * std::cos(ground->positions[i + 2]);
+  }
+  return ground;
+}
+
+} // namespace
+
 TEST(TestVertexData, CreateBox)
 {
   using namespace BABYLON;
@@ -287,3 +314,69 @@ TEST(TestVertexData, CreateTiledGround)
   EXPECT_THAT(tiledGround->normals, ::testing::ContainerEq(expectedNormals));
   EXPECT_THAT(tiledGround->uvs, ::testing::ContainerEq(expectedUVs));
 }
+
+TEST(TestVertexData, ComputeNormalsFacetData)
+{
+  using namespace BABYLON;
+  // Create test data, 2 facets of a square in the XZ plane
+  const Float32Array positions{0.f, 0.f, 0.f, 1.f, 0.f, 0.f, //
+                               1.f, 0.f, 1.f, 0.f, 0.f, 1.f};
+  const Uint32Array indices{0, 1, 2, 0, 2, 3};
+  Float32Array normals;
+  FacetParameters options;
+  options.facetNormals.resize(2);
+  options.facetPositions.resize(2);
+  options.depthSort  = true;
+  options.distanceTo = Vector3(0.f, 1.f, 0.f);
+  VertexData::ComputeNormals(positions, indices, normals, options);
+  // Perform comparison
+  const Float32Array expectedNormals{0.f, 1.f, 0.f, 0.f, 1.f, 0.f, //
+                                     0.f, 1.f, 0.f, 0.f, 1.f, 0.f};
+  EXPECT_THAT(normals, ::testing::ContainerEq(expectedNormals));
+  EXPECT_FLOAT_EQ(options.facetNormals[1].y, 1.f);
+  EXPECT_FLOAT_EQ(options.facetPositions[0].x, 2.f / 3.f);
+  EXPECT_FLOAT_EQ(options.facetPositions[0].z, 1.f / 3.f);
+  ASSERT_EQ(options.depthSortedFacets.size(), 2ull);
+  EXPECT_EQ(options.depthSortedFacets[1].ind, 3u);
+  EXPECT_FLOAT_EQ(options.depthSortedFacets[1].sqDistance, 1.f + 5.f / 9.f);
+}
+
+TEST(TestVertexData, ComputeNormalsParallel)
+{
+  using namespace BABYLON;
+  auto ground = CreateWavyGround();
+  ASSERT_GT(ground->indices.size() / 3, 2 * VertexData::FacetsPerTask);
+
+  ThreadPool threadPool(3);
+  Float32Array expectedNormals, normals;
+  VertexData::ComputeNormals(ground->positions, ground->indices,
+                             expectedNormals);
+  VertexData::ComputeNormals(ground->positions, ground->indices, normals,
+                             &threadPool);
+  ASSERT_EQ(normals.size(), expectedNormals.size());
+  for (size_t i = 0; i < normals.size(); ++i) {
+    EXPECT_NEAR(normals[i], expectedNormals[i], 1e-5f);
+  }
+
+  // The result does not depend on the scheduling of the tasks
+  Float32Array otherNormals;
+  VertexData::ComputeNormals(ground->positions, ground->indices, otherNormals,
+                             &threadPool);
+  EXPECT_THAT(otherNormals, ::testing::ContainerEq(normals));
+
+  // Facets not ordered spatially
+  auto indices = ground->indices;
+  std::vector<size_t> facets(indices.size() / 3);
+  for (size_t i = 0; i < facets.size(); ++i) {
+    facets[i] = i;
+  }
+  std::shuffle(facets.begin(), facets.end(), std::mt19937(42));
+  for (size_t i = 0; i < facets.size(); ++i) {
+    std::copy_n(ground->indices.begin() + facets[i] * 3, 3,
+                indices.begin() + i * 3);
+  }
+  VertexData::ComputeNormals(ground->positions, indices, normals, &threadPool);
+  for (size_t i = 0; i < normals.size(); ++i) {
+    EXPECT_NEAR(normals[i], expectedNormals[i], 1e-5f);
+  }
+}
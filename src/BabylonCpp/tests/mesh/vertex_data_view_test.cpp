@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <babylon/mesh/buffer.h>
+#include <babylon/mesh/vertex_buffer.h>
+#include <babylon/mesh/vertex_data_view.h>
+
+TEST(TestVertexDataView, Interleaved)
+{
+  using namespace BABYLON;
+
+  // Interleaved position and uv of 3 vertices
+  Float32Array data{0.f, 1.f, 2.f, 10.f, 11.f, //
+                    3.f, 4.f, 5.f, 12.f, 13.f, //
+                    6.f, 7.f, 8.f, 14.f, 15.f};
+  VertexDataView view(data.data() + 3, 3, 2, 5);
+
+  EXPECT_FALSE(view.empty());
+  EXPECT_FALSE(view.isTightlyPacked());
+  EXPECT_EQ(view.vertexCount(), 3ull);
+  EXPECT_EQ(view.size(), 2ull);
+  EXPECT_FLOAT_EQ(view[1][0], 12.f);
+  EXPECT_FLOAT_EQ(view[2][1], 15.f);
+  EXPECT_EQ(view.toArray(), Float32Array({10.f, 11.f, 12.f, 13.f, 14.f, 15.f}));
+
+  // Written in place
+  view[0][1] = -1.f;
+  EXPECT_FLOAT_EQ(data[4], -1.f);
+}
+
+TEST(TestVertexDataView, VertexBuffer)
+{
+  using namespace BABYLON;
+
+  Float32Array data{0.f, 1.f, 2.f, 10.f, 11.f, //
+                    3.f, 4.f, 5.f, 12.f, 13.f};
+  Buffer buffer(static_cast<Engine*>(nullptr), data, true, 5, true);
+  auto positions = buffer.createVertexBuffer(VertexBuffer::PositionKind, 0, 3);
+  auto uvs       = buffer.createVertexBuffer(VertexBuffer::UVKind, 3, 2);
+
+  const auto positionsView = positions->getDataView(2);
+  ASSERT_EQ(positionsView.vertexCount(), 2ull);
+  EXPECT_EQ(positionsView.stride(), 5ull);
+  EXPECT_EQ(positionsView.data(), buffer.getData().data());
+  EXPECT_EQ(positionsView.toArray(), Float32Array({0.f, 1.f, 2.f, 3.f, 4.f, 5.f}));
+
+  const auto uvsView = uvs->getDataView(2);
+  ASSERT_EQ(uvsView.vertexCount(), 2ull);
+  EXPECT_EQ(uvsView.toArray(), Float32Array({10.f, 11.f, 12.f, 13.f}));
+
+  // More vertices than stored
+  EXPECT_TRUE(uvs->getDataView(3).empty());
+}
@@ -0,0 +1,92 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/particles/soa_particle_pool.h>
+#include <babylon/tools/factor_gradient.h>
+
+TEST(TestSoAParticlePool, UpdateAppliesGravityAndRecycles)
+{
+  using namespace BABYLON;
+
+  SoAParticlePool pool;
+  pool.reserve(8);
+
+  // Odd count so that both the vectorized body and the tail are used
+  for (size_t i = 0; i < 7; ++i) {
+    const auto index         = pool.add();
+    pool.positionX[index]    = static_cast<float>(i);
+    pool.directionY[index]   = 1.f;
+    pool.colorA[index]       = 1.f;
+    pool.colorStepA[index]   = -0.5f;
+    pool.angularSpeed[index] = 2.f;
+    pool.lifeTime[index]     = (i == 3) ? 0.5f : 10.f;
+  }
+  EXPECT_EQ(pool.size(), 7ull);
+
+  SoAParticlePool::UpdateParameters parameters;
+  parameters.deltaTime = 1.f;
+  parameters.gravity   = Vector3(0.f, -1.f, 0.f);
+
+  // The particle 3 dies and is replaced by the last particle
+  EXPECT_EQ(pool.update(parameters), 1ull);
+  ASSERT_EQ(pool.size(), 6ull);
+  EXPECT_FLOAT_EQ(pool.positionX[3], 6.f);
+
+  for (size_t i = 0; i < pool.size(); ++i) {
+    // Moved along the direction of the previous step, then gravity applied
+    EXPECT_FLOAT_EQ(pool.positionY[i], 1.f);
+    EXPECT_FLOAT_EQ(pool.directionY[i], 0.f);
+    EXPECT_FLOAT_EQ(pool.colorA[i], 0.5f);
+    EXPECT_FLOAT_EQ(pool.angle[i], 2.f);
+    EXPECT_FLOAT_EQ(pool.age[i], 1.f);
+  }
+
+  pool.update(parameters);
+  for (size_t i = 0; i < pool.size(); ++i) {
+    EXPECT_FLOAT_EQ(pool.positionY[i], 1.f);
+    EXPECT_FLOAT_EQ(pool.directionY[i], -1.f);
+    // Alpha is clamped to zero
+    EXPECT_FLOAT_EQ(pool.colorA[i], 0.f);
+  }
+
+  pool.clear();
+  EXPECT_TRUE(pool.empty());
+}
+
+TEST(TestSoAParticlePool, GradientTables)
+{
+  using namespace BABYLON;
+
+  std::vector<FactorGradient> gradients(2);
+  gradients[0].gradient = 0.f;
+  gradients[0].factor1  = 1.f;
+  gradients[0].factor2  = 3.f;
+  gradients[1].gradient = 1.f;
+  gradients[1].factor1  = 2.f;
+
+  SoAParticlePool::GradientTable table;
+  SoAParticlePool::BuildGradientTable(gradients, table);
+  ASSERT_TRUE(table.enabled);
+
+  EXPECT_FLOAT_EQ(SoAParticlePool::SampleGradientTable(table, 0.f, 0.f), 1.f);
+  EXPECT_FLOAT_EQ(SoAParticlePool::SampleGradientTable(table, 0.f, 1.f), 3.f);
+  EXPECT_NEAR(SoAParticlePool::SampleGradientTable(table, 0.5f, 0.f), 1.5f,
+              1e-5f);
+  EXPECT_FLOAT_EQ(SoAParticlePool::SampleGradientTable(table, 1.f, 1.f), 2.f);
+  // Ratios are clamped
+  EXPECT_FLOAT_EQ(SoAParticlePool::SampleGradientTable(table, 2.f, 0.f), 2.f);
+
+  // A size gradient overrides the particle size over its life time
+  SoAParticlePool pool;
+  const auto index     = pool.add();
+  pool.lifeTime[index] = 4.f;
+
+  SoAParticlePool::UpdateParameters parameters;
+  parameters.deltaTime = 2.f;
+  SoAParticlePool::BuildGradientTable(gradients, parameters.sizeGradient);
+  pool.update(parameters);
+  EXPECT_NEAR(pool.particleSize[index], 1.5f, 1e-5f);
+
+  SoAParticlePool::BuildGradientTable({}, table);
+  EXPECT_FALSE(table.enabled);
+}
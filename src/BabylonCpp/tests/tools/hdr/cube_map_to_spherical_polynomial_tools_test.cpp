@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/engine/engine_constants.h>
+#include <babylon/math/spherical_polynomial.h>
+#include <babylon/tools/hdr/cube_map_to_spherical_polynomial_tools.h>
+
+namespace {
+
+BABYLON::CubeMapInfo createCubeMap(size_t size, float rightColor,
+                                   float otherColor)
+{
+  using namespace BABYLON;
+
+  const auto face = [size](float color) {
+    return ArrayBufferView(Float32Array(size * size * 3, color));
+  };
+
+  CubeMapInfo cubeInfo;
+  cubeInfo.size       = size;
+  cubeInfo.right      = face(rightColor);
+  cubeInfo.left       = face(otherColor);
+  cubeInfo.up         = face(otherColor);
+  cubeInfo.down       = face(otherColor);
+  cubeInfo.front      = face(otherColor);
+  cubeInfo.back       = face(otherColor);
+  cubeInfo.format     = EngineConstants::TEXTUREFORMAT_RGB;
+  cubeInfo.type       = EngineConstants::TEXTURETYPE_FLOAT;
+  cubeInfo.gammaSpace = false;
+  return cubeInfo;
+}
+
+} // end of anonymous namespace
+
+TEST(TestCubeMapToSphericalPolynomialTools, UniformCubeMap)
+{
+  using namespace BABYLON;
+
+  // The lambertian radiance of a uniform environment is the environment color
+  const auto polynomial
+    = CubeMapToSphericalPolynomialTools::ConvertCubeMapToSphericalPolynomial(
+      createCubeMap(17, 0.5f, 0.5f));
+  ASSERT_NE(polynomial, nullptr);
+  for (const auto& term : {polynomial->xx, polynomial->yy, polynomial->zz}) {
+    EXPECT_NEAR(term.x, 0.5f, 1e-3f);
+    EXPECT_NEAR(term.y, 0.5f, 1e-3f);
+    EXPECT_NEAR(term.z, 0.5f, 1e-3f);
+  }
+  for (const auto& term : {polynomial->x, polynomial->y, polynomial->z,
+                           polynomial->xy, polynomial->yz, polynomial->zx}) {
+    EXPECT_NEAR(term.x, 0.f, 1e-4f);
+    EXPECT_NEAR(term.y, 0.f, 1e-4f);
+    EXPECT_NEAR(term.z, 0.f, 1e-4f);
+  }
+}
+
+TEST(TestCubeMapToSphericalPolynomialTools, BytesAndThreadPool)
+{
+  using namespace BABYLON;
+
+  // The light comes from the right face, +X
+  auto cubeInfo = createCubeMap(16, 1.f, 0.f);
+  const auto polynomial
+    = CubeMapToSphericalPolynomialTools::ConvertCubeMapToSphericalPolynomial(
+      cubeInfo);
+  ASSERT_NE(polynomial, nullptr);
+  EXPECT_GT(polynomial->x.x, 0.f);
+  EXPECT_NEAR(polynomial->y.x, 0.f, 1e-4f);
+  EXPECT_NEAR(polynomial->z.x, 0.f, 1e-4f);
+
+  // The rows are summed in the same order whatever the number of threads
+  ThreadPool threadPool(3);
+  const auto parallelPolynomial
+    = CubeMapToSphericalPolynomialTools::ConvertCubeMapToSphericalPolynomial(
+      cubeInfo, &threadPool);
+  ASSERT_NE(parallelPolynomial, nullptr);
+  EXPECT_EQ(parallelPolynomial->x.x, polynomial->x.x);
+  EXPECT_EQ(parallelPolynomial->xx.x, polynomial->xx.x);
+
+  // 8 bits faces are read in place
+  for (auto* face : {&cubeInfo.right, &cubeInfo.left, &cubeInfo.up,
+                     &cubeInfo.down, &cubeInfo.front, &cubeInfo.back}) {
+    Uint8Array bytes(face->float32Array.size());
+    for (size_t i = 0; i < bytes.size(); ++i) {
+      bytes[i] = static_cast<uint8_t>(face->float32Array[i] * 255.f);
+    }
+    *face = ArrayBufferView(bytes);
+  }
+  cubeInfo.type = EngineConstants::TEXTURETYPE_UNSIGNED_INT;
+  const auto bytePolynomial
+    = CubeMapToSphericalPolynomialTools::ConvertCubeMapToSphericalPolynomial(
+      cubeInfo);
+  ASSERT_NE(bytePolynomial, nullptr);
+  EXPECT_NEAR(bytePolynomial->x.x, polynomial->x.x, 1e-5f);
+  EXPECT_NEAR(bytePolynomial->xx.x, polynomial->xx.x, 1e-5f);
+
+  // Missing faces are rejected
+  cubeInfo.back = ArrayBufferView();
+  EXPECT_EQ(
+    CubeMapToSphericalPolynomialTools::ConvertCubeMapToSphericalPolynomial(
+      cubeInfo),
+    nullptr);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/tools/hdr/pmrem_generator.h>
+
+namespace {
+
+std::vector<BABYLON::Float32Array> createCubeMap(size_t size, bool uniform)
+{
+  std::vector<BABYLON::Float32Array> faces(6);
+  for (size_t face = 0; face < 6; ++face) {
+    faces[face].resize(size * size * 3);
+    for (size_t i = 0; i < faces[face].size(); ++i) {
+      faces[face][i]
+        = uniform ? 0.5f : std::sin(static_cast<float>(face * 31 + i) * 0.1f);
+    }
+  }
+  return faces;
+}
+
+} // end of anonymous namespace
+
+TEST(TestPMREMGenerator, UniformCubeMap)
+{
+  using namespace BABYLON;
+
+  // The filter is a weighted average, a uniform cube map is left unchanged
+  PMREMGenerator<Float32Array> generator(createCubeMap(16, true), 16, 8, 0, 3,
+                                         true, 256.f, 0.25f, false, true);
+  const auto& mipmaps = generator.filterCubeMap();
+  ASSERT_EQ(mipmaps.size(), 4ull);
+  for (size_t level = 0; level < mipmaps.size(); ++level) {
+    const size_t size = 8 >> level;
+    ASSERT_EQ(mipmaps[level].size(), 6ull);
+    for (const auto& face : mipmaps[level]) {
+      ASSERT_EQ(face.size(), size * size * 3);
+      for (const auto value : face) {
+        EXPECT_NEAR(value, 0.5f, 1e-5f);
+      }
+    }
+  }
+}
+
+TEST(TestPMREMGenerator, ThreadPoolAndProgress)
+{
+  using namespace BABYLON;
+
+  const auto input = createCubeMap(16, false);
+  PMREMGenerator<Float32Array> serialGenerator(input, 16, 8, 0, 3, true, 64.f,
+                                               0.25f, false, true);
+  const auto expected = serialGenerator.filterCubeMap();
+
+  // The rows are filtered independently, the result does not depend on the
+  // number of threads
+  ThreadPool threadPool(3);
+  PMREMGenerator<Float32Array> generator(input, 16, 8, 0, 3, true, 64.f, 0.25f,
+                                         false, true);
+  std::vector<float> progresses;
+  const auto& mipmaps = generator.filterCubeMap(
+    &threadPool, [&progresses](float progress) {
+      progresses.emplace_back(progress);
+    });
+  EXPECT_EQ(mipmaps, expected);
+
+  // One call per row of the output faces: 6 * (8 + 4 + 2 + 1)
+  ASSERT_EQ(progresses.size(), 90ull);
+  for (size_t i = 1; i < progresses.size(); ++i) {
+    EXPECT_LT(progresses[i - 1], progresses[i]);
+  }
+  EXPECT_FLOAT_EQ(progresses.back(), 1.f);
+}
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* cellPixelShader;
-
-const char* cellPixelShader
+constexpr const char* cellPixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
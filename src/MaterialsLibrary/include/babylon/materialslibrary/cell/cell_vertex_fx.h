@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* cellVertexShader;
-
-const char* cellVertexShader
+constexpr const char* cellVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* firePixelShader;
-
-const char* firePixelShader
+constexpr const char* firePixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
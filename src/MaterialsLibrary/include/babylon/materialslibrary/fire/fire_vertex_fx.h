@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* fireVertexShader;
-
-const char* fireVertexShader
+constexpr const char* fireVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
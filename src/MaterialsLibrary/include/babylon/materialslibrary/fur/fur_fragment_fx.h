@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* furPixelShader;
-
-const char* furPixelShader
+constexpr const char* furPixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
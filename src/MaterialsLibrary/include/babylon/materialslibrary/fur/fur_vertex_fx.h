@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* furVertexShader;
-
-const char* furVertexShader
+constexpr const char* furVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
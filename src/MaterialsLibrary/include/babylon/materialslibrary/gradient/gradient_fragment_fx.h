@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* gradientPixelShader;
-
-const char* gradientPixelShader
+constexpr const char* gradientPixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
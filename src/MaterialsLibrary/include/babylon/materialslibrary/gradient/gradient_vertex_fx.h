@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* gradientVertexShader;
-
-const char* gradientVertexShader
+constexpr const char* gradientVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* gridPixelShader;
-
-const char* gridPixelShader
+constexpr const char* gridPixelShader
   = "#extension GL_OES_standard_derivatives : enable\n"
     "\n"
     "#define SQRT2 1.41421356\n"
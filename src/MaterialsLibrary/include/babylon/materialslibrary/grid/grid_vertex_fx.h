@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* gridVertexShader;
-
-const char* gridVertexShader
+constexpr const char* gridVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* lavaPixelShader;
-
-const char* lavaPixelShader
+constexpr const char* lavaPixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* lavaVertexShader;
-
-const char* lavaVertexShader
+constexpr const char* lavaVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
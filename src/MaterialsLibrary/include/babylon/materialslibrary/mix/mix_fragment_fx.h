@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* mixPixelShader;
-
-const char* mixPixelShader
+constexpr const char* mixPixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
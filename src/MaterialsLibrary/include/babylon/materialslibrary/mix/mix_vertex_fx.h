@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* mixVertexShader;
-
-const char* mixVertexShader
+constexpr const char* mixVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* normalPixelShader;
-
-const char* normalPixelShader
+constexpr const char* normalPixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
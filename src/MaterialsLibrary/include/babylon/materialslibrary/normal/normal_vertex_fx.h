@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* normalVertexShader;
-
-const char* normalVertexShader
+constexpr const char* normalVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
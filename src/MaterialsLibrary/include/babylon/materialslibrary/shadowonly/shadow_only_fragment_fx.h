@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* shadowOnlyPixelShader;
-
-const char* shadowOnlyPixelShader
+constexpr const char* shadowOnlyPixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* shadowOnlyVertexShader;
-
-const char* shadowOnlyVertexShader
+constexpr const char* shadowOnlyVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* simplePixelShader;
-
-const char* simplePixelShader
+constexpr const char* simplePixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
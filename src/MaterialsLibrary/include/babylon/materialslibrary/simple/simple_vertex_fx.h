@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* simpleVertexShader;
-
-const char* simpleVertexShader
+constexpr const char* simpleVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* skyPixelShader;
-
-const char* skyPixelShader
+constexpr const char* skyPixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* skyVertexShader;
-
-const char* skyVertexShader
+constexpr const char* skyVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* terrainPixelShader;
-
-const char* terrainPixelShader
+constexpr const char* terrainPixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* terrainVertexShader;
-
-const char* terrainVertexShader
+constexpr const char* terrainVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
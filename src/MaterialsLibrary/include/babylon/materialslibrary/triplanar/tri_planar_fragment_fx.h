@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* triPlanarPixelShader;
-
-const char* triPlanarPixelShader
+constexpr const char* triPlanarPixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
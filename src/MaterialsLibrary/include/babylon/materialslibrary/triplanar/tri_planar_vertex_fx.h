@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* triPlanarVertexShader;
-
-const char* triPlanarVertexShader
+constexpr const char* triPlanarVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* waterPixelShader;
-
-const char* waterPixelShader
+constexpr const char* waterPixelShader
   = "#ifdef LOGARITHMICDEPTH\n"
     "#extension GL_EXT_frag_depth : enable\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* waterVertexShader;
-
-const char* waterVertexShader
+constexpr const char* waterVertexShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
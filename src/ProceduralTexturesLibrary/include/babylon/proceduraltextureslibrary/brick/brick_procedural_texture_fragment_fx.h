@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* brickProceduralTexturePixelShader;
-
-const char* brickProceduralTexturePixelShader
+constexpr const char* brickProceduralTexturePixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
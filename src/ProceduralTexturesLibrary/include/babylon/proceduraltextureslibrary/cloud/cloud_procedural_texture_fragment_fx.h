@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* cloudProceduralTexturePixelShader;
-
-const char* cloudProceduralTexturePixelShader
+constexpr const char* cloudProceduralTexturePixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
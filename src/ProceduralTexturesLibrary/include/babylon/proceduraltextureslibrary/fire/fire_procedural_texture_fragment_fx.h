@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* fireProceduralTexturePixelShader;
-
-const char* fireProceduralTexturePixelShader
+constexpr const char* fireProceduralTexturePixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
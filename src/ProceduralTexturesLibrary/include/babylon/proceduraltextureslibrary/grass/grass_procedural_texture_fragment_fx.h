@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* grassProceduralTexturePixelShader;
-
-const char* grassProceduralTexturePixelShader
+constexpr const char* grassProceduralTexturePixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
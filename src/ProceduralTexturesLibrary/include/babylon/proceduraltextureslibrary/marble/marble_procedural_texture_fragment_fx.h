@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* marbleProceduralTexturePixelShader;
-
-const char* marbleProceduralTexturePixelShader
+constexpr const char* marbleProceduralTexturePixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
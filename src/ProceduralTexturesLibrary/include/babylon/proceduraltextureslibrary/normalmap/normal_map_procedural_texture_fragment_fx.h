@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* normalMapProceduralTexturePixelShader;
-
-const char* normalMapProceduralTexturePixelShader
+constexpr const char* normalMapProceduralTexturePixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* perlinNoiseProceduralTexturePixelShader;
-
-const char* perlinNoiseProceduralTexturePixelShader
+constexpr const char* perlinNoiseProceduralTexturePixelShader
   = "// Taken and improved from https://www.shadertoy.com/view/MdGSzt\n"
     "\n"
     "#ifdef GL_ES\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* roadProceduralTexturePixelShader;
-
-const char* roadProceduralTexturePixelShader
+constexpr const char* roadProceduralTexturePixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* starfieldProceduralTexturePixelShader;
-
-const char* starfieldProceduralTexturePixelShader
+constexpr const char* starfieldProceduralTexturePixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
@@ -3,9 +3,7 @@
 
 namespace BABYLON {
 
-extern const char* woodProceduralTexturePixelShader;
-
-const char* woodProceduralTexturePixelShader
+constexpr const char* woodProceduralTexturePixelShader
   = "#ifdef GL_ES\n"
     "precision highp float;\n"
     "#endif\n"
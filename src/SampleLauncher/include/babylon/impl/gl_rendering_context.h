@@ -51,9 +51,13 @@ public:
                   GLenum usage) override;
   void bufferData(GLenum target, const Uint32Array& data,
                   GLenum usage) override;
+  void bufferData(GLenum target, const ArrayBuffer& data,
+                  GLenum usage) override;
   void bufferSubData(GLenum target, GLintptr offset,
                      const Float32Array& data) override;
   void bufferSubData(GLenum target, GLintptr offset, Int32Array& data) override;
+  void bufferSubData(GLenum target, GLintptr offset,
+                     const ArrayBuffer& data) override;
   void bindVertexArray(GL::IGLVertexArrayObject* vao) override;
   GLenum checkFramebufferStatus(GLenum target) override;
   void clear(GLbitfield mask) override;
@@ -138,7 +142,7 @@ public:
   GLint getAttribLocation(IGLProgram* program,
                           const std::string& name) override;
   GLboolean hasExtension(const std::string& extension) override;
-  std::array<int, 3> getScissorBoxParameter() override; // GL::SCISSOR_BOX
+  std::array<int, 4> getScissorBoxParameter() override; // GL::SCISSOR_BOX
   GLint getParameteri(GLenum pname) override;
   GLfloat getParameterf(GLenum pname) override;
   GLboolean getQueryParameterb(const std::unique_ptr<IGLQuery>& query,
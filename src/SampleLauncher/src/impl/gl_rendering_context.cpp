@@ -343,6 +343,12 @@ void GLRenderingContext::bufferData(GLenum target, const Uint32Array& data,
                data.data(), usage);
 }
 
+void GLRenderingContext::bufferData(GLenum target, const ArrayBuffer& data,
+                                    GLenum usage)
+{
+  glBufferData(target, static_cast<GLint>(data.size()), data.data(), usage);
+}
+
 void GLRenderingContext::bufferSubData(GLenum target, GLintptr offset,
                                        const Float32Array& data)
 {
@@ -360,6 +366,12 @@ void GLRenderingContext::bufferSubData(GLenum target, GLintptr offset,
     data.data());
 }
 
+void GLRenderingContext::bufferSubData(GLenum target, GLintptr offset,
+                                       const ArrayBuffer& data)
+{
+  glBufferSubData(target, offset, static_cast<GLint>(data.size()), data.data());
+}
+
 void GLRenderingContext::bindVertexArray(GL::IGLVertexArrayObject* vao)
 {
   glBindVertexArray(vao ? vao->value : 0);
@@ -714,9 +726,11 @@ bool GLRenderingContext::hasExtension(const std::string& /*extension*/)
   return true;
 }
 
-std::array<int, 3> GLRenderingContext::getScissorBoxParameter()
+std::array<int, 4> GLRenderingContext::getScissorBoxParameter()
 {
-  return {{0, 0, 0}};
+  std::array<int, 4> box{{0, 0, 0, 0}};
+  glGetIntegerv(GL_SCISSOR_BOX, box.data());
+  return box;
 }
 
 GLint GLRenderingContext::getParameteri(GLenum pname)